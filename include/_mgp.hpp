@@ -342,6 +342,45 @@ inline size_t graph_approximate_edge_count(mgp_graph *g) {
   return MgInvoke<size_t>(mgp_graph_approximate_edge_count, g);
 }
 
+// graph projection
+
+inline mgp_graph_projection *graph_project(mgp_graph *graph, const char *const *labels, size_t labels_size,
+                                           const char *const *edge_types, size_t edge_types_size,
+                                           const char *weight_property, double default_weight, mgp_memory *memory) {
+  return MgInvoke<mgp_graph_projection *>(mgp_graph_project, graph, labels, labels_size, edge_types, edge_types_size,
+                                          weight_property, default_weight, memory);
+}
+
+inline void graph_projection_destroy(mgp_graph_projection *projection) { mgp_graph_projection_destroy(projection); }
+
+inline size_t graph_projection_vertex_count(mgp_graph_projection *projection) {
+  return MgInvoke<size_t>(mgp_graph_projection_vertex_count, projection);
+}
+
+inline size_t graph_projection_edge_count(mgp_graph_projection *projection) {
+  return MgInvoke<size_t>(mgp_graph_projection_edge_count, projection);
+}
+
+inline const uint64_t *graph_projection_offsets(mgp_graph_projection *projection) {
+  return MgInvoke<const uint64_t *>(mgp_graph_projection_offsets, projection);
+}
+
+inline const uint64_t *graph_projection_targets(mgp_graph_projection *projection) {
+  return MgInvoke<const uint64_t *>(mgp_graph_projection_targets, projection);
+}
+
+inline const double *graph_projection_weights(mgp_graph_projection *projection) {
+  return MgInvoke<const double *>(mgp_graph_projection_weights, projection);
+}
+
+inline mgp_vertex_id graph_projection_vertex_id(mgp_graph_projection *projection, size_t index) {
+  return MgInvoke<mgp_vertex_id>(mgp_graph_projection_vertex_id, projection, index);
+}
+
+inline size_t graph_projection_vertex_index(mgp_graph_projection *projection, mgp_vertex_id id) {
+  return MgInvoke<size_t>(mgp_graph_projection_vertex_index, projection, id);
+}
+
 // vector index
 
 inline mgp_map *graph_search_vector_index(mgp_graph *graph, const char *index_name, mgp_list *search_vector,
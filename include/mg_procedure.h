@@ -1089,6 +1089,71 @@ enum mgp_error mgp_graph_approximate_vertex_count(struct mgp_graph *graph, size_
 /// Gets the approximate number of edges in the graph.
 enum mgp_error mgp_graph_approximate_edge_count(struct mgp_graph *graph, size_t *result);
 
+/// @name Graph Projection
+/// A graph projection is a read-only compressed sparse row (CSR) view of the out edges between a subset of the
+/// vertices, meant for analytical algorithms that read the whole graph.
+///
+/// The projected vertices are numbered from 0 in the order of their IDs. The out edges of vertex `i` are the elements
+/// `offsets[i]` up to (but not including) `offsets[i + 1]` of the targets array, which holds the numbers of their
+/// destination vertices. Edges whose destination vertex isn't projected are left out.
+///@{
+
+/// Read-only CSR view of the graph.
+struct mgp_graph_projection;
+
+/// Project the vertices with any of the given labels and the edges of any of the given types between them.
+/// All vertices are projected if `labels_size` is 0 and all edges if `edge_types_size` is 0.
+/// If `weight_property` isn't NULL, each edge is weighted with its numeric `weight_property`, or `default_weight` if
+/// the property isn't a number. Otherwise, the projection isn't weighted.
+/// The projection is built on multiple threads and is reused by later calls with the same arguments from
+/// transactions that see the same committed graph, in which case it isn't built again.
+/// Resulting projection must be freed with mgp_graph_projection_destroy.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the projection.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if `graph` is a subgraph or the storage mode doesn't support projections.
+/// Return mgp_error::MGP_ERROR_AUTHORIZATION_ERROR if the user can't read all vertices and edges.
+enum mgp_error mgp_graph_project(struct mgp_graph *graph, const char *const *labels, size_t labels_size,
+                                 const char *const *edge_types, size_t edge_types_size, const char *weight_property,
+                                 double default_weight, struct mgp_memory *memory,
+                                 struct mgp_graph_projection **result);
+
+/// Free the memory used by a mgp_graph_projection.
+void mgp_graph_projection_destroy(struct mgp_graph_projection *projection);
+
+/// Get the number of vertices in the projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_vertex_count(struct mgp_graph_projection *projection, size_t *result);
+
+/// Get the number of edges in the projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_edge_count(struct mgp_graph_projection *projection, size_t *result);
+
+/// Get the array of vertex count + 1 offsets into the targets array.
+/// The array is owned by the projection and is valid until the projection is destroyed.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_offsets(struct mgp_graph_projection *projection, const uint64_t **result);
+
+/// Get the array of edge count destination vertex numbers.
+/// The array is owned by the projection and is valid until the projection is destroyed.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_targets(struct mgp_graph_projection *projection, const uint64_t **result);
+
+/// Get the array of edge count weights, in the same order as the targets. Result is NULL if the projection isn't
+/// weighted or has no edges.
+/// The array is owned by the projection and is valid until the projection is destroyed.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_weights(struct mgp_graph_projection *projection, const double **result);
+
+/// Get the ID of the projected vertex with the given number.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `index` isn't smaller than the number of vertices.
+enum mgp_error mgp_graph_projection_vertex_id(struct mgp_graph_projection *projection, size_t index,
+                                              struct mgp_vertex_id *result);
+
+/// Get the number of the projected vertex with the given ID.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if the vertex isn't in the projection.
+enum mgp_error mgp_graph_projection_vertex_index(struct mgp_graph_projection *projection, struct mgp_vertex_id id,
+                                                 size_t *result);
+///@}
+
 /// @name Temporal Types
 ///
 ///@{
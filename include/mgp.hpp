@@ -17,6 +17,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -106,6 +107,7 @@ class GraphRelationships;
 class Relationships;
 class Node;
 class Relationship;
+class GraphProjection;
 struct MapItem;
 class Duration;
 class Value;
@@ -255,6 +257,15 @@ class Graph {
   /// @brief Deletes a relationship from the graph.
   void DeleteRelationship(const Relationship &relationship);
 
+  /// @brief Returns the CSR projection of the nodes with any of the given labels (all nodes if empty) and the
+  /// relationships of any of the given types (all relationships if empty) between them.
+  /// @param weight_property numeric relationship property used as the weight, the projection isn't weighted if empty
+  /// @param default_weight weight of the relationships without a numeric `weight_property`
+  GraphProjection Project(const std::vector<std::string_view> &labels = {},
+                          const std::vector<std::string_view> &relationship_types = {},
+                          std::optional<std::string_view> weight_property = std::nullopt,
+                          double default_weight = 1.0) const;
+
   /// @brief Checks if process must abort
   /// @return AbortReason the reason to abort, if no need to abort then AbortReason::NO_ABORT is returned
   AbortReason MustAbort() const;
@@ -268,6 +279,35 @@ class Graph {
   mgp_graph *graph_;
 };
 
+/// @brief Read-only compressed sparse row (CSR) view of a graph; wrapper class for @ref mgp_graph_projection.
+/// The nodes are numbered from 0. The outgoing relationships of node `i` are `Targets()[Offsets()[i]]` up to (but not
+/// including) `Targets()[Offsets()[i + 1]]`, given as the numbers of their end nodes.
+class GraphProjection {
+ public:
+  explicit GraphProjection(mgp_graph_projection *projection);
+
+  /// @brief Returns the number of nodes.
+  size_t NodeCount() const;
+  /// @brief Returns the number of relationships.
+  size_t RelationshipCount() const;
+
+  /// @brief Returns the NodeCount() + 1 offsets into Targets().
+  std::span<const uint64_t> Offsets() const;
+  /// @brief Returns the end node numbers of the relationships.
+  std::span<const uint64_t> Targets() const;
+  /// @brief Returns the weights of the relationships, empty if the projection isn't weighted.
+  std::span<const double> Weights() const;
+
+  /// @brief Returns the ID of the node with the given number.
+  Id GetNodeId(size_t index) const;
+  /// @brief Returns the number of the node with the given ID.
+  /// @throws mg_exception::OutOfRangeException if the node isn't in the projection
+  size_t GetNodeIndex(Id node_id) const;
+
+ private:
+  std::shared_ptr<mgp_graph_projection> projection_;
+};
+
 /// @brief View of graph nodes; wrapper class for @ref mgp_vertices_iterator.
 class Nodes {
  public:
@@ -2063,6 +2103,63 @@ inline GraphNodes Graph::Nodes() const {
 
 inline GraphRelationships Graph::Relationships() const { return GraphRelationships(graph_); }
 
+inline GraphProjection Graph::Project(const std::vector<std::string_view> &labels,
+                                      const std::vector<std::string_view> &relationship_types,
+                                      std::optional<std::string_view> weight_property, double default_weight) const {
+  // The C API expects null-terminated names
+  const std::vector<std::string> label_names(labels.begin(), labels.end());
+  const std::vector<std::string> type_names(relationship_types.begin(), relationship_types.end());
+  std::vector<const char *> label_ptrs;
+  label_ptrs.reserve(label_names.size());
+  for (const auto &name : label_names) label_ptrs.push_back(name.c_str());
+  std::vector<const char *> type_ptrs;
+  type_ptrs.reserve(type_names.size());
+  for (const auto &name : type_names) type_ptrs.push_back(name.c_str());
+  const auto weight_name = weight_property ? std::optional<std::string>(*weight_property) : std::nullopt;
+
+  auto *projection = mgp::MemHandlerCallback(graph_project, graph_, label_ptrs.data(), label_ptrs.size(),
+                                             type_ptrs.data(), type_ptrs.size(),
+                                             weight_name ? weight_name->c_str() : nullptr, default_weight);
+  return GraphProjection(projection);
+}
+
+// GraphProjection:
+
+inline GraphProjection::GraphProjection(mgp_graph_projection *projection)
+    : projection_{projection, [](mgp_graph_projection *ptr) {
+                    if (ptr != nullptr) {
+                      mgp::graph_projection_destroy(ptr);
+                    }
+                  }} {}
+
+inline size_t GraphProjection::NodeCount() const { return mgp::graph_projection_vertex_count(projection_.get()); }
+
+inline size_t GraphProjection::RelationshipCount() const {
+  return mgp::graph_projection_edge_count(projection_.get());
+}
+
+inline std::span<const uint64_t> GraphProjection::Offsets() const {
+  return {mgp::graph_projection_offsets(projection_.get()), NodeCount() + 1};
+}
+
+inline std::span<const uint64_t> GraphProjection::Targets() const {
+  return {mgp::graph_projection_targets(projection_.get()), RelationshipCount()};
+}
+
+inline std::span<const double> GraphProjection::Weights() const {
+  const auto *weights = mgp::graph_projection_weights(projection_.get());
+  if (weights == nullptr) return {};
+  return {weights, RelationshipCount()};
+}
+
+inline Id GraphProjection::GetNodeId(size_t index) const {
+  return Id::FromInt(mgp::graph_projection_vertex_id(projection_.get(), index).as_int);
+}
+
+inline size_t GraphProjection::GetNodeIndex(Id node_id) const {
+  return mgp::graph_projection_vertex_index(projection_.get(), mgp_vertex_id{.as_int = node_id.AsInt()});
+}
+
 inline Node Graph::GetNodeById(const Id node_id) const {
   auto *mgp_node = mgp::MemHandlerCallback(graph_get_vertex_by_id, graph_, mgp_vertex_id{.as_int = node_id.AsInt()});
   if (mgp_node == nullptr) {
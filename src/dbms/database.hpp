@@ -14,6 +14,7 @@
 #include <memory>
 #include <optional>
 
+#include "query/plan/cardinality_feedback.hpp"
 #include "query/stream/streams.hpp"
 #include "query/time_to_live/time_to_live.hpp"
 #include "query/trigger.hpp"
@@ -162,6 +163,13 @@ class Database {
    */
   query::PlanCacheLRU *plan_cache() { return &plan_cache_; }
 
+  /**
+   * @brief Returns the cardinalities observed by executing the cached plans
+   *
+   * @return query::plan::CardinalityFeedback*
+   */
+  query::plan::CardinalityFeedback *cardinality_feedback() { return &cardinality_feedback_; }
+
   query::ttl::TTL &ttl() { return time_to_live_; }
 
   /**
@@ -186,7 +194,8 @@ class Database {
   query::ttl::TTL time_to_live_;                    //!< TTL associated with the storage
 
   // TODO: Move to a better place
-  query::PlanCacheLRU plan_cache_;  //!< Plan cache associated with the storage
+  query::plan::CardinalityFeedback cardinality_feedback_;  //!< Outlives the plans which update it
+  query::PlanCacheLRU plan_cache_;                         //!< Plan cache associated with the storage
 };
 
 }  // namespace memgraph::dbms
@@ -339,18 +339,19 @@ void InMemoryReplicationHandlers::PrepareCommitHandler(dbms::DbmsHandler *dbms_h
   // able to recover from durable data
   if (storage->wal_file_) {
     if (*maybe_epoch_id != repl_storage_state.epoch_.id()) {
-      storage->wal_file_->FinalizeWal();
-      storage->wal_file_.reset();
+      storage->CloseWalFile();
     }
   }
 
   // last_durable_timestamp could be set by snapshot; so we cannot guarantee exactly what's the previous timestamp
   if (req.previous_commit_timestamp > repl_storage_state.commit_ts_info_.load(std::memory_order_acquire).ldt_) {
     // Empty the stream
-    bool transaction_complete{false};
-    while (!transaction_complete) {
-      const auto [_, delta] = ReadDelta(&decoder, storage::durability::kVersion);
-      transaction_complete = IsWalDeltaDataTransactionEnd(delta, storage::durability::kVersion);
+    for (uint64_t txn = 0; txn < req.num_txns; ++txn) {
+      bool transaction_complete{false};
+      while (!transaction_complete) {
+        const auto [_, delta] = ReadDelta(&decoder, storage::durability::kVersion);
+        transaction_complete = IsWalDeltaDataTransactionEnd(delta, storage::durability::kVersion);
+      }
     }
 
     const storage::replication::PrepareCommitRes res{false};
@@ -358,15 +359,21 @@ void InMemoryReplicationHandlers::PrepareCommitHandler(dbms::DbmsHandler *dbms_h
     return;
   }
 
-  auto deltas_res =
-      ReadAndApplyDeltasSingleTxn(storage, &decoder, storage::durability::kVersion, res_builder,
-                                  /*commit_txn_immediately*/ req.commit_immediately, /*loading_wal*/ false);
-
-  storage::replication::PrepareCommitRes res{false};
-  if (deltas_res.has_value()) {
+  // Queued transactions of an ASYNC replica come in one request, they are committed one after the other. If one of
+  // them fails, MAIN recovers the replica from the last committed one.
+  storage::replication::PrepareCommitRes res{true};
+  uint32_t batch_counter{0};
+  for (uint64_t txn = 0; txn < req.num_txns; ++txn) {
+    auto deltas_res = ReadAndApplyDeltasSingleTxn(storage, &decoder, storage::durability::kVersion, res_builder,
+                                                  /*commit_txn_immediately*/ req.commit_immediately,
+                                                  /*loading_wal*/ false, batch_counter);
+    if (!deltas_res.has_value()) {
+      res.success = false;
+      break;
+    }
+    batch_counter = deltas_res->current_batch_counter;
     two_pc_cache_.commit_accessor_ = std::move(deltas_res->commit_acc);
     two_pc_cache_.durability_commit_timestamp_ = req.durability_commit_timestamp;
-    res.success = true;
   }
   rpc::SendFinalResponse(res, res_builder, fmt::format("db: {}", storage->name()));
 }
@@ -424,7 +431,7 @@ void InMemoryReplicationHandlers::FinalizeCommitHandler(dbms::DbmsHandler *dbms_
 
   two_pc_cache_.commit_accessor_.reset();
   if (mem_storage->wal_file_) {
-    mem_storage->FinalizeWalFile();
+    mem_storage->WaitForWalSync(mem_storage->FinalizeWalFile());
   }
 
   storage::replication::FinalizeCommitRes const res(true);
@@ -438,8 +445,7 @@ void InMemoryReplicationHandlers::AbortPrevTxnIfNeeded(storage::InMemoryStorage
   }
 
   if (storage->wal_file_) {
-    storage->wal_file_->FinalizeWal();
-    storage->wal_file_.reset();
+    storage->CloseWalFile();
   }
 }
 
@@ -831,8 +837,7 @@ InMemoryReplicationHandlers::LoadWalStatus InMemoryReplicationHandlers::LoadWal(
   // It is also the first recovery step, so the WAL chain needs to restart from 0, otherwise the instance won't be
   // able to recover from durable data
   if (storage->wal_file_) {
-    storage->wal_file_->FinalizeWal();
-    storage->wal_file_.reset();
+    storage->CloseWalFile();
     spdlog::trace("WAL file {} finalized successfully", *maybe_wal_path);
   }
 
@@ -67,6 +67,11 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24UL * 3600));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_gc_thread_count, memgraph::storage::Config().gc.thread_count,
+                        "The number of threads used by a storage garbage collector cycle to unlink deltas, clean up "
+                        "indices and remove deleted vertices and edges.",
+                        FLAG_IN_RANGE(1, 1024));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_python_gc_cycle_sec, 180,
                         "Storage python full garbage collection interval (in seconds).", FLAG_IN_RANGE(1, 24UL * 3600));
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
@@ -82,6 +87,12 @@ DEFINE_bool(storage_wal_enabled, false,
 DEFINE_VALIDATED_uint64(storage_snapshot_retention_count, 3, "The number of snapshots that should always be kept.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_snapshot_incremental_count, 0,
+                        "The number of incremental snapshots created between two full snapshots. An incremental "
+                        "snapshot contains only the vertices and edges changed since the previous snapshot. "
+                        "Set to 0 to always create full snapshots.",
+                        FLAG_IN_RANGE(0, 1000000));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_wal_file_size_kib, memgraph::storage::Config::Durability().wal_file_size_kibibytes,
                         "Minimum file size of each WAL file.",
                         FLAG_IN_RANGE(1, static_cast<unsigned long>(1000) * 1024));
@@ -92,12 +103,25 @@ DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         "WAL file. Set to 1 for fully synchronous operation.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_wal_group_commit, memgraph::storage::Config::Durability().wal_group_commit,
+            "Every commit waits until its WAL records are synced to disk. A single thread syncs the WAL once for all "
+            "transactions committed in the meantime. When enabled, storage_wal_file_flush_every_n_tx is ignored.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(storage_items_per_batch, memgraph::storage::Config::Durability().items_per_batch,
               "The number of edges and vertices stored in a batch in a snapshot file.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_durability_compression_enabled, false,
+            "Controls whether the vertices and edges in snapshots and the deltas in WAL files are compressed.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables, misc-unused-parameters)
+DEFINE_VALIDATED_string(storage_durability_compression_level, "mid",
+                        "Compression level of snapshot and WAL files. Allowed values: low, mid, high.",
+                        { return memgraph::flags::ValidStoragePropertyStoreCompressionLevel(value); });
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,misc-unused-parameters)
 DEFINE_VALIDATED_bool(
     storage_parallel_index_recovery, false,
@@ -128,6 +152,11 @@ DEFINE_uint64(storage_recovery_thread_count,
                        memgraph::storage::Config::Durability().recovery_thread_count),
               "The number of threads used to recover persisted data from disk.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_recovery_memory_mapped, false,
+            "Controls whether snapshot files are memory-mapped during recovery. The recovery threads then decode "
+            "the snapshot directly from the page cache instead of reading it through per-thread buffers.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_enable_schema_metadata, false,
             "Controls whether metadata should be collected about the resident labels and edge types.");
@@ -147,6 +176,48 @@ DEFINE_bool(storage_enable_edges_metadata, false,
 DEFINE_bool(storage_delta_on_identical_property_update, true,
             "Controls whether updating a property with the same value should create a delta object.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_string(storage_columnar_properties, "",
+                        "Comma-separated list of Label.property pairs whose numeric values are cached in dense "
+                        "columns. Aggregations over all vertices with the label read the columns instead of the "
+                        "vertices.",
+                        {
+                          if (value.empty()) return true;
+                          for (const auto &item : memgraph::utils::Split(value, ",")) {
+                            const auto parts = memgraph::utils::Split(item, ".", 1);
+                            if (parts.size() != 2 || parts[0].empty() || parts[1].empty()) {
+                              std::cout << "Expected --" << flagname << " to be a list of Label.property pairs."
+                                        << std::endl;
+                              return false;
+                            }
+                          }
+                          return true;
+                        });
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_index_population_thread_count,
+                        memgraph::storage::Config().index_population_thread_count,
+                        "The number of threads used to populate an index created at runtime. The vertices are split "
+                        "into ranges which are indexed in parallel.",
+                        FLAG_IN_RANGE(1, 1024));
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_graph_projection_thread_count,
+                        std::max(static_cast<uint64_t>(std::thread::hardware_concurrency()),
+                                 memgraph::storage::Config().graph_projection_thread_count),
+                        "The number of threads used to build the graph projections requested by query modules.",
+                        FLAG_IN_RANGE(1, 1024));
+
+auto memgraph::flags::ParseStorageColumnarProperties() -> std::vector<std::pair<std::string, std::string>> {
+  std::vector<std::pair<std::string, std::string>> columns;
+  if (FLAGS_storage_columnar_properties.empty()) return columns;
+  for (const auto &item : memgraph::utils::Split(FLAGS_storage_columnar_properties, ",")) {
+    auto parts = memgraph::utils::Split(item, ".", 1);
+    columns.emplace_back(std::move(parts[0]), std::move(parts[1]));
+  }
+  return columns;
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(schema_info_enabled, false, "Set to true to enable run-time schema info tracking.");
 
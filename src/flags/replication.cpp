@@ -18,4 +18,9 @@ DEFINE_uint64(replication_replica_check_frequency_sec, 1,
               "The time duration between two replica checks/pings. If < 1, replicas will NOT be checked at all. NOTE: "
               "The MAIN instance allocates a new thread for each REPLICA.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(replication_async_queue_size, 1000,
+              "Maximum number of committed transactions queued for shipping to an ASYNC replica. When the queue "
+              "overflows, the replica is recovered from the durability files. If 0, a transaction isn't replicated "
+              "to an ASYNC replica which is still busy with the previous one.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(replication_restore_state_on_startup, true, "Restore replication state on startup, e.g. recover replica");
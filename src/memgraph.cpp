@@ -357,20 +357,27 @@ int main(int argc, char **argv) {
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
-             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .thread_count = FLAGS_storage_gc_thread_count},
 
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_data_recovery_on_startup,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
+                     .snapshot_incremental_count = FLAGS_storage_snapshot_incremental_count,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
+                     .wal_group_commit = FLAGS_storage_wal_group_commit,
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
                      .restore_replication_state_on_startup = FLAGS_replication_restore_state_on_startup,
                      .items_per_batch = FLAGS_storage_items_per_batch,
                      .snapshot_thread_count = FLAGS_storage_snapshot_thread_count,
                      .recovery_thread_count = FLAGS_storage_recovery_thread_count,
+                     .recovery_memory_mapped = FLAGS_storage_recovery_memory_mapped,
                      .allow_parallel_snapshot_creation = FLAGS_storage_parallel_snapshot_creation,
-                     .allow_parallel_schema_creation = FLAGS_storage_parallel_schema_recovery},
+                     .allow_parallel_schema_creation = FLAGS_storage_parallel_schema_recovery,
+                     .compression_enabled = FLAGS_storage_durability_compression_enabled,
+                     .compression_level =
+                         memgraph::flags::ParseCompressionLevel(FLAGS_storage_durability_compression_level)},
       .transaction = {.isolation_level = memgraph::flags::ParseIsolationLevel()},
       .disk = {.main_storage_directory = FLAGS_data_directory + "/rocksdb_main_storage",
                .label_index_directory = FLAGS_data_directory + "/rocksdb_label_index",
@@ -413,6 +420,9 @@ int main(int argc, char **argv) {
   using enum memgraph::storage::Config::Durability::SnapshotWalMode;
 
   db_config.durability.snapshot_interval = memgraph::utils::SchedulerInterval(FLAGS_storage_snapshot_interval);
+  db_config.columnar_properties = memgraph::flags::ParseStorageColumnarProperties();
+  db_config.index_population_thread_count = FLAGS_storage_index_population_thread_count;
+  db_config.graph_projection_thread_count = FLAGS_storage_graph_projection_thread_count;
   if (db_config.salient.storage_mode == IN_MEMORY_TRANSACTIONAL) {
     if (!db_config.durability.snapshot_interval) {
       if (FLAGS_storage_wal_enabled) {
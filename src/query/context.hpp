@@ -26,8 +26,16 @@
 #include "query/frame_change.hpp"
 #include "query/hops_limit.hpp"
 
+namespace memgraph::utils {
+class ThreadPool;
+}  // namespace memgraph::utils
+
 namespace memgraph::query {
 
+namespace plan {
+class MorselSource;
+}  // namespace plan
+
 enum class TransactionStatus {
   IDLE,
   ACTIVE,
@@ -108,6 +116,11 @@ struct ExecutionContext {
   int64_t number_of_hops{0};
   HopsLimit hops_limit;
   std::optional<uint64_t> periodic_commit_frequency;
+  /// Pool used by `Gather` to run parts of the plan in parallel; nullptr
+  /// disables parallel execution.
+  utils::ThreadPool *worker_pool{nullptr};
+  /// Set while a scan is being executed in parallel; see `Gather`.
+  plan::MorselSource *morsel_source{nullptr};
 #ifdef MG_ENTERPRISE
   std::unique_ptr<FineGrainedAuthChecker> auth_checker{nullptr};
 #endif
@@ -10,6 +10,10 @@
 // licenses/APL.txt.
 
 #include "query/cypher_query_interpreter.hpp"
+
+#include <algorithm>
+#include <ranges>
+
 #include "frontend/ast/ast.hpp"
 #include "frontend/semantic/required_privileges.hpp"
 #include "frontend/semantic/rw_checker.hpp"
@@ -17,7 +21,10 @@
 #include "plan/read_write_type_checker.hpp"
 #include "query/frontend/ast/cypher_main_visitor.hpp"
 #include "query/frontend/opencypher/parser.hpp"
+#include "query/plan/cardinality_feedback.hpp"
+#include "query/plan/cost_estimator.hpp"
 #include "query/plan/planner.hpp"
+#include "query/plan/profile.hpp"
 #include "query/plan/rule_based_planner.hpp"
 #include "query/plan/used_index_checker.hpp"
 #include "query/plan/vertex_count_cache.hpp"
@@ -28,9 +35,211 @@ DEFINE_bool(query_cost_planner, true, "Use the cost-estimating query planner.");
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_int32(query_plan_cache_max_size, 1000, "Maximum number of query plans to cache.",
                        FLAG_IN_RANGE(0, std::numeric_limits<int32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_plan_cache_max_variants, 4,
+                        "Maximum number of cached plans of a query, one for each order of magnitude of the estimated "
+                        "number of vertices matched by its parameters.",
+                        FLAG_IN_RANGE(1, 64));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_plan_feedback_sample_rate, 0,
+                        "Profile every this many executions of a cached plan to compare the rows produced by its "
+                        "scans, expansions and filters with the estimates. The observed degrees of expansions and "
+                        "selectivities of filters are used by the cost estimator. Sampled executions are neither "
+                        "batched nor parallel. Default is 0, which disables sampling.",
+                        FLAG_IN_RANGE(0, 1000000));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_plan_replan_factor, 100,
+                        "A cached plan is planned again when it or any of its sampled operators produces this many "
+                        "times more or fewer rows than estimated.",
+                        FLAG_IN_RANGE(2, 1000000));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_batch_size, 0,
+                        "Number of rows read-only queries pull through the operators at once. Scans, expansions, "
+                        "filters, projections and aggregations then process whole batches of rows. Default is 0, "
+                        "which pulls a single row at a time.",
+                        FLAG_IN_RANGE(0, 65536));
 
 namespace memgraph::query {
-PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan) : plan_(std::move(plan)) {}
+
+namespace {
+
+// A plan is planned again when it produces `--query-plan-replan-factor` times
+// more or fewer rows than estimated and either of the numbers is at least this
+// large.
+constexpr double kReplanMinRows = 1000.0;
+
+bool RowsDiverge(double estimated, double produced) {
+  estimated = std::max(estimated, 1.0);
+  produced = std::max(produced, 1.0);
+  if (std::max(estimated, produced) < kReplanMinRows) return false;
+  auto const factor = static_cast<double>(FLAGS_query_plan_replan_factor);
+  return produced > estimated * factor || estimated > produced * factor;
+}
+
+// Operators whose produced rows are estimated by the cost estimator
+bool RowsEstimated(const plan::LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  return type == plan::Once::kType || type == plan::ScanAll::kType || type == plan::ScanAllByLabel::kType ||
+         type == plan::ScanAllByLabelProperties::kType || type == plan::Expand::kType || type == plan::Filter::kType ||
+         type == plan::EdgeUniquenessFilter::kType || type == plan::Produce::kType;
+}
+
+// Estimated rows of the operators which can be compared with the profiling
+// statistics. Those are on the chain of single inputs from the root, which
+// are pulled until exhausted, and only have inputs with estimated rows.
+std::vector<std::pair<const plan::LogicalOperator *, double>> ComparableOperatorRows(
+    const plan::LogicalOperator &root, const std::unordered_map<const plan::LogicalOperator *, double> &cardinalities) {
+  std::vector<const plan::LogicalOperator *> chain{&root};
+  while (chain.back()->HasSingleInput()) chain.push_back(chain.back()->input().get());
+  std::vector<std::pair<const plan::LogicalOperator *, double>> operator_rows;
+  if (std::ranges::any_of(chain, [](const auto *op) { return op->GetTypeInfo() == plan::Limit::kType; })) {
+    return operator_rows;
+  }
+  for (const auto *op : chain | std::views::reverse) {
+    if (!RowsEstimated(*op)) break;
+    if (auto it = cardinalities.find(op); it != cardinalities.end()) operator_rows.emplace_back(op, it->second);
+  }
+  return operator_rows;
+}
+
+// Collects the label property index scans of a plan whose estimated number of
+// vertices depends on the parameter values, and whether the cost estimator
+// estimates the number of rows the plan produces.
+class ParameterSensitivityCollector final : public plan::HierarchicalLogicalOperatorVisitor {
+ public:
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  ParameterSensitivityCollector(const Parameters &parameters, storage::NameIdMapper *name_id_mapper)
+      : parameters_(parameters), name_id_mapper_(name_id_mapper) {}
+
+  bool PreVisit(plan::ScanAllByLabelProperties &op) override {
+    auto const depends_on_values = std::ranges::any_of(op.expression_ranges_, [](const auto &range) {
+      return range.type_ == plan::ExpressionRange::Type::EQUAL || range.type_ == plan::ExpressionRange::Type::IN ||
+             range.type_ == plan::ExpressionRange::Type::RANGE;
+    });
+    auto const known_at_plan_time = std::ranges::all_of(op.expression_ranges_, [&](const auto &range) {
+      return range.ResolveAtPlantime(parameters_, name_id_mapper_).has_value();
+    });
+    if (depends_on_values && known_at_plan_time) sensitive_scans_.push_back(&op);
+    return true;
+  }
+
+  // The number of rows of these isn't estimated
+  bool PreVisit(plan::Aggregate &) override { return RowsNotEstimated(); }
+  bool PreVisit(plan::Skip &) override { return RowsNotEstimated(); }
+  bool PreVisit(plan::Limit &) override { return RowsNotEstimated(); }
+  bool PreVisit(plan::TopK &) override { return RowsNotEstimated(); }
+  bool PreVisit(plan::Distinct &) override { return RowsNotEstimated(); }
+  bool PreVisit(plan::EmptyResult &) override { return RowsNotEstimated(); }
+  bool PreVisit(plan::Unwind &) override { return RowsNotEstimated(); }
+  bool PreVisit(plan::CallProcedure &) override { return RowsNotEstimated(); }
+
+  bool Visit(plan::Once &) override { return true; }
+
+  auto sensitive_scans() && { return std::move(sensitive_scans_); }
+  bool rows_estimated() const { return rows_estimated_; }
+
+ private:
+  bool RowsNotEstimated() {
+    rows_estimated_ = false;
+    return true;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
+  const Parameters &parameters_;
+  storage::NameIdMapper *name_id_mapper_;
+  std::vector<const plan::ScanAllByLabelProperties *> sensitive_scans_;
+  bool rows_estimated_{true};
+};
+
+ParameterSensitivityCollector CollectParameterSensitivity(const plan::LogicalOperator &root,
+                                                          const Parameters &parameters, DbAccessor *db_accessor) {
+  ParameterSensitivityCollector collector(parameters, db_accessor->GetStorageAccessor()->GetNameIdMapper());
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  const_cast<plan::LogicalOperator &>(root).Accept(collector);
+  return collector;
+}
+
+// Puts the estimated number of vertices of each scan into a bucket by its
+// number of decimal digits.
+CachedPlans::SelectivityKey MakeSelectivityKey(const std::vector<const plan::ScanAllByLabelProperties *> &scans,
+                                               const Parameters &parameters, DbAccessor *db_accessor) {
+  // Used when the values of a scan can't be resolved, e.g. a parameter of a different type
+  constexpr uint8_t kUnknownBucket = std::numeric_limits<uint8_t>::max();
+  auto *name_id_mapper = db_accessor->GetStorageAccessor()->GetNameIdMapper();
+  CachedPlans::SelectivityKey key;
+  key.reserve(scans.size());
+  for (const auto *scan : scans) {
+    std::vector<storage::PropertyValueRange> ranges;
+    ranges.reserve(scan->expression_ranges_.size());
+    for (const auto &expression_range : scan->expression_ranges_) {
+      auto range = expression_range.ResolveAtPlantime(parameters, name_id_mapper);
+      if (!range) break;
+      ranges.push_back(std::move(*range));
+    }
+    if (ranges.size() != scan->expression_ranges_.size()) {
+      key.push_back(kUnknownBucket);
+      continue;
+    }
+    auto count = db_accessor->VerticesCount(scan->label_, scan->properties_, ranges);
+    uint8_t bucket = 0;
+    for (; count > 0; count /= 10) ++bucket;
+    key.push_back(bucket);
+  }
+  return key;
+}
+
+}  // namespace
+
+PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan, PlanEstimates estimates,
+                         plan::CardinalityFeedback *cardinality_feedback)
+    : plan_(std::move(plan)), estimates_(std::move(estimates)), cardinality_feedback_(cardinality_feedback) {}
+
+void PlanWrapper::RecordProducedRows(uint64_t rows) {
+  if (estimates_.rows && RowsDiverge(*estimates_.rows, static_cast<double>(rows))) {
+    stale_.store(true, std::memory_order_release);
+  }
+}
+
+bool PlanWrapper::ShouldSampleCardinalities() {
+  auto const sample_rate = FLAGS_query_plan_feedback_sample_rate;
+  if (sample_rate == 0 || estimates_.operator_rows.empty()) return false;
+  return (executions_.fetch_add(1, std::memory_order_relaxed) + 1) % sample_rate == 0;
+}
+
+void PlanWrapper::RecordCardinalities(const plan::ProfilingStats &stats) {
+  if (estimates_.operator_rows.empty()) return;
+  // Rows produced by the chain of single inputs from the root. The input is
+  // the only operator pulled by such an operator, unless it has branches.
+  std::vector<std::pair<const plan::LogicalOperator *, double>> produced;
+  const auto *op = &plan();
+  const auto *op_stats = &stats;
+  while (true) {
+    // The last pull of an exhausted operator doesn't produce a row
+    produced.emplace_back(op, static_cast<double>(std::max(op_stats->actual_hits - 1, int64_t{0})));
+    if (!op->HasSingleInput() || op_stats->children.size() != 1) break;
+    op = op->input().get();
+    op_stats = &op_stats->children.front();
+  }
+
+  for (const auto &[estimated_op, estimated_rows] : estimates_.operator_rows) {
+    auto it = std::ranges::find(produced, estimated_op, &std::pair<const plan::LogicalOperator *, double>::first);
+    if (it == produced.end()) continue;
+    auto const rows = it->second;
+    if (RowsDiverge(estimated_rows, rows)) stale_.store(true, std::memory_order_release);
+
+    if (!cardinality_feedback_ || std::next(it) == produced.end()) continue;
+    auto const input_rows = std::next(it)->second;
+    if (input_rows <= 0) continue;
+    if (const auto *expand = utils::Downcast<const plan::Expand>(estimated_op)) {
+      cardinality_feedback_->RecordExpandDegree(expand->common_, rows / input_rows);
+    } else if (const auto *filter = utils::Downcast<const plan::Filter>(estimated_op)) {
+      cardinality_feedback_->RecordFilterSelectivity(filter->all_filters_, rows / input_rows);
+    }
+  }
+}
 
 auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserParameters const &user_parameters)
     -> Parameters {
@@ -148,10 +357,12 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
 
 std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery *query, const Parameters &parameters,
                                              DbAccessor *db_accessor,
-                                             const std::vector<Identifier *> &predefined_identifiers) {
+                                             const std::vector<Identifier *> &predefined_identifiers,
+                                             const plan::CardinalityFeedback *cardinality_feedback) {
   auto vertex_counts = plan::VertexCountCache(db_accessor);
   auto symbol_table = MakeSymbolTable(query, predefined_identifiers);
   auto planning_context = plan::MakePlanningContext(&ast_storage, &symbol_table, query, &vertex_counts);
+  planning_context.cardinality_feedback = cardinality_feedback;
   auto [root, cost] = plan::MakeLogicalPlan(&planning_context, parameters, FLAGS_query_cost_planner);
   auto rw_type_checker = plan::ReadWriteTypeChecker();
   rw_type_checker.InferRWType(*root);
@@ -162,16 +373,33 @@ std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery
 std::shared_ptr<PlanWrapper> CypherQueryToPlan(frontend::StrippedQuery const &stripped_query, AstStorage ast_storage,
                                                CypherQuery *query, const Parameters &parameters,
                                                PlanCacheLRU *plan_cache, DbAccessor *db_accessor,
-                                               const std::vector<Identifier *> &predefined_identifiers) {
+                                               const std::vector<Identifier *> &predefined_identifiers,
+                                               plan::CardinalityFeedback *cardinality_feedback) {
+  auto const &cache_key = stripped_query.stripped_query();
+  std::shared_ptr<CachedPlans> cached_plans;
+  CachedPlans::SelectivityKey selectivity_key;
+  // Estimated cost of the stale plan which is planned again
+  std::optional<double> stale_cost;
   if (plan_cache) {
-    auto existing_plan =
-        plan_cache->WithLock([&](utils::LRUCache<frontend::HashedString, std::shared_ptr<query::PlanWrapper>> &cache) {
-          return cache.get(stripped_query.stripped_query());
-        });
-    if (existing_plan.has_value()) {
+    cached_plans = plan_cache->WithLock([&](PlanCache_t &cache) { return cache.get(cache_key).value_or(nullptr); });
+  }
+  if (cached_plans) {
+    selectivity_key = MakeSelectivityKey(cached_plans->sensitive_scans, parameters, db_accessor);
+    auto existing_plan = plan_cache->WithLock([&](PlanCache_t & /*cache*/) -> std::shared_ptr<PlanWrapper> {
+      auto &variants = cached_plans->variants;
+      auto it = std::ranges::find(variants, selectivity_key, &CachedPlans::Variant::first);
+      if (it == variants.end()) return nullptr;
+      if (it->second->IsStale()) {
+        stale_cost = it->second->cost();
+        variants.erase(it);
+        return nullptr;
+      }
+      std::rotate(variants.begin(), it, std::next(it));
+      return variants.front().second;
+    });
+    if (existing_plan) {
       // validate the index usage
-      auto &ptr = existing_plan.value();
-      auto &plan = ptr->plan();
+      auto &plan = existing_plan->plan();
 
       auto checker = plan::UsedIndexChecker{};
       // G_Lloyd: I am so SORRY, const_cast is BAD, but I'm not fixing Visitable and HierarchicalLogicalOperatorVisitor
@@ -180,20 +408,53 @@ std::shared_ptr<PlanWrapper> CypherQueryToPlan(frontend::StrippedQuery const &st
 
       auto const all_satisfied = db_accessor->CheckIndicesAreReady(checker.required_indices_);
       if (all_satisfied) {
-        return ptr;
-      } else {
-        plan_cache->WithLock([&](utils::LRUCache<frontend::HashedString, std::shared_ptr<query::PlanWrapper>> &cache) {
-          cache.invalidate(stripped_query.stripped_query());
-        });
+        return existing_plan;
       }
+      plan_cache->WithLock([&](PlanCache_t &cache) { cache.invalidate(cache_key); });
+      cached_plans = nullptr;
     }
   }
 
-  auto plan = std::make_shared<PlanWrapper>(
-      MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers));
+  auto logical_plan = MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers,
+                                      cardinality_feedback);
+  auto sensitivity = CollectParameterSensitivity(logical_plan->GetRoot(), parameters, db_accessor);
+  PlanEstimates estimates;
+  // The estimates didn't change if the cost didn't, so planning again would
+  // give the same plan until the statistics change
+  if (!stale_cost || !utils::ApproxEqualDecimal(*stale_cost, logical_plan->GetCost())) {
+    auto vertex_counts = plan::VertexCountCache(db_accessor);
+    plan::CostEstimator estimator(&vertex_counts, logical_plan->GetSymbolTable(), parameters, plan::IndexHints(),
+                                  cardinality_feedback);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    const_cast<plan::LogicalOperator &>(logical_plan->GetRoot()).Accept(estimator);
+    if (sensitivity.rows_estimated()) estimates.rows = estimator.cardinality();
+    estimates.operator_rows = ComparableOperatorRows(logical_plan->GetRoot(), estimator.operator_cardinalities());
+  }
+  auto plan = std::make_shared<PlanWrapper>(std::move(logical_plan), std::move(estimates), cardinality_feedback);
 
   if (plan_cache) {
-    plan_cache->WithLock([&](auto &cache) { cache.put(stripped_query.stripped_query(), plan); });
+    auto sensitive_scans = std::move(sensitivity).sensitive_scans();
+    // A new entry is keyed by the scans of its first plan
+    if (!cached_plans) selectivity_key = MakeSelectivityKey(sensitive_scans, parameters, db_accessor);
+    plan_cache->WithLock([&](PlanCache_t &cache) {
+      auto current = cache.get(cache_key).value_or(nullptr);
+      if (cached_plans && current == cached_plans) {
+        auto &variants = cached_plans->variants;
+        std::erase_if(variants, [&](const auto &variant) { return variant.first == selectivity_key; });
+        variants.emplace(variants.begin(), std::move(selectivity_key), plan);
+        if (variants.size() > FLAGS_query_plan_cache_max_variants) {
+          variants.erase(variants.begin() + static_cast<std::ptrdiff_t>(FLAGS_query_plan_cache_max_variants),
+                         variants.end());
+        }
+      } else if (!cached_plans && !current) {
+        auto entry = std::make_shared<CachedPlans>();
+        entry->reference_plan = plan;
+        entry->sensitive_scans = std::move(sensitive_scans);
+        entry->variants.emplace_back(std::move(selectivity_key), plan);
+        cache.put(cache_key, entry);
+      }
+      // Otherwise the entry was replaced in the meantime and was keyed by different scans
+    });
   }
 
   return plan;
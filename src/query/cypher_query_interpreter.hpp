@@ -11,6 +11,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <optional>
+#include <utility>
+#include <vector>
+
 #include "plan/read_write_type_checker.hpp"
 #include "query/config.hpp"
 #include "query/frontend/ast/query/auth_query.hpp"
@@ -27,12 +32,23 @@
 DECLARE_bool(query_cost_planner);
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_int32(query_plan_cache_max_size);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(query_plan_cache_max_variants);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(query_plan_feedback_sample_rate);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(query_plan_replan_factor);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(query_batch_size);
 
 namespace memgraph::query {
 
 namespace plan {
+class CardinalityFeedback;
 class LogicalOperator;
-}
+struct ProfilingStats;
+class ScanAllByLabelProperties;
+}  // namespace plan
 
 class SymbolTable;
 class Query;
@@ -62,18 +78,74 @@ using UserParameters = storage::ExternalPropertyValue::map_t;
 auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserParameters const &user_parameters)
     -> Parameters;
 
+/// Estimated numbers of rows, which are compared with the rows an execution of
+/// the plan produced.
+struct PlanEstimates {
+  // Rows produced by the plan, nullopt if the estimate isn't comparable with
+  // the produced rows
+  std::optional<double> rows;
+  // Rows produced by the operators whose number of pulls is known from the
+  // profiling statistics
+  std::vector<std::pair<const plan::LogicalOperator *, double>> operator_rows;
+};
+
 class PlanWrapper {
  public:
-  explicit PlanWrapper(std::unique_ptr<LogicalPlan> plan);
+  explicit PlanWrapper(std::unique_ptr<LogicalPlan> plan, PlanEstimates estimates = {},
+                       plan::CardinalityFeedback *cardinality_feedback = nullptr);
 
   auto plan() const -> plan::LogicalOperator const & { return plan_->GetRoot(); }
   double cost() const { return plan_->GetCost(); }
   const auto &symbol_table() const { return plan_->GetSymbolTable(); }
   const auto &ast_storage() const { return plan_->GetAstStorage(); }
   auto rw_type() const { return plan_->RWType(); }
+  const auto &estimates() const { return estimates_; }
+
+  /// Records the number of rows produced by an execution of the plan. The plan
+  /// becomes stale when the number diverges too much from the estimate.
+  void RecordProducedRows(uint64_t rows);
+
+  /// Whether this execution of the plan should be profiled to sample the rows
+  /// produced by its operators, true for every
+  /// `--query-plan-feedback-sample-rate`-th execution.
+  bool ShouldSampleCardinalities();
+
+  /// Compares the rows produced by the operators in the profiling statistics
+  /// of an execution with the estimates, and records the observed degrees of
+  /// expansions and selectivities of filters for the cost estimator. The plan
+  /// becomes stale when any of the numbers diverges too much from its estimate.
+  void RecordCardinalities(const plan::ProfilingStats &stats);
+
+  /// Stale plans are planned again instead of being reused from the cache.
+  bool IsStale() const { return stale_.load(std::memory_order_acquire); }
 
  private:
   std::unique_ptr<LogicalPlan> plan_;
+  PlanEstimates estimates_;
+  plan::CardinalityFeedback *cardinality_feedback_;
+  std::atomic<uint64_t> executions_{0};
+  std::atomic<bool> stale_{false};
+};
+
+/// Cached plans of a query.
+///
+/// The best plan of a query can depend on the values of its parameters, e.g.
+/// scanning a label property index is only cheap for selective values. The
+/// index scans whose estimated number of vertices depends on the parameters
+/// are taken from the first plan of the query. Each execution puts the
+/// estimated number of vertices of every such scan into a bucket by its order
+/// of magnitude, and reuses the plan made for the same buckets, or makes a new
+/// one. At most `--query-plan-cache-max-variants` plans are kept per query.
+struct CachedPlans {
+  using SelectivityKey = std::vector<uint8_t>;
+  using Variant = std::pair<SelectivityKey, std::shared_ptr<PlanWrapper>>;
+
+  // Owns the operators of `sensitive_scans`
+  std::shared_ptr<PlanWrapper> reference_plan;
+  std::vector<const plan::ScanAllByLabelProperties *> sensitive_scans;
+  // Most recently used first. Modified only while holding the lock of the
+  // plan cache.
+  std::vector<Variant> variants;
 };
 
 struct CachedQuery {
@@ -132,12 +204,13 @@ class SingleNodeLogicalPlan final : public LogicalPlan {
   plan::ReadWriteTypeChecker::RWType rw_type_;
 };
 
-using PlanCache_t = utils::LRUCache<frontend::HashedString, std::shared_ptr<query::PlanWrapper>>;
+using PlanCache_t = utils::LRUCache<frontend::HashedString, std::shared_ptr<query::CachedPlans>>;
 using PlanCacheLRU = utils::Synchronized<PlanCache_t, utils::RWSpinLock>;
 
 std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery *query, const Parameters &parameters,
                                              DbAccessor *db_accessor,
-                                             const std::vector<Identifier *> &predefined_identifiers);
+                                             const std::vector<Identifier *> &predefined_identifiers,
+                                             const plan::CardinalityFeedback *cardinality_feedback = nullptr);
 
 /**
  * Return the parsed *Cypher* query's AST cached logical plan, or create and
@@ -146,10 +219,13 @@ std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery
  * If an identifier is not defined in a scope, we check the predefined identifiers.
  * If an identifier is contained there, we inject it at that place and remove it,
  * because a predefined identifier can be used only in one scope.
+ * @param cardinality_feedback optional cardinalities observed by executing
+ * plans, which are used for planning and updated by the executions of the plan.
  */
 std::shared_ptr<PlanWrapper> CypherQueryToPlan(frontend::StrippedQuery const &stripped_query, AstStorage ast_storage,
                                                CypherQuery *query, const Parameters &parameters,
                                                PlanCacheLRU *plan_cache, DbAccessor *db_accessor,
-                                               const std::vector<Identifier *> &predefined_identifiers = {});
+                                               const std::vector<Identifier *> &predefined_identifiers = {},
+                                               plan::CardinalityFeedback *cardinality_feedback = nullptr);
 
 }  // namespace memgraph::query
@@ -304,6 +304,14 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, view));
   }
 
+  storage::VerticesChunkedIterable ChunkedVertices(storage::View view, size_t num_chunks) {
+    return accessor_->ChunkedVertices(view, num_chunks);
+  }
+
+  storage::VerticesChunkedIterable ChunkedVertices(storage::View view, storage::LabelId label, size_t num_chunks) {
+    return accessor_->ChunkedVertices(label, view, num_chunks);
+  }
+
   VerticesIterable Vertices(storage::View view, storage::LabelId label,
                             std::span<storage::PropertyPath const> properties,
                             std::span<storage::PropertyValueRange const> property_ranges) {
@@ -571,6 +579,16 @@ class DbAccessor final {
 
   int64_t VerticesCount() const { return accessor_->ApproximateVertexCount(); }
 
+  std::shared_ptr<storage::PropertyColumn const> GetPropertyColumn(storage::LabelId label,
+                                                                   storage::PropertyId property) {
+    return accessor_->GetPropertyColumn(label, property);
+  }
+
+  std::shared_ptr<storage::GraphProjection const> GetGraphProjection(storage::GraphProjectionFilter const &filter,
+                                                                     storage::View view) {
+    return accessor_->GetGraphProjection(filter, view);
+  }
+
   int64_t VerticesCount(storage::LabelId label) const { return accessor_->ApproximateVertexCount(label); }
 
   int64_t VerticesCount(storage::LabelId label, std::span<storage::PropertyPath const> properties) const {
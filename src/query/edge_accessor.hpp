@@ -12,6 +12,7 @@
 #pragma once
 
 #include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/edges_range.hpp"
 
 namespace memgraph::query {
 
@@ -83,6 +84,56 @@ class EdgeAccessor final {
   bool operator!=(const EdgeAccessor &e) const noexcept { return !(*this == e); }
 };
 
+/// Edges of a vertex whose accessors are created only while they are iterated,
+/// see `storage::EdgesRange`.
+class EdgesRange final {
+ public:
+  class Iterator final {
+   public:
+    using value_type = EdgeAccessor;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+    explicit Iterator(storage::EdgesRange::Iterator impl) : impl_(impl) {}
+
+    EdgeAccessor operator*() const { return EdgeAccessor(*impl_); }
+
+    Iterator &operator++() {
+      ++impl_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator old = *this;
+      ++impl_;
+      return old;
+    }
+
+    friend bool operator==(const Iterator &lhs, const Iterator &rhs) { return lhs.impl_ == rhs.impl_; }
+
+   private:
+    storage::EdgesRange::Iterator impl_;
+  };
+
+  explicit EdgesRange(storage::EdgesRange impl) : impl_(std::move(impl)) {}
+
+  /// The iterators point into the range, so they are invalidated when the range
+  /// is moved.
+  Iterator begin() const { return Iterator{impl_.begin()}; }
+  Iterator end() const { return Iterator{impl_.end()}; }
+
+  size_t size() const { return impl_.size(); }
+  bool empty() const { return impl_.empty(); }
+
+ private:
+  storage::EdgesRange impl_;
+};
+
+struct EdgeVertexAccessorRange {
+  EdgesRange edges;
+  int64_t expanded_count;
+};
+
 }  // namespace memgraph::query
 
 namespace std {
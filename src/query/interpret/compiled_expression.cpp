@@ -0,0 +1,609 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/interpret/compiled_expression.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "query/exceptions.hpp"
+#include "query/frontend/ast/ast.hpp"
+#include "query/interpret/eval.hpp"
+#include "query/interpret/frame.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/cast.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_compiled_expressions, false,
+            "Compile the expressions of Filter and Produce operators once per cached plan instead of walking the "
+            "AST for every row. Comparisons of properties with literals and parameters then don't allocate.");
+
+namespace memgraph::query {
+
+/// Result of evaluating a node in a boolean context. `kInvalid` means that the
+/// value is neither a bool nor null; the caller then evaluates the node again
+/// through `Evaluate` to report the same error as the ExpressionEvaluator.
+enum class CompiledExpressions::Truth : uint8_t { kFalse, kTrue, kNull, kInvalid };
+
+/// The value of a comparison operand read without creating a TypedValue.
+/// Properties are held by value because storage returns a copy anyway.
+struct CompiledExpressions::Operand {
+  const TypedValue *value{nullptr};
+  storage::PropertyValue property;
+
+  TypedValue ToTypedValue(ExpressionEvaluator &evaluator) const {
+    if (value) return TypedValue(*value, evaluator.GetMemoryResource());
+    return TypedValue(property, evaluator.GetNameIdMapper(), evaluator.GetMemoryResource());
+  }
+
+  bool IsNull() const { return value ? value->IsNull() : property.IsNull(); }
+};
+
+namespace {
+
+using Truth = CompiledExpressions::Truth;
+using Constants = CompiledExpressions::Constants;
+using Operand = CompiledExpressions::Operand;
+
+Truth ToTruth(const TypedValue &value) {
+  if (value.IsNull()) return Truth::kNull;
+  if (value.IsBool()) return value.ValueBool() ? Truth::kTrue : Truth::kFalse;
+  return Truth::kInvalid;
+}
+
+TypedValue FromTruth(Truth truth, utils::MemoryResource *memory) {
+  switch (truth) {
+    case Truth::kFalse:
+      return TypedValue(false, memory);
+    case Truth::kTrue:
+      return TypedValue(true, memory);
+    case Truth::kNull:
+    case Truth::kInvalid:
+      return TypedValue(memory);
+  }
+}
+
+Truth Not(Truth truth) {
+  switch (truth) {
+    case Truth::kFalse:
+      return Truth::kTrue;
+    case Truth::kTrue:
+      return Truth::kFalse;
+    case Truth::kNull:
+    case Truth::kInvalid:
+      return truth;
+  }
+}
+
+Truth Or(Truth lhs, Truth rhs) {
+  if (lhs == Truth::kTrue || rhs == Truth::kTrue) return Truth::kTrue;
+  if (lhs == Truth::kNull || rhs == Truth::kNull) return Truth::kNull;
+  return Truth::kFalse;
+}
+
+/// A null, bool, numeric or string value; anything else is `kOther`.
+struct Scalar {
+  enum class Kind : uint8_t { kNull, kBool, kInt, kDouble, kString, kOther };
+
+  Kind kind{Kind::kOther};
+  bool bool_v{false};
+  int64_t int_v{0};
+  double double_v{0.0};
+  std::string_view string_v;
+
+  bool IsNumeric() const { return kind == Kind::kInt || kind == Kind::kDouble; }
+  double ToDouble() const { return kind == Kind::kInt ? static_cast<double>(int_v) : double_v; }
+};
+
+Scalar ToScalar(const Operand &operand) {
+  Scalar scalar;
+  if (operand.value) {
+    const auto &value = *operand.value;
+    switch (value.type()) {
+      case TypedValue::Type::Null:
+        scalar.kind = Scalar::Kind::kNull;
+        break;
+      case TypedValue::Type::Bool:
+        scalar.kind = Scalar::Kind::kBool;
+        scalar.bool_v = value.ValueBool();
+        break;
+      case TypedValue::Type::Int:
+        scalar.kind = Scalar::Kind::kInt;
+        scalar.int_v = value.ValueInt();
+        break;
+      case TypedValue::Type::Double:
+        scalar.kind = Scalar::Kind::kDouble;
+        scalar.double_v = value.ValueDouble();
+        break;
+      case TypedValue::Type::String:
+        scalar.kind = Scalar::Kind::kString;
+        scalar.string_v = value.ValueString();
+        break;
+      default:
+        break;
+    }
+    return scalar;
+  }
+  const auto &property = operand.property;
+  if (property.IsNull()) {
+    scalar.kind = Scalar::Kind::kNull;
+  } else if (property.IsBool()) {
+    scalar.kind = Scalar::Kind::kBool;
+    scalar.bool_v = property.ValueBool();
+  } else if (property.IsInt()) {
+    scalar.kind = Scalar::Kind::kInt;
+    scalar.int_v = property.ValueInt();
+  } else if (property.IsDouble()) {
+    scalar.kind = Scalar::Kind::kDouble;
+    scalar.double_v = property.ValueDouble();
+  } else if (property.IsString()) {
+    scalar.kind = Scalar::Kind::kString;
+    scalar.string_v = property.ValueString();
+  }
+  return scalar;
+}
+
+enum class CompareOp : uint8_t { kEqual, kNotEqual, kLess, kGreater, kLessEqual, kGreaterEqual };
+
+const char *CompareOpName(CompareOp op) {
+  switch (op) {
+    case CompareOp::kEqual:
+      return "=";
+    case CompareOp::kNotEqual:
+      return "<>";
+    case CompareOp::kLess:
+      return "<";
+    case CompareOp::kGreater:
+      return ">";
+    case CompareOp::kLessEqual:
+      return "<=";
+    case CompareOp::kGreaterEqual:
+      return ">=";
+  }
+}
+
+/// Same as `operator==(TypedValue, TypedValue)` for scalars.
+Truth ScalarEqual(const Scalar &lhs, const Scalar &rhs) {
+  if (lhs.kind == Scalar::Kind::kNull || rhs.kind == Scalar::Kind::kNull) return Truth::kNull;
+  if (lhs.IsNumeric() && rhs.IsNumeric()) {
+    if (lhs.kind == Scalar::Kind::kInt && rhs.kind == Scalar::Kind::kInt) {
+      return lhs.int_v == rhs.int_v ? Truth::kTrue : Truth::kFalse;
+    }
+    return lhs.ToDouble() == rhs.ToDouble() ? Truth::kTrue : Truth::kFalse;
+  }
+  if (lhs.kind != rhs.kind) return Truth::kFalse;
+  if (lhs.kind == Scalar::Kind::kBool) return lhs.bool_v == rhs.bool_v ? Truth::kTrue : Truth::kFalse;
+  return lhs.string_v == rhs.string_v ? Truth::kTrue : Truth::kFalse;
+}
+
+/// Same as `operator<(TypedValue, TypedValue)` for null, numeric and string
+/// scalars. Returns nullopt for the operand types which are an error there.
+std::optional<Truth> ScalarLess(const Scalar &lhs, const Scalar &rhs) {
+  auto is_legal = [](Scalar::Kind kind) {
+    return kind == Scalar::Kind::kNull || kind == Scalar::Kind::kInt || kind == Scalar::Kind::kDouble ||
+           kind == Scalar::Kind::kString;
+  };
+  if (!is_legal(lhs.kind) || !is_legal(rhs.kind)) return std::nullopt;
+  if (lhs.kind == Scalar::Kind::kNull || rhs.kind == Scalar::Kind::kNull) return Truth::kNull;
+  if (lhs.kind == Scalar::Kind::kString || rhs.kind == Scalar::Kind::kString) {
+    if (lhs.kind != rhs.kind) return std::nullopt;
+    return lhs.string_v < rhs.string_v ? Truth::kTrue : Truth::kFalse;
+  }
+  if (lhs.kind == Scalar::Kind::kInt && rhs.kind == Scalar::Kind::kInt) {
+    return lhs.int_v < rhs.int_v ? Truth::kTrue : Truth::kFalse;
+  }
+  return lhs.ToDouble() < rhs.ToDouble() ? Truth::kTrue : Truth::kFalse;
+}
+
+/// Compares two scalars the way TypedValue does, which composes the other
+/// comparisons out of `==` and `<`. Returns nullopt if the operands need the
+/// generic TypedValue comparison.
+std::optional<Truth> CompareScalars(CompareOp op, const Scalar &lhs, const Scalar &rhs) {
+  if (lhs.kind == Scalar::Kind::kOther || rhs.kind == Scalar::Kind::kOther) return std::nullopt;
+  switch (op) {
+    case CompareOp::kEqual:
+      return ScalarEqual(lhs, rhs);
+    case CompareOp::kNotEqual:
+      return Not(ScalarEqual(lhs, rhs));
+    case CompareOp::kLess:
+      return ScalarLess(lhs, rhs);
+    case CompareOp::kGreater:
+    case CompareOp::kLessEqual: {
+      auto less = ScalarLess(lhs, rhs);
+      if (!less) return std::nullopt;
+      auto less_equal = Or(*less, ScalarEqual(lhs, rhs));
+      return op == CompareOp::kLessEqual ? less_equal : Not(less_equal);
+    }
+    case CompareOp::kGreaterEqual: {
+      auto less = ScalarLess(lhs, rhs);
+      if (!less) return std::nullopt;
+      return Not(*less);
+    }
+  }
+}
+
+/// Same as the comparison visitors of the ExpressionEvaluator.
+TypedValue CompareValues(CompareOp op, const TypedValue &lhs, const TypedValue &rhs) {
+  try {
+    switch (op) {
+      case CompareOp::kEqual:
+        return lhs == rhs;
+      case CompareOp::kNotEqual:
+        return lhs != rhs;
+      case CompareOp::kLess:
+        return lhs < rhs;
+      case CompareOp::kGreater:
+        return lhs > rhs;
+      case CompareOp::kLessEqual:
+        return lhs <= rhs;
+      case CompareOp::kGreaterEqual:
+        return lhs >= rhs;
+    }
+  } catch (const TypedValueException &) {
+    throw QueryRuntimeException("Invalid types: {} and {} for '{}'.", lhs.type(), rhs.type(), CompareOpName(op));
+  }
+}
+
+}  // namespace
+
+class CompiledExpressions::Node {
+ public:
+  Node() = default;
+  Node(const Node &) = delete;
+  Node &operator=(const Node &) = delete;
+  Node(Node &&) = delete;
+  Node &operator=(Node &&) = delete;
+  virtual ~Node() = default;
+
+  virtual TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants &constants) const = 0;
+
+  /// Evaluates the node in a boolean context.
+  virtual Truth Test(ExpressionEvaluator &evaluator, const Constants &constants) const {
+    return ToTruth(Evaluate(evaluator, constants));
+  }
+
+  /// Reads the value as a comparison operand. Returns false if the node can't
+  /// do that cheaper than `Evaluate`, in which case nothing was evaluated.
+  virtual bool Read(ExpressionEvaluator & /*evaluator*/, const Constants & /*constants*/,
+                    Operand & /*operand*/) const {
+    return false;
+  }
+};
+
+namespace {
+
+using Node = CompiledExpressions::Node;
+
+/// Evaluates an unsupported subexpression with the ExpressionEvaluator.
+class FallbackNode : public Node {
+ public:
+  explicit FallbackNode(Expression *expression) : expression_(expression) {}
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants & /*constants*/) const override {
+    return expression_->Accept(evaluator);
+  }
+
+ private:
+  Expression *expression_;
+};
+
+/// A literal or a parameter, bound once per execution.
+class ConstantNode : public Node {
+ public:
+  explicit ConstantNode(size_t index) : index_(index) {}
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    return TypedValue(constants[index_], evaluator.GetMemoryResource());
+  }
+
+  Truth Test(ExpressionEvaluator & /*evaluator*/, const Constants &constants) const override {
+    return ToTruth(constants[index_]);
+  }
+
+  bool Read(ExpressionEvaluator & /*evaluator*/, const Constants &constants, Operand &operand) const override {
+    operand.value = &constants[index_];
+    return true;
+  }
+
+ private:
+  size_t index_;
+};
+
+class IdentifierNode : public Node {
+ public:
+  explicit IdentifierNode(int32_t position) : position_(position) {}
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants & /*constants*/) const override {
+    return TypedValue(evaluator.GetFrame()->elems()[position_], evaluator.GetMemoryResource());
+  }
+
+  Truth Test(ExpressionEvaluator &evaluator, const Constants & /*constants*/) const override {
+    return ToTruth(evaluator.GetFrame()->elems()[position_]);
+  }
+
+  bool Read(ExpressionEvaluator &evaluator, const Constants & /*constants*/, Operand &operand) const override {
+    operand.value = &evaluator.GetFrame()->elems()[position_];
+    return true;
+  }
+
+ private:
+  int32_t position_;
+};
+
+/// `identifier.property` where the identifier is expected to be a vertex or
+/// an edge. Other values (maps, temporal types...) use the generic lookup.
+class PropertyLookupNode : public Node {
+ public:
+  PropertyLookupNode(PropertyLookup *lookup, int32_t position) : lookup_(lookup), position_(position) {}
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    Operand operand;
+    if (!Read(evaluator, constants, operand)) return lookup_->Accept(evaluator);
+    return operand.ToTypedValue(evaluator);
+  }
+
+  bool Read(ExpressionEvaluator &evaluator, const Constants & /*constants*/, Operand &operand) const override {
+    const auto &value = evaluator.GetFrame()->elems()[position_];
+    switch (value.type()) {
+      case TypedValue::Type::Null:
+        operand.property = storage::PropertyValue();
+        return true;
+      case TypedValue::Type::Vertex:
+        operand.property = evaluator.LookupProperty(value.ValueVertex(), lookup_->property_);
+        return true;
+      case TypedValue::Type::Edge:
+        operand.property = evaluator.LookupProperty(value.ValueEdge(), lookup_->property_);
+        return true;
+      default:
+        return false;
+    }
+  }
+
+ private:
+  PropertyLookup *lookup_;
+  int32_t position_;
+};
+
+class CompareNode : public Node {
+ public:
+  CompareNode(CompareOp op, std::unique_ptr<Node> lhs, std::unique_ptr<Node> rhs)
+      : op_(op), lhs_(std::move(lhs)), rhs_(std::move(rhs)) {}
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    Operand lhs;
+    Operand rhs;
+    if (lhs_->Read(evaluator, constants, lhs) && rhs_->Read(evaluator, constants, rhs)) {
+      if (auto result = CompareScalars(op_, ToScalar(lhs), ToScalar(rhs))) {
+        return FromTruth(*result, evaluator.GetMemoryResource());
+      }
+      return CompareValues(op_, lhs.ToTypedValue(evaluator), rhs.ToTypedValue(evaluator));
+    }
+    return CompareValues(op_, lhs_->Evaluate(evaluator, constants), rhs_->Evaluate(evaluator, constants));
+  }
+
+  Truth Test(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    Operand lhs;
+    Operand rhs;
+    if (lhs_->Read(evaluator, constants, lhs) && rhs_->Read(evaluator, constants, rhs)) {
+      if (auto result = CompareScalars(op_, ToScalar(lhs), ToScalar(rhs))) return *result;
+      return ToTruth(CompareValues(op_, lhs.ToTypedValue(evaluator), rhs.ToTypedValue(evaluator)));
+    }
+    return ToTruth(CompareValues(op_, lhs_->Evaluate(evaluator, constants), rhs_->Evaluate(evaluator, constants)));
+  }
+
+ private:
+  CompareOp op_;
+  std::unique_ptr<Node> lhs_;
+  std::unique_ptr<Node> rhs_;
+};
+
+class AndNode : public Node {
+ public:
+  AndNode(std::unique_ptr<Node> lhs, std::unique_ptr<Node> rhs) : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {}
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    auto value1 = lhs_->Evaluate(evaluator, constants);
+    if (value1.IsBool() && !value1.ValueBool()) return value1;
+    auto value2 = rhs_->Evaluate(evaluator, constants);
+    try {
+      return value1 && value2;
+    } catch (const TypedValueException &) {
+      throw QueryRuntimeException("Invalid types: {} and {} for AND.", value1.type(), value2.type());
+    }
+  }
+
+  Truth Test(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    auto lhs = lhs_->Test(evaluator, constants);
+    if (lhs == Truth::kFalse) return Truth::kFalse;
+    auto rhs = lhs == Truth::kInvalid ? Truth::kInvalid : rhs_->Test(evaluator, constants);
+    if (rhs == Truth::kInvalid) return ToTruth(Evaluate(evaluator, constants));
+    if (rhs == Truth::kFalse) return Truth::kFalse;
+    return lhs == Truth::kNull || rhs == Truth::kNull ? Truth::kNull : Truth::kTrue;
+  }
+
+ private:
+  std::unique_ptr<Node> lhs_;
+  std::unique_ptr<Node> rhs_;
+};
+
+class OrNode : public Node {
+ public:
+  OrNode(std::unique_ptr<Node> lhs, std::unique_ptr<Node> rhs) : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {}
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    auto value1 = lhs_->Evaluate(evaluator, constants);
+    if (value1.IsBool() && value1.ValueBool()) return value1;
+    auto value2 = rhs_->Evaluate(evaluator, constants);
+    try {
+      return value1 || value2;
+    } catch (const TypedValueException &) {
+      throw QueryRuntimeException("Invalid types: {} and {} for OR.", value1.type(), value2.type());
+    }
+  }
+
+  Truth Test(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    auto lhs = lhs_->Test(evaluator, constants);
+    if (lhs == Truth::kTrue) return Truth::kTrue;
+    auto rhs = lhs == Truth::kInvalid ? Truth::kInvalid : rhs_->Test(evaluator, constants);
+    if (rhs == Truth::kInvalid) return ToTruth(Evaluate(evaluator, constants));
+    return Or(lhs, rhs);
+  }
+
+ private:
+  std::unique_ptr<Node> lhs_;
+  std::unique_ptr<Node> rhs_;
+};
+
+class NotNode : public Node {
+ public:
+  explicit NotNode(std::unique_ptr<Node> operand) : operand_(std::move(operand)) {}
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    auto value = operand_->Evaluate(evaluator, constants);
+    try {
+      return !value;
+    } catch (const TypedValueException &) {
+      throw QueryRuntimeException("Invalid type {} for '{}'.", value.type(), "NOT");
+    }
+  }
+
+  Truth Test(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    auto operand = operand_->Test(evaluator, constants);
+    if (operand == Truth::kInvalid) return ToTruth(Evaluate(evaluator, constants));
+    return Not(operand);
+  }
+
+ private:
+  std::unique_ptr<Node> operand_;
+};
+
+class IsNullNode : public Node {
+ public:
+  explicit IsNullNode(std::unique_ptr<Node> operand) : operand_(std::move(operand)) {}
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    return FromTruth(Test(evaluator, constants), evaluator.GetMemoryResource());
+  }
+
+  Truth Test(ExpressionEvaluator &evaluator, const Constants &constants) const override {
+    Operand operand;
+    if (operand_->Read(evaluator, constants, operand)) return operand.IsNull() ? Truth::kTrue : Truth::kFalse;
+    return operand_->Evaluate(evaluator, constants).IsNull() ? Truth::kTrue : Truth::kFalse;
+  }
+
+ private:
+  std::unique_ptr<Node> operand_;
+};
+
+class Compiler {
+ public:
+  explicit Compiler(std::vector<Expression *> *constants) : constants_(constants) {}
+
+  std::unique_ptr<Node> Compile(Expression *expression) {
+    if (auto *literal = utils::Downcast<PrimitiveLiteral>(expression)) return Constant(literal);
+    if (auto *parameter = utils::Downcast<ParameterLookup>(expression)) return Constant(parameter);
+    if (auto *identifier = utils::Downcast<Identifier>(expression)) {
+      if (identifier->symbol_pos_ < 0) return std::make_unique<FallbackNode>(expression);
+      return std::make_unique<IdentifierNode>(identifier->symbol_pos_);
+    }
+    if (auto *lookup = utils::Downcast<PropertyLookup>(expression)) {
+      // Looking up all properties at once is cached by the evaluator.
+      auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+      if (!identifier || identifier->symbol_pos_ < 0 ||
+          lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) {
+        return std::make_unique<FallbackNode>(expression);
+      }
+      return std::make_unique<PropertyLookupNode>(lookup, identifier->symbol_pos_);
+    }
+    if (auto *op = utils::Downcast<EqualOperator>(expression)) return Compare(CompareOp::kEqual, op);
+    if (auto *op = utils::Downcast<NotEqualOperator>(expression)) return Compare(CompareOp::kNotEqual, op);
+    if (auto *op = utils::Downcast<LessOperator>(expression)) return Compare(CompareOp::kLess, op);
+    if (auto *op = utils::Downcast<GreaterOperator>(expression)) return Compare(CompareOp::kGreater, op);
+    if (auto *op = utils::Downcast<LessEqualOperator>(expression)) return Compare(CompareOp::kLessEqual, op);
+    if (auto *op = utils::Downcast<GreaterEqualOperator>(expression)) return Compare(CompareOp::kGreaterEqual, op);
+    if (auto *op = utils::Downcast<AndOperator>(expression)) {
+      return std::make_unique<AndNode>(Compile(op->expression1_), Compile(op->expression2_));
+    }
+    if (auto *op = utils::Downcast<OrOperator>(expression)) {
+      return std::make_unique<OrNode>(Compile(op->expression1_), Compile(op->expression2_));
+    }
+    if (auto *op = utils::Downcast<NotOperator>(expression)) {
+      return std::make_unique<NotNode>(Compile(op->expression_));
+    }
+    if (auto *op = utils::Downcast<IsNullOperator>(expression)) {
+      return std::make_unique<IsNullNode>(Compile(op->expression_));
+    }
+    return std::make_unique<FallbackNode>(expression);
+  }
+
+ private:
+  std::unique_ptr<Node> Constant(Expression *expression) {
+    constants_->push_back(expression);
+    return std::make_unique<ConstantNode>(constants_->size() - 1);
+  }
+
+  template <class TOperator>
+  std::unique_ptr<Node> Compare(CompareOp op, TOperator *expression) {
+    return std::make_unique<CompareNode>(op, Compile(expression->expression1_), Compile(expression->expression2_));
+  }
+
+  std::vector<Expression *> *constants_;
+};
+
+}  // namespace
+
+CompiledExpressions::CompiledExpressions(std::vector<Expression *> expressions) : expressions_(std::move(expressions)) {
+  Compiler compiler(&constants_);
+  roots_.reserve(expressions_.size());
+  for (auto *expression : expressions_) roots_.push_back(compiler.Compile(expression));
+}
+
+CompiledExpressions::~CompiledExpressions() = default;
+
+CompiledExpressions::Constants CompiledExpressions::Bind(ExpressionEvaluator &evaluator) const {
+  Constants constants(evaluator.GetMemoryResource());
+  constants.reserve(constants_.size());
+  for (auto *expression : constants_) constants.push_back(expression->Accept(evaluator));
+  return constants;
+}
+
+TypedValue CompiledExpressions::Evaluate(size_t index, ExpressionEvaluator &evaluator,
+                                         const Constants &constants) const {
+  return roots_[index]->Evaluate(evaluator, constants);
+}
+
+bool CompiledExpressions::EvaluateFilter(size_t index, ExpressionEvaluator &evaluator,
+                                         const Constants &constants) const {
+  switch (roots_[index]->Test(evaluator, constants)) {
+    case Truth::kTrue:
+      return true;
+    case Truth::kFalse:
+    case Truth::kNull:
+      return false;
+    case Truth::kInvalid:
+      break;
+  }
+  auto result = roots_[index]->Evaluate(evaluator, constants);
+  throw QueryRuntimeException("Filter expression must evaluate to bool or null, got {}.", result.type());
+}
+
+std::shared_ptr<const CompiledExpressions> CompiledExpressionsCache::Get(
+    const std::vector<Expression *> &expressions) const {
+  auto guard = std::lock_guard{lock_};
+  if (!compiled_ || compiled_->expressions() != expressions) {
+    compiled_ = std::make_shared<const CompiledExpressions>(expressions);
+  }
+  return compiled_;
+}
+
+}  // namespace memgraph::query
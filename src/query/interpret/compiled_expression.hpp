@@ -0,0 +1,102 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "query/typed_value.hpp"
+#include "utils/pmr/vector.hpp"
+#include "utils/spin_lock.hpp"
+
+DECLARE_bool(query_compiled_expressions);
+
+namespace memgraph::query {
+
+class Expression;
+class ExpressionEvaluator;
+
+/// Expressions of a logical operator compiled into trees of specialized nodes.
+///
+/// Compilation resolves frame positions of identifiers, turns property
+/// lookups on vertices and edges into direct storage reads and replaces
+/// comparisons of a property with a literal or a parameter by kernels which
+/// don't create TypedValue temporaries for null, bool, numeric and string
+/// operands. Logical operators are evaluated as three-valued booleans.
+/// Everything else is evaluated with the ExpressionEvaluator, so the results
+/// (and errors) are exactly the same as when walking the AST.
+///
+/// Compiled expressions don't depend on query parameters and are shared by
+/// all executions of a cached plan. Literals and parameters are converted to
+/// TypedValue once per execution with `Bind`.
+class CompiledExpressions {
+ public:
+  using Constants = utils::pmr::vector<TypedValue>;
+
+  enum class Truth : uint8_t;
+  struct Operand;
+  class Node;
+
+  explicit CompiledExpressions(std::vector<Expression *> expressions);
+  CompiledExpressions(const CompiledExpressions &) = delete;
+  CompiledExpressions &operator=(const CompiledExpressions &) = delete;
+  CompiledExpressions(CompiledExpressions &&) = delete;
+  CompiledExpressions &operator=(CompiledExpressions &&) = delete;
+  ~CompiledExpressions();
+
+  const std::vector<Expression *> &expressions() const { return expressions_; }
+
+  /// Evaluates literals and parameters used by the compiled nodes.
+  Constants Bind(ExpressionEvaluator &evaluator) const;
+
+  /// Evaluates the expression at `index`.
+  TypedValue Evaluate(size_t index, ExpressionEvaluator &evaluator, const Constants &constants) const;
+
+  /// Evaluates the expression at `index` as a filter: null is treated like
+  /// false and any other non-bool value is an error.
+  bool EvaluateFilter(size_t index, ExpressionEvaluator &evaluator, const Constants &constants) const;
+
+ private:
+  std::vector<Expression *> expressions_;
+  std::vector<Expression *> constants_;
+  std::vector<std::unique_ptr<Node>> roots_;
+};
+
+/// Compiles the expressions of a logical operator on first use and shares the
+/// result between its cursors, including the ones created concurrently by
+/// `Gather`. Copies start out empty.
+class CompiledExpressionsCache {
+ public:
+  CompiledExpressionsCache() = default;
+  CompiledExpressionsCache(const CompiledExpressionsCache & /*other*/) {}
+  CompiledExpressionsCache &operator=(const CompiledExpressionsCache & /*other*/) {
+    auto guard = std::lock_guard{lock_};
+    compiled_.reset();
+    return *this;
+  }
+  ~CompiledExpressionsCache() = default;
+
+  /// Returns the compiled `expressions`, recompiling them if the operator's
+  /// expressions were replaced since the last call.
+  std::shared_ptr<const CompiledExpressions> Get(const std::vector<Expression *> &expressions) const;
+
+ private:
+  mutable utils::SpinLock lock_;
+  mutable std::shared_ptr<const CompiledExpressions> compiled_;
+};
+
+}  // namespace memgraph::query
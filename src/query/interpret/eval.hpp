@@ -202,6 +202,8 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
 
   utils::MemoryResource *GetMemoryResource() const { return ctx_->memory; }
 
+  Frame *GetFrame() const { return frame_; }
+
   storage::NameIdMapper *GetNameIdMapper() const { return dba_->GetStorageAccessor()->GetNameIdMapper(); }
 
   void ResetPropertyLookupCache() { property_lookup_cache_.clear(); }
@@ -503,6 +505,12 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
 
   TypedValue Visit(PropertyLookup &property_lookup) override;
 
+  /// Reads a property of a vertex or an edge the same way `PropertyLookup` does.
+  template <class TRecordAccessor>
+  storage::PropertyValue LookupProperty(const TRecordAccessor &record_accessor, const PropertyIx &prop) {
+    return GetProperty(record_accessor, prop);
+  }
+
   TypedValue Visit(AllPropertiesLookup &all_properties_lookup) override;
 
   TypedValue Visit(LabelsTest &labels_test) override {
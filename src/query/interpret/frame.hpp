@@ -37,6 +37,7 @@ class Frame {
   const TypedValue &at(const Symbol &symbol) const { return elems_.at(symbol.position()); }
 
   auto &elems() { return elems_; }
+  const auto &elems() const { return elems_; }
 
   auto get_allocator() const -> allocator_type { return elems_.get_allocator(); }
 
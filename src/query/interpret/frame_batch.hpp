@@ -0,0 +1,95 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/interpret/frame.hpp"
+#include "query/typed_value.hpp"
+#include "utils/logging.hpp"
+#include "utils/memory.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::query {
+
+/// Column-major storage for up to `capacity` frames.
+///
+/// Column `i` holds the values of the frame slot at position `i`, so a row of
+/// the batch corresponds to a whole Frame. Rows are moved in and out of a Frame
+/// because expressions are still evaluated against a single Frame.
+class FrameBatch {
+ public:
+  using allocator_type = utils::Allocator<TypedValue>;
+
+  FrameBatch(int64_t frame_size, size_t capacity, allocator_type alloc) : columns_(alloc), capacity_(capacity) {
+    MG_ASSERT(frame_size >= 0);
+    MG_ASSERT(capacity > 0);
+    columns_.resize(frame_size);
+    for (auto &column : columns_) column.reserve(capacity_);
+  }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+  int64_t frame_size() const { return static_cast<int64_t>(columns_.size()); }
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ == capacity_; }
+
+  void Clear() {
+    for (auto &column : columns_) column.clear();
+    size_ = 0;
+  }
+
+  /// Appends a copy of the frame as the last row.
+  void Append(const Frame &frame) {
+    DMG_ASSERT(!full(), "Appending to a full FrameBatch");
+    const auto &elems = frame.elems();
+    for (size_t i = 0; i < columns_.size(); ++i) columns_[i].push_back(elems[i]);
+    ++size_;
+  }
+
+  /// Moves the values of `row` into the frame. The row is left in a valid but
+  /// unspecified state until it is overwritten with `MoveFrameToRow`.
+  void MoveRowToFrame(size_t row, Frame &frame) {
+    DMG_ASSERT(row < size_, "FrameBatch row out of range");
+    auto &elems = frame.elems();
+    for (size_t i = 0; i < columns_.size(); ++i) elems[i] = std::move(columns_[i][row]);
+  }
+
+  /// Moves the values of the frame into an existing `row`.
+  void MoveFrameToRow(Frame &frame, size_t row) {
+    DMG_ASSERT(row < size_, "FrameBatch row out of range");
+    auto &elems = frame.elems();
+    for (size_t i = 0; i < columns_.size(); ++i) columns_[i][row] = std::move(elems[i]);
+  }
+
+  /// Drops every row starting from `size`. Used to compact the batch after
+  /// the rows which should be kept were moved to its beginning.
+  void Truncate(size_t size) {
+    DMG_ASSERT(size <= size_, "FrameBatch can't grow by truncating");
+    for (auto &column : columns_) column.resize(size);
+    size_ = size;
+  }
+
+  TypedValue &at(size_t row, const Symbol &symbol) { return columns_.at(symbol.position()).at(row); }
+  const TypedValue &at(size_t row, const Symbol &symbol) const { return columns_.at(symbol.position()).at(row); }
+
+  auto get_allocator() const -> allocator_type { return columns_.get_allocator(); }
+
+ private:
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> columns_;
+  size_t capacity_;
+  size_t size_{0};
+};
+
+}  // namespace memgraph::query
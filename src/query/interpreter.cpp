@@ -90,6 +90,7 @@
 #include "storage/v2/edge_import_mode.hpp"
 #include "storage/v2/fmt.hpp"
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/indices/label_property_index_stats.hpp"
 #include "storage/v2/indices/vector_index.hpp"
 #include "storage/v2/indices/vector_index_utils.hpp"
 #include "storage/v2/inmemory/storage.hpp"
@@ -2450,6 +2451,8 @@ struct PullPlan {
  private:
   std::shared_ptr<PlanWrapper> plan_ = nullptr;
   plan::UniqueCursorPtr cursor_ = nullptr;
+  // Pulls from `cursor_` in batches when `--query-batch-size` is set.
+  plan::BatchedInput batched_input_;
   Frame frame_;
   ExecutionContext ctx_;
   std::optional<size_t> memory_limit_;
@@ -2460,6 +2463,8 @@ struct PullPlan {
   // we need the keep track of the total execution time across
   // those pulls by accumulating the execution time.
   std::chrono::duration<double> execution_time_{0};
+  // Rows produced across all of the pulls, reported back to the plan
+  uint64_t produced_rows_{0};
 
   // To pull the results from a query we call the `Pull` method on
   // the cursor which saves the results in a Frame.
@@ -2503,11 +2508,24 @@ PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &pa
   }
 #endif
   ctx_.stopping_context = std::move(stopping_context);
-  ctx_.is_profile_query = is_profile_query;
+  // Sampled executions are profiled to compare the rows produced by the
+  // operators with the estimates
+  ctx_.is_profile_query = is_profile_query || plan->ShouldSampleCardinalities();
   ctx_.trigger_context_collector = trigger_context_collector;
   ctx_.frame_change_collector = frame_change_collector;
   ctx_.evaluation_context.memory = execution_memory;
   ctx_.db_acc = std::move(db_acc);
+  ctx_.worker_pool = interpreter_context ? interpreter_context->query_worker_pool.get() : nullptr;
+
+  // All rows of a batch are evaluated before the first one is streamed, which
+  // is only equivalent to pulling row by row if the query doesn't write.
+  // PROFILE counts hits per row and the cached values of the frame change
+  // collector are invalidated per row, so those queries aren't batched either.
+  if (FLAGS_query_batch_size > 0 && !ctx_.is_profile_query &&
+      plan->rw_type() == plan::ReadWriteTypeChecker::RWType::R &&
+      !(frame_change_collector && frame_change_collector->IsTrackingValues())) {
+    batched_input_.Enable(plan->symbol_table().max_position(), FLAGS_query_batch_size, execution_memory);
+  }
 }
 
 std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *stream, std::optional<int> n,
@@ -2536,7 +2554,7 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   }};
 
   // Returns true if a result was pulled.
-  const auto pull_result = [&]() -> bool { return cursor_->Pull(frame_, ctx_); };
+  const auto pull_result = [&]() -> bool { return batched_input_.Pull(*cursor_, frame_, ctx_); };
 
   auto values = std::vector<TypedValue>(output_symbols.size());
   const auto stream_values = [&] {
@@ -2570,6 +2588,7 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   // we try to pull the next result to see if there is more.
   // If there is additional result, we leave the pulled result in the frame
   // and set the flag to true.
+  produced_rows_ += static_cast<uint64_t>(i);
   has_unsent_results_ = i == n && pull_result();
 
   execution_time_ += timer.Elapsed();
@@ -2578,6 +2597,8 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
     return std::nullopt;
   }
 
+  plan_->RecordProducedRows(produced_rows_);
+
   summary->insert_or_assign("plan_execution_time", execution_time_.count());
   summary->insert_or_assign("number_of_hops", ctx_.number_of_hops);
 
@@ -2612,6 +2633,9 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   }
 
   auto stats_and_total_time = GetStatsWithTotalTime(ctx_);
+  if (ctx_.is_profile_query) {
+    plan_->RecordCardinalities(stats_and_total_time.cumulative_stats);
+  }
 
   if (query_logger_) {
     query_logger_->trace(fmt::format("Profile plan\n{}", ProfilingStatsToJson(stats_and_total_time).dump()));
@@ -2803,7 +2827,8 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   auto *plan_cache = is_cacheable ? current_db.db_acc_->get()->plan_cache() : nullptr;
 
   auto plan = CypherQueryToPlan(parsed_query.stripped_query, std::move(parsed_query.ast_storage), cypher_query,
-                                parsed_query.parameters, plan_cache, dba);
+                                parsed_query.parameters, plan_cache, dba, {},
+                                current_db.db_acc_->get()->cardinality_feedback());
 
   auto hints = plan::ProvidePlanHints(&plan->plan(), plan->symbol_table());
   for (const auto &hint : hints) {
@@ -2887,7 +2912,8 @@ PreparedQuery PrepareExplainQuery(ParsedQuery parsed_query, std::map<std::string
 
   auto cypher_query_plan =
       CypherQueryToPlan(parsed_inner_query.stripped_query, std::move(parsed_inner_query.ast_storage), cypher_query,
-                        parsed_inner_query.parameters, plan_cache, dba);
+                        parsed_inner_query.parameters, plan_cache, dba, {},
+                        current_db.db_acc_->get()->cardinality_feedback());
 
   auto hints = plan::ProvidePlanHints(&cypher_query_plan->plan(), cypher_query_plan->symbol_table());
   for (const auto &hint : hints) {
@@ -2975,7 +3001,8 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
   auto *plan_cache = parsed_inner_query.is_cacheable ? current_db.db_acc_->get()->plan_cache() : nullptr;
   auto cypher_query_plan =
       CypherQueryToPlan(parsed_inner_query.stripped_query, std::move(parsed_inner_query.ast_storage), cypher_query,
-                        parsed_inner_query.parameters, plan_cache, dba);
+                        parsed_inner_query.parameters, plan_cache, dba, {},
+                        current_db.db_acc_->get()->cardinality_feedback());
   TryCaching(cypher_query_plan->ast_storage(), frame_change_collector);
 
   auto hints = plan::ProvidePlanHints(&cypher_query_plan->plan(), cypher_query_plan->symbol_table());
@@ -3077,15 +3104,33 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreat
                     auto vertices = execution_db_accessor->Vertices(view, label_id);
                     uint64_t no_vertices{0};
                     uint64_t total_degree{0};
+                    // Number of out and in edges by edge type
+                    std::map<storage::EdgeTypeId, std::pair<uint64_t, uint64_t>> edge_type_counter;
                     std::for_each(vertices.begin(), vertices.end(),
-                                  [&total_degree, &no_vertices, &view](const auto &vertex) {
+                                  [&total_degree, &no_vertices, &edge_type_counter, &view](const auto &vertex) {
                                     no_vertices++;
                                     total_degree += *vertex.OutDegree(view) + *vertex.InDegree(view);
+                                    if (auto out_edges = vertex.OutEdgesRange(view, {}); out_edges.HasValue()) {
+                                      for (auto const &edge : out_edges->edges) {
+                                        ++edge_type_counter[edge.EdgeType()].first;
+                                      }
+                                    }
+                                    if (auto in_edges = vertex.InEdgesRange(view, {}); in_edges.HasValue()) {
+                                      for (auto const &edge : in_edges->edges) {
+                                        ++edge_type_counter[edge.EdgeType()].second;
+                                      }
+                                    }
                                   });
 
                     auto average_degree =
                         no_vertices > 0 ? static_cast<double>(total_degree) / static_cast<double>(no_vertices) : 0;
                     auto index_stats = storage::LabelIndexStats{.count = no_vertices, .avg_degree = average_degree};
+                    for (auto const &[edge_type, counts] : edge_type_counter) {
+                      index_stats.edge_type_degrees.push_back(
+                          {.edge_type = edge_type,
+                           .avg_out_degree = static_cast<double>(counts.first) / static_cast<double>(no_vertices),
+                           .avg_in_degree = static_cast<double>(counts.second) / static_cast<double>(no_vertices)});
+                    }
                     execution_db_accessor->SetIndexStats(label_id, index_stats);
                     label_stats.emplace_back(label_id, index_stats);
                   });
@@ -3207,6 +3252,7 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreat
                                                .statistic = chi_squared_stat,
                                                .avg_group_size = avg_group_size,
                                                .avg_degree = average_degree};
+          storage::BuildKeyDistribution(values_map, index_stats);
           execution_db_accessor->SetIndexStats(label_property.first, label_property.second, index_stats);
           label_property_stats.push_back(std::make_pair(label_property, index_stats));
         });
@@ -15,6 +15,7 @@
 #include "query/interpreter_context.hpp"
 
 #include "query/interpreter.hpp"
+#include "query/plan/rewrite/parallel.hpp"
 
 #include "system/include/system/system.hpp"
 namespace memgraph::query {
@@ -39,6 +40,9 @@ InterpreterContext::InterpreterContext(
       auth_checker(ac),
       replication_handler_{replication_handler},
       system_{&system} {
+  if (FLAGS_query_parallel_workers > 1) {
+    query_worker_pool = std::make_unique<utils::ThreadPool>(FLAGS_query_parallel_workers - 1);
+  }
 }
 
 std::vector<std::vector<TypedValue>> InterpreterContext::TerminateTransactions(
@@ -14,6 +14,7 @@
 #include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_set>
@@ -32,6 +33,7 @@
 #include "utils/skip_list.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread_pool.hpp"
 #ifdef MG_ENTERPRISE
 #include "coordination/coordinator_state.hpp"
 #endif
@@ -79,6 +81,10 @@ struct InterpreterContext {
   // TODO: Have a way to read the current database
   memgraph::utils::Synchronized<std::unordered_set<Interpreter *>, memgraph::utils::SpinLock> interpreters;
 
+  /// Threads used to execute parts of a single query in parallel (see
+  /// `plan::Gather`); nullptr when parallel execution is disabled.
+  std::unique_ptr<utils::ThreadPool> query_worker_pool;
+
   struct {
     auto next() -> uint64_t { return transaction_id++; }
 
@@ -0,0 +1,94 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/cardinality_feedback.hpp"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "query/plan/operator.hpp"
+#include "query/plan/preprocess.hpp"
+
+namespace memgraph::query::plan {
+
+std::optional<double> CardinalityFeedback::ExpandDegree(const ExpandCommon &common) const {
+  auto key = MakeExpandKey(common);
+  return observations_.WithReadLock([&](const auto &observations) -> std::optional<double> {
+    auto it = observations.expand_degrees.find(key);
+    if (it == observations.expand_degrees.end()) return std::nullopt;
+    return it->second;
+  });
+}
+
+void CardinalityFeedback::RecordExpandDegree(const ExpandCommon &common, double degree) {
+  auto key = MakeExpandKey(common);
+  observations_.WithLock(
+      [&](auto &observations) { Record(observations.expand_degrees, std::move(key), std::max(degree, 0.0)); });
+}
+
+std::optional<double> CardinalityFeedback::FilterSelectivity(const Filters &filters) const {
+  auto key = MakeFilterKey(filters);
+  if (!key) return std::nullopt;
+  return observations_.WithReadLock([&](const auto &observations) -> std::optional<double> {
+    auto it = observations.filter_selectivities.find(*key);
+    if (it == observations.filter_selectivities.end()) return std::nullopt;
+    return it->second;
+  });
+}
+
+void CardinalityFeedback::RecordFilterSelectivity(const Filters &filters, double selectivity) {
+  auto key = MakeFilterKey(filters);
+  if (!key) return;
+  observations_.WithLock([&](auto &observations) {
+    Record(observations.filter_selectivities, std::move(*key), std::clamp(selectivity, 0.0, 1.0));
+  });
+}
+
+CardinalityFeedback::ExpandKey CardinalityFeedback::MakeExpandKey(const ExpandCommon &common) {
+  auto edge_types = common.edge_types;
+  std::ranges::sort(edge_types);
+  return {std::move(edge_types), common.direction, common.existing_node};
+}
+
+std::optional<std::string> CardinalityFeedback::MakeFilterKey(const Filters &filters) {
+  if (filters.empty()) return std::nullopt;
+  std::vector<std::string> parts;
+  for (const auto &filter : filters) {
+    if (filter.type == FilterInfo::Type::Label && filter.or_labels.empty()) {
+      for (const auto &label : filter.labels) parts.push_back(fmt::format(":{}", label.name));
+    } else if (filter.type == FilterInfo::Type::Property && filter.property_filter) {
+      std::string path;
+      for (const auto &property : filter.property_filter->property_ids_.path) path += "." + property.name;
+      parts.push_back(fmt::format("{}{}", path, static_cast<int>(filter.property_filter->type_)));
+    } else {
+      // Generic expressions can't be told apart by their shape
+      return std::nullopt;
+    }
+  }
+  std::ranges::sort(parts);
+  std::string key;
+  for (const auto &part : parts) key += part + ";";
+  return key;
+}
+
+template <typename TKey>
+void CardinalityFeedback::Record(std::map<TKey, double> &observations, TKey key, double value) {
+  auto it = observations.find(key);
+  if (it != observations.end()) {
+    it->second += kObservationWeight * (value - it->second);
+    return;
+  }
+  if (observations.size() >= kMaxEntries) return;
+  observations.emplace(std::move(key), value);
+}
+
+}  // namespace memgraph::query::plan
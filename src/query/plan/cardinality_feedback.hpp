@@ -0,0 +1,71 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "query/frontend/ast/ast.hpp"
+#include "storage/v2/id_types.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::query::plan {
+
+struct ExpandCommon;
+class Filters;
+
+/// Cardinalities observed while executing plans, used by the cost estimator
+/// where the statistics of the database don't tell enough.
+///
+/// Executions of cached plans are occasionally profiled, and the number of
+/// rows each expansion and filter produced per row of its input is recorded
+/// here. The degree of an expansion is kept by its edge types and direction,
+/// and the selectivity of a filter by the labels and properties it filters
+/// on. Repeated observations are averaged, weighting the recent ones more.
+class CardinalityFeedback {
+ public:
+  /// Observed number of edges expanded per input vertex.
+  std::optional<double> ExpandDegree(const ExpandCommon &common) const;
+  void RecordExpandDegree(const ExpandCommon &common, double degree);
+
+  /// Observed fraction of the input rows which pass the filters, nullopt also
+  /// if the filters aren't all label and property filters.
+  std::optional<double> FilterSelectivity(const Filters &filters) const;
+  void RecordFilterSelectivity(const Filters &filters, double selectivity);
+
+ private:
+  // Bounds the memory used by the queries of a database with many shapes
+  static constexpr size_t kMaxEntries = 10000;
+  // Weight of a new observation in the average
+  static constexpr double kObservationWeight = 0.5;
+
+  using ExpandKey = std::tuple<std::vector<storage::EdgeTypeId>, EdgeAtom::Direction, bool>;
+
+  struct Observations {
+    std::map<ExpandKey, double> expand_degrees;
+    std::map<std::string, double> filter_selectivities;
+  };
+
+  static ExpandKey MakeExpandKey(const ExpandCommon &common);
+  static std::optional<std::string> MakeFilterKey(const Filters &filters);
+
+  template <typename TKey>
+  static void Record(std::map<TKey, double> &observations, TKey key, double value);
+
+  utils::Synchronized<Observations, utils::RWSpinLock> observations_;
+};
+
+}  // namespace memgraph::query::plan
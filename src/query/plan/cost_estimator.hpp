@@ -12,8 +12,11 @@
 #pragma once
 
 #include "query/parameters.hpp"
+#include "query/plan/cardinality_feedback.hpp"
 #include "query/plan/operator.hpp"
 #include "query/plan/rewrite/index_lookup.hpp"
+#include "storage/v2/indices/label_index_stats.hpp"
+#include "storage/v2/indices/label_property_index_stats.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/math.hpp"
 
@@ -27,6 +30,8 @@ namespace memgraph::query::plan {
 struct SymbolStatistics {
   uint64_t count;
   double degree;
+  // Label of the index the statistics come from
+  std::optional<storage::LabelId> label;
 };
 
 /**
@@ -122,15 +127,26 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   using HierarchicalLogicalOperatorVisitor::PreVisit;
 
   CostEstimator(TDbAccessor *db_accessor, const SymbolTable &table, const Parameters &parameters,
-                const IndexHints &index_hints)
-      : db_accessor_(db_accessor), table_(table), parameters(parameters), scopes_{Scope()}, index_hints_(index_hints) {}
+                const IndexHints &index_hints, const CardinalityFeedback *cardinality_feedback = nullptr)
+      : db_accessor_(db_accessor),
+        table_(table),
+        parameters(parameters),
+        scopes_{Scope()},
+        index_hints_(index_hints),
+        cardinality_feedback_(cardinality_feedback) {}
 
   CostEstimator(TDbAccessor *db_accessor, const SymbolTable &table, const Parameters &parameters, Scope scope,
-                const IndexHints &index_hints)
-      : db_accessor_(db_accessor), table_(table), parameters(parameters), scopes_{scope}, index_hints_(index_hints) {}
-
-  bool PostVisit(ScanAll &) override {
+                const IndexHints &index_hints, const CardinalityFeedback *cardinality_feedback = nullptr)
+      : db_accessor_(db_accessor),
+        table_(table),
+        parameters(parameters),
+        scopes_{scope},
+        index_hints_(index_hints),
+        cardinality_feedback_(cardinality_feedback) {}
+
+  bool PostVisit(ScanAll &op) override {
     cardinality_ *= db_accessor_->VerticesCount();
+    operator_cardinalities_[&op] = cardinality_;
     // ScanAll performs some work for every element that is produced
     IncrementCost(CostParam::kScanAll);
     return true;
@@ -139,10 +155,11 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   bool PostVisit(ScanAllByLabel &scan_all_by_label) override {
     auto index_stats = db_accessor_->GetIndexStats(scan_all_by_label.label_);
     if (index_stats.has_value()) {
-      SaveStatsFor(scan_all_by_label.output_symbol_, index_stats.value());
+      SaveStatsFor(scan_all_by_label.output_symbol_, scan_all_by_label.label_, index_stats.value());
     }
 
     cardinality_ *= db_accessor_->VerticesCount(scan_all_by_label.label_);
+    operator_cardinalities_[&scan_all_by_label] = cardinality_;
     if (index_hints_.HasLabelIndex(db_accessor_, scan_all_by_label.label_)) {
       use_index_hints_ = true;
     }
@@ -154,7 +171,7 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   bool PostVisit(ScanAllByLabelProperties &logical_op) override {
     auto index_stats = db_accessor_->GetIndexStats(logical_op.label_, logical_op.properties_);
     if (index_stats.has_value()) {
-      SaveStatsFor(logical_op.output_symbol_, index_stats.value());
+      SaveStatsFor(logical_op.output_symbol_, logical_op.label_, index_stats.value());
     }
 
     // this cardinality estimation depends on Bound expressions.
@@ -173,6 +190,12 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
                                     ranges::to_vector;
 
         return db_accessor_->VerticesCount(logical_op.label_, logical_op.properties_, propertyvalue_ranges);
+      } else if (index_stats && index_stats->count > 0 &&
+                 ranges::all_of(logical_op.expression_ranges_,
+                                [](ExpressionRange const &er) { return er.type_ == ExpressionRange::Type::EQUAL; })) {
+        // the values are only known at runtime, expect the average number
+        // of vertices with the same values
+        return index_stats->avg_group_size;
       } else {
         // no values, but we still have the label + properties
         // use filtering constant to modify the factor
@@ -181,6 +204,7 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     });
 
     cardinality_ *= factor;
+    operator_cardinalities_[&logical_op] = cardinality_;
 
     if (index_hints_.HasLabelPropertiesIndex(db_accessor_, logical_op.label_, logical_op.properties_)) {
       use_index_hints_ = true;
@@ -338,12 +362,20 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   bool PostVisit(Expand &expand) override {
     auto card_param = CardParam::kExpand;
     auto stats = GetStatsFor(expand.input_symbol_);
-
-    if (stats.has_value()) {
-      card_param = stats.value().degree;
+    auto edge_types_degree = stats ? EdgeTypesDegree(*stats, expand.common_) : std::nullopt;
+    // The degree by edge type from the statistics, then the degree observed by
+    // executing plans, then the average degree of the label
+    if (edge_types_degree) {
+      card_param = *edge_types_degree;
+    } else if (auto observed = cardinality_feedback_ ? cardinality_feedback_->ExpandDegree(expand.common_)
+                                                     : std::nullopt) {
+      card_param = *observed;
+    } else if (stats) {
+      card_param = stats->degree;
     }
 
     cardinality_ *= card_param;
+    operator_cardinalities_[&expand] = cardinality_;
     IncrementCost(CostParam::kExpand);
 
     return true;
@@ -427,8 +459,8 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     for (const auto &symbol : op.ModifiedSymbols(table_)) {
       auto stats = GetStatsFor(symbol);
       if (stats.has_value()) {
-        scope.symbol_stats[symbol.name()] =
-            SymbolStatistics{.count = stats.value().count, .degree = stats.value().degree};
+        scope.symbol_stats[symbol.name()] = SymbolStatistics{
+            .count = stats.value().count, .degree = stats.value().degree, .label = stats.value().label};
       }
     }
 
@@ -445,7 +477,8 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
       total_branch_cost += pattern_estimation.cost;
     }
     IncrementCost(std::max(total_branch_cost, CostParam::kFilter));
-    cardinality_ *= CardParam::kFilter;
+    cardinality_ *= FilterSelectivity(op.all_filters_);
+    operator_cardinalities_[&op] = cardinality_;
     return false;
   }
 
@@ -520,6 +553,9 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   auto cost() const { return cost_; }
   auto cardinality() const { return cardinality_; }
   auto use_index_hints() const { return use_index_hints_; }
+  // Estimated number of rows produced by the scans, expansions and filters of
+  // the main branch
+  const auto &operator_cardinalities() const { return operator_cardinalities_; }
 
  private:
   // cost estimation that gets accumulated as the visitor
@@ -537,17 +573,20 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   std::vector<Scope> scopes_;
   IndexHints index_hints_;
   bool use_index_hints_{false};
+  const CardinalityFeedback *cardinality_feedback_;
+  std::unordered_map<const LogicalOperator *, double> operator_cardinalities_;
 
   void IncrementCost(double param) { cost_ += std::max(CostParam::kMinimumCost, param * cardinality_); }
 
   CostEstimation EstimateCostOnBranch(std::shared_ptr<LogicalOperator> *branch) {
-    CostEstimator<TDbAccessor> cost_estimator(db_accessor_, table_, parameters, index_hints_);
+    CostEstimator<TDbAccessor> cost_estimator(db_accessor_, table_, parameters, index_hints_, cardinality_feedback_);
     (*branch)->Accept(cost_estimator);
     return CostEstimation{.cost = cost_estimator.cost(), .cardinality = cost_estimator.cardinality()};
   }
 
   CostEstimation EstimateCostOnBranch(std::shared_ptr<LogicalOperator> const *branch, Scope scope) {
-    CostEstimator<TDbAccessor> cost_estimator(db_accessor_, table_, parameters, scope, index_hints_);
+    CostEstimator<TDbAccessor> cost_estimator(db_accessor_, table_, parameters, scope, index_hints_,
+                                              cardinality_feedback_);
     (*branch)->Accept(cost_estimator);
     return CostEstimation{.cost = cost_estimator.cost(), .cardinality = cost_estimator.cardinality()};
   }
@@ -591,19 +630,108 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   }
 
   template <typename T>
-  void SaveStatsFor(const Symbol &symbol, T index_stats) {
+  void SaveStatsFor(const Symbol &symbol, storage::LabelId label, T index_stats) {
     scopes_.back().symbol_stats[symbol.name()] = SymbolStatistics{
         .count = index_stats.count,
         .degree = index_stats.avg_degree,
+        .label = label,
     };
   }
+
+  // Degree over the expanded edge types and direction, if ANALYZE GRAPH
+  // computed the degrees by edge type for the label of the input symbol. The
+  // degree of the label is scaled to the vertices the symbol stats describe.
+  std::optional<double> EdgeTypesDegree(const SymbolStatistics &stats, const ExpandCommon &common) {
+    if (!stats.label) return std::nullopt;
+    auto label_stats = db_accessor_->GetIndexStats(*stats.label);
+    if (!label_stats) return std::nullopt;
+    auto degree = storage::AverageDegree(*label_stats, common.edge_types, common.direction != EdgeAtom::Direction::IN,
+                                         common.direction != EdgeAtom::Direction::OUT);
+    if (!degree) return std::nullopt;
+    if (label_stats->avg_degree > 0) *degree *= stats.degree / label_stats->avg_degree;
+    return degree;
+  }
+
+  // Product of the selectivities of the property filters which can be
+  // estimated from the index statistics. All of the other filters together
+  // are estimated with the filtering constant. If none of the filters can be
+  // estimated, the selectivity observed by executing plans is used instead.
+  double FilterSelectivity(const Filters &filters) {
+    double selectivity = 1.0;
+    bool estimated = false;
+    bool other_filters = filters.empty();
+    for (const auto &filter : filters) {
+      auto filter_selectivity = PropertyFilterSelectivity(filter, filters);
+      if (filter_selectivity) {
+        selectivity *= *filter_selectivity;
+        estimated = true;
+      } else {
+        other_filters = true;
+      }
+    }
+    if (!estimated) {
+      auto observed = cardinality_feedback_ ? cardinality_feedback_->FilterSelectivity(filters) : std::nullopt;
+      return observed.value_or(CardParam::kFilter);
+    }
+    return other_filters ? selectivity * CardParam::kFilter : selectivity;
+  }
+
+  std::optional<double> PropertyFilterSelectivity(const FilterInfo &filter, const Filters &filters) {
+    if (filter.type != FilterInfo::Type::Property || !filter.property_filter) return std::nullopt;
+    const auto &property_filter = *filter.property_filter;
+    using PropertyFilterType = PropertyFilter::Type;
+    if (property_filter.type_ != PropertyFilterType::EQUAL && property_filter.type_ != PropertyFilterType::RANGE) {
+      return std::nullopt;
+    }
+
+    // The statistics of an index on the filtered property and any of the
+    // known labels of the symbol
+    std::vector<storage::LabelId> labels;
+    for (const auto &label : filters.FilteredLabels(property_filter.symbol_)) {
+      labels.push_back(db_accessor_->NameToLabel(label.name));
+    }
+    if (auto stats = GetStatsFor(property_filter.symbol_); stats && stats->label) labels.push_back(*stats->label);
+    auto property_path = storage::PropertyPath{property_filter.property_ids_.path |
+                                               ranges::views::transform([&](const PropertyIx &property) {
+                                                 return db_accessor_->NameToProperty(property.name);
+                                               }) |
+                                               ranges::to_vector};
+    std::optional<storage::LabelPropertyIndexStats> index_stats;
+    storage::LabelId stats_label;
+    for (auto label : labels) {
+      index_stats = db_accessor_->GetIndexStats(label, std::span{&property_path, 1});
+      if (index_stats) {
+        stats_label = label;
+        break;
+      }
+    }
+    if (!index_stats || index_stats->count == 0) return std::nullopt;
+    // The vertices without the property aren't in the index and never pass the filter
+    auto label_count = std::max(db_accessor_->VerticesCount(stats_label), int64_t{1});
+    auto indexed_fraction = std::min(static_cast<double>(index_stats->count) / static_cast<double>(label_count), 1.0);
+
+    if (property_filter.type_ == PropertyFilterType::EQUAL) {
+      auto value = ConstPropertyValue(property_filter.value_);
+      if (!value) return indexed_fraction * index_stats->avg_group_size / static_cast<double>(index_stats->count);
+      auto key = std::vector{storage::ToPropertyValue(*value, db_accessor_->GetStorageAccessor()->GetNameIdMapper())};
+      return indexed_fraction * storage::EstimateEqualFraction(*index_stats, key);
+    }
+
+    auto lower = BoundToPropertyValue(property_filter.lower_bound_);
+    auto upper = BoundToPropertyValue(property_filter.upper_bound_);
+    if ((property_filter.lower_bound_ && !lower) || (property_filter.upper_bound_ && !upper)) return std::nullopt;
+    auto range_fraction = storage::EstimateRangeFraction(*index_stats, lower, upper);
+    if (!range_fraction) return std::nullopt;
+    return indexed_fraction * *range_fraction;
+  }
 };
 
 /** Returns the estimated cost of the given plan. */
 template <class TDbAccessor>
 PlanCost EstimatePlanCost(TDbAccessor *db, const SymbolTable &table, const Parameters &parameters,
-                          LogicalOperator &plan, const IndexHints &index_hints) {
-  CostEstimator<TDbAccessor> estimator(db, table, parameters, index_hints);
+                          LogicalOperator &plan, const IndexHints &index_hints,
+                          const CardinalityFeedback *cardinality_feedback = nullptr) {
+  CostEstimator<TDbAccessor> estimator(db, table, parameters, index_hints, cardinality_feedback);
   plan.Accept(estimator);
   return PlanCost{.cost = estimator.cost(), .use_index_hints = estimator.use_index_hints()};
 }
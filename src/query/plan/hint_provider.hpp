@@ -186,6 +186,9 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
   bool PreVisit(OrderBy & /*unused*/) override { return true; }
   bool PostVisit(OrderBy & /*unused*/) override { return true; }
 
+  bool PreVisit(TopK & /*unused*/) override { return true; }
+  bool PostVisit(TopK & /*unused*/) override { return true; }
+
   bool PreVisit(Unwind & /*unused*/) override { return true; }
   bool PostVisit(Unwind & /*unused*/) override { return true; }
 
@@ -244,6 +247,9 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
   bool PreVisit(PeriodicCommit & /*unused*/) override { return true; }
   bool PostVisit(PeriodicCommit & /*unused*/) override { return true; }
 
+  bool PreVisit(Gather & /*unused*/) override { return true; }
+  bool PostVisit(Gather & /*unused*/) override { return true; }
+
   bool PreVisit(PeriodicSubquery &op) override {
     op.input()->Accept(*this);
     op.subquery_->Accept(*this);
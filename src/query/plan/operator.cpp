@@ -12,11 +12,18 @@
 #include "query/plan/operator.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <queue>
+#include <span>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -40,8 +47,11 @@
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/graph.hpp"
 #include "query/interpret/eval.hpp"
+#include "query/interpret/frame_batch.hpp"
 #include "query/path.hpp"
+#include "query/plan/rewrite/parallel.hpp"
 #include "query/plan/scoped_profile.hpp"
+#include "query/plan/spill.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
 #include "query/typed_value.hpp"
@@ -50,6 +60,7 @@
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/property_value_utils.hpp"
 #include "storage/v2/storage_error.hpp"
+#include "storage/v2/vertex_info_cache.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/event_counter.hpp"
@@ -71,6 +82,7 @@
 #include "utils/readable_size.hpp"
 #include "utils/tag.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread_pool.hpp"
 #include "vertex_accessor.hpp"
 
 namespace r = ranges;
@@ -137,6 +149,7 @@ extern const Event AggregateOperator;
 extern const Event SkipOperator;
 extern const Event LimitOperator;
 extern const Event OrderByOperator;
+extern const Event TopKOperator;
 extern const Event MergeOperator;
 extern const Event OptionalOperator;
 extern const Event UnwindOperator;
@@ -153,6 +166,7 @@ extern const Event HashJoinOperator;
 extern const Event RollUpApplyOperator;
 extern const Event PeriodicCommitOperator;
 extern const Event PeriodicSubqueryOperator;
+extern const Event GatherOperator;
 }  // namespace memgraph::metrics
 
 namespace memgraph::query::plan {
@@ -422,6 +436,48 @@ storage::EdgeTypeId EvaluateEdgeType(const StorageEdgeType &edge_type, Expressio
       context.is_profile_query ? std::optional<ScopedProfile>(std::in_place, ComputeProfilingKey(this), ref, &context) \
                                : std::nullopt;
 
+bool Cursor::PullBatch(FrameBatch &batch, Frame &frame, ExecutionContext &context) {
+  batch.Clear();
+  while (!batch.full() && Pull(frame, context)) batch.Append(frame);
+  return !batch.empty();
+}
+
+BatchedInput::BatchedInput() = default;
+BatchedInput::BatchedInput(BatchedInput &&) noexcept = default;
+BatchedInput &BatchedInput::operator=(BatchedInput &&) noexcept = default;
+BatchedInput::~BatchedInput() = default;
+
+void BatchedInput::Enable(int64_t frame_size, size_t capacity, utils::MemoryResource *mem) {
+  if (input_frame_) return;
+  input_frame_ = std::make_unique<Frame>(frame_size, mem);
+  capacity_ = capacity;
+}
+
+bool BatchedInput::Pull(Cursor &input, Frame &frame, ExecutionContext &context) {
+  if (!input_frame_) return input.Pull(frame, context);
+  if (!buffer_) {
+    buffer_ = std::make_unique<FrameBatch>(input_frame_->elems().size(), capacity_, input_frame_->get_allocator());
+  }
+  while (position_ == buffer_->size()) {
+    if (!PullBatch(input, *buffer_, context)) return false;
+    position_ = 0;
+  }
+  buffer_->MoveRowToFrame(position_++, frame);
+  return true;
+}
+
+bool BatchedInput::PullBatch(Cursor &input, FrameBatch &batch, ExecutionContext &context) {
+  DMG_ASSERT(input_frame_, "BatchedInput must be enabled before pulling batches");
+  return input.PullBatch(batch, *input_frame_, context);
+}
+
+void BatchedInput::Reset() {
+  input_frame_.reset();
+  buffer_.reset();
+  capacity_ = 0;
+  position_ = 0;
+}
+
 bool Once::OnceCursor::Pull(Frame &, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP("Once");
@@ -743,6 +799,31 @@ VertexAccessor &CreateExpand::CreateExpandCursor::OtherVertex(Frame &frame, Exec
   }
 }
 
+/// Hands out morsels (chunks) of vertices of a single scan operator to the
+/// cursors running in different threads. See `Gather`.
+class MorselSource {
+ public:
+  MorselSource(const ScanAll &scan, storage::VerticesChunkedIterable vertices)
+      : scan_(&scan), vertices_(std::move(vertices)) {}
+
+  bool IsFor(const ScanAll &scan) const { return scan_ == &scan; }
+
+  /// Thread-safe; returns std::nullopt once all morsels were handed out.
+  std::optional<storage::VerticesChunkedIterable::Chunk> Next() {
+    const auto id = next_.fetch_add(1, std::memory_order_acq_rel);
+    if (id >= vertices_.size()) return std::nullopt;
+    return vertices_.get_chunk(id);
+  }
+
+  /// Stop handing out morsels; those already taken are still processed.
+  void Cancel() { next_.store(vertices_.size(), std::memory_order_release); }
+
+ private:
+  const ScanAll *scan_;
+  storage::VerticesChunkedIterable vertices_;
+  std::atomic<size_t> next_{0};
+};
+
 template <class TVerticesFun>
 class ScanAllCursor : public Cursor {
  public:
@@ -761,25 +842,18 @@ class ScanAllCursor : public Cursor {
 
     AbortCheck(context);
 
-    while (!vertices_ || vertices_it_.value() == vertices_end_it_.value()) {
-      if (!input_cursor_->Pull(frame, context)) return false;
-      // We need a getter function, because in case of exhausting a lazy
-      // iterable, we cannot simply reset it by calling begin().
-      auto next_vertices = get_vertices_(frame, context);
-      if (!next_vertices) continue;
-      vertices_ = std::move(next_vertices);
-      vertices_it_.emplace(vertices_.value().begin());
-      vertices_end_it_.emplace(vertices_.value().end());
-    }
-#ifdef MG_ENTERPRISE
-    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker && !FindNextVertex(context)) {
-      return false;
-    }
-#endif
+    return PullNext(frame, context);
+  }
 
-    frame[output_symbol_] = *vertices_it_.value();
-    ++vertices_it_.value();
-    return true;
+  bool PullBatch(FrameBatch &batch, Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    AbortCheck(context);
+
+    batch.Clear();
+    while (!batch.full() && PullNext(frame, context)) batch.Append(frame);
+    return !batch.empty();
   }
 
 #ifdef MG_ENTERPRISE
@@ -802,9 +876,57 @@ class ScanAllCursor : public Cursor {
     vertices_ = std::nullopt;
     vertices_it_ = std::nullopt;
     vertices_end_it_ = std::nullopt;
+    morsel_input_pulled_ = false;
+    morsel_it_ = std::nullopt;
+    morsel_end_it_ = std::nullopt;
+    morsel_ = std::nullopt;
   }
 
  private:
+  bool PullNext(Frame &frame, ExecutionContext &context) {
+    if (context.morsel_source && context.morsel_source->IsFor(self_)) [[unlikely]] {
+      return PullMorsel(frame, context);
+    }
+
+    while (!vertices_ || vertices_it_.value() == vertices_end_it_.value()) {
+      if (!input_cursor_->Pull(frame, context)) return false;
+      // We need a getter function, because in case of exhausting a lazy
+      // iterable, we cannot simply reset it by calling begin().
+      auto next_vertices = get_vertices_(frame, context);
+      if (!next_vertices) continue;
+      vertices_ = std::move(next_vertices);
+      vertices_it_.emplace(vertices_.value().begin());
+      vertices_end_it_.emplace(vertices_.value().end());
+    }
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker && !FindNextVertex(context)) {
+      return false;
+    }
+#endif
+
+    frame[output_symbol_] = *vertices_it_.value();
+    ++vertices_it_.value();
+    return true;
+  }
+
+  // The planner only parallelizes scans over `Once`, so the input is pulled a
+  // single time and afterwards the vertices come from the shared morsels.
+  bool PullMorsel(Frame &frame, ExecutionContext &context) {
+    if (!morsel_input_pulled_) {
+      if (!input_cursor_->Pull(frame, context)) return false;
+      morsel_input_pulled_ = true;
+    }
+    while (!morsel_ || morsel_it_.value() == morsel_end_it_.value()) {
+      morsel_ = context.morsel_source->Next();
+      if (!morsel_) return false;
+      morsel_it_.emplace(morsel_->begin());
+      morsel_end_it_.emplace(morsel_->end());
+    }
+    frame[output_symbol_] = VertexAccessor(*morsel_it_.value());
+    ++morsel_it_.value();
+    return true;
+  }
+
   const ScanAll &self_;
   const Symbol output_symbol_;
   const UniqueCursorPtr input_cursor_;
@@ -814,6 +936,10 @@ class ScanAllCursor : public Cursor {
   std::optional<decltype(vertices_.value().begin())> vertices_it_;
   std::optional<decltype(vertices_.value().end())> vertices_end_it_;
   const char *op_name_;
+  bool morsel_input_pulled_{false};
+  std::optional<storage::VerticesChunkedIterable::Chunk> morsel_;
+  std::optional<storage::VerticesChunkedIterable::Iterator> morsel_it_;
+  std::optional<storage::VerticesChunkedIterable::Iterator> morsel_end_it_;
 };
 template <typename TEdgesFun>
 class ScanAllByEdgeCursor : public Cursor {
@@ -1597,6 +1723,20 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP_BY_REF(self_);
 
+  return PullNext(frame, context);
+}
+
+bool Expand::ExpandCursor::PullBatch(FrameBatch &batch, Frame &frame, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  input_.Enable(batch.frame_size(), batch.capacity(), batch.get_allocator().resource());
+  batch.Clear();
+  while (!batch.full() && PullNext(frame, context)) batch.Append(frame);
+  return !batch.empty();
+}
+
+bool Expand::ExpandCursor::PullNext(Frame &frame, ExecutionContext &context) {
   // A helper function for expanding a node from an edge.
   auto pull_node = [this, &frame]<EdgeAtom::Direction direction>(const EdgeAccessor &new_edge,
                                                                  utils::tag_value<direction>) {
@@ -1661,6 +1801,7 @@ void Expand::ExpandCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Expand::ExpandCursor::Reset() {
   input_cursor_->Reset();
+  input_.Reset();
   in_edges_ = std::nullopt;
   in_edges_it_ = std::nullopt;
   out_edges_ = std::nullopt;
@@ -1721,7 +1862,7 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
   // Input Vertex could be null if it is created by a failed optional match. In
   // those cases we skip that input pull and continue with the next.
   while (true) {
-    if (!input_cursor_->Pull(frame, context)) return false;
+    if (!input_.Pull(*input_cursor_, frame, context)) return false;
 
     if (context.hops_limit.IsLimitReached()) return false;
 
@@ -1741,14 +1882,14 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
           auto existing_node = *expansion_info_.existing_node;
 
           auto edges_result = UnwrapEdgesResult(
-              vertex.InEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
+              vertex.InEdgesRange(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
           context.number_of_hops += edges_result.expanded_count;
           in_edges_.emplace(std::move(edges_result.edges));
           num_expanded_first = edges_result.expanded_count;
         }
       } else {
         auto edges_result =
-            UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types, &context.hops_limit));
+            UnwrapEdgesResult(vertex.InEdgesRange(self_.view_, self_.common_.edge_types, &context.hops_limit));
         context.number_of_hops += edges_result.expanded_count;
         in_edges_.emplace(std::move(edges_result.edges));
         num_expanded_first = edges_result.expanded_count;
@@ -1764,14 +1905,14 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
         if (expansion_info_.existing_node) {
           auto existing_node = *expansion_info_.existing_node;
           auto edges_result = UnwrapEdgesResult(
-              vertex.OutEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
+              vertex.OutEdgesRange(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
           context.number_of_hops += edges_result.expanded_count;
           out_edges_.emplace(std::move(edges_result.edges));
           num_expanded_second = edges_result.expanded_count;
         }
       } else {
         auto edges_result =
-            UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types, &context.hops_limit));
+            UnwrapEdgesResult(vertex.OutEdgesRange(self_.view_, self_.common_.edge_types, &context.hops_limit));
         context.number_of_hops += edges_result.expanded_count;
         out_edges_.emplace(std::move(edges_result.edges));
         num_expanded_second = edges_result.expanded_count;
@@ -2127,10 +2268,226 @@ class ExpandVariableCursor : public Cursor {
   }
 };
 
+namespace {
+
+// Monotonic memory used by a single worker thread, same as the execution
+// memory of the main thread.
+constexpr size_t kWorkerMemoryBlockSize = 1UL * 1024UL * 1024UL;
+
+/// Everything a worker needs to build its own `ExecutionContext`. The
+/// `ExecutionContext` of the main thread is mutated during execution and can't
+/// be shared.
+struct WorkerContext {
+  DbAccessor *db_accessor{nullptr};
+  SymbolTable symbol_table;
+  int64_t timestamp{-1};
+  Parameters parameters;
+  std::vector<storage::PropertyId> properties;
+  std::vector<storage::LabelId> labels;
+  StoppingContext stopping_context;
+  std::shared_ptr<QueryUserOrRole> user_or_role;
+};
+
+WorkerContext MakeWorkerContext(const ExecutionContext &context) {
+  return WorkerContext{
+      .db_accessor = context.db_accessor,
+      .symbol_table = context.symbol_table,
+      .timestamp = context.evaluation_context.timestamp,
+      .parameters = context.evaluation_context.parameters,
+      .properties = context.evaluation_context.properties,
+      .labels = context.evaluation_context.labels,
+      .stopping_context = context.stopping_context,
+      .user_or_role = context.user_or_role,
+  };
+}
+
+ExecutionContext MakeWorkerExecutionContext(const WorkerContext &worker_context, utils::MemoryResource *memory) {
+  ExecutionContext context;
+  context.db_accessor = worker_context.db_accessor;
+  context.symbol_table = worker_context.symbol_table;
+  context.evaluation_context.memory = memory;
+  context.evaluation_context.timestamp = worker_context.timestamp;
+  context.evaluation_context.parameters = worker_context.parameters;
+  context.evaluation_context.properties = worker_context.properties;
+  context.evaluation_context.labels = worker_context.labels;
+  context.stopping_context = worker_context.stopping_context;
+  context.user_or_role = worker_context.user_or_role;
+  return context;
+}
+
+bool CanUseWorkerPool(const ExecutionContext &context) {
+  if (context.worker_pool == nullptr) return false;
+  // Profiling, hops limit and fine-grained access control keep per query
+  // state in the `ExecutionContext` which can't be split between threads.
+  if (context.is_profile_query || context.hops_limit.IsUsed()) return false;
+#ifdef MG_ENTERPRISE
+  if (context.auth_checker) return false;
+#endif
+  const auto storage_mode = context.db_accessor->GetStorageMode();
+  return storage_mode == storage::StorageMode::IN_MEMORY_TRANSACTIONAL ||
+         storage_mode == storage::StorageMode::IN_MEMORY_ANALYTICAL;
+}
+
+/// State shared between `RunOnWorkerPool` and the tasks it scheduled. A task
+/// may start after `RunOnWorkerPool` returned, so a task only touches the
+/// caller's state after successfully registering itself as running.
+struct WorkerPoolRunState {
+  std::mutex lock;
+  std::condition_variable cv;
+  bool closed{false};
+  uint64_t running{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+};
+
+/// Runs `worker` on the calling thread and on up to `num_workers - 1` threads
+/// of the worker pool, which split the work between themselves. A worker gets
+/// the flag which is set once any of them failed. The tasks which didn't start
+/// until the calling thread is done are skipped, so a busy pool doesn't delay
+/// the query. The first exception thrown by a worker is rethrown.
+template <typename TWorker>
+void RunOnWorkerPool(ExecutionContext &context, uint64_t num_workers, const TWorker &worker) {
+  auto state = std::make_shared<WorkerPoolRunState>();
+  auto run = [&worker](WorkerPoolRunState &run_state) {
+    try {
+      worker(run_state.failed);
+    } catch (...) {
+      run_state.failed.store(true, std::memory_order_release);
+      std::lock_guard guard(run_state.lock);
+      if (!run_state.error) run_state.error = std::current_exception();
+    }
+  };
+
+  for (uint64_t i = 1; i < num_workers; ++i) {
+    context.worker_pool->AddTask([state, &run, db_accessor = context.db_accessor] {
+      {
+        std::lock_guard guard(state->lock);
+        if (state->closed) return;
+        ++state->running;
+      }
+      const utils::OnScopeExit unregister{[&state] {
+        std::lock_guard guard(state->lock);
+        --state->running;
+        state->cv.notify_all();
+      }};
+      db_accessor->TrackCurrentThreadAllocations();
+      const utils::OnScopeExit untrack{[] { memgraph::memory::StopTrackingCurrentThread(); }};
+      // The transaction's cache of long delta chains is used by the calling thread at the same time
+      const storage::ThreadVertexInfoCache thread_cache;
+      run(*state);
+    });
+  }
+  run(*state);
+
+  std::unique_lock guard(state->lock);
+  state->closed = true;
+  state->cv.wait(guard, [&state] { return state->running == 0; });
+  if (state->error) std::rethrow_exception(state->error);
+}
+
+/// An edge of a breadth-first expansion frontier vertex and the vertex on its
+/// other end.
+struct FrontierEdge {
+  EdgeAccessor edge;
+  VertexAccessor vertex;
+};
+
+// Frontier vertices a worker takes at a time.
+constexpr size_t kFrontierChunkSize = 64;
+
+/// Whether a level of a breadth-first expansion is expanded in parallel. The
+/// filter lambda is evaluated by all of the workers, so it has to be safe for
+/// that (see `impl::IsParallelSafe`).
+bool ShouldExpandInParallel(size_t frontier_size, bool parallel_safe_filter, const ExecutionContext &context) {
+  return parallel_safe_filter && FLAGS_query_parallel_workers > 1 &&
+         frontier_size >= FLAGS_query_parallel_expansion_min_frontier && CanUseWorkerPool(context);
+}
+
+/// Expands all vertices of a breadth-first expansion frontier on the calling
+/// thread and the worker pool. Every worker has its own copy of `frame` and
+/// calls `keep(frontier_vertex, edge, other_vertex, frame, evaluator)` to
+/// decide which edges are kept, so `keep` may evaluate the filter lambda but
+/// must not modify the cursor. The edges are returned in the frontier order.
+template <typename TKeep>
+std::vector<FrontierEdge> ExpandFrontierInParallel(std::span<const VertexAccessor> frontier,
+                                                   const ExpandVariable &self, bool expand_out, bool expand_in,
+                                                   const Frame &frame, ExecutionContext &context, const TKeep &keep) {
+  const auto chunk_count = (frontier.size() + kFrontierChunkSize - 1) / kFrontierChunkSize;
+  std::vector<std::vector<FrontierEdge>> chunks(chunk_count);
+  std::atomic<size_t> next_chunk{0};
+  std::atomic<int64_t> number_of_hops{0};
+  const auto worker_context = MakeWorkerContext(context);
+
+  RunOnWorkerPool(context, FLAGS_query_parallel_workers, [&](const std::atomic<bool> &failed) {
+    utils::MonotonicBufferResource memory(kWorkerMemoryBlockSize);
+    auto worker_execution_context = MakeWorkerExecutionContext(worker_context, &memory);
+    Frame worker_frame(static_cast<int64_t>(frame.elems().size()), &memory);
+    std::ranges::copy(frame.elems(), worker_frame.elems().begin());
+    ExpressionEvaluator evaluator(&worker_frame, worker_execution_context.symbol_table,
+                                  worker_execution_context.evaluation_context, worker_execution_context.db_accessor,
+                                  storage::View::OLD, nullptr, &worker_execution_context.number_of_hops);
+
+    while (!failed.load(std::memory_order_acquire)) {
+      const auto chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= chunk_count) break;
+      AbortCheck(worker_execution_context);
+      auto &edges = chunks[chunk];
+      const auto first = chunk * kFrontierChunkSize;
+      for (const auto &vertex : frontier.subspan(first, std::min(kFrontierChunkSize, frontier.size() - first))) {
+        if (expand_out) {
+          auto out_edges_result = UnwrapEdgesResult(vertex.OutEdgesRange(storage::View::OLD, self.common_.edge_types));
+          worker_execution_context.number_of_hops += out_edges_result.expanded_count;
+          for (const auto &edge : out_edges_result.edges) {
+            auto to = edge.To();
+            if (keep(vertex, edge, to, worker_frame, evaluator)) edges.push_back({edge, to});
+          }
+        }
+        if (expand_in) {
+          auto in_edges_result = UnwrapEdgesResult(vertex.InEdgesRange(storage::View::OLD, self.common_.edge_types));
+          worker_execution_context.number_of_hops += in_edges_result.expanded_count;
+          for (const auto &edge : in_edges_result.edges) {
+            auto from = edge.From();
+            if (keep(vertex, edge, from, worker_frame, evaluator)) edges.push_back({edge, from});
+          }
+        }
+      }
+    }
+    number_of_hops.fetch_add(worker_execution_context.number_of_hops, std::memory_order_relaxed);
+  });
+  context.number_of_hops += number_of_hops.load(std::memory_order_relaxed);
+
+  size_t edge_count = 0;
+  for (const auto &edges : chunks) edge_count += edges.size();
+  std::vector<FrontierEdge> result;
+  result.reserve(edge_count);
+  for (auto &edges : chunks) {
+    result.insert(result.end(), edges.begin(), edges.end());
+    edges = {};
+  }
+  return result;
+}
+
+/// Evaluates the filter lambda of a breadth-first expansion for the given
+/// edge and vertex; null counts as false.
+bool EvaluateExpansionFilter(const ExpansionLambda &filter_lambda, const EdgeAccessor &edge,
+                             const VertexAccessor &vertex, Frame &frame, ExpressionEvaluator &evaluator) {
+  if (!filter_lambda.expression) return true;
+  frame[filter_lambda.inner_edge_symbol] = edge;
+  frame[filter_lambda.inner_node_symbol] = vertex;
+  TypedValue result = filter_lambda.expression->Accept(evaluator);
+  if (result.IsNull()) return false;
+  if (result.IsBool()) return result.ValueBool();
+  throw QueryRuntimeException("Expansion condition must evaluate to boolean or null.");
+}
+
+}  // namespace
+
 class STShortestPathCursor : public query::plan::Cursor {
  public:
   STShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input()->MakeCursor(mem)) {
+      : self_(self),
+        input_cursor_(self_.input()->MakeCursor(mem)),
+        can_expand_in_parallel_(impl::IsParallelSafe(self_.filter_lambda_.expression)) {
     MG_ASSERT(self_.common_.existing_node,
               "s-t shortest path algorithm should only "
               "be used when `existing_node` flag is "
@@ -2180,6 +2537,9 @@ class STShortestPathCursor : public query::plan::Cursor {
  private:
   const ExpandVariable &self_;
   UniqueCursorPtr input_cursor_;
+  // Frontiers can be expanded on multiple threads only if the filter lambda
+  // can be evaluated by them
+  const bool can_expand_in_parallel_;
 
   using VertexEdgeMapT = utils::pmr::unordered_map<VertexAccessor, std::optional<EdgeAccessor>>;
 
@@ -2252,17 +2612,49 @@ class STShortestPathCursor : public query::plan::Cursor {
     sink_frontier.emplace_back(sink);
     out_edge[sink] = std::nullopt;
 
+    // Records the vertices reached from one side by a parallel expansion, in
+    // the same way as the serial expansion below. Returns whether the path was
+    // found once the expansions from both sides meet.
+    auto merge_expansions = [&](const std::vector<FrontierEdge> &edges, VertexEdgeMapT &visited,
+                                const VertexEdgeMapT &visited_from_other_side,
+                                utils::pmr::vector<VertexAccessor> &next) -> std::optional<bool> {
+      for (const auto &[edge, vertex] : edges) {
+        if (Contains(visited, vertex)) continue;
+        visited.emplace(vertex, edge);
+        if (Contains(visited_from_other_side, vertex)) {
+          if (current_length < lower_bound) return false;
+          ReconstructPath(vertex, in_edge, out_edge, frame, pull_memory);
+          return true;
+        }
+        next.push_back(vertex);
+      }
+      return std::nullopt;
+    };
+
     while (true) {
       AbortCheck(context);
       // Top-down step (expansion from the source).
       ++current_length;
       if (current_length > upper_bound) return false;
 
+      if (ShouldExpandInParallel(source_frontier.size(), can_expand_in_parallel_, context)) {
+        // `in_edge` isn't modified until all of the workers are done.
+        auto edges = ExpandFrontierInParallel(
+            source_frontier, self_, self_.common_.direction != EdgeAtom::Direction::IN,
+            self_.common_.direction != EdgeAtom::Direction::OUT, *frame, context,
+            [this, &in_edge](const VertexAccessor & /*from*/, const EdgeAccessor &edge, const VertexAccessor &vertex,
+                             Frame &worker_frame, ExpressionEvaluator &worker_evaluator) {
+              return !Contains(in_edge, vertex) && ShouldExpand(vertex, edge, &worker_frame, &worker_evaluator);
+            });
+        if (auto found = merge_expansions(edges, in_edge, out_edge, source_next)) return *found;
+        // Nothing is left for the serial expansion.
+        source_frontier.clear();
+      }
       for (const auto &vertex : source_frontier) {
         if (context.hops_limit.IsLimitReached()) break;
         if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          auto out_edges_result =
-              UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+          auto out_edges_result = UnwrapEdgesResult(
+              vertex.OutEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
           context.number_of_hops += out_edges_result.expanded_count;
           for (const auto &edge : out_edges_result.edges) {
 #ifdef MG_ENTERPRISE
@@ -2289,7 +2681,7 @@ class STShortestPathCursor : public query::plan::Cursor {
         }
         if (self_.common_.direction != EdgeAtom::Direction::OUT) {
           auto in_edges_result =
-              UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+              UnwrapEdgesResult(vertex.InEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
           context.number_of_hops += in_edges_result.expanded_count;
           for (const auto &edge : in_edges_result.edges) {
 #ifdef MG_ENTERPRISE
@@ -2327,11 +2719,24 @@ class STShortestPathCursor : public query::plan::Cursor {
       // When expanding from the sink we have to be careful which edge
       // endpoint we pass to `should_expand`, because everything is
       // reversed.
+      if (ShouldExpandInParallel(sink_frontier.size(), can_expand_in_parallel_, context)) {
+        // `out_edge` isn't modified until all of the workers are done.
+        auto edges = ExpandFrontierInParallel(
+            sink_frontier, self_, self_.common_.direction != EdgeAtom::Direction::OUT,
+            self_.common_.direction != EdgeAtom::Direction::IN, *frame, context,
+            [this, &out_edge](const VertexAccessor &from, const EdgeAccessor &edge, const VertexAccessor &vertex,
+                              Frame &worker_frame, ExpressionEvaluator &worker_evaluator) {
+              return !Contains(out_edge, vertex) && ShouldExpand(from, edge, &worker_frame, &worker_evaluator);
+            });
+        if (auto found = merge_expansions(edges, out_edge, in_edge, sink_next)) return *found;
+        // Nothing is left for the serial expansion.
+        sink_frontier.clear();
+      }
       for (const auto &vertex : sink_frontier) {
         if (context.hops_limit.IsLimitReached()) break;
         if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          auto out_edges_result =
-              UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+          auto out_edges_result = UnwrapEdgesResult(
+              vertex.OutEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
           context.number_of_hops += out_edges_result.expanded_count;
           for (const auto &edge : out_edges_result.edges) {
 #ifdef MG_ENTERPRISE
@@ -2358,7 +2763,7 @@ class STShortestPathCursor : public query::plan::Cursor {
         }
         if (self_.common_.direction != EdgeAtom::Direction::IN) {
           auto in_edges_result =
-              UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+              UnwrapEdgesResult(vertex.InEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
           context.number_of_hops += in_edges_result.expanded_count;
           for (const auto &edge : in_edges_result.edges) {
 #ifdef MG_ENTERPRISE
@@ -2399,7 +2804,9 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         input_cursor_(self_.input()->MakeCursor(mem)),
         processed_(mem),
         to_visit_next_(mem),
-        to_visit_current_(mem) {
+        to_visit_current_(mem),
+        can_expand_in_parallel_(impl::IsParallelSafe(self_.filter_lambda_.expression) &&
+                                !self_.filter_lambda_.accumulated_path_symbol) {
     MG_ASSERT(!self_.common_.existing_node,
               "Single source shortest path algorithm "
               "should not be used when `existing_node` "
@@ -2468,7 +2875,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     auto expand_from_vertex = [this, &expand_pair, &restore_frame_state_after_expansion, &context](const auto &vertex) {
       if (self_.common_.direction != EdgeAtom::Direction::IN) {
         auto out_edges_result =
-            UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+            UnwrapEdgesResult(vertex.OutEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
         context.number_of_hops += out_edges_result.expanded_count;
         for (const auto &edge : out_edges_result.edges) {
           bool was_expanded = expand_pair(edge, edge.To());
@@ -2477,7 +2884,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
       }
       if (self_.common_.direction != EdgeAtom::Direction::OUT) {
         auto in_edges_result =
-            UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+            UnwrapEdgesResult(vertex.InEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
         context.number_of_hops += in_edges_result.expanded_count;
         for (const auto &edge : in_edges_result.edges) {
           bool was_expanded = expand_pair(edge, edge.From());
@@ -2490,7 +2897,15 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     while (true) {
       AbortCheck(context);
       // if we have nothing to visit on the current depth, switch to next
-      if (to_visit_current_.empty()) to_visit_current_.swap(to_visit_next_);
+      if (to_visit_current_.empty() && !to_visit_next_.empty()) {
+        to_visit_current_.swap(to_visit_next_);
+        ++depth_;
+        current_expanded_ = false;
+        if (depth_ < upper_bound_ &&
+            ShouldExpandInParallel(to_visit_current_.size(), can_expand_in_parallel_, context)) {
+          ExpandCurrentInParallel(frame, context);
+        }
+      }
 
       // if current is still empty, it means both are empty, so pull from
       // input
@@ -2502,6 +2917,8 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         to_visit_current_.clear();
         to_visit_next_.clear();
         processed_.clear();
+        depth_ = 0;
+        current_expanded_ = false;
 
         const auto &vertex_value = frame[self_.input_symbol_];
         // it is possible that the vertex is Null due to optional matching
@@ -2548,7 +2965,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
       }
 
       // expand only if what we've just expanded is less then max depth
-      if (static_cast<int64_t>(edge_list.size()) < upper_bound_) {
+      if (!current_expanded_ && static_cast<int64_t>(edge_list.size()) < upper_bound_) {
         if (self_.filter_lambda_.accumulated_path_symbol) {
           MG_ASSERT(curr_acc_path.has_value(), "Expected non-null accumulated path");
           frame[self_.filter_lambda_.accumulated_path_symbol.value()] = std::move(curr_acc_path.value());
@@ -2577,9 +2994,35 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     processed_.clear();
     to_visit_next_.clear();
     to_visit_current_.clear();
+    depth_ = 0;
+    current_expanded_ = false;
   }
 
  private:
+  /// Expands all of the vertices at the current depth on multiple threads
+  /// before they are returned, instead of expanding each of them when it is
+  /// returned.
+  void ExpandCurrentInParallel(const Frame &frame, ExecutionContext &context) {
+    std::vector<VertexAccessor> frontier;
+    frontier.reserve(to_visit_current_.size());
+    for (const auto &[edge, vertex, accumulated_path] : to_visit_current_) frontier.push_back(vertex);
+
+    // `processed_` isn't modified until all of the workers are done, so they
+    // can skip the processed vertices before evaluating the filter.
+    auto edges = ExpandFrontierInParallel(
+        frontier, self_, self_.common_.direction != EdgeAtom::Direction::IN,
+        self_.common_.direction != EdgeAtom::Direction::OUT, frame, context,
+        [this](const VertexAccessor & /*from*/, const EdgeAccessor &edge, const VertexAccessor &vertex,
+               Frame &worker_frame, ExpressionEvaluator &evaluator) {
+          return !processed_.contains(vertex) &&
+                 EvaluateExpansionFilter(self_.filter_lambda_, edge, vertex, worker_frame, evaluator);
+        });
+    for (const auto &[edge, vertex] : edges) {
+      if (processed_.emplace(vertex, edge).second) to_visit_next_.emplace_back(edge, vertex, std::nullopt);
+    }
+    current_expanded_ = true;
+  }
+
   const ExpandVariable &self_;
   const UniqueCursorPtr input_cursor_;
 
@@ -2587,6 +3030,10 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
   // is irrelevant.
   int64_t lower_bound_{-1};
   int64_t upper_bound_{-1};
+  // Depth of the vertices in `to_visit_current_`
+  int64_t depth_{0};
+  // True if the vertices in `to_visit_current_` were already expanded
+  bool current_expanded_{false};
 
   // maps vertices to the edge they got expanded from. it is an optional
   // edge because the root does not get expanded from anything.
@@ -2595,6 +3042,9 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
   // edge, vertex we have yet to visit, for current and next depth and their accumulated paths
   utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_next_;
   utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_current_;
+  // Levels can be expanded on multiple threads only if the filter lambda can
+  // be evaluated by them and doesn't need the accumulated path
+  const bool can_expand_in_parallel_;
 };
 
 namespace {
@@ -2722,7 +3172,7 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
     auto expand_from_vertex = [this, &context, &expand_pair, &restore_frame_state_after_expansion](
                                   const VertexAccessor &vertex, const TypedValue &weight, int64_t depth) {
       if (self_.common_.direction != EdgeAtom::Direction::IN) {
-        auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+        auto out_edges = UnwrapEdgesResult(vertex.OutEdgesRange(storage::View::OLD, self_.common_.edge_types)).edges;
         for (const auto &edge : out_edges) {
 #ifdef MG_ENTERPRISE
           if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
@@ -2737,7 +3187,7 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         }
       }
       if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-        auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+        auto in_edges = UnwrapEdgesResult(vertex.InEdgesRange(storage::View::OLD, self_.common_.edge_types)).edges;
         for (const auto &edge : in_edges) {
 #ifdef MG_ENTERPRISE
           if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
@@ -3054,7 +3504,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
     auto expand_from_vertex = [this, &expand_vertex, &context, &restore_frame_state_after_expansion](
                                   const VertexAccessor &vertex, const TypedValue &weight, int64_t depth) {
       if (self_.common_.direction != EdgeAtom::Direction::IN) {
-        auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+        auto out_edges = UnwrapEdgesResult(vertex.OutEdgesRange(storage::View::OLD, self_.common_.edge_types)).edges;
         for (const auto &edge : out_edges) {
 #ifdef MG_ENTERPRISE
           if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
@@ -3069,7 +3519,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
         }
       }
       if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-        auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+        auto in_edges = UnwrapEdgesResult(vertex.InEdgesRange(storage::View::OLD, self_.common_.edge_types)).edges;
         for (const auto &edge : in_edges) {
 #ifdef MG_ENTERPRISE
           if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
@@ -3500,8 +3950,8 @@ class KShortestPathsCursor : public Cursor {
   utils::pmr::unordered_set<EdgeAccessor, EdgeAccessorHash> blocked_edges_;
   utils::pmr::unordered_set<VertexAccessor, VertexAccessorHash> blocked_vertices_;
   utils::pmr::unordered_map<VertexAccessor, double, VertexAccessorHash> distances_;
-  utils::pmr::unordered_map<VertexAccessor, EdgeVertexAccessorResult, VertexAccessorHash> in_edges_;
-  utils::pmr::unordered_map<VertexAccessor, EdgeVertexAccessorResult, VertexAccessorHash> out_edges_;
+  utils::pmr::unordered_map<VertexAccessor, EdgeVertexAccessorRange, VertexAccessorHash> in_edges_;
+  utils::pmr::unordered_map<VertexAccessor, EdgeVertexAccessorRange, VertexAccessorHash> out_edges_;
   utils::pmr::unordered_map<VertexAccessor, std::optional<EdgeAccessor>, VertexAccessorHash> predecessors_;
 
   // Bidirectional search state
@@ -3731,10 +4181,10 @@ class KShortestPathsCursor : public Cursor {
         if (context.hops_limit.IsLimitReached()) break;
         if (self_.common_.direction != EdgeAtom::Direction::IN) {
           if (!out_edges_.contains(vertex)) {
-            auto out_edges_result =
-                UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+            auto out_edges_result = UnwrapEdgesResult(
+                vertex.OutEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
             context.number_of_hops += out_edges_result.expanded_count;
-            out_edges_.emplace(vertex, out_edges_result);
+            out_edges_.emplace(vertex, std::move(out_edges_result));
           }
           for (const auto &edge : out_edges_.at(vertex).edges) {
             if (!ShouldExpand<kTo>(edge, context, in_edge, blocked_edges_, blocked_vertices_)) {
@@ -3749,10 +4199,10 @@ class KShortestPathsCursor : public Cursor {
         }
         if (self_.common_.direction != EdgeAtom::Direction::OUT) {
           if (!in_edges_.contains(vertex)) {
-            auto in_edges_result =
-                UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+            auto in_edges_result = UnwrapEdgesResult(
+                vertex.InEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
             context.number_of_hops += in_edges_result.expanded_count;
-            in_edges_.emplace(vertex, in_edges_result);
+            in_edges_.emplace(vertex, std::move(in_edges_result));
           }
           for (const auto &edge : in_edges_.at(vertex).edges) {
             if (!ShouldExpand<kFrom>(edge, context, in_edge, blocked_edges_, blocked_vertices_)) {
@@ -3782,10 +4232,10 @@ class KShortestPathsCursor : public Cursor {
         if (context.hops_limit.IsLimitReached()) break;
         if (self_.common_.direction != EdgeAtom::Direction::OUT) {
           if (!out_edges_.contains(vertex)) {
-            auto out_edges_result =
-                UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+            auto out_edges_result = UnwrapEdgesResult(
+                vertex.OutEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
             context.number_of_hops += out_edges_result.expanded_count;
-            out_edges_.emplace(vertex, out_edges_result);
+            out_edges_.emplace(vertex, std::move(out_edges_result));
           }
           for (const auto &edge : out_edges_.at(vertex).edges) {
             if (!ShouldExpand<kTo>(edge, context, out_edge, blocked_edges_, blocked_vertices_)) {
@@ -3800,10 +4250,10 @@ class KShortestPathsCursor : public Cursor {
         }
         if (self_.common_.direction != EdgeAtom::Direction::IN) {
           if (!in_edges_.contains(vertex)) {
-            auto in_edges_result =
-                UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+            auto in_edges_result = UnwrapEdgesResult(
+                vertex.InEdgesRange(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
             context.number_of_hops += in_edges_result.expanded_count;
-            in_edges_.emplace(vertex, in_edges_result);
+            in_edges_.emplace(vertex, std::move(in_edges_result));
           }
           for (const auto &edge : in_edges_.at(vertex).edges) {
             if (!ShouldExpand<kFrom>(edge, context, out_edge, blocked_edges_, blocked_vertices_)) {
@@ -4173,7 +4623,14 @@ static std::vector<UniqueCursorPtr> MakeCursorVector(const std::vector<std::shar
 Filter::FilterCursor::FilterCursor(const Filter &self, utils::MemoryResource *mem)
     : self_(self),
       input_cursor_(self_.input_->MakeCursor(mem)),
-      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem)) {}
+      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem)),
+      compiled_(FLAGS_query_compiled_expressions ? self_.compiled_expressions_.Get({self_.expression_}) : nullptr) {}
+
+bool Filter::FilterCursor::Evaluate(ExpressionEvaluator &evaluator) {
+  if (!compiled_) return EvaluateFilter(evaluator, self_.expression_);
+  if (!constants_) constants_.emplace(compiled_->Bind(evaluator));
+  return compiled_->EvaluateFilter(0, evaluator, *constants_);
+}
 
 bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
@@ -4189,14 +4646,42 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
     for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
       pattern_filter_cursor->Pull(frame, context);
     }
-    if (EvaluateFilter(evaluator, self_.expression_)) return true;
+    if (Evaluate(evaluator)) return true;
+  }
+  return false;
+}
+
+bool Filter::FilterCursor::PullBatch(FrameBatch &batch, Frame &frame, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  AbortCheck(context);
+
+  input_.Enable(batch.frame_size(), batch.capacity(), batch.get_allocator().resource());
+  ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::OLD, context.frame_change_collector, &context.number_of_hops);
+  while (input_.PullBatch(*input_cursor_, batch, context)) {
+    // Rows which pass the filter are moved to the front of the batch.
+    size_t passed = 0;
+    for (size_t row = 0; row < batch.size(); ++row) {
+      batch.MoveRowToFrame(row, frame);
+      for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
+        pattern_filter_cursor->Pull(frame, context);
+      }
+      if (Evaluate(evaluator)) batch.MoveFrameToRow(frame, passed++);
+    }
+    batch.Truncate(passed);
+    if (passed > 0) return true;
   }
   return false;
 }
 
 void Filter::FilterCursor::Shutdown() { input_cursor_->Shutdown(); }
 
-void Filter::FilterCursor::Reset() { input_cursor_->Reset(); }
+void Filter::FilterCursor::Reset() {
+  input_cursor_->Reset();
+  input_.Reset();
+}
 
 EvaluatePatternFilter::EvaluatePatternFilter(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol)
     : input_(input), output_symbol_(std::move(output_symbol)) {}
@@ -4281,8 +4766,38 @@ std::string Produce::ToString() const {
                      utils::IterableToString(named_expressions_, ", ", [](const auto &nexpr) { return nexpr->name_; }));
 }
 
+namespace {
+
+std::vector<Expression *> ProducedExpressions(const std::vector<NamedExpression *> &named_expressions) {
+  std::vector<Expression *> expressions;
+  expressions.reserve(named_expressions.size());
+  for (auto *named_expr : named_expressions) expressions.push_back(named_expr->expression_);
+  return expressions;
+}
+
+}  // namespace
+
 Produce::ProduceCursor::ProduceCursor(const Produce &self, utils::MemoryResource *mem)
-    : self_(self), input_cursor_(self_.input_->MakeCursor(mem)) {}
+    : self_(self),
+      input_cursor_(self_.input_->MakeCursor(mem)),
+      compiled_(FLAGS_query_compiled_expressions
+                    ? self_.compiled_expressions_.Get(ProducedExpressions(self_.named_expressions_))
+                    : nullptr) {}
+
+void Produce::ProduceCursor::Evaluate(Frame &frame, ExecutionContext &context, ExpressionEvaluator &evaluator) {
+  if (compiled_ && !constants_) constants_.emplace(compiled_->Bind(evaluator));
+  for (size_t i = 0; i < self_.named_expressions_.size(); ++i) {
+    auto *named_expr = self_.named_expressions_[i];
+    if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(named_expr->name_)) {
+      context.frame_change_collector->ResetTrackingValue(named_expr->name_);
+    }
+    if (compiled_) {
+      frame[context.symbol_table.at(*named_expr)] = compiled_->Evaluate(i, evaluator, *constants_);
+    } else {
+      named_expr->Accept(evaluator);
+    }
+  }
+}
 
 bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
@@ -4294,20 +4809,37 @@ bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
     // Produce should always yield the latest results.
     ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                   storage::View::NEW, context.frame_change_collector, &context.number_of_hops);
-    for (auto *named_expr : self_.named_expressions_) {
-      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(named_expr->name_)) {
-        context.frame_change_collector->ResetTrackingValue(named_expr->name_);
-      }
-      named_expr->Accept(evaluator);
-    }
+    Evaluate(frame, context, evaluator);
     return true;
   }
   return false;
 }
 
+bool Produce::ProduceCursor::PullBatch(FrameBatch &batch, Frame &frame, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  AbortCheck(context);
+
+  input_.Enable(batch.frame_size(), batch.capacity(), batch.get_allocator().resource());
+  if (!input_.PullBatch(*input_cursor_, batch, context)) return false;
+
+  ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::NEW, context.frame_change_collector, &context.number_of_hops);
+  for (size_t row = 0; row < batch.size(); ++row) {
+    batch.MoveRowToFrame(row, frame);
+    Evaluate(frame, context, evaluator);
+    batch.MoveFrameToRow(frame, row);
+  }
+  return true;
+}
+
 void Produce::ProduceCursor::Shutdown() { input_cursor_->Shutdown(); }
 
-void Produce::ProduceCursor::Reset() { input_cursor_->Reset(); }
+void Produce::ProduceCursor::Reset() {
+  input_cursor_->Reset();
+  input_.Reset();
+}
 
 Delete::Delete(const std::shared_ptr<LogicalOperator> &input_, const std::vector<Expression *> &expressions,
                bool detach_)
@@ -5340,7 +5872,9 @@ class AggregateCursor : public Cursor {
     AbortCheck(context);
 
     if (!pulled_all_input_) {
-      if (!ProcessAll(&frame, &context) && !self_.group_by_.empty()) return false;
+      if (!AggregateFromColumns(&frame, &context) && !ProcessAll(&frame, &context) && !self_.group_by_.empty()) {
+        return false;
+      }
       pulled_all_input_ = true;
       aggregation_it_ = aggregation_.begin();
 
@@ -5364,7 +5898,11 @@ class AggregateCursor : public Cursor {
         return true;
       }
     }
-    if (aggregation_it_ == aggregation_.end()) return false;
+    while (aggregation_it_ == aggregation_.end()) {
+      // Groups which were spilled to disk are aggregated after the ones kept
+      // in memory are exhausted.
+      if (!ProcessNextPartition(&frame, &context)) return false;
+    }
 
     // place aggregation values on the frame
     auto aggregation_values_it = aggregation_it_->second.values_.begin();
@@ -5379,16 +5917,37 @@ class AggregateCursor : public Cursor {
     return true;
   }
 
+  // The input is consumed in batches, while the (usually few) aggregated rows
+  // are returned through the row adapter.
+  bool PullBatch(FrameBatch &batch, Frame &frame, ExecutionContext &context) override {
+    input_.Enable(batch.frame_size(), batch.capacity(), batch.get_allocator().resource());
+    return Cursor::PullBatch(batch, frame, context);
+  }
+
   void Shutdown() override { input_cursor_->Shutdown(); }
 
   void Reset() override {
     input_cursor_->Reset();
+    input_.Reset();
     aggregation_.clear();
     aggregation_it_ = aggregation_.begin();
     pulled_all_input_ = false;
+    partitions_.reset();
+    pending_.clear();
+    current_level_ = 0;
   }
 
  private:
+  // Don't bother with spilling a small number of groups.
+  static constexpr size_t kMinGroupsToSpill = 1024;
+  // Partitions aren't split further after this many levels.
+  static constexpr uint64_t kMaxSpillLevel = 3;
+
+  struct PendingPartition {
+    std::unique_ptr<SpillFile> file;
+    uint64_t level;
+  };
+
   // Data structure for a single aggregation cache.
   // Does NOT include the group-by values since those are a key in the
   // aggregation map. The vectors in an AggregationValue contain one element for
@@ -5416,6 +5975,7 @@ class AggregateCursor : public Cursor {
 
   const Aggregate &self_;
   const UniqueCursorPtr input_cursor_;
+  BatchedInput input_;
   // storage for aggregated data
   // map key is the vector of group-by values
   // map value is an AggregationValue struct
@@ -5433,6 +5993,14 @@ class AggregateCursor : public Cursor {
   // this LogicalOp pulls all from the input on it's first pull
   // this switch tracks if this has been performed
   bool pulled_all_input_{false};
+  // Once the query used too much memory (see `--query-spill-threshold`), no
+  // new groups are added to `aggregation_`. Rows of new groups are written to
+  // disk with their remember values and evaluated aggregation arguments
+  // instead, and each partition is aggregated after the groups in memory are
+  // returned.
+  std::optional<SpillPartitions> partitions_;
+  std::vector<PendingPartition> pending_;
+  uint64_t current_level_{0};
 
   /**
    * Pulls from the input operator until exhausted and aggregates the
@@ -5448,13 +6016,180 @@ class AggregateCursor : public Cursor {
                                   storage::View::NEW, nullptr, &context->number_of_hops);
 
     bool pulled = false;
-    while (input_cursor_->Pull(*frame, *context)) {
+    while (input_.Pull(*input_cursor_, *frame, *context)) {
       ProcessOne(*frame, &evaluator);
+      if (!partitions_ && aggregation_.size() >= kMinGroupsToSpill && SpillThresholdExceeded(context->db_accessor)) {
+        partitions_.emplace(0);
+      }
       pulled = true;
     }
     if (!pulled) return false;
 
-    // post processing
+    FinishPartitions();
+    PostProcess(context);
+    return true;
+  }
+
+  /**
+   * Aggregates the properties of all vertices with a label from the storage
+   * columns (see `--storage-columnar-properties`) instead of pulling the
+   * input. Used only when the input is a plain label scan without grouping and
+   * every aggregation is a COUNT, SUM, AVG, MIN or MAX of the scanned vertex or
+   * its property, so the result is the same as when aggregating row by row.
+   * Returns false if the input has to be pulled.
+   */
+  bool AggregateFromColumns(Frame *frame, ExecutionContext *context) {
+    if (!self_.group_by_.empty() || !self_.remember_.empty() || self_.aggregations_.empty()) return false;
+    if (context->morsel_source || context->is_profile_query) return false;
+#ifdef MG_ENTERPRISE
+    if (context->auth_checker) return false;
+#endif
+    if (self_.input_->GetTypeInfo() != ScanAllByLabel::kType) return false;
+    const auto &scan = static_cast<const ScanAllByLabel &>(*self_.input_);
+    if (!scan.input_ || scan.input_->GetTypeInfo() != Once::kType) return false;
+
+    auto scanned_property = [&](const Expression *expression) -> std::optional<storage::PropertyId> {
+      const auto *lookup = utils::Downcast<const PropertyLookup>(expression);
+      if (!lookup) return std::nullopt;
+      const auto *identifier = utils::Downcast<const Identifier>(lookup->expression_);
+      if (!identifier || context->symbol_table.at(*identifier) != scan.output_symbol_) return std::nullopt;
+      return context->evaluation_context.properties[lookup->property_.ix];
+    };
+    auto is_scanned_vertex = [&](const Expression *expression) {
+      const auto *identifier = utils::Downcast<const Identifier>(expression);
+      return identifier && context->symbol_table.at(*identifier) == scan.output_symbol_;
+    };
+
+    std::vector<std::shared_ptr<storage::PropertyColumn const>> columns;
+    columns.reserve(self_.aggregations_.size());
+    std::shared_ptr<storage::PropertyColumn const> any_column;
+    for (const auto &elem : self_.aggregations_) {
+      if (elem.distinct) return false;
+      if (elem.op != Aggregation::Op::COUNT && elem.op != Aggregation::Op::SUM && elem.op != Aggregation::Op::AVG &&
+          elem.op != Aggregation::Op::MIN && elem.op != Aggregation::Op::MAX) {
+        return false;
+      }
+      if (!elem.arg1 || is_scanned_vertex(elem.arg1)) {
+        if (elem.op != Aggregation::Op::COUNT) return false;
+        columns.emplace_back(nullptr);
+        continue;
+      }
+      auto property = scanned_property(elem.arg1);
+      if (!property) return false;
+      auto column = context->db_accessor->GetPropertyColumn(scan.label_, *property);
+      if (!column) return false;
+      // Mixed or non-numeric values are aggregated row by row, which also
+      // takes care of the type errors.
+      const bool mixed = column->other_count != 0 || (!column->ints.empty() && !column->doubles.empty());
+      if (elem.op != Aggregation::Op::COUNT && mixed) return false;
+      any_column = column;
+      columns.push_back(std::move(column));
+    }
+    // COUNT(*) alone doesn't reference a column, so the vertex count is unknown.
+    if (!any_column) return false;
+    // No vertices means no groups, the default values are placed by `Pull`.
+    if (any_column->vertex_count == 0) return true;
+
+    reused_group_by_.clear();
+    auto &agg_value = aggregation_.try_emplace(reused_group_by_, aggregation_.get_allocator().resource()).first->second;
+    EnsureInitialized(*frame, &agg_value);
+    auto *mem = agg_value.values_.get_allocator().resource();
+    for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+      const auto &column = columns[pos];
+      auto &value = agg_value.values_[pos];
+      const auto op = self_.aggregations_[pos].op;
+      if (!column) {
+        value = TypedValue(static_cast<int64_t>(any_column->vertex_count), mem);
+        continue;
+      }
+      const auto count = column->ints.size() + column->doubles.size() + column->other_count;
+      if (op == Aggregation::Op::COUNT) {
+        value = TypedValue(static_cast<int64_t>(count), mem);
+        continue;
+      }
+      if (count == 0) continue;
+      if (!column->ints.empty()) {
+        const auto &ints = column->ints;
+        switch (op) {
+          case Aggregation::Op::SUM:
+          case Aggregation::Op::AVG: {
+            // Overflow wraps around like the addition of TypedValue integers.
+            uint64_t sum = 0;
+            for (const auto x : ints) sum += static_cast<uint64_t>(x);
+            value = TypedValue(static_cast<int64_t>(sum), mem);
+            break;
+          }
+          case Aggregation::Op::MIN:
+            value = TypedValue(*std::ranges::min_element(ints), mem);
+            break;
+          case Aggregation::Op::MAX:
+            value = TypedValue(*std::ranges::max_element(ints), mem);
+            break;
+          default:
+            break;
+        }
+      } else {
+        // Doubles are combined in the scan order with the same comparisons and
+        // additions as row by row, so NaNs and rounding give the same result.
+        const auto &doubles = column->doubles;
+        double result = doubles.front();
+        for (size_t i = 1; i < doubles.size(); ++i) {
+          const auto x = doubles[i];
+          if (op == Aggregation::Op::MIN) {
+            if (x < result) result = x;
+          } else if (op == Aggregation::Op::MAX) {
+            // TypedValue `>` is defined as the negation of `<=`.
+            if (!(x < result || x == result)) result = x;
+          } else {
+            result += x;
+          }
+        }
+        value = TypedValue(result, mem);
+      }
+      if (op == Aggregation::Op::AVG) value = value / TypedValue(static_cast<double>(count), mem);
+    }
+    return true;
+  }
+
+  /**
+   * Aggregates the next spilled partition, replacing the groups in
+   * `aggregation_`. Returns false if there are no partitions left.
+   */
+  bool ProcessNextPartition(Frame *frame, ExecutionContext *context) {
+    if (pending_.empty()) return false;
+    auto partition = std::move(pending_.back());
+    pending_.pop_back();
+    current_level_ = partition.level;
+    aggregation_.clear();
+
+    partition.file->FinishWriting();
+    utils::pmr::vector<TypedValue> row(aggregation_.get_allocator().resource());
+    while (partition.file->ReadRow(&row)) {
+      AbortCheck(*context);
+      ProcessSpilledRow(frame, &row);
+      if (!partitions_ && aggregation_.size() >= kMinGroupsToSpill && current_level_ + 1 < kMaxSpillLevel &&
+          SpillThresholdExceeded(context->db_accessor)) {
+        partitions_.emplace(current_level_ + 1);
+      }
+    }
+
+    FinishPartitions();
+    PostProcess(context);
+    aggregation_it_ = aggregation_.begin();
+    return true;
+  }
+
+  void FinishPartitions() {
+    if (!partitions_) return;
+    for (size_t i = 0; i < SpillPartitions::kNumPartitions; ++i) {
+      if (auto &partition = partitions_->partition(i)) {
+        pending_.push_back({std::move(partition), partitions_->level()});
+      }
+    }
+    partitions_.reset();
+  }
+
+  void PostProcess(ExecutionContext *context) {
     for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
       switch (self_.aggregations_[pos].op) {
         case Aggregation::Op::AVG: {
@@ -5487,7 +6222,6 @@ class AggregateCursor : public Cursor {
           break;
       }
     }
-    return true;
   }
 
   /**
@@ -5504,17 +6238,86 @@ class AggregateCursor : public Cursor {
       reused_group_by_.emplace_back(expression->Accept(*evaluator));
     }
     auto *mem = aggregation_.get_allocator().resource();
+    if (partitions_) {
+      if (auto it = aggregation_.find(reused_group_by_); it != aggregation_.end()) {
+        Update(evaluator, &it->second);
+        return;
+      }
+      auto row = MakeSpillRow(frame, evaluator);
+      if (!std::ranges::all_of(reused_group_by_, IsSpillable)) {
+        // No rows of this group could have been spilled, so it can stay in
+        // memory. The arguments were already evaluated.
+        auto &agg_value = aggregation_.try_emplace(reused_group_by_, mem).first->second;
+        EnsureInitialized(frame, &agg_value);
+        UpdateFromSpillRow(&agg_value, &row);
+        return;
+      }
+      if (!std::ranges::all_of(row, IsSpillable)) {
+        throw QueryRuntimeException("Aggregation can't move rows holding functions to disk.");
+      }
+      partitions_->WriteRow(aggregation_.hash_function()(reused_group_by_), row);
+      return;
+    }
     auto res = aggregation_.try_emplace(reused_group_by_, mem);
     auto &agg_value = res.first->second;
     if (res.second /*was newly inserted*/) EnsureInitialized(frame, &agg_value);
     Update(evaluator, &agg_value);
   }
 
-  /** Ensures the new AggregationValue has been initialized. This means
-   * that the value vectors are filled with an appropriate number of Nulls,
-   * counts are set to 0 and remember values are remembered.
+  /**
+   * Row of a group which isn't kept in memory: the group-by values, remember
+   * values, and both arguments of each aggregation. Arguments which wouldn't be
+   * evaluated are Null.
    */
-  void EnsureInitialized(const Frame &frame, AggregateCursor::AggregationValue *agg_value) const {
+  utils::pmr::vector<TypedValue> MakeSpillRow(const Frame &frame, ExpressionEvaluator *evaluator) {
+    utils::pmr::vector<TypedValue> row(aggregation_.get_allocator().resource());
+    row.reserve(reused_group_by_.size() + self_.remember_.size() + 2 * self_.aggregations_.size());
+    row.insert(row.end(), reused_group_by_.begin(), reused_group_by_.end());
+    for (const Symbol &remember_sym : self_.remember_) {
+      row.emplace_back(frame[remember_sym]);
+    }
+    for (const auto &agg_elem : self_.aggregations_) {
+      auto &arg1 = row.emplace_back(agg_elem.arg1 ? agg_elem.arg1->Accept(*evaluator) : TypedValue());
+      if (agg_elem.arg2 && !arg1.IsNull()) {
+        row.emplace_back(agg_elem.arg2->Accept(*evaluator));
+      } else {
+        row.emplace_back();
+      }
+    }
+    return row;
+  }
+
+  /**
+   * Aggregates a row created by `MakeSpillRow`. Remember values of new groups
+   * are placed on the frame.
+   */
+  void ProcessSpilledRow(Frame *frame, utils::pmr::vector<TypedValue> *row) {
+    reused_group_by_.assign(row->begin(), row->begin() + static_cast<ptrdiff_t>(self_.group_by_.size()));
+    if (partitions_) {
+      if (auto it = aggregation_.find(reused_group_by_); it != aggregation_.end()) {
+        UpdateFromSpillRow(&it->second, row);
+      } else {
+        partitions_->WriteRow(aggregation_.hash_function()(reused_group_by_), *row);
+      }
+      return;
+    }
+    auto res = aggregation_.try_emplace(reused_group_by_, aggregation_.get_allocator().resource());
+    auto &agg_value = res.first->second;
+    if (res.second /*was newly inserted*/) {
+      auto remember_value_it = row->begin() + static_cast<ptrdiff_t>(self_.group_by_.size());
+      for (const Symbol &remember_sym : self_.remember_) {
+        (*frame)[remember_sym] = *remember_value_it++;
+      }
+      EnsureInitialized(*frame, &agg_value);
+    }
+    UpdateFromSpillRow(&agg_value, row);
+  }
+
+  /** Ensures the new AggregationValue has been initialized. This means
+   * that the value vectors are filled with an appropriate number of Nulls,
+   * counts are set to 0 and remember values are remembered.
+   */
+  void EnsureInitialized(const Frame &frame, AggregateCursor::AggregationValue *agg_value) const {
     if (!agg_value->values_.empty()) return;
 
     const auto num_of_aggregations = self_.aggregations_.size();
@@ -5537,6 +6340,23 @@ class AggregateCursor : public Cursor {
   /** Updates the given AggregationValue with new data. Assumes that
    * the AggregationValue has been initialized */
   void Update(ExpressionEvaluator *evaluator, AggregateCursor::AggregationValue *agg_value) {
+    auto arg1 = [evaluator](const Aggregate::Element &agg_elem, size_t) { return agg_elem.arg1->Accept(*evaluator); };
+    auto arg2 = [evaluator](const Aggregate::Element &agg_elem, size_t) { return agg_elem.arg2->Accept(*evaluator); };
+    Update(agg_value, arg1, arg2);
+  }
+
+  /** Updates the given AggregationValue with arguments stored by `MakeSpillRow`. */
+  void UpdateFromSpillRow(AggregateCursor::AggregationValue *agg_value, utils::pmr::vector<TypedValue> *row) {
+    const auto args_offset = self_.group_by_.size() + self_.remember_.size();
+    auto arg1 = [&](const Aggregate::Element &, size_t pos) { return std::move((*row)[args_offset + 2 * pos]); };
+    auto arg2 = [&](const Aggregate::Element &, size_t pos) { return std::move((*row)[args_offset + 2 * pos + 1]); };
+    Update(agg_value, arg1, arg2);
+  }
+
+  /** Updates the given AggregationValue using `arg1` and `arg2` to get the
+   * arguments of an aggregation. */
+  template <typename TArg1, typename TArg2>
+  void Update(AggregateCursor::AggregationValue *agg_value, TArg1 &&arg1, TArg2 &&arg2) {
     DMG_ASSERT(self_.aggregations_.size() == agg_value->values_.size(),
                "Expected as much AggregationValue.values_ as there are "
                "aggregations.");
@@ -5559,7 +6379,8 @@ class AggregateCursor : public Cursor {
         continue;
       }
 
-      TypedValue input_value = input_expr_ptr->Accept(*evaluator);
+      const auto pos = static_cast<size_t>(agg_elem_it - self_.aggregations_.begin());
+      TypedValue input_value = arg1(*agg_elem_it, pos);
 
       // Aggregations skip Null input values.
       if (input_value.IsNull()) continue;
@@ -5596,11 +6417,11 @@ class AggregateCursor : public Cursor {
             break;
           }
           case Aggregation::Op::PROJECT_LISTS: {
-            ProjectList(input_value, agg_elem_it->arg2->Accept(*evaluator), value_it->ValueGraph());
+            ProjectList(input_value, arg2(*agg_elem_it, pos), value_it->ValueGraph());
             break;
           }
           case Aggregation::Op::COLLECT_MAP:
-            auto key = agg_elem_it->arg2->Accept(*evaluator);
+            auto key = arg2(*agg_elem_it, pos);
             if (key.type() != TypedValue::Type::String) throw QueryRuntimeException("Map key must be a string.");
             value_it->ValueMap().emplace(key.ValueString(), std::move(input_value));
             break;
@@ -5654,11 +6475,11 @@ class AggregateCursor : public Cursor {
         }
 
         case Aggregation::Op::PROJECT_LISTS: {
-          ProjectList(input_value, agg_elem_it->arg2->Accept(*evaluator), value_it->ValueGraph());
+          ProjectList(input_value, arg2(*agg_elem_it, pos), value_it->ValueGraph());
           break;
         }
         case Aggregation::Op::COLLECT_MAP:
-          auto key = agg_elem_it->arg2->Accept(*evaluator);
+          auto key = arg2(*agg_elem_it, pos);
           if (key.type() != TypedValue::Type::String) throw QueryRuntimeException("Map key must be a string.");
           value_it->ValueMap().emplace(key.ValueString(), std::move(input_value));
           break;
@@ -5910,7 +6731,7 @@ std::vector<Symbol> OrderBy::ModifiedSymbols(const SymbolTable &table) const { r
 class OrderByCursor : public Cursor {
  public:
   OrderByCursor(const OrderBy &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), cache_(mem) {}
+      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), cache_(mem), merged_row_(mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -5921,6 +6742,7 @@ class OrderByCursor : public Cursor {
                                     storage::View::OLD, nullptr, &context.number_of_hops);
       auto *pull_mem = context.evaluation_context.memory;
       auto *query_mem = cache_.get_allocator().resource();
+      spill_baseline_ = SpillMemoryUsage(context.db_accessor);
 
       utils::pmr::vector<utils::pmr::vector<TypedValue>> order_by(pull_mem);  // Not cached, pull memory
       utils::pmr::vector<utils::pmr::vector<TypedValue>> output(query_mem);   // Cached, query memory
@@ -5941,6 +6763,11 @@ class OrderByCursor : public Cursor {
           output_elem.emplace_back(frame[output_sym]);
         }
         output.emplace_back(std::move(output_elem));
+
+        if (can_spill_ && output.size() >= kMinRowsToSpill && ShouldSpill(context.db_accessor, output.size())) {
+          SpillRun(order_by, output, query_mem);
+          spill_baseline_ = SpillMemoryUsage(context.db_accessor);
+        }
       }
 
       // sorting with range zip
@@ -5950,29 +6777,35 @@ class OrderByCursor : public Cursor {
           rv::zip(order_by, output), self_.compare_.lex_cmp(),
           [](auto const &value) -> auto const & { return std::get<0>(value); });
 
-      // no longer need the order_by terms
-      order_by.clear();
-      cache_ = std::move(output);
+      if (!runs_.empty()) {
+        // The remaining rows are written as the last run, all runs are then
+        // merged while pulling.
+        WriteRun(order_by, output, query_mem);
+        MergeRuns(query_mem);
+      } else {
+        // no longer need the order_by terms
+        order_by.clear();
+        cache_ = std::move(output);
+      }
 
       did_pull_all_ = true;
       cache_it_ = cache_.begin();
     }
 
+    if (merger_) {
+      if (!merger_->Next(&merged_row_)) return false;
+      AbortCheck(context);
+      // Merged rows start with the order_by terms.
+      PlaceOnFrame(frame, context, merged_row_.begin() + static_cast<ptrdiff_t>(self_.order_by_.size()),
+                   merged_row_.end());
+      return true;
+    }
+
     if (cache_it_ == cache_.end()) return false;
 
     AbortCheck(context);
 
-    // place the output values on the frame
-    DMG_ASSERT(self_.output_symbols_.size() == cache_it_->size(),
-               "Number of values does not match the number of output symbols "
-               "in OrderBy");
-    auto output_sym_it = self_.output_symbols_.begin();
-    for (TypedValue &output : *cache_it_) {
-      if (context.frame_change_collector) {
-        context.frame_change_collector->ResetTrackingValue(output_sym_it->name());
-      }
-      frame[*output_sym_it++] = std::move(output);
-    }
+    PlaceOnFrame(frame, context, cache_it_->begin(), cache_it_->end());
     cache_it_++;
     return true;
   }
@@ -5983,9 +6816,119 @@ class OrderByCursor : public Cursor {
     did_pull_all_ = false;
     cache_.clear();
     cache_it_ = cache_.begin();
+    can_spill_ = true;
+    run_rows_ = 0;
+    run_memory_ = 0;
+    spill_baseline_ = 0;
+    runs_.clear();
+    merger_.reset();
+    merged_row_.clear();
   }
 
  private:
+  // Runs shorter than this aren't worth a separate file.
+  static constexpr size_t kMinRowsToSpill = 1024;
+  // Maximum number of runs merged at once, each run holds a read buffer.
+  // Runs are merged as soon as this many of them are written, which keeps the
+  // number of open files logarithmic in the number of spilled rows.
+  static constexpr size_t kMaxMergedRuns = 64;
+
+  // The memory tracker doesn't go down once rows are spilled, so only the first
+  // run is sized by `--query-spill-threshold`. Later runs are spilled once they
+  // hold as many rows as the first one, or earlier if the query used as much
+  // new memory as the first run since the last spill.
+  bool ShouldSpill(DbAccessor *dba, size_t rows) {
+    if (run_rows_ == 0) {
+      if (!SpillThresholdExceeded(dba)) return false;
+      run_rows_ = rows;
+      run_memory_ = SpillMemoryUsage(dba) - spill_baseline_;
+      return true;
+    }
+    return rows >= run_rows_ || (run_memory_ > 0 && SpillMemoryUsage(dba) - spill_baseline_ >= run_memory_);
+  }
+
+  void PlaceOnFrame(Frame &frame, ExecutionContext &context, auto begin, auto end) {
+    // place the output values on the frame
+    DMG_ASSERT(self_.output_symbols_.size() == static_cast<size_t>(std::distance(begin, end)),
+               "Number of values does not match the number of output symbols "
+               "in OrderBy");
+    auto output_sym_it = self_.output_symbols_.begin();
+    for (auto it = begin; it != end; ++it) {
+      if (context.frame_change_collector) {
+        context.frame_change_collector->ResetTrackingValue(output_sym_it->name());
+      }
+      frame[*output_sym_it++] = std::move(*it);
+    }
+  }
+
+  void SpillRun(utils::pmr::vector<utils::pmr::vector<TypedValue>> &order_by,
+                utils::pmr::vector<utils::pmr::vector<TypedValue>> &output, utils::MemoryResource *mem) {
+    auto is_spillable = [](const auto &row) { return std::ranges::all_of(row, IsSpillable); };
+    if (!std::ranges::all_of(order_by, is_spillable) || !std::ranges::all_of(output, is_spillable)) {
+      // Keep everything in memory.
+      can_spill_ = false;
+      return;
+    }
+    ranges::sort(
+        rv::zip(order_by, output), self_.compare_.lex_cmp(),
+        [](auto const &value) -> auto const & { return std::get<0>(value); });
+    WriteRun(order_by, output, mem);
+  }
+
+  void WriteRun(utils::pmr::vector<utils::pmr::vector<TypedValue>> &order_by,
+                utils::pmr::vector<utils::pmr::vector<TypedValue>> &output, utils::MemoryResource *mem) {
+    auto run = std::make_unique<SpillFile>();
+    std::vector<TypedValue> row;
+    row.reserve(self_.order_by_.size() + self_.output_symbols_.size());
+    for (size_t i = 0; i < output.size(); ++i) {
+      row.clear();
+      std::ranges::move(order_by[i], std::back_inserter(row));
+      std::ranges::move(output[i], std::back_inserter(row));
+      run->WriteRow(row);
+    }
+    order_by.clear();
+    output.clear();
+    run->FinishWriting();
+    AddRun(std::move(run), mem);
+  }
+
+  void AddRun(std::unique_ptr<SpillFile> run, utils::MemoryResource *mem) {
+    for (size_t level = 0;; ++level) {
+      if (level == runs_.size()) runs_.emplace_back();
+      runs_[level].emplace_back(std::move(run));
+      if (runs_[level].size() < kMaxMergedRuns) return;
+      run = MergeToFile(runs_[level], mem);
+      runs_[level].clear();
+    }
+  }
+
+  std::unique_ptr<SpillFile> MergeToFile(std::vector<std::unique_ptr<SpillFile>> &runs, utils::MemoryResource *mem) {
+    SortedRunsMerger merger(self_.compare_, mem);
+    for (auto &run : runs) merger.AddRun(std::move(run));
+    auto merged = std::make_unique<SpillFile>();
+    utils::pmr::vector<TypedValue> row(mem);
+    while (merger.Next(&row)) merged->WriteRow(row);
+    merged->FinishWriting();
+    return merged;
+  }
+
+  void MergeRuns(utils::MemoryResource *mem) {
+    std::vector<std::unique_ptr<SpillFile>> runs;
+    for (auto &level : runs_) std::ranges::move(level, std::back_inserter(runs));
+    runs_.clear();
+    // Every level holds less than kMaxMergedRuns runs, the smaller ones are
+    // merged first until the rest can be merged at once.
+    while (runs.size() > kMaxMergedRuns) {
+      const auto batch = std::min(kMaxMergedRuns, runs.size() - kMaxMergedRuns + 1);
+      std::vector<std::unique_ptr<SpillFile>> merged_runs(std::make_move_iterator(runs.begin()),
+                                                          std::make_move_iterator(runs.begin() + batch));
+      runs.erase(runs.begin(), runs.begin() + batch);
+      runs.emplace_back(MergeToFile(merged_runs, mem));
+    }
+    merger_.emplace(self_.compare_, mem);
+    for (auto &run : runs) merger_->AddRun(std::move(run));
+  }
+
   const OrderBy &self_;
   const UniqueCursorPtr input_cursor_;
   bool did_pull_all_{false};
@@ -5994,6 +6937,20 @@ class OrderByCursor : public Cursor {
   utils::pmr::vector<utils::pmr::vector<TypedValue>> cache_;
   // iterator over the cache_, maintains state between Pulls
   decltype(cache_.begin()) cache_it_ = cache_.begin();
+  // Set when a row can't be written to disk.
+  bool can_spill_{true};
+  // Size of the first run, later runs are at most this large, see ShouldSpill.
+  size_t run_rows_{0};
+  int64_t run_memory_{0};
+  // Query memory usage right after the last spill.
+  int64_t spill_baseline_{0};
+  // Sorted runs written to disk once the query used too much memory, see
+  // `--query-spill-threshold`. Rows hold the order_by terms followed by the
+  // output values. Runs of level `i` are made by merging kMaxMergedRuns runs of
+  // level `i - 1`.
+  std::vector<std::vector<std::unique_ptr<SpillFile>>> runs_;
+  std::optional<SortedRunsMerger> merger_;
+  utils::pmr::vector<TypedValue> merged_row_;
 };
 
 UniqueCursorPtr OrderBy::MakeCursor(utils::MemoryResource *mem) const {
@@ -6019,6 +6976,187 @@ std::string OrderBy::ToString() const {
                      utils::IterableToString(output_symbols_, ", ", [](const auto &sym) { return sym.name(); }));
 }
 
+TopK::TopK(const std::shared_ptr<LogicalOperator> &input, const std::vector<SortItem> &order_by,
+           const std::vector<Symbol> &output_symbols, Expression *limit, Expression *skip)
+    : input_(input), output_symbols_(output_symbols), limit_(limit), skip_(skip) {
+  std::vector<OrderedTypedValueCompare> ordering;
+  ordering.reserve(order_by.size());
+  order_by_.reserve(order_by.size());
+  for (const auto &ordering_expression_pair : order_by) {
+    ordering.emplace_back(ordering_expression_pair.ordering);
+    order_by_.emplace_back(ordering_expression_pair.expression);
+  }
+  compare_ = TypedValueVectorCompare(std::move(ordering));
+}
+
+ACCEPT_WITH_INPUT(TopK)
+
+std::vector<Symbol> TopK::OutputSymbols(const SymbolTable &symbol_table) const {
+  // Propagate this to potential Produce.
+  return input_->OutputSymbols(symbol_table);
+}
+
+std::vector<Symbol> TopK::ModifiedSymbols(const SymbolTable &table) const { return input_->ModifiedSymbols(table); }
+
+class TopKCursor : public Cursor {
+ public:
+  TopKCursor(const TopK &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), cache_(mem) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    if (!did_pull_all_) [[unlikely]] {
+      PullAll(frame, context);
+      did_pull_all_ = true;
+      cache_it_ = cache_.begin();
+    }
+
+    if (cache_it_ == cache_.end()) return false;
+
+    AbortCheck(context);
+
+    // place the output values on the frame
+    DMG_ASSERT(self_.output_symbols_.size() == cache_it_->size(),
+               "Number of values does not match the number of output symbols "
+               "in TopK");
+    auto output_sym_it = self_.output_symbols_.begin();
+    for (TypedValue &output : *cache_it_) {
+      if (context.frame_change_collector) {
+        context.frame_change_collector->ResetTrackingValue(output_sym_it->name());
+      }
+      frame[*output_sym_it++] = std::move(output);
+    }
+    cache_it_++;
+    return true;
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    did_pull_all_ = false;
+    cache_.clear();
+    cache_it_ = cache_.begin();
+  }
+
+ private:
+  void PullAll(Frame &frame, ExecutionContext &context) {
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD, nullptr, &context.number_of_hops);
+    auto *pull_mem = context.evaluation_context.memory;
+    auto *query_mem = cache_.get_allocator().resource();
+    auto const lex_cmp = self_.compare_.lex_cmp();
+
+    // Each kept row has a fixed slot in order_by and output, the heap only
+    // permutes slot indices. The top of the heap is the worst kept row.
+    utils::pmr::vector<utils::pmr::vector<TypedValue>> order_by(pull_mem);  // Not cached, pull memory
+    utils::pmr::vector<utils::pmr::vector<TypedValue>> output(query_mem);   // Cached, query memory
+    utils::pmr::vector<size_t> heap(pull_mem);
+    auto const heap_cmp = [&](size_t lhs, size_t rhs) { return lex_cmp(order_by[lhs], order_by[rhs]); };
+    utils::pmr::vector<TypedValue> candidate(pull_mem);
+    candidate.reserve(self_.order_by_.size());
+
+    std::optional<int64_t> bound;
+    while (input_cursor_->Pull(frame, context)) {
+      if (!bound) {
+        bound = EvaluateBound(evaluator);
+        if (*bound == 0) break;
+      }
+
+      candidate.clear();
+      for (auto const &expression_ptr : self_.order_by_) {
+        candidate.emplace_back(expression_ptr->Accept(evaluator));
+      }
+
+      size_t slot = 0;
+      if (static_cast<int64_t>(heap.size()) < *bound) {
+        slot = order_by.size();
+        order_by.emplace_back();
+        output.emplace_back().reserve(self_.output_symbols_.size());
+        for (const Symbol &output_sym : self_.output_symbols_) {
+          output.back().emplace_back(frame[output_sym]);
+        }
+      } else if (lex_cmp(candidate, order_by[heap.front()])) {
+        std::ranges::pop_heap(heap, heap_cmp);
+        slot = heap.back();
+        heap.pop_back();
+        // Reuse the evicted row, output values are assigned in place.
+        auto output_it = output[slot].begin();
+        for (const Symbol &output_sym : self_.output_symbols_) {
+          *output_it++ = frame[output_sym];
+        }
+      } else {
+        // Not better than the worst kept row, skip copying the output.
+        continue;
+      }
+      std::swap(order_by[slot], candidate);
+      heap.push_back(slot);
+      std::ranges::push_heap(heap, heap_cmp);
+    }
+
+    // Best rows first.
+    std::ranges::sort_heap(heap, heap_cmp);
+    cache_.reserve(heap.size());
+    for (auto slot : heap) {
+      cache_.emplace_back(std::move(output[slot]));
+    }
+  }
+
+  /// Number of rows which have to be kept, `skip + limit`. Evaluated after
+  /// the first successful input Pull, like the skip expression in Skip.
+  int64_t EvaluateBound(ExpressionEvaluator &evaluator) const {
+    TypedValue limit = self_.limit_->Accept(evaluator);
+    if (limit.type() != TypedValue::Type::Int)
+      throw QueryRuntimeException("Limit on number of returned elements must be an integer.");
+    auto bound = limit.ValueInt();
+    if (bound < 0) throw QueryRuntimeException("Limit on number of returned elements must be non-negative.");
+    if (!self_.skip_) return bound;
+
+    TypedValue to_skip = self_.skip_->Accept(evaluator);
+    if (to_skip.type() != TypedValue::Type::Int)
+      throw QueryRuntimeException("Number of elements to skip must be an integer.");
+    auto const skip = to_skip.ValueInt();
+    if (skip < 0) throw QueryRuntimeException("Number of elements to skip must be non-negative.");
+    // A bound larger than the input simply degrades to a full sort.
+    return skip > std::numeric_limits<int64_t>::max() - bound ? std::numeric_limits<int64_t>::max() : bound + skip;
+  }
+
+  const TopK &self_;
+  const UniqueCursorPtr input_cursor_;
+  bool did_pull_all_{false};
+  // the kept rows in sorted order, filled on first Pull
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> cache_;
+  // iterator over the cache_, maintains state between Pulls
+  decltype(cache_.begin()) cache_it_ = cache_.begin();
+};
+
+UniqueCursorPtr TopK::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::TopKOperator);
+
+  return MakeUniqueCursorPtr<TopKCursor>(mem, *this, mem);
+}
+
+std::unique_ptr<LogicalOperator> TopK::Clone(AstStorage *storage) const {
+  auto object = std::make_unique<TopK>();
+  object->input_ = input_ ? input_->Clone(storage) : nullptr;
+  object->compare_ = compare_;
+  object->order_by_.reserve(order_by_.size());
+  for (auto *expression : order_by_) {
+    object->order_by_.emplace_back(expression ? expression->Clone(storage) : nullptr);
+  }
+  object->output_symbols_ = output_symbols_;
+  object->limit_ = limit_ ? limit_->Clone(storage) : nullptr;
+  object->skip_ = skip_ ? skip_->Clone(storage) : nullptr;
+  return object;
+}
+
+std::string TopK::ToString() const {
+  return fmt::format("TopK {{{}}}",
+                     utils::IterableToString(output_symbols_, ", ", [](const auto &sym) { return sym.name(); }));
+}
+
 Merge::Merge(const std::shared_ptr<LogicalOperator> &input, const std::shared_ptr<LogicalOperator> &merge_match,
              const std::shared_ptr<LogicalOperator> &merge_create)
     : input_(input ? input : std::make_shared<Once>()), merge_match_(merge_match), merge_create_(merge_create) {}
@@ -6292,20 +7430,38 @@ class DistinctCursor : public Cursor {
     AbortCheck(context);
 
     while (true) {
-      if (!input_cursor_->Pull(frame, context)) {
+      utils::pmr::vector<TypedValue> row(seen_rows_.get_allocator().resource());
+      if (!input_exhausted_) {
+        if (!input_cursor_->Pull(frame, context)) {
+          input_exhausted_ = true;
+          FinishPartitions();
+          continue;
+        }
+        row.reserve(self_.value_symbols_.size());
+        for (const auto &symbol : self_.value_symbols_) {
+          row.emplace_back(frame.at(symbol));
+        }
+      } else if (!ReadSpilledRow(frame, context, &row)) {
         // Nothing left to pull, we can dispose of seen_rows now
         seen_rows_.clear();
         return false;
       }
 
-      utils::pmr::vector<TypedValue> row(seen_rows_.get_allocator().resource());
-      row.reserve(self_.value_symbols_.size());
-
-      for (const auto &symbol : self_.value_symbols_) {
-        row.emplace_back(frame.at(symbol));
+      if (partitions_) {
+        // Rows which weren't seen before the rows were frozen are deferred to
+        // one of the partitions, unless they can't be written to disk.
+        if (seen_rows_.contains(row)) continue;
+        if (std::ranges::all_of(row, IsSpillable)) {
+          partitions_->WriteRow(seen_rows_.hash_function()(row), row);
+          continue;
+        }
       }
 
       if (seen_rows_.insert(std::move(row)).second) {
+        if (!partitions_ && seen_rows_.size() >= kMinRowsToSpill && current_level_ < kMaxSpillLevel &&
+            SpillThresholdExceeded(context.db_accessor)) {
+          partitions_.emplace(current_level_ + (input_exhausted_ ? 1 : 0));
+        }
         return true;
       }
     }
@@ -6316,9 +7472,58 @@ class DistinctCursor : public Cursor {
   void Reset() override {
     input_cursor_->Reset();
     seen_rows_.clear();
+    input_exhausted_ = false;
+    partitions_.reset();
+    pending_.clear();
+    current_.reset();
+    current_level_ = 0;
   }
 
  private:
+  // Don't bother with spilling small sets.
+  static constexpr size_t kMinRowsToSpill = 1024;
+  // Partitions aren't split further after this many levels.
+  static constexpr uint64_t kMaxSpillLevel = 3;
+
+  struct PendingPartition {
+    std::unique_ptr<SpillFile> file;
+    uint64_t level;
+  };
+
+  void FinishPartitions() {
+    if (!partitions_) return;
+    for (size_t i = 0; i < SpillPartitions::kNumPartitions; ++i) {
+      if (auto &partition = partitions_->partition(i)) {
+        pending_.push_back({std::move(partition), partitions_->level()});
+      }
+    }
+    partitions_.reset();
+  }
+
+  /// Reads the next row from the spilled partitions and places it on the frame.
+  bool ReadSpilledRow(Frame &frame, ExecutionContext &context, utils::pmr::vector<TypedValue> *row) {
+    while (!current_ || !current_->ReadRow(row)) {
+      if (current_) {
+        FinishPartitions();
+        current_.reset();
+      }
+      if (pending_.empty()) return false;
+      current_ = std::move(pending_.back().file);
+      current_level_ = pending_.back().level;
+      pending_.pop_back();
+      current_->FinishWriting();
+      // Rows of different partitions are always different.
+      seen_rows_.clear();
+    }
+    for (size_t i = 0; i < self_.value_symbols_.size(); ++i) {
+      if (context.frame_change_collector) {
+        context.frame_change_collector->ResetTrackingValue(self_.value_symbols_[i].name());
+      }
+      frame[self_.value_symbols_[i]] = (*row)[i];
+    }
+    return true;
+  }
+
   const Distinct &self_;
   const UniqueCursorPtr input_cursor_;
   // a set of already seen rows
@@ -6328,6 +7533,14 @@ class DistinctCursor : public Cursor {
                             utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
                             TypedValueVectorEqual>
       seen_rows_;
+  bool input_exhausted_{false};
+  // Once the query used too much memory (see `--query-spill-threshold`),
+  // `seen_rows_` is frozen and new rows are written to disk. Each partition is
+  // deduplicated separately after the input is exhausted.
+  std::optional<SpillPartitions> partitions_;
+  std::vector<PendingPartition> pending_;
+  std::unique_ptr<SpillFile> current_;
+  uint64_t current_level_{0};
 };
 
 Distinct::Distinct(const std::shared_ptr<LogicalOperator> &input, const std::vector<Symbol> &value_symbols)
@@ -7523,13 +8736,14 @@ class HashJoinCursor : public Cursor {
     }
 
     // If left_op yielded zero results, there is no cartesian product.
-    if (hashtable_.empty()) {
+    if (hashtable_.empty() && !build_partitions_) {
       return false;
     }
 
-    auto restore_frame = [&frame, &context](const auto &symbols, const auto &restore_from) {
-      for (const auto &symbol : symbols) {
-        frame[symbol] = restore_from[symbol.position()];
+    auto restore_frame = [&frame, &context](const auto &symbols, const auto &restore_from, bool by_position) {
+      for (size_t i = 0; i < symbols.size(); ++i) {
+        const auto &symbol = symbols[i];
+        frame[symbol] = restore_from[by_position ? symbol.position() : i];
         if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
           context.frame_change_collector->ResetTrackingValue(symbol.name());
         }
@@ -7539,8 +8753,29 @@ class HashJoinCursor : public Cursor {
     if (!common_value_found_) {
       // Pull from the right_op until there’s a mergeable frame
       while (true) {
+        if (processing_partitions_) {
+          // Spilled rows hold the join value followed by the values of the
+          // right symbols.
+          if (!current_probe_ || !current_probe_->ReadRow(&right_op_frame_)) {
+            if (!LoadNextPartition()) return false;
+            continue;
+          }
+          if (!hashtable_.contains(right_op_frame_[0])) continue;
+          common_value = right_op_frame_[0];
+          right_op_frame_.erase(right_op_frame_.begin());
+          restore_frame(self_.right_symbols_, right_op_frame_, false);
+          common_value_found_ = true;
+          left_op_frame_it_ = hashtable_[common_value].begin();
+          break;
+        }
+
         auto pulled = right_op_cursor_->Pull(frame, context);
-        if (!pulled) return false;
+        if (!pulled) {
+          if (!build_partitions_) return false;
+          // Join the spilled partitions once the right_op is exhausted.
+          processing_partitions_ = true;
+          continue;
+        }
 
         // Check if the join value from the pulled frame is shared with any left frames
         ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
@@ -7554,13 +8789,18 @@ class HashJoinCursor : public Cursor {
           left_op_frame_it_ = hashtable_[common_value].begin();
           break;
         }
+        if (build_partitions_ && !right_value.IsNull() &&
+            build_partitions_->partition(build_partitions_->PartitionIndex(TypedValue::Hash{}(right_value)))) {
+          // The matching left frames may have been spilled.
+          SpillRow(&*probe_partitions_, right_value, self_.right_symbols_, frame);
+        }
       }
     } else {
       // Restore the right frame ahead of restoring the left frame
-      restore_frame(self_.right_symbols_, right_op_frame_);
+      restore_frame(self_.right_symbols_, right_op_frame_, !processing_partitions_);
     }
 
-    restore_frame(self_.left_symbols_, *left_op_frame_it_);
+    restore_frame(self_.left_symbols_, *left_op_frame_it_, !processing_partitions_);
 
     left_op_frame_it_++;
     // When all left frames with the common value have been joined, move on to pulling and joining the next right
@@ -7585,24 +8825,82 @@ class HashJoinCursor : public Cursor {
     left_op_frame_it_ = {};
     hash_join_initialized_ = false;
     common_value_found_ = false;
+    build_partitions_.reset();
+    probe_partitions_.reset();
+    processing_partitions_ = false;
+    next_partition_ = 0;
+    current_probe_.reset();
   }
 
  private:
+  // Don't bother with spilling small hash tables.
+  static constexpr size_t kMinRowsToSpill = 1024;
+
   void InitializeHashJoin(Frame &frame, ExecutionContext &context) {
+    size_t num_rows = 0;
     // Pull all left_op_ frames
     while (left_op_cursor_->Pull(frame, context)) {
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                     storage::View::OLD, nullptr, &context.number_of_hops);
       auto left_value = self_.hash_join_condition_->expression1_->Accept(evaluator);
-      if (left_value.type() != TypedValue::Type::Null) {
-        hashtable_[left_value].emplace_back(frame.elems().begin(), frame.elems().end());
+      if (left_value.type() == TypedValue::Type::Null) continue;
+      if (build_partitions_) {
+        if (auto it = hashtable_.find(left_value); it != hashtable_.end()) {
+          it->second.emplace_back(frame.elems().begin(), frame.elems().end());
+        } else {
+          SpillRow(&*build_partitions_, left_value, self_.left_symbols_, frame);
+        }
+        continue;
+      }
+      hashtable_[left_value].emplace_back(frame.elems().begin(), frame.elems().end());
+      if (++num_rows >= kMinRowsToSpill && SpillThresholdExceeded(context.db_accessor)) {
+        build_partitions_.emplace();
+        probe_partitions_.emplace();
+      }
+    }
+  }
+
+  static void SpillRow(SpillPartitions *partitions, const TypedValue &join_value, const std::vector<Symbol> &symbols,
+                       const Frame &frame) {
+    std::vector<TypedValue> row;
+    row.reserve(symbols.size() + 1);
+    row.push_back(join_value);
+    for (const auto &symbol : symbols) {
+      row.push_back(frame[symbol]);
+    }
+    if (!std::ranges::all_of(row, IsSpillable)) {
+      throw QueryRuntimeException("HashJoin can't move rows holding functions to disk.");
+    }
+    partitions->WriteRow(TypedValue::Hash{}(join_value), row);
+  }
+
+  /// Loads the left frames of the next spilled partition into `hashtable_`.
+  bool LoadNextPartition() {
+    for (; next_partition_ < SpillPartitions::kNumPartitions; ++next_partition_) {
+      auto &build = build_partitions_->partition(next_partition_);
+      current_probe_ = std::move(probe_partitions_->partition(next_partition_));
+      if (!build || !current_probe_) continue;
+
+      hashtable_.clear();
+      build->FinishWriting();
+      utils::pmr::vector<TypedValue> row(hashtable_.get_allocator().resource());
+      while (build->ReadRow(&row)) {
+        hashtable_[row[0]].emplace_back(std::make_move_iterator(row.begin() + 1), std::make_move_iterator(row.end()));
       }
+      build.reset();
+      current_probe_->FinishWriting();
+      ++next_partition_;
+      return true;
     }
+    current_probe_.reset();
+    return false;
   }
 
   const HashJoin &self_;
   const UniqueCursorPtr left_op_cursor_;
   const UniqueCursorPtr right_op_cursor_;
+  // Holds whole left frames, or only the values of the left symbols while
+  // processing spilled partitions.
   utils::pmr::unordered_map<TypedValue, utils::pmr::vector<utils::pmr::vector<TypedValue>>, TypedValue::Hash,
                             TypedValue::BoolEqual>
       hashtable_;
@@ -7611,6 +8909,15 @@ class HashJoinCursor : public Cursor {
   bool hash_join_initialized_{false};
   bool common_value_found_{false};
   TypedValue common_value;
+  // Once the query used too much memory (see `--query-spill-threshold`), left
+  // frames with join values which aren't in `hashtable_` yet are written to
+  // disk, as well as the right frames which may join with them. Matching
+  // partitions are joined after the right_op is exhausted.
+  std::optional<SpillPartitions> build_partitions_;
+  std::optional<SpillPartitions> probe_partitions_;
+  bool processing_partitions_{false};
+  size_t next_partition_{0};
+  std::unique_ptr<SpillFile> current_probe_;
 };
 }  // namespace
 
@@ -7953,6 +9260,235 @@ std::unique_ptr<LogicalOperator> PeriodicSubquery::Clone(AstStorage *storage) co
   return object;
 }
 
+Gather::Gather(const std::shared_ptr<LogicalOperator> &input, uint64_t num_workers)
+    : input_(input), num_workers_(num_workers) {}
+
+ACCEPT_WITH_INPUT(Gather)
+
+std::vector<Symbol> Gather::ModifiedSymbols(const SymbolTable &table) const { return input_->ModifiedSymbols(table); }
+
+std::vector<Symbol> Gather::OutputSymbols(const SymbolTable &table) const { return input_->OutputSymbols(table); }
+
+std::string Gather::ToString() const { return fmt::format("Gather ({} workers)", num_workers_); }
+
+std::unique_ptr<LogicalOperator> Gather::Clone(AstStorage *storage) const {
+  auto object = std::make_unique<Gather>();
+  object->input_ = input_ ? input_->Clone(storage) : nullptr;
+  object->num_workers_ = num_workers_;
+  return object;
+}
+
+namespace {
+
+// Number of morsels each thread gets on average. More morsels balance the work
+// better at the cost of more skip list lookups.
+constexpr uint64_t kMorselsPerWorker = 16;
+
+const ScanAll *FindParallelScan(const LogicalOperator &op) {
+  const auto *current = &op;
+  while (current->GetTypeInfo() != ScanAll::kType && current->GetTypeInfo() != ScanAllByLabel::kType) {
+    if (!current->HasSingleInput() || !current->input()) return nullptr;
+    current = current->input().get();
+  }
+  if (!current->input() || current->input()->GetTypeInfo() != Once::kType) return nullptr;
+  return static_cast<const ScanAll *>(current);
+}
+
+/// State shared between the `GatherCursor` and the tasks it scheduled on the
+/// worker pool. A task may start after the cursor is gone, so a task only
+/// touches the cursor after successfully registering itself as running.
+struct GatherSharedState {
+  std::mutex lock;
+  std::condition_variable cv;
+  bool closed{false};
+  uint64_t running{0};
+  std::deque<std::vector<TypedValue>> rows;
+  std::exception_ptr error;
+};
+
+class GatherCursor : public Cursor {
+ public:
+  GatherCursor(const Gather &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), state_(std::make_shared<GatherSharedState>()) {}
+
+  ~GatherCursor() override { StopWorkers(); }
+
+  GatherCursor(const GatherCursor &) = delete;
+  GatherCursor &operator=(const GatherCursor &) = delete;
+  GatherCursor(GatherCursor &&) = delete;
+  GatherCursor &operator=(GatherCursor &&) = delete;
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    AbortCheck(context);
+
+    if (!started_) {
+      Start(context);
+      started_ = true;
+    }
+
+    if (!morsels_) return input_cursor_->Pull(frame, context);
+
+    if (!local_done_) {
+      // The calling thread processes morsels as well, which guarantees
+      // progress even when all of the pool threads are busy.
+      context.morsel_source = morsels_.get();
+      const utils::OnScopeExit reset_morsel_source{[&context] { context.morsel_source = nullptr; }};
+      try {
+        if (input_cursor_->Pull(frame, context)) return true;
+      } catch (...) {
+        StopWorkers();
+        throw;
+      }
+      local_done_ = true;
+      // Tasks which didn't start until now would have nothing left to do.
+      std::lock_guard guard(state_->lock);
+      state_->closed = true;
+    }
+
+    std::unique_lock guard(state_->lock);
+    while (true) {
+      if (state_->error) {
+        auto error = state_->error;
+        guard.unlock();
+        StopWorkers();
+        std::rethrow_exception(error);
+      }
+      if (!state_->rows.empty()) {
+        auto row = std::move(state_->rows.front());
+        state_->rows.pop_front();
+        guard.unlock();
+        for (size_t i = 0; i < output_symbols_.size(); ++i) {
+          frame[output_symbols_[i]] = std::move(row[i]);
+        }
+        return true;
+      }
+      if (state_->running == 0) return false;
+      state_->cv.wait_for(guard, std::chrono::milliseconds(100));
+      if (auto const reason = context.stopping_context.MustAbort(); reason != AbortReason::NO_ABORT) {
+        guard.unlock();
+        StopWorkers();
+        throw HintedAbortError(reason);
+      }
+    }
+  }
+
+  void Shutdown() override {
+    StopWorkers();
+    input_cursor_->Shutdown();
+  }
+
+  void Reset() override {
+    StopWorkers();
+    input_cursor_->Reset();
+    state_ = std::make_shared<GatherSharedState>();
+    morsels_.reset();
+    worker_context_.reset();
+    output_symbols_.clear();
+    started_ = false;
+    local_done_ = false;
+  }
+
+ private:
+  void Start(ExecutionContext &context) {
+    if (self_.num_workers_ < 2 || !CanUseWorkerPool(context)) return;
+    const auto *scan = FindParallelScan(*self_.input_);
+    if (!scan) return;
+
+    const auto num_morsels = self_.num_workers_ * kMorselsPerWorker;
+    auto vertices = scan->GetTypeInfo() == ScanAllByLabel::kType
+                        ? context.db_accessor->ChunkedVertices(
+                              scan->view_, static_cast<const ScanAllByLabel *>(scan)->label_, num_morsels)
+                        : context.db_accessor->ChunkedVertices(scan->view_, num_morsels);
+    morsels_ = std::make_unique<MorselSource>(*scan, std::move(vertices));
+    output_symbols_ = self_.input_->ModifiedSymbols(context.symbol_table);
+    worker_context_ = std::make_unique<WorkerContext>(MakeWorkerContext(context));
+
+    for (uint64_t i = 1; i < self_.num_workers_; ++i) {
+      context.worker_pool->AddTask(
+          [state = state_, self = &self_, morsels = morsels_.get(), worker_context = worker_context_.get(),
+           symbols = &output_symbols_] { RunWorker(state, self, morsels, worker_context, symbols); });
+    }
+  }
+
+  /// The cursor may be gone by the time the task starts, so the pointers into
+  /// it are only dereferenced once the worker is registered as running.
+  static void RunWorker(const std::shared_ptr<GatherSharedState> &state, const Gather *self_ptr,
+                        MorselSource *morsels, const WorkerContext *worker_context_ptr,
+                        const std::vector<Symbol> *output_symbols_ptr) {
+    {
+      std::lock_guard guard(state->lock);
+      if (state->closed) return;
+      ++state->running;
+    }
+    const utils::OnScopeExit unregister{[&state] {
+      std::lock_guard guard(state->lock);
+      --state->running;
+      state->cv.notify_all();
+    }};
+    const auto &self = *self_ptr;
+    const auto &worker_context = *worker_context_ptr;
+    const auto &output_symbols = *output_symbols_ptr;
+
+    try {
+      worker_context.db_accessor->TrackCurrentThreadAllocations();
+      const utils::OnScopeExit untrack{[] { memgraph::memory::StopTrackingCurrentThread(); }};
+      // The transaction's cache of long delta chains is used by the calling thread at the same time
+      const storage::ThreadVertexInfoCache thread_cache;
+      utils::MonotonicBufferResource memory(kWorkerMemoryBlockSize);
+
+      auto context = MakeWorkerExecutionContext(worker_context, &memory);
+      context.morsel_source = morsels;
+
+      Frame frame(context.symbol_table.max_position(), &memory);
+      auto cursor = self.input_->MakeCursor(&memory);
+      while (cursor->Pull(frame, context)) {
+        std::vector<TypedValue> row;
+        row.reserve(output_symbols.size());
+        for (const auto &symbol : output_symbols) {
+          row.emplace_back(frame[symbol], utils::NewDeleteResource());
+        }
+        std::lock_guard guard(state->lock);
+        state->rows.emplace_back(std::move(row));
+        state->cv.notify_all();
+      }
+      cursor->Shutdown();
+    } catch (...) {
+      morsels->Cancel();
+      std::lock_guard guard(state->lock);
+      if (!state->error) state->error = std::current_exception();
+    }
+  }
+
+  /// Prevents new tasks from starting and waits for the running ones to finish.
+  void StopWorkers() {
+    if (!morsels_) return;
+    morsels_->Cancel();
+    std::unique_lock guard(state_->lock);
+    state_->closed = true;
+    state_->cv.wait(guard, [this] { return state_->running == 0; });
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
+  const Gather &self_;
+  const UniqueCursorPtr input_cursor_;
+  std::shared_ptr<GatherSharedState> state_;
+  std::unique_ptr<MorselSource> morsels_;
+  std::unique_ptr<WorkerContext> worker_context_;
+  std::vector<Symbol> output_symbols_;
+  bool started_{false};
+  bool local_done_{false};
+};
+
+}  // namespace
+
+UniqueCursorPtr Gather::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::GatherOperator);
+  return MakeUniqueCursorPtr<GatherCursor>(mem, *this, mem);
+}
+
 ScanAllByPointDistance::ScanAllByPointDistance(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
                                                storage::LabelId label, storage::PropertyId property,
                                                Expression *cmp_value, Expression *boundary_value,
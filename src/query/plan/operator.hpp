@@ -20,6 +20,7 @@
 
 #include "query/common.hpp"
 #include "query/frontend/semantic/symbol.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/parameters.hpp"
 #include "query/plan/point_distance_condition.hpp"
 #include "query/plan/preprocess.hpp"
@@ -37,6 +38,7 @@ namespace memgraph::query {
 struct ExecutionContext;
 class ExpressionEvaluator;
 class Frame;
+class FrameBatch;
 class SymbolTable;
 
 namespace plan {
@@ -84,6 +86,24 @@ class Cursor {
   /// @throws QueryRuntimeException if something went wrong with execution
   virtual bool Pull(Frame &, ExecutionContext &) = 0;
 
+  /// Run iterations of a @c LogicalOperator until the batch is full.
+  ///
+  /// The batch is cleared first and afterwards holds the pulled rows. The
+  /// default implementation calls `Pull` for each row and copies the frame
+  /// into the batch. Operators which can process many rows at once override
+  /// this to pull their input in batches too. A cursor must be pulled either
+  /// only with `Pull` or only with `PullBatch` until it is `Reset`.
+  ///
+  /// @param FrameBatch Where the rows are written to.
+  /// @param Frame Used as scratch space while evaluating a row, its contents
+  ///     are unspecified afterwards.
+  /// @param ExecutionContext Used to get the position of symbols in frame and
+  ///     other information.
+  ///
+  /// @return false if no rows were pulled, i.e. the cursor is exhausted.
+  /// @throws QueryRuntimeException if something went wrong with execution
+  virtual bool PullBatch(FrameBatch &, Frame &, ExecutionContext &);
+
   /// Resets the Cursor to its initial state.
   virtual void Reset() = 0;
 
@@ -93,6 +113,43 @@ class Cursor {
   virtual ~Cursor() = default;
 };
 
+/// Pulls the input of an operator that is itself pulled in batches.
+///
+/// `Cursor::PullBatch` requires that the frame passed to it isn't modified
+/// between calls, so the input gets a frame of its own. Until `Enable` is
+/// called `Pull` simply forwards to `Cursor::Pull`. Once enabled, `Pull`
+/// pulls the input in batches and moves the buffered rows into the frame one
+/// at a time, for operators which still process their input row by row.
+class BatchedInput {
+ public:
+  BatchedInput();
+  BatchedInput(const BatchedInput &) = delete;
+  BatchedInput &operator=(const BatchedInput &) = delete;
+  BatchedInput(BatchedInput &&) noexcept;
+  BatchedInput &operator=(BatchedInput &&) noexcept;
+  ~BatchedInput();
+
+  /// Start pulling the input in batches of the given capacity. Does nothing
+  /// if already enabled.
+  void Enable(int64_t frame_size, size_t capacity, utils::MemoryResource *mem);
+  bool IsEnabled() const { return input_frame_ != nullptr; }
+
+  /// Pulls a single row of the input into the frame.
+  bool Pull(Cursor &input, Frame &frame, ExecutionContext &context);
+
+  /// Pulls the next batch of rows of the input. Must be enabled.
+  bool PullBatch(Cursor &input, FrameBatch &batch, ExecutionContext &context);
+
+  /// Drops the buffered rows and goes back to pulling rows one at a time.
+  void Reset();
+
+ private:
+  std::unique_ptr<Frame> input_frame_;
+  std::unique_ptr<FrameBatch> buffer_;
+  size_t capacity_{0};
+  size_t position_{0};
+};
+
 /// unique_ptr to Cursor managed with a custom deleter.
 /// This allows us to use utils::MemoryResource for allocation.
 using UniqueCursorPtr = std::unique_ptr<Cursor, std::function<void(Cursor *)>>;
@@ -144,6 +201,7 @@ class Aggregate;
 class Skip;
 class Limit;
 class OrderBy;
+class TopK;
 class Merge;
 class Optional;
 class Unwind;
@@ -161,6 +219,7 @@ class HashJoin;
 class RollUpApply;
 class PeriodicCommit;
 class PeriodicSubquery;
+class Gather;
 
 using LogicalOperatorCompositeVisitor = utils::CompositeVisitor<
     Once, CreateNode, CreateExpand, ScanAll, ScanAllByLabel, ScanAllByLabelProperties, ScanAllById, ScanAllByEdge,
@@ -168,9 +227,9 @@ using LogicalOperatorCompositeVisitor = utils::CompositeVisitor<
     ScanAllByEdgeProperty, ScanAllByEdgePropertyValue, ScanAllByEdgePropertyRange, ScanAllByEdgeId,
     ScanAllByPointDistance, ScanAllByPointWithinbbox, Expand, ExpandVariable, ConstructNamedPath, Filter, Produce,
     Delete, SetProperty, SetProperties, SetLabels, RemoveProperty, RemoveLabels, EdgeUniquenessFilter, Accumulate,
-    Aggregate, Skip, Limit, OrderBy, Merge, Optional, Unwind, Distinct, Union, Cartesian, CallProcedure, LoadCsv,
-    Foreach, EmptyResult, EvaluatePatternFilter, Apply, IndexedJoin, HashJoin, RollUpApply, PeriodicCommit,
-    PeriodicSubquery>;
+    Aggregate, Skip, Limit, OrderBy, TopK, Merge, Optional, Unwind, Distinct, Union, Cartesian, CallProcedure,
+    LoadCsv, Foreach, EmptyResult, EvaluatePatternFilter, Apply, IndexedJoin, HashJoin, RollUpApply, PeriodicCommit,
+    PeriodicSubquery, Gather>;
 
 using LogicalOperatorLeafVisitor = utils::LeafVisitor<Once>;
 
@@ -958,18 +1017,20 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     ExpandCursor(const Expand &, utils::MemoryResource *);
     ExpandCursor(const Expand &, int64_t input_degree, int64_t existing_node_degree, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(FrameBatch &, Frame &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
     ExpansionInfo GetExpansionInfo(Frame &);
 
    private:
-    using InEdgeT = std::vector<EdgeAccessor>;
+    using InEdgeT = EdgesRange;
     using InEdgeIteratorT = decltype(std::declval<InEdgeT>().begin());
-    using OutEdgeT = std::vector<EdgeAccessor>;
+    using OutEdgeT = EdgesRange;
     using OutEdgeIteratorT = decltype(std::declval<OutEdgeT>().begin());
 
     const Expand &self_;
     const UniqueCursorPtr input_cursor_;
+    BatchedInput input_;
 
     // The iterable over edges and the current edge iterator are referenced via
     // optional because they can not be initialized in the constructor of
@@ -982,6 +1043,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     int64_t prev_input_degree_{-1};
     int64_t prev_existing_degree_{-1};
 
+    bool PullNext(Frame &, ExecutionContext &);
     bool InitEdges(Frame &, ExecutionContext &);
   };
 
@@ -1171,17 +1233,25 @@ class Filter : public memgraph::query::plan::LogicalOperator {
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
 
  private:
+  CompiledExpressionsCache compiled_expressions_;
+
   class FilterCursor : public Cursor {
    public:
     FilterCursor(const Filter &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(FrameBatch &, Frame &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
    private:
+    bool Evaluate(ExpressionEvaluator &evaluator);
+
     const Filter &self_;
     const UniqueCursorPtr input_cursor_;
+    BatchedInput input_;
     const std::vector<UniqueCursorPtr> pattern_filter_cursors_;
+    const std::shared_ptr<const CompiledExpressions> compiled_;
+    std::optional<CompiledExpressions::Constants> constants_;
   };
 };
 
@@ -1219,16 +1289,24 @@ class Produce : public memgraph::query::plan::LogicalOperator {
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
 
  private:
+  CompiledExpressionsCache compiled_expressions_;
+
   class ProduceCursor : public Cursor {
    public:
     ProduceCursor(const Produce &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(FrameBatch &, Frame &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
    private:
+    void Evaluate(Frame &frame, ExecutionContext &context, ExpressionEvaluator &evaluator);
+
     const Produce &self_;
     const UniqueCursorPtr input_cursor_;
+    BatchedInput input_;
+    const std::shared_ptr<const CompiledExpressions> compiled_;
+    std::optional<CompiledExpressions::Constants> constants_;
   };
 };
 
@@ -1863,6 +1941,48 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
 };
 
+/// Logical operator for ordering results when only the first rows are needed
+/// (`ORDER BY ... [SKIP s] LIMIT l`).
+///
+/// Works like OrderBy, but keeps only the best `s + l` rows in a bounded heap.
+/// A row whose ordering values are not better than the worst kept row is
+/// rejected before its output symbols are copied. Memory usage is therefore
+/// proportional to `s + l` and not to the number of input rows.
+///
+/// TopK only orders and bounds the rows, the actual skipping and limiting is
+/// still done by the Skip and Limit operators above it. The limit and skip
+/// expressions follow the same rules as in those operators.
+class TopK : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  TopK() = default;
+
+  TopK(const std::shared_ptr<LogicalOperator> &input, const std::vector<SortItem> &order_by,
+       const std::vector<Symbol> &output_symbols, Expression *limit, Expression *skip = nullptr);
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> OutputSymbols(const SymbolTable &) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  TypedValueVectorCompare compare_;
+  std::vector<Expression *> order_by_;
+  std::vector<Symbol> output_symbols_;
+  Expression *limit_;
+  // Optional, nullptr when there is no Skip.
+  Expression *skip_{nullptr};
+
+  std::string ToString() const override;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
+};
+
 /// Merge operator. For every sucessful Pull from the
 /// input operator a Pull from the merge_match is attempted. All
 /// successfull Pulls from the merge_match are passed on as output.
@@ -2455,5 +2575,43 @@ class PeriodicSubquery : public memgraph::query::plan::LogicalOperator {
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
 };
 
+/// Runs the input branch on multiple threads and merges the produced rows.
+///
+/// The input branch must be a single chain of operators ending with a
+/// `ScanAll` or `ScanAllByLabel` over `Once`. The scanned vertices are split
+/// into morsels (chunks) which are dynamically distributed between the calling
+/// thread and up to `num_workers_ - 1` worker threads. Each thread executes
+/// its own copy of the input branch, so the rows produced by `Gather` are in no
+/// particular order.
+///
+/// `Gather` is introduced by the planner (see `RewriteWithParallelScan`) and
+/// falls back to a plain, single-threaded pull of its input when parallel
+/// execution isn't possible (no worker pool, profiling, fine-grained access
+/// control, hops limit or on-disk storage).
+class Gather : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  Gather() = default;
+  Gather(const std::shared_ptr<LogicalOperator> &input, uint64_t num_workers);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+  std::vector<Symbol> OutputSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::string ToString() const override;
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  uint64_t num_workers_{1};
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
+};
+
 }  // namespace plan
 }  // namespace memgraph::query
@@ -136,6 +136,8 @@ constexpr utils::TypeInfo query::plan::Limit::kType{utils::TypeId::LIMIT, "Limit
 constexpr utils::TypeInfo query::plan::OrderBy::kType{utils::TypeId::ORDERBY, "OrderBy",
                                                       &query::plan::LogicalOperator::kType};
 
+constexpr utils::TypeInfo query::plan::TopK::kType{utils::TypeId::TOPK, "TopK", &query::plan::LogicalOperator::kType};
+
 constexpr utils::TypeInfo query::plan::Merge::kType{utils::TypeId::MERGE, "Merge",
                                                     &query::plan::LogicalOperator::kType};
 
@@ -185,6 +187,8 @@ constexpr utils::TypeInfo query::plan::PeriodicCommit::kType{utils::TypeId::PERI
                                                              &query::plan::LogicalOperator::kType};
 constexpr utils::TypeInfo query::plan::PeriodicSubquery::kType{utils::TypeId::PERIODIC_SUBQUERY, "PeriodicSubquery",
                                                                &query::plan::LogicalOperator::kType};
+constexpr utils::TypeInfo query::plan::Gather::kType{utils::TypeId::GATHER, "Gather",
+                                                     &query::plan::LogicalOperator::kType};
 
 constexpr utils::TypeInfo query::plan::ScanAllByPointDistance::kType{
     utils::TypeId::SCAN_ALL_BY_POINT_DISTANCE, "ScanAllByPointDistance", &query::plan::ScanAllByPointDistance::kType};
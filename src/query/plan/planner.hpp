@@ -27,8 +27,10 @@
 #include "query/plan/rewrite/enum.hpp"
 #include "query/plan/rewrite/index_lookup.hpp"
 #include "query/plan/rewrite/join.hpp"
+#include "query/plan/rewrite/parallel.hpp"
 #include "query/plan/rewrite/periodic_delete.hpp"
 #include "query/plan/rewrite/plan_validator.hpp"
+#include "query/plan/rewrite/top_k.hpp"
 #include "query/plan/rule_based_planner.hpp"
 #include "query/plan/variable_start_planner.hpp"
 #include "query/plan/vertex_count_cache.hpp"
@@ -51,6 +53,7 @@ class PostProcessor final {
 
  public:
   IndexHints index_hints_{};
+  const CardinalityFeedback *cardinality_feedback_{nullptr};
 
   using ProcessedPlan = std::unique_ptr<LogicalOperator>;
 
@@ -70,7 +73,9 @@ class PostProcessor final {
            [&](auto p) { return RewriteWithIndexLookup(std::move(p), symbol_table, ast, db, index_hints_); } |
            [&](auto p) { return RewriteWithJoinRewriter(std::move(p), symbol_table, ast, db); } |
            [&](auto p) { return RewriteWithEdgeIndexRewriter(std::move(p), symbol_table, ast, db); } |
-           [&](auto p) { return RewritePeriodicDelete(std::move(p), symbol_table, ast, db); };
+           [&](auto p) { return RewritePeriodicDelete(std::move(p), symbol_table, ast, db); } |
+           [&](auto p) { return RewriteWithTopK(std::move(p), symbol_table, ast, db); } |
+           [&](auto p) { return RewriteWithParallelScan(std::move(p), symbol_table, ast, db); };
   }
 
   bool IsValidPlan(const std::unique_ptr<LogicalOperator> &plan, const SymbolTable &table) {
@@ -80,7 +85,7 @@ class PostProcessor final {
   template <class TVertexCounts>
   PlanCost EstimatePlanCost(const std::unique_ptr<LogicalOperator> &plan, TVertexCounts *vertex_counts,
                             const SymbolTable &table) {
-    return query::plan::EstimatePlanCost(vertex_counts, table, parameters_, *plan, index_hints_);
+    return query::plan::EstimatePlanCost(vertex_counts, table, parameters_, *plan, index_hints_, cardinality_feedback_);
   }
 };
 
@@ -186,6 +191,7 @@ auto MakeLogicalPlan(TPlanningContext *context, TPlanPostProcess *post_process,
 template <class TPlanningContext>
 auto MakeLogicalPlan(TPlanningContext *context, const Parameters &parameters, bool use_variable_planner) {
   PostProcessor post_processor(parameters, context->query->pre_query_directives_.index_hints_, context->db);
+  post_processor.cardinality_feedback_ = context->cardinality_feedback;
   return MakeLogicalPlan(context, &post_processor, use_variable_planner);
 }
 
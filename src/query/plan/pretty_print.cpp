@@ -183,6 +183,11 @@ bool PlanPrinter::PreVisit(query::plan::OrderBy &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::TopK &op) {
+  WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
+  return true;
+}
+
 bool PlanPrinter::PreVisit(query::plan::Merge &op) {
   WithPrintLn([](auto &out) { out << "* Merge"; });
   Branch(*op.merge_match_, "On Match");
@@ -200,6 +205,7 @@ bool PlanPrinter::PreVisit(query::plan::Optional &op) {
 
 PRE_VISIT(Unwind);
 PRE_VISIT(Distinct);
+PRE_VISIT(Gather);
 
 bool PlanPrinter::PreVisit(query::plan::Union &op) {
   WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
@@ -1005,6 +1011,27 @@ bool PlanToJsonVisitor::PreVisit(OrderBy &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(TopK &op) {
+  json self;
+  self["name"] = "TopK";
+
+  for (auto i = 0; i < op.order_by_.size(); ++i) {
+    json json;
+    json["ordering"] = ToString(op.compare_.orderings()[i].ordering());
+    json["expression"] = ToJson(op.order_by_[i], *dba_);
+    self["order_by"].push_back(json);
+  }
+  self["output_symbols"] = ToJson(op.output_symbols_);
+  self["limit"] = ToJson(op.limit_, *dba_);
+  self["skip"] = op.skip_ ? ToJson(op.skip_, *dba_) : json();
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(Merge &op) {
   json self;
   self["name"] = "Merge";
@@ -1232,6 +1259,18 @@ bool PlanToJsonVisitor::PreVisit(RollUpApply &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(Gather &op) {
+  json self;
+  self["name"] = "Gather";
+  self["num_workers"] = op.num_workers_;
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(PeriodicCommit &op) {
   json self;
   self["name"] = "PeriodicCommit";
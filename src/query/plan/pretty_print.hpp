@@ -98,11 +98,13 @@ class PlanPrinter : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(Skip &) override;
   bool PreVisit(Limit &) override;
   bool PreVisit(OrderBy &) override;
+  bool PreVisit(TopK &) override;
   bool PreVisit(Distinct &) override;
   bool PreVisit(Union &) override;
   bool PreVisit(RollUpApply &) override;
   bool PreVisit(PeriodicCommit &) override;
   bool PreVisit(PeriodicSubquery &) override;
+  bool PreVisit(Gather &) override;
 
   bool PreVisit(Unwind &) override;
   bool PreVisit(CallProcedure &) override;
@@ -235,6 +237,7 @@ class PlanToJsonVisitor : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(Skip &) override;
   bool PreVisit(Limit &) override;
   bool PreVisit(OrderBy &) override;
+  bool PreVisit(TopK &) override;
   bool PreVisit(Distinct &) override;
   bool PreVisit(Union &) override;
 
@@ -245,6 +248,7 @@ class PlanToJsonVisitor : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(RollUpApply &) override;
   bool PreVisit(PeriodicCommit &) override;
   bool PreVisit(PeriodicSubquery &) override;
+  bool PreVisit(Gather &) override;
 
   bool Visit(Once &) override;
 
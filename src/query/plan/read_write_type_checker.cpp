@@ -70,8 +70,10 @@ PRE_VISIT(Aggregate, RWType::NONE, true)
 PRE_VISIT(Skip, RWType::NONE, true)
 PRE_VISIT(Limit, RWType::NONE, true)
 PRE_VISIT(OrderBy, RWType::NONE, true)
+PRE_VISIT(TopK, RWType::NONE, true)
 PRE_VISIT(Distinct, RWType::NONE, true)
 PRE_VISIT(PeriodicCommit, RWType::NONE, true)
+PRE_VISIT(Gather, RWType::NONE, true)
 
 bool ReadWriteTypeChecker::PreVisit(Union &op) {
   op.left_op_->Accept(*this);
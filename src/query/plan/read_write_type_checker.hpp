@@ -88,6 +88,7 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
   bool PreVisit(Skip &) override;
   bool PreVisit(Limit &) override;
   bool PreVisit(OrderBy &) override;
+  bool PreVisit(TopK &) override;
   bool PreVisit(Distinct &) override;
   bool PreVisit(Union &) override;
 
@@ -101,6 +102,7 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
   bool PreVisit(RollUpApply &) override;
   bool PreVisit(PeriodicSubquery &) override;
   bool PreVisit(PeriodicCommit &) override;
+  bool PreVisit(Gather &) override;
 
   bool Visit(Once &) override;
 
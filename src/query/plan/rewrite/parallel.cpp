@@ -0,0 +1,169 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/rewrite/parallel.hpp"
+
+#include <algorithm>
+
+#include "query/frontend/ast/ast.hpp"
+#include "utils/flag_validation.hpp"
+#include "utils/string.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_parallel_workers, 1,
+                        "Number of threads used to execute a single aggregation over a scan or a level of a "
+                        "breadth-first expansion. Default is 1, which disables parallel execution.",
+                        FLAG_IN_RANGE(1, 256));
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_parallel_expansion_min_frontier, 1024,
+              "Levels of a breadth-first expansion with at least this many vertices are expanded by "
+              "--query-parallel-workers threads.");
+
+namespace memgraph::query::plan::impl {
+
+namespace {
+
+/// Looks for expressions which can't be evaluated from multiple threads at
+/// the same time, e.g. `counter` which modifies the shared evaluation context
+/// or user-defined functions.
+class ParallelUnsafeExpressionFinder : public HierarchicalTreeVisitor {
+ public:
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool PreVisit(Function &function) override {
+    if (function.IsUserDefined() || utils::ToUpperCase(function.function_name_) == "COUNTER") {
+      found_ = true;
+    }
+    return !found_;
+  }
+
+  bool PreVisit(Exists & /*exists*/) override {
+    found_ = true;
+    return false;
+  }
+
+  bool PreVisit(PatternComprehension & /*pattern_comprehension*/) override {
+    found_ = true;
+    return false;
+  }
+
+  bool Visit(Identifier & /*identifier*/) override { return true; }
+  bool Visit(PrimitiveLiteral & /*literal*/) override { return true; }
+  bool Visit(ParameterLookup & /*parameter_lookup*/) override { return true; }
+  bool Visit(EnumValueAccess & /*enum_value_access*/) override { return true; }
+
+  bool found() const { return found_; }
+
+ private:
+  bool found_{false};
+};
+
+}  // namespace
+
+bool IsParallelSafe(Expression *expression) {
+  if (!expression) return true;
+  ParallelUnsafeExpressionFinder finder;
+  expression->Accept(finder);
+  return !finder.found();
+}
+
+namespace {
+
+bool CanMergeAggregations(const Aggregate &aggregate) {
+  return std::ranges::all_of(aggregate.aggregations_, [](const auto &aggregation) {
+    switch (aggregation.op) {
+      case Aggregation::Op::COUNT:
+      case Aggregation::Op::SUM:
+      case Aggregation::Op::MIN:
+      case Aggregation::Op::MAX:
+        return !aggregation.distinct && !aggregation.arg2 && IsParallelSafe(aggregation.arg1);
+      default:
+        return false;
+    }
+  });
+}
+
+/// Checks that everything below the aggregation can be executed by multiple
+/// threads, each scanning only a part of the vertices.
+bool CanRunInParallel(const LogicalOperator &op) {
+  const auto *current = &op;
+  while (true) {
+    const auto &type = current->GetTypeInfo();
+    if (type == ScanAll::kType || type == ScanAllByLabel::kType) {
+      return current->input() && current->input()->GetTypeInfo() == Once::kType;
+    }
+    if (type == Filter::kType) {
+      const auto &filter = static_cast<const Filter &>(*current);
+      if (!filter.pattern_filters_.empty() || !IsParallelSafe(filter.expression_)) return false;
+    } else if (type != Expand::kType && type != EdgeUniquenessFilter::kType) {
+      return false;
+    }
+    current = current->input().get();
+  }
+}
+
+/// Replaces `aggregate` with:
+///   Aggregate (merge) <- Gather <- Aggregate (partial) <- original input
+std::shared_ptr<LogicalOperator> SplitAggregate(const Aggregate &aggregate, SymbolTable *symbol_table,
+                                                AstStorage *ast_storage, uint64_t num_workers) {
+  std::vector<Aggregate::Element> partial_aggregations;
+  std::vector<Aggregate::Element> merge_aggregations;
+  partial_aggregations.reserve(aggregate.aggregations_.size());
+  merge_aggregations.reserve(aggregate.aggregations_.size());
+  for (const auto &aggregation : aggregate.aggregations_) {
+    auto partial_symbol = symbol_table->CreateAnonymousSymbol();
+    auto partial = aggregation;
+    partial.output_sym = partial_symbol;
+    partial_aggregations.emplace_back(std::move(partial));
+
+    auto *partial_identifier = ast_storage->Create<Identifier>(partial_symbol.name())->MapTo(partial_symbol);
+    // Partial counts and sums are summed up, minimums and maximums are merged
+    // with the same aggregation.
+    const auto merge_op = aggregation.op == Aggregation::Op::COUNT ? Aggregation::Op::SUM : aggregation.op;
+    merge_aggregations.emplace_back(
+        Aggregate::Element{partial_identifier, nullptr, merge_op, aggregation.output_sym, false});
+  }
+
+  // Group by expressions only depend on the remembered symbols, so both
+  // aggregations group the same way.
+  auto partial = std::make_shared<Aggregate>(aggregate.input_, partial_aggregations, aggregate.group_by_,
+                                             aggregate.remember_);
+  auto gather = std::make_shared<Gather>(partial, num_workers);
+  return std::make_shared<Aggregate>(gather, merge_aggregations, aggregate.group_by_, aggregate.remember_);
+}
+
+}  // namespace
+
+std::unique_ptr<LogicalOperator> RewriteWithParallelScan(std::unique_ptr<LogicalOperator> root_op,
+                                                         SymbolTable *symbol_table, AstStorage *ast_storage,
+                                                         uint64_t num_workers) {
+  // Only the main branch is considered, operators with multiple inputs
+  // (e.g. Cartesian) stop the search.
+  LogicalOperator *parent = nullptr;
+  for (auto *current = root_op.get(); current && current->HasSingleInput(); current = current->input().get()) {
+    if (current->GetTypeInfo() == Aggregate::kType) {
+      const auto &aggregate = static_cast<const Aggregate &>(*current);
+      if (!parent || !CanMergeAggregations(aggregate) ||
+          !std::ranges::all_of(aggregate.group_by_, IsParallelSafe) || !CanRunInParallel(*aggregate.input_)) {
+        break;
+      }
+      parent->set_input(SplitAggregate(aggregate, symbol_table, ast_storage, num_workers));
+      break;
+    }
+    parent = current;
+  }
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan::impl
@@ -0,0 +1,58 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// This file provides a plan rewriter which splits an `Aggregate` over a scan
+/// into a partial `Aggregate` executed on multiple threads (see `Gather`) and
+/// a final `Aggregate` which merges the partial results. The public entrypoint
+/// is `RewriteWithParallelScan`.
+
+#pragma once
+
+#include <memory>
+
+#include <gflags/gflags.h>
+
+#include "query/frontend/ast/ast_storage.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/plan/operator.hpp"
+
+DECLARE_uint64(query_parallel_workers);
+DECLARE_uint64(query_parallel_expansion_min_frontier);
+
+namespace memgraph::query::plan {
+
+namespace impl {
+
+/// Whether `expression` can be evaluated by multiple threads at the same time.
+/// Expressions which modify the shared evaluation context (e.g. `counter`),
+/// user-defined functions and subqueries can't.
+bool IsParallelSafe(Expression *expression);
+
+std::unique_ptr<LogicalOperator> RewriteWithParallelScan(std::unique_ptr<LogicalOperator> root_op,
+                                                         SymbolTable *symbol_table, AstStorage *ast_storage,
+                                                         uint64_t num_workers);
+
+}  // namespace impl
+
+/// Parallelizes the (single) aggregation of the main query branch when its
+/// input is a chain of `Filter`, `Expand` and `EdgeUniquenessFilter` operators
+/// over a `ScanAll` or `ScanAllByLabel`. Only `count`, `sum`, `min` and `max`
+/// without `DISTINCT` can be merged, other plans are left untouched.
+template <class TDbAccessor>
+std::unique_ptr<LogicalOperator> RewriteWithParallelScan(std::unique_ptr<LogicalOperator> root_op,
+                                                         SymbolTable *symbol_table, AstStorage *ast_storage,
+                                                         TDbAccessor * /*db*/) {
+  if (FLAGS_query_parallel_workers < 2) return root_op;
+  return impl::RewriteWithParallelScan(std::move(root_op), symbol_table, ast_storage, FLAGS_query_parallel_workers);
+}
+
+}  // namespace memgraph::query::plan
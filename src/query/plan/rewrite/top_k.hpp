@@ -0,0 +1,76 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// This file provides a plan rewriter which replaces an `OrderBy` followed by
+/// `Limit` (and optionally `Skip`) with a `TopK` operator. The public
+/// entrypoint is `RewriteWithTopK`.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "query/plan/operator.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query::plan {
+
+namespace impl {
+
+class TopKRewriter final : public HierarchicalLogicalOperatorVisitor {
+ public:
+  TopKRewriter() = default;
+  ~TopKRewriter() override = default;
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once & /*op*/) override { return true; }
+
+  bool PreVisit(Limit &op) override {
+    // The planner always generates Limit <- [Skip <-] OrderBy, see GenReturnBody.
+    auto *parent = static_cast<LogicalOperator *>(&op);
+    Skip *skip = nullptr;
+    if (op.input_->GetTypeInfo() == Skip::kType) {
+      skip = static_cast<Skip *>(op.input_.get());
+      parent = skip;
+    }
+    auto order_by_op = parent->input();
+    if (order_by_op->GetTypeInfo() != OrderBy::kType) return true;
+
+    auto const &order_by = static_cast<const OrderBy &>(*order_by_op);
+    std::vector<SortItem> sort_items;
+    sort_items.reserve(order_by.order_by_.size());
+    for (size_t i = 0; i < order_by.order_by_.size(); ++i) {
+      sort_items.push_back(SortItem{order_by.compare_.orderings()[i].ordering(), order_by.order_by_[i]});
+    }
+    parent->set_input(std::make_shared<TopK>(order_by.input_, sort_items, order_by.output_symbols_, op.expression_,
+                                             skip ? skip->expression_ : nullptr));
+    return true;
+  }
+};
+
+}  // namespace impl
+
+/// Keeps only the first `skip + limit` rows while ordering instead of sorting
+/// all of them. Skip and Limit are left in the plan.
+template <class TDbAccessor>
+std::unique_ptr<LogicalOperator> RewriteWithTopK(std::unique_ptr<LogicalOperator> root_op,
+                                                 SymbolTable * /*symbol_table*/, AstStorage * /*ast_storage*/,
+                                                 TDbAccessor * /*db*/) {
+  impl::TopKRewriter rewriter;
+  root_op->Accept(rewriter);
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
@@ -19,6 +19,7 @@
 #include "flags/run_time_configurable.hpp"
 #include "query/database_access.hpp"
 #include "query/frontend/ast/ast_visitor.hpp"
+#include "query/plan/cardinality_feedback.hpp"
 #include "query/plan/operator.hpp"
 #include "query/plan/preprocess.hpp"
 #include "query/plan/rewrite/general.hpp"
@@ -69,6 +70,9 @@ struct PlanningContext {
   std::unordered_set<Symbol> bound_symbols{};
   bool is_write_query{false};
   bool in_exists_subquery{false};
+  /// @brief Cardinalities observed by executing plans, used by the cost
+  /// estimator if set.
+  const CardinalityFeedback *cardinality_feedback{nullptr};
 };
 
 template <class TDbAccessor>
@@ -0,0 +1,459 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/spill.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "flags/general.hpp"
+#include "query/db_accessor.hpp"
+#include "query/exceptions.hpp"
+#include "utils/file.hpp"
+#include "utils/flag_validation.hpp"
+#include "utils/memory_tracker.hpp"
+#include "utils/query_memory_tracker.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_spill_threshold, 0,
+                        "Percentage of the query memory limit (or of the global memory limit if the query doesn't "
+                        "have one) after which ORDER BY, aggregations, DISTINCT and hash joins start moving their "
+                        "state to disk. Default is 0, which disables spilling.",
+                        FLAG_IN_RANGE(0, 100));
+
+namespace memgraph::query::plan {
+
+namespace {
+
+constexpr size_t kSpillBufferSize = 64UL * 1024UL;
+
+static_assert(std::is_trivially_copyable_v<storage::VertexAccessor>);
+static_assert(std::is_trivially_copyable_v<storage::EdgeAccessor>);
+
+bool Exceeded(int64_t amount, int64_t limit) {
+  if (limit <= 0) return false;
+  return static_cast<uint64_t>(amount) * 100 >= static_cast<uint64_t>(limit) * FLAGS_query_spill_threshold;
+}
+
+struct MemoryUsage {
+  int64_t amount;
+  int64_t limit;
+};
+
+MemoryUsage GetMemoryUsage(DbAccessor *dba) {
+  if (dba) {
+    const auto &query_tracker = dba->GetQueryMemoryTracker();
+    if (query_tracker && query_tracker->HardLimit() > 0) {
+      return {.amount = query_tracker->Amount(), .limit = query_tracker->HardLimit()};
+    }
+  }
+  return {.amount = utils::total_memory_tracker.Amount(), .limit = utils::total_memory_tracker.HardLimit()};
+}
+
+}  // namespace
+
+bool SpillThresholdExceeded(DbAccessor *dba) {
+  if (FLAGS_query_spill_threshold == 0) [[likely]] {
+    return false;
+  }
+  const auto usage = GetMemoryUsage(dba);
+  return Exceeded(usage.amount, usage.limit);
+}
+
+int64_t SpillMemoryUsage(DbAccessor *dba) { return GetMemoryUsage(dba).amount; }
+
+bool IsSpillable(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::Function:
+      return false;
+    case TypedValue::Type::List:
+      return std::ranges::all_of(value.ValueList(), IsSpillable);
+    case TypedValue::Type::Map:
+      return std::ranges::all_of(value.ValueMap(), [](const auto &entry) { return IsSpillable(entry.second); });
+    default:
+      return true;
+  }
+}
+
+SpillFile::SpillFile() : buffer_(kSpillBufferSize) {
+  const auto directory = std::filesystem::path(FLAGS_data_directory) / "query_spill";
+  if (!utils::EnsureDir(directory)) {
+    throw QueryRuntimeException("Couldn't create the directory {} used for spilling query data to disk.",
+                                directory.string());
+  }
+  auto path = (directory / "spill_XXXXXX").string();
+  fd_ = mkstemp(path.data());
+  if (fd_ == -1) {
+    throw QueryRuntimeException("Couldn't create a file in {} used for spilling query data to disk: {}",
+                                directory.string(), std::strerror(errno));
+  }
+  // The file is only accessed through the descriptor, the space is released
+  // once it's closed.
+  unlink(path.c_str());
+}
+
+SpillFile::~SpillFile() {
+  if (fd_ != -1) close(fd_);
+}
+
+void SpillFile::WriteRow(std::span<const TypedValue> row) {
+  DMG_ASSERT(!reading_, "Rows can't be written to a spill file which is being read.");
+  WritePod<uint64_t>(row.size());
+  for (const auto &value : row) {
+    WriteValue(value);
+  }
+  ++rows_;
+}
+
+void SpillFile::FinishWriting() {
+  Flush();
+  if (lseek(fd_, 0, SEEK_SET) == -1) {
+    throw QueryRuntimeException("Couldn't read spilled query data: {}", std::strerror(errno));
+  }
+  // Finished files can wait a long time before they're read, the buffer is
+  // allocated again by the first read.
+  buffer_ = {};
+  reading_ = true;
+  buffer_size_ = 0;
+  buffer_position_ = 0;
+}
+
+bool SpillFile::ReadRow(utils::pmr::vector<TypedValue> *row) {
+  DMG_ASSERT(reading_, "FinishWriting wasn't called on the spill file.");
+  row->clear();
+  if (rows_read_ == rows_) return false;
+  const auto size = ReadPod<uint64_t>();
+  row->reserve(size);
+  for (uint64_t i = 0; i < size; ++i) {
+    row->emplace_back(ReadValue(row->get_allocator()));
+  }
+  ++rows_read_;
+  return true;
+}
+
+void SpillFile::WriteValue(const TypedValue &value) {
+  WritePod(static_cast<uint8_t>(value.type()));
+  switch (value.type()) {
+    case TypedValue::Type::Null:
+      break;
+    case TypedValue::Type::Bool:
+      WritePod(value.ValueBool());
+      break;
+    case TypedValue::Type::Int:
+      WritePod(value.ValueInt());
+      break;
+    case TypedValue::Type::Double:
+      WritePod(value.ValueDouble());
+      break;
+    case TypedValue::Type::String: {
+      const auto &string = value.ValueString();
+      WritePod<uint64_t>(string.size());
+      Write(string.data(), string.size());
+      break;
+    }
+    case TypedValue::Type::List: {
+      const auto &list = value.ValueList();
+      WritePod<uint64_t>(list.size());
+      for (const auto &element : list) WriteValue(element);
+      break;
+    }
+    case TypedValue::Type::Map: {
+      const auto &map = value.ValueMap();
+      WritePod<uint64_t>(map.size());
+      for (const auto &[key, element] : map) {
+        WritePod<uint64_t>(key.size());
+        Write(key.data(), key.size());
+        WriteValue(element);
+      }
+      break;
+    }
+    case TypedValue::Type::Vertex:
+      WritePod(value.ValueVertex().impl_);
+      break;
+    case TypedValue::Type::Edge:
+      WritePod(value.ValueEdge().impl_);
+      break;
+    case TypedValue::Type::Path: {
+      // Vertices and edges are written alternately, starting with a vertex.
+      const auto &path = value.ValuePath();
+      WritePod<uint64_t>(path.vertices().size());
+      for (size_t i = 0; i < path.vertices().size(); ++i) {
+        if (i > 0) WritePod(path.edges()[i - 1].impl_);
+        WritePod(path.vertices()[i].impl_);
+      }
+      break;
+    }
+    case TypedValue::Type::Graph: {
+      const auto &graph = value.ValueGraph();
+      WritePod<uint64_t>(graph.vertices().size());
+      for (const auto &vertex : graph.vertices()) WritePod(vertex.impl_);
+      WritePod<uint64_t>(graph.edges().size());
+      for (const auto &edge : graph.edges()) WritePod(edge.impl_);
+      break;
+    }
+    case TypedValue::Type::Date:
+      WritePod(value.ValueDate().MicrosecondsSinceEpoch());
+      break;
+    case TypedValue::Type::LocalTime:
+      WritePod(value.ValueLocalTime().MicrosecondsSinceEpoch());
+      break;
+    case TypedValue::Type::LocalDateTime:
+      WritePod(value.ValueLocalDateTime().SysMicrosecondsSinceEpoch());
+      break;
+    case TypedValue::Type::ZonedDateTime: {
+      const auto &zoned_date_time = value.ValueZonedDateTime();
+      WritePod(zoned_date_time.SysTimeSinceEpoch().time_since_epoch().count());
+      const auto offset = zoned_date_time.GetTimezone().GetOffset();
+      WritePod(static_cast<uint8_t>(offset.index()));
+      if (const auto *minutes = std::get_if<std::chrono::minutes>(&offset)) {
+        WritePod(minutes->count());
+      } else {
+        // Time zones are owned by the tz database and live until the process
+        // exits.
+        WritePod(std::get<const std::chrono::time_zone *>(offset));
+      }
+      break;
+    }
+    case TypedValue::Type::Duration:
+      WritePod(value.ValueDuration().microseconds);
+      break;
+    case TypedValue::Type::Enum:
+      WritePod(value.ValueEnum().type_id().value_of());
+      WritePod(value.ValueEnum().value_id().value_of());
+      break;
+    case TypedValue::Type::Point2d: {
+      const auto &point = value.ValuePoint2d();
+      WritePod(point.crs());
+      WritePod(point.x());
+      WritePod(point.y());
+      break;
+    }
+    case TypedValue::Type::Point3d: {
+      const auto &point = value.ValuePoint3d();
+      WritePod(point.crs());
+      WritePod(point.x());
+      WritePod(point.y());
+      WritePod(point.z());
+      break;
+    }
+    case TypedValue::Type::Function:
+      throw QueryRuntimeException("Functions can't be spilled to disk.");
+  }
+}
+
+TypedValue SpillFile::ReadValue(TypedValue::allocator_type alloc) {
+  const auto type = static_cast<TypedValue::Type>(ReadPod<uint8_t>());
+  switch (type) {
+    case TypedValue::Type::Null:
+      return TypedValue(alloc);
+    case TypedValue::Type::Bool:
+      return TypedValue(ReadPod<bool>(), alloc);
+    case TypedValue::Type::Int:
+      return TypedValue(ReadPod<int64_t>(), alloc);
+    case TypedValue::Type::Double:
+      return TypedValue(ReadPod<double>(), alloc);
+    case TypedValue::Type::String: {
+      TypedValue::TString string(ReadPod<uint64_t>(), '\0', alloc);
+      Read(string.data(), string.size());
+      return TypedValue(std::move(string), alloc);
+    }
+    case TypedValue::Type::List: {
+      const auto size = ReadPod<uint64_t>();
+      TypedValue::TVector list(alloc);
+      list.reserve(size);
+      for (uint64_t i = 0; i < size; ++i) list.emplace_back(ReadValue(alloc));
+      return TypedValue(std::move(list), alloc);
+    }
+    case TypedValue::Type::Map: {
+      const auto size = ReadPod<uint64_t>();
+      TypedValue::TMap map(alloc);
+      for (uint64_t i = 0; i < size; ++i) {
+        TypedValue::TString key(ReadPod<uint64_t>(), '\0', alloc);
+        Read(key.data(), key.size());
+        auto element = ReadValue(alloc);
+        map.emplace(std::move(key), std::move(element));
+      }
+      return TypedValue(std::move(map), alloc);
+    }
+    case TypedValue::Type::Vertex:
+      return TypedValue(VertexAccessor(ReadPod<storage::VertexAccessor>()), alloc);
+    case TypedValue::Type::Edge:
+      return TypedValue(EdgeAccessor(ReadPod<storage::EdgeAccessor>()), alloc);
+    case TypedValue::Type::Path: {
+      const auto num_vertices = ReadPod<uint64_t>();
+      Path path(VertexAccessor(ReadPod<storage::VertexAccessor>()), alloc);
+      for (uint64_t i = 1; i < num_vertices; ++i) {
+        path.Expand(EdgeAccessor(ReadPod<storage::EdgeAccessor>()));
+        path.Expand(VertexAccessor(ReadPod<storage::VertexAccessor>()));
+      }
+      return TypedValue(std::move(path), alloc);
+    }
+    case TypedValue::Type::Graph: {
+      Graph graph(alloc);
+      const auto num_vertices = ReadPod<uint64_t>();
+      for (uint64_t i = 0; i < num_vertices; ++i) {
+        graph.InsertVertex(VertexAccessor(ReadPod<storage::VertexAccessor>()));
+      }
+      const auto num_edges = ReadPod<uint64_t>();
+      for (uint64_t i = 0; i < num_edges; ++i) {
+        graph.InsertEdge(EdgeAccessor(ReadPod<storage::EdgeAccessor>()));
+      }
+      return TypedValue(std::move(graph), alloc);
+    }
+    case TypedValue::Type::Date:
+      return TypedValue(utils::Date(ReadPod<int64_t>()), alloc);
+    case TypedValue::Type::LocalTime:
+      return TypedValue(utils::LocalTime(ReadPod<int64_t>()), alloc);
+    case TypedValue::Type::LocalDateTime:
+      return TypedValue(utils::LocalDateTime(ReadPod<int64_t>()), alloc);
+    case TypedValue::Type::ZonedDateTime: {
+      const auto time = std::chrono::sys_time<std::chrono::microseconds>(std::chrono::microseconds(ReadPod<int64_t>()));
+      const auto offset_index = ReadPod<uint8_t>();
+      const auto timezone = offset_index == 0
+                                ? utils::Timezone(std::chrono::minutes(ReadPod<std::chrono::minutes::rep>()))
+                                : utils::Timezone(ReadPod<const std::chrono::time_zone *>());
+      return TypedValue(utils::ZonedDateTime(time, timezone), alloc);
+    }
+    case TypedValue::Type::Duration:
+      return TypedValue(utils::Duration(ReadPod<int64_t>()), alloc);
+    case TypedValue::Type::Enum: {
+      const auto type_id = ReadPod<uint64_t>();
+      const auto value_id = ReadPod<uint64_t>();
+      return TypedValue(storage::Enum(storage::EnumTypeId{type_id}, storage::EnumValueId{value_id}), alloc);
+    }
+    case TypedValue::Type::Point2d: {
+      const auto crs = ReadPod<storage::CoordinateReferenceSystem>();
+      const auto x = ReadPod<double>();
+      const auto y = ReadPod<double>();
+      return TypedValue(storage::Point2d(crs, x, y), alloc);
+    }
+    case TypedValue::Type::Point3d: {
+      const auto crs = ReadPod<storage::CoordinateReferenceSystem>();
+      const auto x = ReadPod<double>();
+      const auto y = ReadPod<double>();
+      const auto z = ReadPod<double>();
+      return TypedValue(storage::Point3d(crs, x, y, z), alloc);
+    }
+    case TypedValue::Type::Function:
+      break;
+  }
+  throw QueryRuntimeException("Spilled query data is corrupted.");
+}
+
+void SpillFile::Write(const void *data, size_t size) {
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  while (size > 0) {
+    if (buffer_size_ == buffer_.size()) Flush();
+    const auto to_copy = std::min(size, buffer_.size() - buffer_size_);
+    std::memcpy(buffer_.data() + buffer_size_, bytes, to_copy);
+    buffer_size_ += to_copy;
+    bytes += to_copy;
+    size -= to_copy;
+  }
+}
+
+void SpillFile::Flush() {
+  size_t written = 0;
+  while (written < buffer_size_) {
+    const auto ret = write(fd_, buffer_.data() + written, buffer_size_ - written);
+    if (ret == -1) {
+      if (errno == EINTR) continue;
+      throw QueryRuntimeException("Couldn't spill query data to disk: {}", std::strerror(errno));
+    }
+    written += static_cast<size_t>(ret);
+  }
+  buffer_size_ = 0;
+}
+
+void SpillFile::Read(void *data, size_t size) {
+  auto *bytes = static_cast<uint8_t *>(data);
+  while (size > 0) {
+    if (buffer_position_ == buffer_size_) {
+      if (buffer_.empty()) buffer_.resize(kSpillBufferSize);
+      const auto ret = read(fd_, buffer_.data(), buffer_.size());
+      if (ret == -1) {
+        if (errno == EINTR) continue;
+        throw QueryRuntimeException("Couldn't read spilled query data: {}", std::strerror(errno));
+      }
+      if (ret == 0) throw QueryRuntimeException("Spilled query data is truncated.");
+      buffer_size_ = static_cast<size_t>(ret);
+      buffer_position_ = 0;
+    }
+    const auto to_copy = std::min(size, buffer_size_ - buffer_position_);
+    std::memcpy(bytes, buffer_.data() + buffer_position_, to_copy);
+    buffer_position_ += to_copy;
+    bytes += to_copy;
+    size -= to_copy;
+  }
+}
+
+void SpillPartitions::WriteRow(size_t key_hash, std::span<const TypedValue> row) {
+  auto &partition = partitions_[PartitionIndex(key_hash)];
+  if (!partition) partition = std::make_unique<SpillFile>();
+  partition->WriteRow(row);
+}
+
+size_t SpillPartitions::PartitionIndex(size_t key_hash) const {
+  // Rows of a partition have the same `key_hash % kNumPartitions`, so the
+  // hash is remixed with the level before splitting them again.
+  uint64_t x = key_hash ^ (level_ * 0x9e3779b97f4a7c15ULL);
+  x = (x ^ (x >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27U)) * 0x94d049bb133111ebULL;
+  x ^= x >> 31U;
+  return x % kNumPartitions;
+}
+
+void SortedRunsMerger::AddRun(std::unique_ptr<SpillFile> run) {
+  auto &head = heads_.emplace_back();
+  if (!run->ReadRow(&head)) {
+    heads_.pop_back();
+    return;
+  }
+  runs_.emplace_back(std::move(run));
+  heap_.push_back(runs_.size() - 1);
+  std::ranges::push_heap(heap_, [this](size_t lhs, size_t rhs) { return HeadLess(rhs, lhs); });
+}
+
+bool SortedRunsMerger::Next(utils::pmr::vector<TypedValue> *row) {
+  if (heap_.empty()) return false;
+  auto greater = [this](size_t lhs, size_t rhs) { return HeadLess(rhs, lhs); };
+  std::ranges::pop_heap(heap_, greater);
+  const auto index = heap_.back();
+  std::swap(*row, heads_[index]);
+  if (runs_[index]->ReadRow(&heads_[index])) {
+    std::ranges::push_heap(heap_, greater);
+  } else {
+    heap_.pop_back();
+    runs_[index].reset();
+  }
+  return true;
+}
+
+bool SortedRunsMerger::HeadLess(size_t lhs, size_t rhs) const {
+  // Rows hold more values than there are orderings, so `lex_cmp` can't be
+  // used directly.
+  const auto &lhs_row = heads_[lhs];
+  const auto &rhs_row = heads_[rhs];
+  for (size_t i = 0; i < compare_->orderings().size(); ++i) {
+    const auto res = compare_->orderings()[i](lhs_row[i], rhs_row[i]);
+    if (res == std::partial_ordering::less) return true;
+    if (res == std::partial_ordering::greater) return false;
+  }
+  return false;
+}
+
+}  // namespace memgraph::query::plan
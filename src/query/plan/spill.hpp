@@ -0,0 +1,174 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// Helpers used by operators which materialize their input (OrderBy,
+/// Aggregate, Distinct and HashJoin) to move part of their state to disk once
+/// the query uses too much memory.
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "query/common.hpp"
+#include "query/typed_value.hpp"
+#include "utils/pmr/vector.hpp"
+
+DECLARE_uint64(query_spill_threshold);
+
+namespace memgraph::query {
+class DbAccessor;
+}  // namespace memgraph::query
+
+namespace memgraph::query::plan {
+
+/// Returns true once the memory used by the current query crossed
+/// `--query-spill-threshold` percent of its memory limit. Queries without their
+/// own limit are compared against the global memory limit.
+bool SpillThresholdExceeded(DbAccessor *dba);
+
+/// Memory used by the current query, or by the whole process if the query
+/// doesn't have its own limit. This is the amount `SpillThresholdExceeded`
+/// compares against the limit. It usually doesn't go down when spilled rows are
+/// freed, the query allocators keep their memory until the query ends.
+int64_t SpillMemoryUsage(DbAccessor *dba);
+
+/// Returns false for values which can't be written to a `SpillFile`
+/// (functions).
+bool IsSpillable(const TypedValue &value);
+
+/// Temporary file holding rows of `TypedValue`s. The file is created in the
+/// `query_spill` subdirectory of `--data-directory` and unlinked right away, so
+/// it disappears once closed, even if the process crashes.
+///
+/// Vertices and edges are stored as raw accessors. A file can only be read by
+/// the transaction which wrote it, while that transaction is still active.
+///
+/// The file is written first and then read sequentially, once, after
+/// `FinishWriting` is called.
+class SpillFile final {
+ public:
+  SpillFile();
+  ~SpillFile();
+
+  SpillFile(const SpillFile &) = delete;
+  SpillFile &operator=(const SpillFile &) = delete;
+  SpillFile(SpillFile &&) = delete;
+  SpillFile &operator=(SpillFile &&) = delete;
+
+  /// @throw QueryRuntimeException if the data can't be written.
+  void WriteRow(std::span<const TypedValue> row);
+
+  /// Flushes the written rows and rewinds the file for reading. The write
+  /// buffer is released until the first read.
+  void FinishWriting();
+
+  /// Reads the next row into `row`, which is cleared first. Values are
+  /// allocated with the allocator of `row`. Returns false when all rows were
+  /// read.
+  /// @throw QueryRuntimeException if the data can't be read.
+  bool ReadRow(utils::pmr::vector<TypedValue> *row);
+
+  uint64_t rows() const { return rows_; }
+
+ private:
+  void WriteValue(const TypedValue &value);
+  TypedValue ReadValue(TypedValue::allocator_type alloc);
+
+  void Write(const void *data, size_t size);
+  void Read(void *data, size_t size);
+
+  template <typename T>
+  void WritePod(const T &value) {
+    Write(&value, sizeof(value));
+  }
+  template <typename T>
+  T ReadPod() {
+    // Accessors aren't default constructible, read the raw bytes instead.
+    std::array<std::byte, sizeof(T)> bytes;
+    Read(bytes.data(), bytes.size());
+    return std::bit_cast<T>(bytes);
+  }
+
+  void Flush();
+
+  int fd_{-1};
+  std::vector<uint8_t> buffer_;
+  // Write mode: number of buffered bytes. Read mode: number of valid bytes.
+  size_t buffer_size_{0};
+  // Read mode only: position of the next byte in the buffer.
+  size_t buffer_position_{0};
+  bool reading_{false};
+  uint64_t rows_{0};
+  uint64_t rows_read_{0};
+};
+
+/// Rows of a hash-based operator (Aggregate, Distinct, HashJoin) split into a
+/// fixed number of spill files by the hash of their key. Rows with equal keys
+/// always end up in the same partition, so each partition can be processed
+/// independently. `level` selects a different split when a partition needs
+/// to be partitioned again.
+class SpillPartitions final {
+ public:
+  static constexpr size_t kNumPartitions = 16;
+
+  explicit SpillPartitions(uint64_t level = 0) : level_(level) {}
+
+  void WriteRow(size_t key_hash, std::span<const TypedValue> row);
+
+  uint64_t level() const { return level_; }
+
+  /// Partition with the given index, nullptr if no row was written to it.
+  std::unique_ptr<SpillFile> &partition(size_t index) { return partitions_[index]; }
+
+  size_t PartitionIndex(size_t key_hash) const;
+
+ private:
+  uint64_t level_;
+  std::array<std::unique_ptr<SpillFile>, kNumPartitions> partitions_;
+};
+
+/// Merges spill files holding rows sorted by their first
+/// `compare.orderings().size()` values (external merge sort).
+class SortedRunsMerger final {
+ public:
+  SortedRunsMerger(const TypedValueVectorCompare &compare, utils::MemoryResource *mem)
+      : compare_(&compare), heads_(mem) {}
+
+  /// Adds a run on which `FinishWriting` was called.
+  void AddRun(std::unique_ptr<SpillFile> run);
+
+  /// Moves the smallest remaining row into `row`, which has to use the memory
+  /// resource passed to the constructor. Returns false when all runs are
+  /// exhausted.
+  bool Next(utils::pmr::vector<TypedValue> *row);
+
+ private:
+  bool HeadLess(size_t lhs, size_t rhs) const;
+
+  const TypedValueVectorCompare *compare_;
+  std::vector<std::unique_ptr<SpillFile>> runs_;
+  // Next row of each run.
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> heads_;
+  // Min-heap of indices of the runs which still have rows.
+  std::vector<size_t> heap_;
+};
+
+}  // namespace memgraph::query::plan
@@ -102,8 +102,10 @@ PRE_VISIT(Aggregate)
 PRE_VISIT(Skip)
 PRE_VISIT(Limit)
 PRE_VISIT(OrderBy)
+PRE_VISIT(TopK)
 PRE_VISIT(Distinct)
 PRE_VISIT(PeriodicCommit)
+PRE_VISIT(Gather)
 
 bool UsedIndexChecker::PreVisit(Union &op) {
   op.left_op_->Accept(*this);
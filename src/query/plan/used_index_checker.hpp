@@ -74,6 +74,7 @@ struct UsedIndexChecker : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(Skip &) override;
   bool PreVisit(Limit &) override;
   bool PreVisit(OrderBy &) override;
+  bool PreVisit(TopK &) override;
   bool PreVisit(Distinct &) override;
   bool PreVisit(Union &) override;
 
@@ -87,6 +88,7 @@ struct UsedIndexChecker : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(RollUpApply &) override;
   bool PreVisit(PeriodicSubquery &) override;
   bool PreVisit(PeriodicCommit &) override;
+  bool PreVisit(Gather &) override;
 
   bool Visit(Once &) override;
 
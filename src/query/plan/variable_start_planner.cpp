@@ -11,6 +11,7 @@
 
 #include "query/plan/variable_start_planner.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <queue>
 #include <utility>
@@ -23,6 +24,13 @@
 DEFINE_VALIDATED_uint64(query_max_plans, 1000U, "Maximum number of generated plans for a query.",
                         FLAG_IN_RANGE(1, std::numeric_limits<std::uint64_t>::max()));
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_max_join_order_expansions, 0U,
+                        "Maximum number of expansions in a pattern for which all orders of the expansions are "
+                        "considered when picking the cheapest one. Larger patterns are ordered greedily. Default is "
+                        "0, which keeps the breadth-first order of the expansions.",
+                        FLAG_IN_RANGE(0, 16));
+
 namespace memgraph::query::plan::impl {
 
 namespace {
@@ -160,6 +168,219 @@ std::vector<Expansion> ExpansionsFrom(const PatternAtom *start_atom, const Match
   return expansions;
 }
 
+EdgeAtom::Direction Reversed(EdgeAtom::Direction direction) {
+  if (direction == EdgeAtom::Direction::BOTH) return direction;
+  return direction == EdgeAtom::Direction::IN ? EdgeAtom::Direction::OUT : EdgeAtom::Direction::IN;
+}
+
+// Estimates for ordering the expansions of a matching from a fixed start node.
+// Nodes of the expansions are numbered in the order of their appearance.
+class ExpansionCosts {
+ public:
+  ExpansionCosts(const Matching &matching, const SymbolTable &symbol_table, const ExpansionCostModel &cost_model)
+      : vertices_count_(cost_model.VerticesCount()) {
+    auto node_id = [&](const NodeAtom *node) {
+      const auto &symbol = symbol_table.at(*node->identifier_);
+      auto [it, inserted] = node_ids_.try_emplace(symbol, node_ids_.size());
+      if (inserted) node_selectivities_.push_back(cost_model.NodeSelectivity(symbol, matching.filters));
+      return it->second;
+    };
+    steps_.reserve(matching.expansions.size());
+    for (const auto &expansion : matching.expansions) {
+      const auto &node1_symbol = symbol_table.at(*expansion.node1->identifier_);
+      const auto &node2_symbol = symbol_table.at(*expansion.node2->identifier_);
+      steps_.push_back(Step{
+          .node1 = node_id(expansion.node1),
+          .node2 = node_id(expansion.node2),
+          .node1_degree = cost_model.Degree(*expansion.edge, node1_symbol, expansion.direction, matching.filters),
+          .node2_degree =
+              cost_model.Degree(*expansion.edge, node2_symbol, Reversed(expansion.direction), matching.filters)});
+    }
+  }
+
+  size_t NodesCount() const { return node_selectivities_.size(); }
+
+  std::optional<size_t> NodeId(const Symbol &node_symbol) const {
+    auto it = node_ids_.find(node_symbol);
+    if (it == node_ids_.end()) return std::nullopt;
+    return it->second;
+  }
+
+  size_t NodeId(size_t expansion, bool node2) const {
+    return node2 ? steps_[expansion].node2 : steps_[expansion].node1;
+  }
+
+  // Estimated number of vertices matched by the node.
+  double NodeCardinality(size_t node) const { return node_selectivities_[node] * vertices_count_; }
+
+  // Returns the factor by which the expansion multiplies the number of rows and
+  // whether it should expand from node2, or nullopt if none of the nodes of the
+  // expansion is bound.
+  template <typename TIsBound>
+  std::optional<std::pair<double, bool>> Fanout(size_t expansion, const TIsBound &is_bound) const {
+    const auto &step = steps_[expansion];
+    const bool node1_bound = is_bound(step.node1);
+    const bool node2_bound = is_bound(step.node2);
+    if (node1_bound && node2_bound) {
+      // Only the edges which lead to the other, already bound vertex are kept
+      const bool from_node2 = step.node2_degree < step.node1_degree;
+      const auto to_node = from_node2 ? step.node1 : step.node2;
+      return std::pair{std::min(step.node1_degree, step.node2_degree) / std::max(NodeCardinality(to_node), 1.0),
+                       from_node2};
+    }
+    if (node1_bound) return std::pair{step.node1_degree * node_selectivities_[step.node2], false};
+    if (node2_bound) return std::pair{step.node2_degree * node_selectivities_[step.node1], true};
+    return std::nullopt;
+  }
+
+ private:
+  struct Step {
+    size_t node1;
+    size_t node2;
+    double node1_degree;
+    double node2_degree;
+  };
+
+  double vertices_count_;
+  std::unordered_map<Symbol, size_t> node_ids_;
+  std::vector<double> node_selectivities_;
+  std::vector<Step> steps_;
+};
+
+// Returns the expansion, flipped if it expands from node2.
+Expansion OrientedExpansion(const Expansion &original, bool from_node2) {
+  auto expansion = original;
+  if (from_node2) {
+    std::swap(expansion.node1, expansion.node2);
+    expansion.is_flipped = true;
+    expansion.direction = Reversed(expansion.direction);
+  }
+  return expansion;
+}
+
+// Orders the expansions by going through all of their orders which start from
+// `start_node`. The cost of an order is the estimated number of rows produced
+// by all of its expansions.
+std::optional<std::vector<Expansion>> CheapestExpansionOrder(const Matching &matching, const ExpansionCosts &costs,
+                                                             size_t start_node) {
+  const auto expansions_count = matching.expansions.size();
+  const auto full_mask = (uint64_t{1} << expansions_count) - 1;
+  struct State {
+    double cost{std::numeric_limits<double>::infinity()};
+    double cardinality{0};
+    uint64_t bound_nodes{0};
+    size_t last_expansion{0};
+    bool from_node2{false};
+  };
+  std::vector<State> states(full_mask + 1);
+  states[0] =
+      State{.cost = 0, .cardinality = costs.NodeCardinality(start_node), .bound_nodes = uint64_t{1} << start_node};
+  // Each state is reached only from its subsets, which are smaller numbers
+  for (uint64_t mask = 0; mask < full_mask; ++mask) {
+    const auto &state = states[mask];
+    if (state.cost == std::numeric_limits<double>::infinity()) continue;
+    auto is_bound = [&](size_t node) { return (state.bound_nodes >> node) & 1U; };
+    for (size_t i = 0; i < expansions_count; ++i) {
+      const auto next_mask = mask | (uint64_t{1} << i);
+      if (next_mask == mask) continue;
+      auto fanout = costs.Fanout(i, is_bound);
+      if (!fanout) continue;
+      const auto cardinality = state.cardinality * fanout->first;
+      const auto cost = state.cost + cardinality;
+      auto &next_state = states[next_mask];
+      if (cost < next_state.cost) {
+        next_state = State{.cost = cost,
+                           .cardinality = cardinality,
+                           .bound_nodes = state.bound_nodes | (uint64_t{1} << costs.NodeId(i, false)) |
+                                          (uint64_t{1} << costs.NodeId(i, true)),
+                           .last_expansion = i,
+                           .from_node2 = fanout->second};
+      }
+    }
+  }
+  if (states[full_mask].cost == std::numeric_limits<double>::infinity()) {
+    // Some expansions aren't connected to the start node
+    return std::nullopt;
+  }
+  std::vector<Expansion> expansions;
+  expansions.reserve(expansions_count);
+  for (auto mask = full_mask; mask != 0; mask &= ~(uint64_t{1} << states[mask].last_expansion)) {
+    const auto &state = states[mask];
+    expansions.push_back(OrientedExpansion(matching.expansions[state.last_expansion], state.from_node2));
+  }
+  std::ranges::reverse(expansions);
+  return expansions;
+}
+
+// Orders the expansions by picking the one which produces the fewest rows at
+// each step.
+std::optional<std::vector<Expansion>> GreedyExpansionOrder(const Matching &matching, const ExpansionCosts &costs,
+                                                           size_t start_node) {
+  std::vector<bool> bound_nodes(costs.NodesCount(), false);
+  bound_nodes[start_node] = true;
+  std::vector<bool> used(matching.expansions.size(), false);
+  auto is_bound = [&](size_t node) { return bound_nodes[node]; };
+  std::vector<Expansion> expansions;
+  expansions.reserve(matching.expansions.size());
+  while (expansions.size() < matching.expansions.size()) {
+    std::optional<std::pair<size_t, std::pair<double, bool>>> best;
+    for (size_t i = 0; i < matching.expansions.size(); ++i) {
+      if (used[i]) continue;
+      auto fanout = costs.Fanout(i, is_bound);
+      if (fanout && (!best || fanout->first < best->second.first)) best.emplace(i, *fanout);
+    }
+    if (!best) {
+      // Some expansions aren't connected to the start node
+      return std::nullopt;
+    }
+    const auto [i, fanout] = *best;
+    used[i] = true;
+    bound_nodes[costs.NodeId(i, false)] = true;
+    bound_nodes[costs.NodeId(i, true)] = true;
+    expansions.push_back(OrientedExpansion(matching.expansions[i], fanout.second));
+  }
+  return expansions;
+}
+
+// Orders the expansions which start from `start_atom` by their estimated cost.
+// Returns nullopt if the matching has to keep the breadth-first order of
+// `ExpansionsFrom`, i.e. when it has fewer than two expansions, when it starts
+// from an edge, when some of its expansions can't be flipped or depend on other
+// symbols and when not all of the expansions are reachable from the start.
+std::optional<std::vector<Expansion>> ExpansionsByCost(const PatternAtom *start_atom, const Matching &matching,
+                                                       const SymbolTable &symbol_table,
+                                                       const ExpansionCostModel &cost_model) {
+  if (FLAGS_query_max_join_order_expansions == 0 || matching.expansions.size() < 2) return std::nullopt;
+  const auto *start_node = dynamic_cast<const NodeAtom *>(start_atom);
+  if (!start_node) return std::nullopt;
+  const bool can_reorder = std::ranges::all_of(matching.expansions, [](const auto &expansion) {
+    return expansion.edge && expansion.symbols_in_range.empty() &&
+           (expansion.edge->type_ == EdgeAtom::Type::SINGLE || expansion.edge->type_ == EdgeAtom::Type::DEPTH_FIRST) &&
+           !expansion.edge->filter_lambda_.accumulated_path;
+  });
+  if (!can_reorder) return std::nullopt;
+
+  ExpansionCosts costs(matching, symbol_table, cost_model);
+  auto start_node_id = costs.NodeId(symbol_table.at(*start_node->identifier_));
+  if (!start_node_id) return std::nullopt;
+  if (matching.expansions.size() <= FLAGS_query_max_join_order_expansions) {
+    return CheapestExpansionOrder(matching, costs, *start_node_id);
+  }
+  return GreedyExpansionOrder(matching, costs, *start_node_id);
+}
+
+// Expansions ordered by their cost if there is a cost model and the matching
+// can be reordered, or in the breadth-first order from `start_atom` otherwise.
+std::vector<Expansion> OrderedExpansions(const PatternAtom *start_atom, const Matching &matching,
+                                         const SymbolTable &symbol_table, const ExpansionCostModel *cost_model) {
+  if (cost_model) {
+    if (auto expansions = ExpansionsByCost(start_atom, matching, symbol_table, *cost_model)) {
+      return std::move(*expansions);
+    }
+  }
+  return ExpansionsFrom(start_atom, matching, symbol_table);
+}
+
 // Collect all unique nodes from expansions. Uniqueness is determined by
 // symbol uniqueness.
 auto ExpansionAtoms(const std::vector<Expansion> &expansions, const SymbolTable &symbol_table) {
@@ -196,9 +417,11 @@ FilterMatching ToFilterMatching(Matching &matching) {
 
 }  // namespace
 
-VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table)
+VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table,
+                                     std::shared_ptr<const ExpansionCostModel> cost_model)
     : matching_(matching),
       symbol_table_(symbol_table),
+      cost_model_(std::move(cost_model)),
       graph_atoms_(ExpansionAtoms(matching.expansions, symbol_table)) {}
 
 VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
@@ -212,7 +435,8 @@ VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
     // Overwrite the original matching expansions with the new ones by
     // generating it from the first start node.
     start_atoms_it_ = self_->graph_atoms_.begin();
-    current_matching_.expansions = ExpansionsFrom(**start_atoms_it_, self_->matching_, self_->symbol_table_);
+    current_matching_.expansions =
+        OrderedExpansions(**start_atoms_it_, self_->matching_, self_->symbol_table_, self_->cost_model_.get());
   }
   DMG_ASSERT(start_atoms_it_ || self_->graph_atoms_.empty(),
              "start_atoms_it_ should only be nullopt when self_->graph_atoms_ is empty");
@@ -236,22 +460,25 @@ VaryMatchingStart::iterator &VaryMatchingStart::iterator::operator++() {
     return *this;
   }
   const auto &start_atom = **start_atoms_it_;
-  current_matching_.expansions = ExpansionsFrom(start_atom, self_->matching_, self_->symbol_table_);
+  current_matching_.expansions =
+      OrderedExpansions(start_atom, self_->matching_, self_->symbol_table_, self_->cost_model_.get());
   return *this;
 }
 
-CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &matchings,
-                                                            const SymbolTable &symbol_table) {
+CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(
+    const std::vector<Matching> &matchings, const SymbolTable &symbol_table,
+    const std::shared_ptr<const ExpansionCostModel> &cost_model) {
   std::vector<VaryMatchingStart> variants;
   variants.reserve(matchings.size());
   for (const auto &matching : matchings) {
-    variants.emplace_back(matching, symbol_table);
+    variants.emplace_back(matching, symbol_table, cost_model);
   }
   return MakeCartesianProduct(std::move(variants));
 }
 
-CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching,
-                                                             const SymbolTable &symbol_table) {
+CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(
+    const Matching &matching, const SymbolTable &symbol_table,
+    const std::shared_ptr<const ExpansionCostModel> &cost_model) {
   auto filter_matchings_cnt = 0;
   for (const auto &filter : matching.filters) {
     filter_matchings_cnt += static_cast<int>(filter.matchings.size());
@@ -262,19 +489,20 @@ CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &mat
 
   for (const auto &filter : matching.filters) {
     for (const auto &filter_matching : filter.matchings) {
-      variants.emplace_back(filter_matching, symbol_table);
+      variants.emplace_back(filter_matching, symbol_table, cost_model);
     }
   }
 
   return MakeCartesianProduct(std::move(variants));
 }
 
-VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table)
+VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table,
+                                             const std::shared_ptr<const ExpansionCostModel> &cost_model)
     : query_part_(std::move(query_part)),
-      matchings_(VaryMatchingStart(query_part_.matching, symbol_table)),
-      optional_matchings_(VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table)),
-      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table)),
-      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table)) {}
+      matchings_(VaryMatchingStart(query_part_.matching, symbol_table, cost_model)),
+      optional_matchings_(VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table, cost_model)),
+      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table, cost_model)),
+      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table, cost_model)) {}
 
 VaryQueryPartMatching::iterator::iterator(SingleQueryPart query_part, VaryMatchingStart::iterator matchings_begin,
                                           VaryMatchingStart::iterator matchings_end,
@@ -16,12 +16,85 @@
 #include "cppitertools/slice.hpp"
 #include "gflags/gflags.h"
 
+#include "query/plan/cost_estimator.hpp"
 #include "query/plan/rule_based_planner.hpp"
+#include "storage/v2/indices/label_index_stats.hpp"
 
 DECLARE_uint64(query_max_plans);
+DECLARE_uint64(query_max_join_order_expansions);
 
 namespace memgraph::query::plan {
 
+/// Estimates used for ordering the expansions of a matching by their cost.
+class ExpansionCostModel {
+ public:
+  virtual ~ExpansionCostModel() = default;
+
+  /// Number of vertices in the graph, at least 1.
+  virtual double VerticesCount() const = 0;
+
+  /// Fraction of all vertices which pass the label and property filters of
+  /// the node.
+  virtual double NodeSelectivity(const Symbol &node_symbol, const Filters &filters) const = 0;
+
+  /// Average number of edges of the atom in the given direction of a vertex
+  /// matched by `from_symbol`.
+  virtual double Degree(const EdgeAtom &edge, const Symbol &from_symbol, EdgeAtom::Direction direction,
+                        const Filters &filters) const = 0;
+};
+
+/// Cost model which uses the vertex counts and the index statistics of the
+/// database, with the `CostEstimator` constants where those are missing.
+template <class TDbAccessor>
+class DbExpansionCostModel final : public ExpansionCostModel {
+ public:
+  explicit DbExpansionCostModel(TDbAccessor *db) : db_(db) {}
+
+  double VerticesCount() const override { return std::max(static_cast<double>(db_->VerticesCount()), 1.0); }
+
+  double NodeSelectivity(const Symbol &node_symbol, const Filters &filters) const override {
+    double selectivity = 1.0;
+    for (const auto &label : filters.FilteredLabels(node_symbol)) {
+      auto label_count = static_cast<double>(db_->VerticesCount(db_->NameToLabel(label.name)));
+      selectivity = std::min(selectivity, label_count / VerticesCount());
+    }
+    for (size_t i = 0; i < filters.FilteredProperties(node_symbol).size(); ++i) {
+      selectivity *= CardParam::kFilter;
+    }
+    return selectivity;
+  }
+
+  double Degree(const EdgeAtom &edge, const Symbol &from_symbol, EdgeAtom::Direction direction,
+                const Filters &filters) const override {
+    if (edge.IsVariable()) return CardParam::kExpandVariable;
+    // Types given by expressions are only known at runtime, so all of the types are considered then
+    std::vector<storage::EdgeTypeId> edge_types;
+    for (const auto &edge_type : edge.edge_types_) {
+      const auto *edge_type_ix = std::get_if<EdgeTypeIx>(&edge_type);
+      if (!edge_type_ix) {
+        edge_types.clear();
+        break;
+      }
+      edge_types.push_back(db_->NameToEdgeType(edge_type_ix->name));
+    }
+    std::optional<double> degree;
+    for (const auto &label : filters.FilteredLabels(from_symbol)) {
+      auto stats = db_->GetIndexStats(db_->NameToLabel(label.name));
+      if (!stats || stats->count == 0) continue;
+      auto label_degree = storage::AverageDegree(*stats, edge_types, direction != EdgeAtom::Direction::IN,
+                                                 direction != EdgeAtom::Direction::OUT)
+                              .value_or(stats->avg_degree);
+      degree = std::min(degree.value_or(label_degree), label_degree);
+    }
+    return degree.value_or(CardParam::kExpand);
+  }
+
+ private:
+  using CardParam = typename CostEstimator<TDbAccessor>::CardParam;
+
+  TDbAccessor *db_;
+};
+
 /// Produces a Cartesian product among vectors between begin and end iterator.
 /// For example:
 ///
@@ -179,10 +252,12 @@ class PatternAtomSymbolEqual {
 };
 
 // Generates n matchings, where n is the number of nodes to match. Each Matching
-// will have a different node as a starting node for expansion.
+// will have a different node as a starting node for expansion. With a cost
+// model, the expansions from each starting node are ordered by their estimated
+// cost instead of breadth-first.
 class VaryMatchingStart {
  public:
-  VaryMatchingStart(Matching, const SymbolTable &);
+  VaryMatchingStart(Matching, const SymbolTable &, std::shared_ptr<const ExpansionCostModel> cost_model = nullptr);
 
   class iterator {
    public:
@@ -222,21 +297,27 @@ class VaryMatchingStart {
   friend class iterator;
   Matching matching_;
   const SymbolTable &symbol_table_;
+  std::shared_ptr<const ExpansionCostModel> cost_model_;
   std::vector<PatternAtom *> graph_atoms_;
 };
 
 // Similar to VaryMatchingStart, but varies the starting nodes for all given
 // matchings. After all matchings produce multiple alternative starts, the
 // Cartesian product of all of them is returned.
-CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &, const SymbolTable &);
+CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(
+    const std::vector<Matching> &, const SymbolTable &,
+    const std::shared_ptr<const ExpansionCostModel> &cost_model = nullptr);
 
-CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table);
+CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(
+    const Matching &matching, const SymbolTable &symbol_table,
+    const std::shared_ptr<const ExpansionCostModel> &cost_model = nullptr);
 
 // Produces alternative query parts out of a single part by varying how each
 // graph matching is done.
 class VaryQueryPartMatching {
  public:
-  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &);
+  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &,
+                        const std::shared_ptr<const ExpansionCostModel> &cost_model = nullptr);
 
   class iterator {
    public:
@@ -318,8 +399,11 @@ class VariableStartPlanner {
 
     auto single_query_parts = ExtractSingleQueryParts(std::make_unique<QueryParts>(query_parts));
 
+    // Shared by the lazily generated variants, which outlive this planner
+    std::shared_ptr<const ExpansionCostModel> cost_model =
+        std::make_shared<DbExpansionCostModel<std::remove_pointer_t<decltype(context_->db)>>>(context_->db);
     for (const auto &single_query_part : single_query_parts) {
-      varying_query_matchings.emplace_back(single_query_part, symbol_table);
+      varying_query_matchings.emplace_back(single_query_part, symbol_table, cost_model);
     }
 
     return iter::slice(MakeCartesianProduct(std::move(varying_query_matchings)), 0UL, FLAGS_query_max_plans);
@@ -3962,6 +3962,99 @@ mgp_error mgp_graph_approximate_edge_count(mgp_graph *graph, size_t *result) {
   return WrapExceptions([graph, result] { *result = graph->getImpl()->EdgesCount(); });
 }
 
+mgp_error mgp_graph_project(mgp_graph *graph, const char *const *labels, size_t labels_size,
+                            const char *const *edge_types, size_t edge_types_size, const char *weight_property,
+                            double default_weight, mgp_memory *memory, mgp_graph_projection **result) {
+  return WrapExceptions(
+      [=] {
+        auto *db_accessor = std::get_if<memgraph::query::DbAccessor *>(&graph->impl);
+        if (!db_accessor) {
+          throw std::logic_error{"Graph projections aren't supported on subgraphs."};
+        }
+#ifdef MG_ENTERPRISE
+        // Projections are built from the storage without label-based access control and are shared between
+        // transactions, so only users who can read the whole graph may use them.
+        if (memgraph::license::global_license_checker.IsEnterpriseValidFast() && graph->ctx &&
+            graph->ctx->auth_checker &&
+            (!graph->ctx->auth_checker->HasGlobalPrivilegeOnVertices(
+                 memgraph::query::AuthQuery::FineGrainedPrivilege::READ) ||
+             !graph->ctx->auth_checker->HasGlobalPrivilegeOnEdges(
+                 memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+          throw AuthorizationException{"Insufficient permissions for projecting the graph!"};
+        }
+#endif
+        memgraph::storage::GraphProjectionFilter filter{.default_weight = default_weight};
+        filter.labels.reserve(labels_size);
+        for (size_t i = 0; i < labels_size; ++i) {
+          filter.labels.push_back((*db_accessor)->NameToLabel(labels[i]));
+        }
+        filter.edge_types.reserve(edge_types_size);
+        for (size_t i = 0; i < edge_types_size; ++i) {
+          filter.edge_types.push_back((*db_accessor)->NameToEdgeType(edge_types[i]));
+        }
+        if (weight_property) {
+          filter.weight_property = (*db_accessor)->NameToProperty(weight_property);
+        }
+        auto projection = (*db_accessor)->GetGraphProjection(filter, graph->view);
+        if (!projection) {
+          throw std::logic_error{"Graph projections aren't supported in the current storage mode."};
+        }
+        return NewRawMgpObject<mgp_graph_projection>(memory, std::move(projection));
+      },
+      result);
+}
+
+void mgp_graph_projection_destroy(mgp_graph_projection *projection) { DeleteRawMgpObject(projection); }
+
+mgp_error mgp_graph_projection_vertex_count(mgp_graph_projection *projection, size_t *result) {
+  return WrapExceptions([projection] { return projection->impl->gids.size(); }, result);
+}
+
+mgp_error mgp_graph_projection_edge_count(mgp_graph_projection *projection, size_t *result) {
+  return WrapExceptions([projection] { return projection->impl->targets.size(); }, result);
+}
+
+mgp_error mgp_graph_projection_offsets(mgp_graph_projection *projection, const uint64_t **result) {
+  return WrapExceptions([projection] { return projection->impl->offsets.data(); }, result);
+}
+
+mgp_error mgp_graph_projection_targets(mgp_graph_projection *projection, const uint64_t **result) {
+  return WrapExceptions([projection] { return projection->impl->targets.data(); }, result);
+}
+
+mgp_error mgp_graph_projection_weights(mgp_graph_projection *projection, const double **result) {
+  return WrapExceptions(
+      [projection]() -> const double * {
+        if (projection->impl->weights.empty()) return nullptr;
+        return projection->impl->weights.data();
+      },
+      result);
+}
+
+mgp_error mgp_graph_projection_vertex_id(mgp_graph_projection *projection, size_t index, mgp_vertex_id *result) {
+  return WrapExceptions(
+      [projection, index] {
+        if (index >= projection->impl->gids.size()) {
+          throw std::out_of_range{"Vertex index is out of the graph projection."};
+        }
+        return mgp_vertex_id{.as_int = projection->impl->gids[index].AsInt()};
+      },
+      result);
+}
+
+mgp_error mgp_graph_projection_vertex_index(mgp_graph_projection *projection, mgp_vertex_id id, size_t *result) {
+  return WrapExceptions(
+      [projection, id] {
+        auto const &gids = projection->impl->gids;
+        auto const it = std::ranges::lower_bound(gids, memgraph::storage::Gid::FromInt(id.as_int));
+        if (it == gids.end() || it->AsInt() != id.as_int) {
+          throw std::out_of_range{"Vertex isn't in the graph projection."};
+        }
+        return static_cast<size_t>(it - gids.begin());
+      },
+      result);
+}
+
 mgp_error mgp_vertices_iterator_underlying_graph_is_mutable(mgp_vertices_iterator *it, int *result) {
   return mgp_graph_is_mutable(it->graph, result);
 }
@@ -705,6 +705,19 @@ struct mgp_vertices_iterator {
   std::optional<mgp_vertex> current_v;
 };
 
+struct mgp_graph_projection {
+  using allocator_type = memgraph::utils::Allocator<mgp_graph_projection>;
+
+  mgp_graph_projection(std::shared_ptr<memgraph::storage::GraphProjection const> impl, allocator_type alloc)
+      : alloc(alloc), impl(std::move(impl)) {}
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const { return alloc.resource(); }
+
+  allocator_type alloc;
+  // Shared with the storage, which keeps it for reuse by other transactions
+  std::shared_ptr<memgraph::storage::GraphProjection const> impl;
+};
+
 struct mgp_type {
   memgraph::query::procedure::CypherTypePtr impl;
 };
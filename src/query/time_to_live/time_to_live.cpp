@@ -14,9 +14,10 @@
 #include <chrono>
 #include <memory>
 #include <optional>
+#include <string>
 #include <thread>
+#include <vector>
 
-#include "query/discard_value_stream.hpp"
 #include "query/interpreter.hpp"
 #include "query/interpreter_context.hpp"
 #include "query/typed_value.hpp"
@@ -37,6 +38,23 @@ int GetPart(auto &current) {
   current -= T{whole_part};
   return whole_part;
 }
+
+/// Result stream of a TTL batch, keeping the largest ttl it deleted.
+struct LastTtlResultStream final {
+  void Result(const std::vector<memgraph::query::TypedValue> &values) {
+    last_ttl.reset();
+    if (values.empty()) return;
+    if (values[0].IsInt()) {
+      last_ttl.emplace(values[0].ValueInt());
+    } else if (values[0].IsDouble()) {
+      last_ttl.emplace(values[0].ValueDouble());
+    }
+  }
+
+  std::optional<memgraph::storage::ExternalPropertyValue> last_ttl;
+};
+
+constexpr int64_t kTtlBatchSize = 10000;
 }  // namespace
 
 namespace memgraph::query::ttl {
@@ -69,12 +87,17 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context, cons
   interpreter_context->interpreters->insert(interpreter.get());
 
   auto TTL = [interpreter = std::move(interpreter), should_run_edge_ttl]() {
-    memgraph::query::DiscardValueResultStream result_stream;
     bool finished_vertex = false;
     bool finished_edge = !should_run_edge_ttl;
     // Using microseconds to be aligned with timestamp() query, could just use seconds
     const auto now = std::chrono::system_clock::now();
     const auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch());
+    // The queries are served by the ttl indices created with ENABLE TTL, which keep the objects ordered by their
+    // ttl, so a batch deletes the objects expiring first. The next batch continues from the largest deleted ttl,
+    // instead of walking over the index entries of the objects deleted (but not yet garbage collected) so far.
+    // Once a continued batch finds nothing, a last batch from the beginning makes sure nothing was skipped.
+    std::optional<storage::ExternalPropertyValue> vertex_from;
+    std::optional<storage::ExternalPropertyValue> edge_from;
 
     auto get_value = [](auto map, std::string_view key) {
       int64_t n = 0;
@@ -87,45 +110,66 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context, cons
       return n;
     };
 
+    // Deletes a batch of the expired objects, continuing from `from` if set
+    auto run_batch = [&](std::string_view query, std::string_view query_from,
+                         const std::optional<storage::ExternalPropertyValue> &from,
+                         LastTtlResultStream &result_stream) {
+      interpreter->Prepare(std::string{from ? query_from : query},
+                           [&](auto) {
+                             UserParameters params;
+                             params.emplace("now", now_us.count());
+                             params.emplace("batch", kTtlBatchSize);
+                             if (from) params.emplace("from", *from);
+                             return params;
+                           },
+                           {});
+      return interpreter->PullAll(&result_stream);
+    };
+
+    // A run is finished once a batch from the beginning finds nothing to delete
+    auto is_finished = [](const auto &pull_res, const int64_t n, const bool continued) {
+      return !pull_res.at("has_more").ValueBool() && n == 0 && !continued;
+    };
+
     spdlog::trace("Running TTL at {}", now);
     while (!finished_vertex || !finished_edge) {
       try {
         int n_deleted = 0;
         int n_edges_deleted = 0;
+        LastTtlResultStream result_stream;
+        // Where the batch continues from, moved on only once the batch is committed
+        std::optional<storage::ExternalPropertyValue> *from = nullptr;
         interpreter->BeginTransaction();
         // First run vertex TTL as that might already delete edges scheduled to be deleted by the edge TTL
         if (!finished_vertex) {
-          auto prepare_result =
-              interpreter->Prepare("MATCH (n:TTL) WHERE n.ttl < $now WITH n LIMIT $batch DETACH DELETE n;",
-                                   [now_us](auto) {
-                                     UserParameters params;
-                                     params.emplace("now", now_us.count());
-                                     params.emplace("batch", 10000);
-                                     return params;
-                                   },
-                                   {});
-          const auto pull_res = interpreter->PullAll(&result_stream);
+          const bool continued = vertex_from.has_value();
+          from = &vertex_from;
+          const auto pull_res = run_batch(
+              "MATCH (n:TTL) WHERE n.ttl < $now WITH n LIMIT $batch WITH n, n.ttl AS ttl DETACH DELETE n "
+              "RETURN max(ttl);",
+              "MATCH (n:TTL) WHERE n.ttl >= $from AND n.ttl < $now WITH n LIMIT $batch WITH n, n.ttl AS ttl "
+              "DETACH DELETE n RETURN max(ttl);",
+              vertex_from, result_stream);
           n_deleted = get_value(pull_res, "nodes-deleted");
           n_edges_deleted = get_value(pull_res, "relationships-deleted");
-          finished_vertex = !pull_res.at("has_more").ValueBool() && n_deleted == 0;
+          finished_vertex = is_finished(pull_res, n_deleted, continued);
         } else if (!finished_edge) {
-          auto prepare_result =
-              interpreter->Prepare("MATCH ()-[e]->() WHERE e.ttl < $now WITH e LIMIT $batch DETACH DELETE e;",
-                                   [now_us](auto) {
-                                     UserParameters params;
-                                     params.emplace("now", now_us.count());
-                                     params.emplace("batch", 10000);
-                                     return params;
-                                   },
-                                   {});
-          const auto pull_res = interpreter->PullAll(&result_stream);
+          const bool continued = edge_from.has_value();
+          from = &edge_from;
+          const auto pull_res = run_batch(
+              "MATCH ()-[e]->() WHERE e.ttl < $now WITH e LIMIT $batch WITH e, e.ttl AS ttl DETACH DELETE e "
+              "RETURN max(ttl);",
+              "MATCH ()-[e]->() WHERE e.ttl >= $from AND e.ttl < $now WITH e LIMIT $batch WITH e, e.ttl AS ttl "
+              "DETACH DELETE e RETURN max(ttl);",
+              edge_from, result_stream);
           n_edges_deleted = get_value(pull_res, "relationships-deleted");
-          finished_edge = !pull_res.at("has_more").ValueBool() && n_edges_deleted == 0;
+          finished_edge = is_finished(pull_res, n_edges_deleted, continued);
         } else {
           DMG_ASSERT(false, "Unsupported TTL state.");
         }
         spdlog::trace("Committing TTL batch transaction");
         interpreter->CommitTransaction();
+        if (from) *from = std::move(result_stream.last_ttl);
         spdlog::trace("Committed TTL batch deleted {} vertices and {} edges", n_deleted, n_edges_deleted);
         // Telemetry
         memgraph::metrics::IncrementCounter(memgraph::metrics::DeletedNodes, n_deleted);
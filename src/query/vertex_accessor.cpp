@@ -26,7 +26,7 @@ storage::Result<EdgeVertexAccessorResult> VertexAccessor::InEdges(storage::View
   std::ranges::transform((*maybe_result).edges, std::back_inserter(edges),
                          [](auto const &edge) { return EdgeAccessor(edge); });
 
-  return EdgeVertexAccessorResult{.edges = edges, .expanded_count = (*maybe_result).expanded_count};
+  return EdgeVertexAccessorResult{.edges = std::move(edges), .expanded_count = (*maybe_result).expanded_count};
 }
 
 storage::Result<EdgeVertexAccessorResult> VertexAccessor::InEdges(storage::View view,
@@ -41,7 +41,7 @@ storage::Result<EdgeVertexAccessorResult> VertexAccessor::InEdges(storage::View
   std::ranges::transform((*maybe_result).edges, std::back_inserter(edges),
                          [](auto const &edge) { return EdgeAccessor(edge); });
 
-  return EdgeVertexAccessorResult{.edges = edges, .expanded_count = (*maybe_result).expanded_count};
+  return EdgeVertexAccessorResult{.edges = std::move(edges), .expanded_count = (*maybe_result).expanded_count};
 }
 
 storage::Result<EdgeVertexAccessorResult> VertexAccessor::InEdges(storage::View view) const {
@@ -59,7 +59,7 @@ storage::Result<EdgeVertexAccessorResult> VertexAccessor::OutEdges(storage::View
   std::ranges::transform((*maybe_result).edges, std::back_inserter(edges),
                          [](auto const &edge) { return EdgeAccessor(edge); });
 
-  return EdgeVertexAccessorResult{.edges = edges, .expanded_count = (*maybe_result).expanded_count};
+  return EdgeVertexAccessorResult{.edges = std::move(edges), .expanded_count = (*maybe_result).expanded_count};
 }
 
 storage::Result<EdgeVertexAccessorResult> VertexAccessor::OutEdges(storage::View view,
@@ -74,11 +74,45 @@ storage::Result<EdgeVertexAccessorResult> VertexAccessor::OutEdges(storage::View
   std::ranges::transform((*maybe_result).edges, std::back_inserter(edges),
                          [](auto const &edge) { return EdgeAccessor(edge); });
 
-  return EdgeVertexAccessorResult{.edges = edges, .expanded_count = (*maybe_result).expanded_count};
+  return EdgeVertexAccessorResult{.edges = std::move(edges), .expanded_count = (*maybe_result).expanded_count};
 }
 
 storage::Result<EdgeVertexAccessorResult> VertexAccessor::OutEdges(storage::View view) const {
   return OutEdges(view, {});
 }
 
+storage::Result<EdgeVertexAccessorRange> VertexAccessor::InEdgesRange(
+    storage::View view, const std::vector<storage::EdgeTypeId> &edge_types, query::HopsLimit *hops_limit) const {
+  auto maybe_result = impl_.InEdgesRange(view, edge_types, nullptr, hops_limit);
+  if (maybe_result.HasError()) return maybe_result.GetError();
+  return EdgeVertexAccessorRange{.edges = EdgesRange(std::move(maybe_result->edges)),
+                                 .expanded_count = maybe_result->expanded_count};
+}
+
+storage::Result<EdgeVertexAccessorRange> VertexAccessor::InEdgesRange(
+    storage::View view, const std::vector<storage::EdgeTypeId> &edge_types, const VertexAccessor &dest,
+    query::HopsLimit *hops_limit) const {
+  auto maybe_result = impl_.InEdgesRange(view, edge_types, &dest.impl_, hops_limit);
+  if (maybe_result.HasError()) return maybe_result.GetError();
+  return EdgeVertexAccessorRange{.edges = EdgesRange(std::move(maybe_result->edges)),
+                                 .expanded_count = maybe_result->expanded_count};
+}
+
+storage::Result<EdgeVertexAccessorRange> VertexAccessor::OutEdgesRange(
+    storage::View view, const std::vector<storage::EdgeTypeId> &edge_types, query::HopsLimit *hops_limit) const {
+  auto maybe_result = impl_.OutEdgesRange(view, edge_types, nullptr, hops_limit);
+  if (maybe_result.HasError()) return maybe_result.GetError();
+  return EdgeVertexAccessorRange{.edges = EdgesRange(std::move(maybe_result->edges)),
+                                 .expanded_count = maybe_result->expanded_count};
+}
+
+storage::Result<EdgeVertexAccessorRange> VertexAccessor::OutEdgesRange(
+    storage::View view, const std::vector<storage::EdgeTypeId> &edge_types, const VertexAccessor &dest,
+    query::HopsLimit *hops_limit) const {
+  auto maybe_result = impl_.OutEdgesRange(view, edge_types, &dest.impl_, hops_limit);
+  if (maybe_result.HasError()) return maybe_result.GetError();
+  return EdgeVertexAccessorRange{.edges = EdgesRange(std::move(maybe_result->edges)),
+                                 .expanded_count = maybe_result->expanded_count};
+}
+
 }  // namespace memgraph::query
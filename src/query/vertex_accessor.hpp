@@ -20,6 +20,7 @@
 namespace memgraph::query {
 
 class EdgeAccessor;
+struct EdgeVertexAccessorRange;
 
 struct EdgeVertexAccessorResult {
   std::vector<EdgeAccessor> edges;
@@ -97,6 +98,26 @@ class VertexAccessor final {
                                                      const VertexAccessor &dest,
                                                      query::HopsLimit *hops_limit = nullptr) const;
 
+  /// The edge accessors are created while the result is iterated, so the
+  /// consumers which don't need all of the edges at once should prefer these.
+  storage::Result<EdgeVertexAccessorRange> InEdgesRange(storage::View view,
+                                                        const std::vector<storage::EdgeTypeId> &edge_types,
+                                                        query::HopsLimit *hops_limit = nullptr) const;
+
+  storage::Result<EdgeVertexAccessorRange> InEdgesRange(storage::View view,
+                                                        const std::vector<storage::EdgeTypeId> &edge_types,
+                                                        const VertexAccessor &dest,
+                                                        query::HopsLimit *hops_limit = nullptr) const;
+
+  storage::Result<EdgeVertexAccessorRange> OutEdgesRange(storage::View view,
+                                                         const std::vector<storage::EdgeTypeId> &edge_types,
+                                                         query::HopsLimit *hops_limit = nullptr) const;
+
+  storage::Result<EdgeVertexAccessorRange> OutEdgesRange(storage::View view,
+                                                         const std::vector<storage::EdgeTypeId> &edge_types,
+                                                         const VertexAccessor &dest,
+                                                         query::HopsLimit *hops_limit = nullptr) const;
+
   storage::Result<size_t> InDegree(storage::View view) const { return impl_.InDegree(view); }
 
   storage::Result<size_t> OutDegree(storage::View view) const { return impl_.OutDegree(view); }
@@ -14,6 +14,7 @@
 #include "replication/config.hpp"
 #include "replication_coordination_glue/messages.hpp"
 #include "rpc/client.hpp"
+#include "rpc/client_pool.hpp"
 #include "utils/event_histogram.hpp"
 #include "utils/metrics_timer.hpp"
 #include "utils/rw_lock.hpp"
@@ -57,10 +58,9 @@ struct ReplicationClient {
                              // Measure callbacks also to see how long it takes between scheduled runs
                              utils::MetricsTimer const timer{metrics::FrequentHeartbeatRpc_us};
                              try {
-                               {
-                                 auto stream{rpc_client_.Stream<replication_coordination_glue::FrequentHeartbeatRpc>()};
-                                 stream.SendAndWait();
-                               }
+                               // Sent over the pool so the check doesn't wait behind a long recovery or
+                               // transaction RPC holding the ordered client
+                               heartbeat_client_pool_.Call<replication_coordination_glue::FrequentHeartbeatRpc>();
                                succ_cb(*this);
                                failed_attempts = 0U;
                              } catch (const rpc::RpcFailedException &) {
@@ -121,6 +121,8 @@ struct ReplicationClient {
   std::string name_;
   communication::ClientContext rpc_context_;
   rpc::Client rpc_client_;
+  // Connections for the frequent heartbeats, which don't have to be ordered with the RPCs of rpc_client_
+  rpc::ClientPool heartbeat_client_pool_;
   std::chrono::seconds replica_check_frequency_;
   // True only when we are migrating from V1 or V2 to V3 in replication durability
   // and we want to set replica to listen to main
@@ -26,6 +26,7 @@ ReplicationClient::ReplicationClient(const ReplicationClientConfig &config)
     : name_{config.name},
       rpc_context_{CreateClientContext(config)},
       rpc_client_{config.repl_server_endpoint, &rpc_context_},
+      heartbeat_client_pool_{config.repl_server_endpoint, &rpc_context_},
       replica_check_frequency_{config.replica_check_frequency},
       mode_{config.mode} {}
 
@@ -23,11 +23,12 @@ auto CreateServerContext(const memgraph::replication::ReplicationServerConfig &c
                       : communication::ServerContext{};
 }
 
-// NOTE: The replication server must have a single thread for processing
-// because there is no need for more processing threads - each replica can
-// have only a single main server. Also, the single-threaded guarantee
-// simplifies the rest of the implementation.
-constexpr auto kReplicationServerThreads = 1;
+// NOTE: Each replica can have only a single main server, which sends all the
+// data RPCs over a single connection. A connection is always handled by one
+// thread at a time, so those RPCs are still processed in order. The second
+// thread serves the frequent heartbeats, which main sends over separate
+// connections so they don't wait behind a long recovery or transaction RPC.
+constexpr auto kReplicationServerThreads = 2;
 }  // namespace
 
 ReplicationServer::ReplicationServer(const memgraph::replication::ReplicationServerConfig &config)
@@ -13,6 +13,8 @@
 
 #include <mutex>
 #include <stack>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 
 #include "rpc/client.hpp"
@@ -23,11 +25,24 @@ namespace memgraph::rpc {
  * A simple client pool that creates new RPC clients on demand. Useful when you
  * want to send RPCs to the same server from multiple threads without them
  * blocking each other.
+ *
+ * Each client has its own connection, so the RPCs sent through the pool aren't
+ * ordered with each other nor with the RPCs of any other client. Use it only
+ * for the RPCs whose order doesn't matter, e.g. liveness checks, which then
+ * don't have to wait for a long RPC holding the lock of the ordered client.
+ * At most `max_idle_clients` connections are kept open between the calls.
  */
 class ClientPool {
  public:
-  ClientPool(io::network::Endpoint endpoint, communication::ClientContext *context)
-      : endpoint_(std::move(endpoint)), context_(context) {}
+  static constexpr size_t kDefaultMaxIdleClients = 4;
+
+  ClientPool(io::network::Endpoint endpoint, communication::ClientContext *context,
+             std::unordered_map<std::string_view, int> const &rpc_timeouts_ms = Client::default_rpc_timeouts_ms,
+             size_t max_idle_clients = kDefaultMaxIdleClients)
+      : endpoint_(std::move(endpoint)),
+        context_(context),
+        rpc_timeouts_ms_(rpc_timeouts_ms),
+        max_idle_clients_(max_idle_clients) {}
 
   template <class TRequestResponse, class... Args>
   typename TRequestResponse::Response Call(Args &&...args) {
@@ -42,6 +57,12 @@ class ClientPool {
     });
   }
 
+  /// The number of connections kept open between the calls
+  size_t IdleClientCount() {
+    auto lock = std::unique_lock{mutex_};
+    return unused_clients_.size();
+  }
+
  private:
   template <class TFun>
   auto WithUnusedClient(const TFun &fun) {
@@ -49,7 +70,7 @@ class ClientPool {
 
     auto lock = std::unique_lock{mutex_};
     if (unused_clients_.empty()) {
-      client = std::make_unique<Client>(endpoint_, context_);
+      client = std::make_unique<Client>(endpoint_, context_, rpc_timeouts_ms_);
     } else {
       client = std::move(unused_clients_.top());
       unused_clients_.pop();
@@ -59,12 +80,17 @@ class ClientPool {
     auto res = fun(client);
 
     lock.lock();
-    unused_clients_.push(std::move(client));
+    // The connections over the limit are closed, the pool only grows while many threads call at the same time
+    if (unused_clients_.size() < max_idle_clients_) {
+      unused_clients_.push(std::move(client));
+    }
     return res;
   }
 
   io::network::Endpoint endpoint_;
   communication::ClientContext *context_;
+  std::unordered_map<std::string_view, int> rpc_timeouts_ms_;
+  size_t max_idle_clients_;
 
   std::mutex mutex_;
   std::stack<std::unique_ptr<Client>> unused_clients_;
@@ -36,6 +36,10 @@ constexpr auto v3 = Version{2024'02'02'0'2'14};
 // this is due to auto index creation
 constexpr auto v4 = Version{2024'07'02'0'2'18};
 
-constexpr auto current_version = v4;
+// PrepareCommitReq carries the number of transactions whose deltas follow,
+// an ASYNC replica can be sent several transactions in one request
+constexpr auto v5 = Version{2025'06'02'0'3'04};
+
+constexpr auto current_version = v5;
 
 }  // namespace memgraph::rpc
@@ -38,4 +38,48 @@ AllVerticesIterable::Iterator &AllVerticesIterable::Iterator::operator++() {
   return *this;
 }
 
+AllVerticesChunkedIterable::AllVerticesChunkedIterable(utils::SkipList<Vertex>::Accessor vertices_accessor,
+                                                       Storage *storage, Transaction *transaction, View view,
+                                                       size_t num_chunks)
+    : vertices_accessor_(std::move(vertices_accessor)), storage_(storage), transaction_(transaction), view_(view) {
+  for (const auto &it : vertices_accessor_.chunk_boundaries(num_chunks)) {
+    chunk_starts_.push_back(it->gid);
+  }
+}
+
+AllVerticesChunkedIterable::Chunk AllVerticesChunkedIterable::get_chunk(size_t id) {
+  DMG_ASSERT(id < size(), "Chunk id out of range");
+  auto begin = id == 0 ? vertices_accessor_.begin() : vertices_accessor_.find_equal_or_greater(chunk_starts_[id - 1]);
+  auto upper_bound = id < chunk_starts_.size() ? std::optional{chunk_starts_[id]} : std::nullopt;
+  return {this, begin, upper_bound};
+}
+
+AllVerticesChunkedIterable::Iterator::Iterator(AllVerticesChunkedIterable *self, utils::SkipList<Vertex>::Iterator it,
+                                               std::optional<Gid> upper_bound)
+    : self_(self), it_(it), upper_bound_(upper_bound) {
+  AdvanceToVisibleVertex();
+}
+
+void AllVerticesChunkedIterable::Iterator::AdvanceToVisibleVertex() {
+  const auto end = self_->vertices_accessor_.end();
+  for (; it_ != end; ++it_) {
+    // Gids are the skip list keys, so the first vertex past the bound belongs
+    // to the next chunk.
+    if (upper_bound_ && it_->gid >= *upper_bound_) {
+      it_ = end;
+      break;
+    }
+    if (VertexAccessor::IsVisible(&*it_, self_->transaction_, self_->view_)) [[likely]] {
+      vertex_.emplace(&*it_, self_->storage_, self_->transaction_);
+      break;
+    }
+  }
+}
+
+AllVerticesChunkedIterable::Iterator &AllVerticesChunkedIterable::Iterator::operator++() {
+  ++it_;
+  AdvanceToVisibleVertex();
+  return *this;
+}
+
 }  // namespace memgraph::storage
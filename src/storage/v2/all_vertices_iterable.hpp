@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/skip_list.hpp"
 
@@ -50,4 +53,59 @@ class AllVerticesIterable final {
   Iterator end() { return {this, vertices_accessor_.end()}; }
 };
 
+/// Splits all vertices into independent chunks that can be consumed from
+/// different threads at the same time. Chunks are delimited by vertex gids, so
+/// every vertex belongs to exactly one chunk. Each chunk iterator owns its own
+/// `VertexAccessor`; the iterable itself has to outlive all of its chunks.
+class AllVerticesChunkedIterable final {
+  utils::SkipList<Vertex>::Accessor vertices_accessor_;
+  Storage *storage_;
+  Transaction *transaction_;
+  View view_;
+  // First gid of chunks 1..n, chunk 0 starts at the beginning of the list.
+  std::vector<Gid> chunk_starts_;
+
+ public:
+  class Iterator final {
+    AllVerticesChunkedIterable *self_;
+    utils::SkipList<Vertex>::Iterator it_;
+    std::optional<Gid> upper_bound_;
+    std::optional<VertexAccessor> vertex_;
+
+    void AdvanceToVisibleVertex();
+
+   public:
+    Iterator(AllVerticesChunkedIterable *self, utils::SkipList<Vertex>::Iterator it, std::optional<Gid> upper_bound);
+
+    VertexAccessor const &operator*() const { return *vertex_; }
+
+    Iterator &operator++();
+
+    bool operator==(const Iterator &other) const { return self_ == other.self_ && it_ == other.it_; }
+
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+  };
+
+  class Chunk final {
+    AllVerticesChunkedIterable *self_;
+    utils::SkipList<Vertex>::Iterator begin_;
+    std::optional<Gid> upper_bound_;
+
+   public:
+    Chunk(AllVerticesChunkedIterable *self, utils::SkipList<Vertex>::Iterator begin, std::optional<Gid> upper_bound)
+        : self_(self), begin_(begin), upper_bound_(upper_bound) {}
+
+    Iterator begin() { return {self_, begin_, upper_bound_}; }
+    Iterator end() { return {self_, self_->vertices_accessor_.end(), std::nullopt}; }
+  };
+
+  AllVerticesChunkedIterable(utils::SkipList<Vertex>::Accessor vertices_accessor, Storage *storage,
+                             Transaction *transaction, View view, size_t num_chunks);
+
+  size_t size() const { return chunk_starts_.size() + 1; }
+
+  /// Thread-safe; returns the chunk with the given index (0 <= id < size()).
+  Chunk get_chunk(size_t id);
+};
+
 }  // namespace memgraph::storage
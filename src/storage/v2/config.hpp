@@ -14,6 +14,9 @@
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "flags/coord_flag_env_handler.hpp"
 #include "flags/replication.hpp"
@@ -64,6 +67,8 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+    // Number of threads unlinking deltas, cleaning up indices and removing deleted objects in a GC cycle
+    uint64_t thread_count{1};
     friend bool operator==(const Gc &lrh, const Gc &rhs) = default;
   } gc;  // SYSTEM FLAG
 
@@ -81,9 +86,13 @@ struct Config {
     memgraph::utils::SchedulerInterval snapshot_interval{
         std::chrono::minutes(2)};          // PER DATABASE - as at time of initialization; can be changed by user
     uint64_t snapshot_retention_count{3};  // PER DATABASE
+    // Number of incremental snapshots created between two full ones (0 disables them)
+    uint64_t snapshot_incremental_count{0};  // PER DATABASE
 
     uint64_t wal_file_size_kibibytes{20 * 1024};  // PER DATABASE
     uint64_t wal_file_flush_every_n_tx{100000};   // PER DATABASE
+    // Every commit waits until its WAL records are synced, syncs of concurrent commits are grouped together
+    bool wal_group_commit{false};  // PER DATABASE
 
     bool snapshot_on_exit{false};                      // PER DATABASE
     bool restore_replication_state_on_startup{false};  // PER INSTANCE
@@ -91,9 +100,15 @@ struct Config {
     uint64_t items_per_batch{1'000'000};  // PER DATABASE
     uint64_t snapshot_thread_count{8};    // PER INSTANCE SYSTEM FLAG
     uint64_t recovery_thread_count{8};    // PER INSTANCE SYSTEM FLAG
+    // Snapshots are memory-mapped during recovery instead of being read through a buffer
+    bool recovery_memory_mapped{false};  // PER INSTANCE SYSTEM FLAG
 
     bool allow_parallel_snapshot_creation{false};  // PER DATABASE
     bool allow_parallel_schema_creation{false};    // PER DATABASE
+
+    // Compression of the vertices and edges in snapshots and of the deltas in WAL files
+    bool compression_enabled{false};                                          // PER DATABASE
+    utils::CompressionLevel compression_level{utils::CompressionLevel::MID};  // PER DATABASE
     friend bool operator==(const Durability &lrh, const Durability &rhs) = default;
   } durability;
 
@@ -116,6 +131,15 @@ struct Config {
 
   SalientConfig salient;
 
+  // Label and property names whose numeric values are cached in columns (see `PropertyColumns`)
+  std::vector<std::pair<std::string, std::string>> columnar_properties;  // PER DATABASE
+
+  // Number of threads populating an index created at runtime
+  uint64_t index_population_thread_count{1};  // PER INSTANCE SYSTEM FLAG
+
+  // Number of threads building a graph projection for query modules
+  uint64_t graph_projection_thread_count{8};  // PER INSTANCE SYSTEM FLAG
+
   bool force_on_disk{false};  // TODO: cleanup.... remove + make the default storage_mode ON_DISK_TRANSACTIONAL if true
 
   friend bool operator==(const Config &lrh, const Config &rhs) = default;
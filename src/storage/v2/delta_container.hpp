@@ -240,6 +240,9 @@ struct delta_container {
   auto begin() const { return ConstFlatten(deltas_).begin(); }
   auto end() const { return ConstFlatten(deltas_).end(); }
 
+  // The deltas in slabs of at most `delta_slab::capacity()`, so they can be split into batches for processing
+  auto slabs() -> PageAlignedList<delta_slab> & { return deltas_; }
+
   template <typename... Args>
   auto emplace(Args &&...args) -> Delta & {
     auto do_emplace = [&]() -> Delta & {
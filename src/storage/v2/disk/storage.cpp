@@ -494,6 +494,15 @@ void DiskStorage::LoadVerticesFromLabelPropertyIndexStorageToEdgeImportCache(Tra
   }
 }
 
+VerticesChunkedIterable DiskStorage::DiskAccessor::ChunkedVertices(View /*view*/, size_t /*num_chunks*/) {
+  throw utils::NotYetImplemented("Chunked vertices are not yet implemented for on-disk storage. {}", kErrorMessage);
+}
+
+VerticesChunkedIterable DiskStorage::DiskAccessor::ChunkedVertices(LabelId /*label*/, View /*view*/,
+                                                                   size_t /*num_chunks*/) {
+  throw utils::NotYetImplemented("Chunked vertices are not yet implemented for on-disk storage. {}", kErrorMessage);
+}
+
 VerticesIterable DiskStorage::DiskAccessor::Vertices(View view) {
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
   if (disk_storage->edge_import_status_ == EdgeImportMode::ACTIVE) {
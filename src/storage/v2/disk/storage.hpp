@@ -75,6 +75,10 @@ class DiskStorage final : public Storage {
     VerticesIterable Vertices(LabelId label, std::span<storage::PropertyPath const> properties,
                               std::span<storage::PropertyValueRange const> property_ranges, View view) override;
 
+    VerticesChunkedIterable ChunkedVertices(View view, size_t num_chunks) override;
+
+    VerticesChunkedIterable ChunkedVertices(LabelId label, View view, size_t num_chunks) override;
+
     std::optional<EdgeAccessor> FindEdge(Gid gid, View view) override;
 
     EdgesIterable Edges(EdgeTypeId edge_type, View view) override;
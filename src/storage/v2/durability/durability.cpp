@@ -456,6 +456,31 @@ std::optional<ParallelizedSchemaCreationInfo> GetParallelExecInfo(const Recovery
              : std::nullopt;
 }
 
+namespace {
+// The vertex batches recovered from the snapshot don't cover the vertices
+// created by the incremental snapshots and WALs, so they are regenerated.
+// TODO edges?
+void RegenerateVertexBatches(utils::SkipList<Vertex> *vertices, uint64_t const items_per_batch,
+                             RecoveryInfo &recovery_info) {
+  size_t pos = 0;
+  size_t batched = 0;
+  recovery_info.vertex_batches.clear();
+  auto v_acc = vertices->access();
+  const auto size = v_acc.size();
+  for (auto v_itr = v_acc.begin(); v_itr != v_acc.end(); ++v_itr, ++pos) {
+    if (pos == batched) {
+      const auto left = size - pos;
+      if (left <= items_per_batch) {
+        recovery_info.vertex_batches.emplace_back(v_itr->gid, left);
+        break;
+      }
+      recovery_info.vertex_batches.emplace_back(v_itr->gid, items_per_batch);
+      batched += items_per_batch;
+    }
+  }
+}
+}  // namespace
+
 std::optional<RecoveryInfo> Recovery::RecoverData(
     utils::UUID &uuid, ReplicationStorageState &repl_storage_state, utils::SkipList<Vertex> *vertices,
     utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata, std::atomic<uint64_t> *edge_count,
@@ -513,6 +538,19 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
     recovery_info = recovered_snapshot->recovery_info;
     indices_constraints = std::move(recovered_snapshot->indices_constraints);
     snapshot_durable_timestamp = recovered_snapshot->snapshot_info.durable_timestamp;
+
+    // Continue with the incremental snapshots created after the recovered one.
+    try {
+      if (auto const last_incremental = LoadIncrementalSnapshots(
+              snapshot_directory_, recovered_snapshot->snapshot_info, vertices, edges, edges_metadata, name_id_mapper,
+              edge_count, config, schema_info, &recovery_info)) {
+        snapshot_durable_timestamp = last_incremental->durable_timestamp;
+        RegenerateVertexBatches(vertices, config.durability.items_per_batch, recovery_info);
+        spdlog::info("Incremental snapshot recovery successful!");
+      }
+    } catch (const RecoveryFailure &e) {
+      LOG_FATAL("Couldn't recover incremental snapshots because of: {}", e.what());
+    }
     spdlog::trace("Recovered epoch {} for db {}", recovered_snapshot->snapshot_info.epoch_id, db_name);
     repl_storage_state.epoch_.SetEpoch(std::move(recovered_snapshot->snapshot_info.epoch_id));
     recovery_info.last_durable_timestamp = *snapshot_durable_timestamp;
@@ -647,24 +685,7 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
 
     spdlog::info("All necessary WAL files are loaded successfully.");
 
-    // Regenerate the vertex batches
-    // TODO edges?
-    size_t pos = 0;
-    size_t batched = 0;
-    recovery_info.vertex_batches.clear();
-    auto v_acc = vertices->access();
-    const auto size = v_acc.size();
-    for (auto v_itr = v_acc.begin(); v_itr != v_acc.end(); ++v_itr, ++pos) {
-      if (pos == batched) {
-        const auto left = size - pos;
-        if (left <= config.durability.items_per_batch) {
-          recovery_info.vertex_batches.emplace_back(v_itr->gid, left);
-          break;
-        }
-        recovery_info.vertex_batches.emplace_back(v_itr->gid, config.durability.items_per_batch);
-        batched += config.durability.items_per_batch;
-      }
-    }
+    RegenerateVertexBatches(vertices, config.durability.items_per_batch, recovery_info);
   }
 
   // Apply meta structures now after all graph data has been loaded
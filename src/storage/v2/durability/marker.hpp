@@ -43,6 +43,9 @@ enum class Marker : uint8_t {
   SECTION_EPOCH_HISTORY = 0x27,
   SECTION_EDGE_INDICES = 0x28,
   SECTION_ENUMS = 0x29,
+  // Starts a compressed block. The Decoder consumes it and never returns it
+  // as a marker, so it isn't listed in `kMarkersAll`.
+  SECTION_COMPRESSED = 0x2a,
 
   SECTION_OFFSETS = 0x42,
 
@@ -34,6 +34,12 @@ inline std::string MakeSnapshotName(uint64_t start_timestamp) {
   return date_str + "_timestamp_" + std::to_string(start_timestamp);
 }
 
+// Generates the name for an incremental snapshot in the same format as the
+// full snapshots.
+inline std::string MakeIncrementalSnapshotName(uint64_t start_timestamp) {
+  return MakeSnapshotName(start_timestamp) + "_incremental";
+}
+
 // Generates the name for a WAL file in a well-defined sortable format.
 inline std::string MakeWalName() {
   std::string date_str = utils::Timestamp::Now().ToString(kTimestampFormat);
@@ -17,6 +17,8 @@
 
 namespace memgraph::storage::durability {
 struct ParallelizedSchemaCreationInfo {
+  // Batches of the recovered snapshot (first Gid, count). Empty when an index is created at runtime, the vertices
+  // are then split into ranges by `PopulateIndexDispatch`.
   std::vector<std::pair<Gid, uint64_t>> vertex_recovery_info;
   uint64_t thread_count;
 };
@@ -9,8 +9,11 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <optional>
 
 #include "storage/v2/durability/marker.hpp"
@@ -19,6 +22,7 @@
 #include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
 #include "utils/endian.hpp"
+#include "utils/logging.hpp"
 #include "utils/temporal.hpp"
 
 namespace memgraph::storage::durability {
@@ -62,6 +66,10 @@ void Encoder<FileType>::Close() {
 
 template <typename FileType>
 void Encoder<FileType>::Write(const uint8_t *data, uint64_t size) {
+  if (compression_level_) {
+    block_.insert(block_.end(), data, data + size);
+    return;
+  }
   file_.Write(data, size);
 }
 
@@ -206,8 +214,42 @@ void Encoder<FileType>::WriteExternalPropertyValue(const ExternalPropertyValue &
   }
 }
 
+template <typename FileType>
+void Encoder<FileType>::StartCompressedBlocks(utils::CompressionLevel const level) {
+  MG_ASSERT(block_.empty(), "Compressed blocks already started!");
+  compression_level_ = level;
+}
+
+template <typename FileType>
+void Encoder<FileType>::EndCompressedBlock(bool const force) {
+  if (!compression_level_ || block_.empty()) return;
+  if (!force && block_.size() < kCompressedBlockSize) return;
+
+  auto const level = *compression_level_;
+  compression_level_.reset();
+  auto const compressed = utils::Compressor::GetInstance()->Compress(block_, level);
+  if (compressed && compressed->view().size() < block_.size()) {
+    WriteMarker(Marker::SECTION_COMPRESSED);
+    WriteUint(compressed->original_size());
+    WriteUint(compressed->view().size());
+    Write(compressed->view().data(), compressed->view().size());
+  } else {
+    // Incompressible (or too large) data is written as is
+    Write(block_.data(), block_.size());
+  }
+  block_.clear();
+  compression_level_ = level;
+}
+
+template <typename FileType>
+void Encoder<FileType>::FinishCompressedBlocks() {
+  EndCompressedBlock(true);
+  compression_level_.reset();
+}
+
 template <typename FileType>
 uint64_t Encoder<FileType>::GetPosition() {
+  DMG_ASSERT(block_.empty(), "Position of data inside of a compressed block is unknown!");
   return file_.GetPosition();
 }
 
@@ -223,6 +265,7 @@ void Encoder<FileType>::Sync() {
 
 template <typename FileType>
 void Encoder<FileType>::Finalize() {
+  FinishCompressedBlocks();
   file_.Sync();
   file_.Close();
 }
@@ -242,6 +285,11 @@ void Encoder<FileType>::TryFlushing() requires std::same_as<FileType, utils::Out
   file_.TryFlushing();
 }
 
+template <typename FileType>
+void Encoder<FileType>::FlushBuffer() requires std::same_as<FileType, utils::OutputFile> {
+  file_.FlushBuffer();
+}
+
 template <typename FileType>
 std::pair<const uint8_t *, size_t> Encoder<FileType>::CurrentFileBuffer() const {
   return file_.CurrentBuffer();
@@ -289,8 +337,9 @@ std::optional<uint64_t> ReadSize(Decoder *decoder) {
 }
 }  // namespace
 
-std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, const std::string &magic) {
-  if (!file_.Open(path)) return std::nullopt;
+std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, const std::string &magic,
+                                            bool mapped) {
+  if (!file_.Open(path, mapped)) return std::nullopt;
   std::string file_magic(magic.size(), '\0');
   if (!Read(reinterpret_cast<uint8_t *>(file_magic.data()), file_magic.size())) return std::nullopt;
   if (file_magic != magic) return std::nullopt;
@@ -299,17 +348,66 @@ std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, c
   return utils::LittleEndianToHost(version_encoded);
 }
 
-bool Decoder::Read(uint8_t *data, size_t size) { return file_.Read(data, size); }
+bool Decoder::Read(uint8_t *data, size_t size) {
+  if (auto const remaining = BlockRemaining(); remaining > 0) {
+    auto const from_block = std::min<uint64_t>(remaining, size);
+    std::memcpy(data, block_.view().data() + block_position_, from_block);
+    block_position_ += from_block;
+    data += from_block;
+    size -= from_block;
+    if (size == 0) return true;
+  }
+  return file_.Read(data, size);
+}
 
-bool Decoder::Peek(uint8_t *data, size_t size) { return file_.Peek(data, size); }
+bool Decoder::Peek(uint8_t *data, size_t size) {
+  if (auto const remaining = BlockRemaining(); remaining > 0) {
+    // Blocks end at marker boundaries, so a peek never spans two of them
+    if (remaining < size) return false;
+    std::memcpy(data, block_.view().data() + block_position_, size);
+    return true;
+  }
+  return file_.Peek(data, size);
+}
+
+bool Decoder::LoadCompressedBlock() {
+  if (BlockRemaining() > 0) return true;
+
+  uint8_t value;
+  if (!file_.Peek(&value, sizeof(value)) || value != static_cast<uint8_t>(Marker::SECTION_COMPRESSED)) return true;
+  block_offset_ = file_.GetPosition();
+  if (!file_.Read(&value, sizeof(value))) return false;
+
+  auto read_size = [this]() -> std::optional<uint64_t> {
+    uint8_t marker;
+    if (!file_.Read(&marker, sizeof(marker)) || marker != static_cast<uint8_t>(Marker::TYPE_INT)) return std::nullopt;
+    uint64_t size;
+    if (!file_.Read(reinterpret_cast<uint8_t *>(&size), sizeof(size))) return std::nullopt;
+    return utils::LittleEndianToHost(size);
+  };
+  auto const original_size = read_size();
+  auto const compressed_size = read_size();
+  if (!original_size || !compressed_size || *original_size > std::numeric_limits<uint32_t>::max()) return false;
+
+  std::vector<uint8_t> compressed(*compressed_size);
+  if (!file_.Read(compressed.data(), compressed.size())) return false;
+  auto decompressed =
+      utils::Compressor::GetInstance()->Decompress(compressed, static_cast<uint32_t>(*original_size));
+  if (!decompressed) return false;
+  block_ = std::move(*decompressed);
+  block_position_ = 0;
+  return true;
+}
 
 std::optional<Marker> Decoder::PeekMarker() {
+  if (!LoadCompressedBlock()) return std::nullopt;
   uint8_t value;
   if (!Peek(&value, sizeof(value))) return std::nullopt;
   return CastToMarker(value);
 }
 
 std::optional<Marker> Decoder::ReadMarker() {
+  if (!LoadCompressedBlock()) return std::nullopt;
   uint8_t value;
   if (!Read(&value, sizeof(value))) return std::nullopt;
   return CastToMarker(value);
@@ -555,6 +653,7 @@ std::optional<ExternalPropertyValue> Decoder::ReadExternalPropertyValue() {
     case Marker::SECTION_EDGE_INDICES:
     case Marker::SECTION_OFFSETS:
     case Marker::SECTION_ENUMS:
+    case Marker::SECTION_COMPRESSED:
     case Marker::DELTA_VERTEX_CREATE:
     case Marker::DELTA_VERTEX_DELETE:
     case Marker::DELTA_VERTEX_ADD_LABEL:
@@ -691,6 +790,7 @@ bool Decoder::SkipExternalPropertyValue() {
     case Marker::SECTION_EDGE_INDICES:
     case Marker::SECTION_OFFSETS:
     case Marker::SECTION_ENUMS:
+    case Marker::SECTION_COMPRESSED:
     case Marker::DELTA_VERTEX_CREATE:
     case Marker::DELTA_VERTEX_DELETE:
     case Marker::DELTA_VERTEX_ADD_LABEL:
@@ -739,8 +839,15 @@ bool Decoder::SkipExternalPropertyValue() {
 
 std::optional<uint64_t> Decoder::GetSize() { return file_.GetSize(); }
 
-std::optional<uint64_t> Decoder::GetPosition() { return file_.GetPosition(); }
+std::optional<uint64_t> Decoder::GetPosition() {
+  if (BlockRemaining() > 0) return block_offset_;
+  return file_.GetPosition();
+}
 
-bool Decoder::SetPosition(uint64_t position) { return !!file_.SetPosition(utils::InputFile::Position::SET, position); }
+bool Decoder::SetPosition(uint64_t position) {
+  block_ = utils::DecompressedBuffer{};
+  block_position_ = 0;
+  return !!file_.SetPosition(utils::InputFile::Position::SET, position);
+}
 
 }  // namespace memgraph::storage::durability
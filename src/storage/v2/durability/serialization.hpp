@@ -13,11 +13,14 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/durability/marker.hpp"
 #include "storage/v2/property_value.hpp"
+#include "utils/compressor.hpp"
 #include "utils/file.hpp"
 
 namespace memgraph::storage::durability {
@@ -40,7 +43,19 @@ class BaseEncoder {
   virtual void WriteExternalPropertyValue(const ExternalPropertyValue &value) = 0;
 };
 
+/// Size of the uncompressed data after which a compressed block is written
+/// to the file.
+inline constexpr uint64_t kCompressedBlockSize{1024UL * 1024UL};
+
 /// Encoder that is used to generate a snapshot/WAL.
+///
+/// Data written between `StartCompressedBlocks` and `FinishCompressedBlocks`
+/// is buffered and written as blocks compressed with `utils::Compressor`.
+/// Each block starts with `Marker::SECTION_COMPRESSED` followed by the
+/// uncompressed and the compressed size. The `Decoder` decompresses a block
+/// when it reads a marker at the block start, so blocks can only be ended at
+/// positions where the reader expects a marker (e.g. before each vertex, edge
+/// or WAL delta). Positions can't be taken while a block is being collected.
 template <typename FileType>
 class Encoder final : public BaseEncoder {
  public:
@@ -64,6 +79,11 @@ class Encoder final : public BaseEncoder {
   void WritePoint3d(storage::Point3d value) override;
   void WriteExternalPropertyValue(const ExternalPropertyValue &value) override;
 
+  void StartCompressedBlocks(utils::CompressionLevel level);
+  // Writes the current block if it reached `kCompressedBlockSize` or if `force` is set.
+  void EndCompressedBlock(bool force = false);
+  void FinishCompressedBlocks();
+
   uint64_t GetPosition();
   void SetPosition(uint64_t position);
 
@@ -77,6 +97,8 @@ class Encoder final : public BaseEncoder {
   void EnableFlushing() requires std::same_as<FileType, utils::OutputFile>;
   // Try flushing the internal buffer.
   void TryFlushing() requires std::same_as<FileType, utils::OutputFile>;
+  // Write the internal buffer to the file without syncing it.
+  void FlushBuffer() requires std::same_as<FileType, utils::OutputFile>;
   // Get the current internal buffer with its size.
   std::pair<const uint8_t *, size_t> CurrentFileBuffer() const;
 
@@ -88,6 +110,8 @@ class Encoder final : public BaseEncoder {
 
  private:
   FileType file_;
+  std::optional<utils::CompressionLevel> compression_level_;
+  std::vector<uint8_t> block_;
 };
 
 /// Decoder interface class. Used to implement streams from different sources
@@ -111,10 +135,13 @@ class BaseDecoder {
   virtual bool SkipExternalPropertyValue() = 0;
 };
 
-/// Decoder that is used to read a generated snapshot/WAL.
+/// Decoder that is used to read a generated snapshot/WAL. Compressed blocks
+/// written by the `Encoder` are decompressed transparently.
 class Decoder final : public BaseDecoder {
  public:
-  std::optional<uint64_t> Initialize(const std::filesystem::path &path, const std::string &magic);
+  // A `mapped` file is memory-mapped instead of being read through a buffer.
+  std::optional<uint64_t> Initialize(const std::filesystem::path &path, const std::string &magic,
+                                     bool mapped = false);
 
   // Main read functions, the only one that are allowed to read from the `file_`
   // directly.
@@ -136,11 +163,20 @@ class Decoder final : public BaseDecoder {
   bool SkipExternalPropertyValue() override;
 
   std::optional<uint64_t> GetSize();
+  // Inside of a compressed block this is the position of the block.
   std::optional<uint64_t> GetPosition();
   bool SetPosition(uint64_t position);
 
  private:
+  // Decompresses the block at the current position if there is one and the
+  // previous block was fully read.
+  bool LoadCompressedBlock();
+  uint64_t BlockRemaining() const { return block_.view().size() - block_position_; }
+
   utils::InputFile file_;
+  utils::DecompressedBuffer block_;
+  uint64_t block_position_{0};
+  uint64_t block_offset_{0};
 };
 
 }  // namespace memgraph::storage::durability
@@ -22,8 +22,11 @@
 #include <optional>
 #include <queue>
 #include <ranges>
+#include <set>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <usearch/index_plugins.hpp>
 
 #include "flags/experimental.hpp"
@@ -47,6 +50,7 @@
 #include "storage/v2/inmemory/label_property_index.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/sorted_adjacency.hpp"
 #include "storage/v2/storage.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertex_accessor.hpp"
@@ -142,6 +146,37 @@ namespace memgraph::storage::durability {
 //        * starting offset of the batch
 //        * number of vertices in the batch
 //
+// Incremental snapshots use their own magic string and contain only the
+// objects changed since the previous snapshot of the chain:
+//
+// 1) Magic string and version (same as above)
+//
+// 2) Section offsets:
+//     * offset to the first edge (`0` if properties on edges are disabled)
+//     * offset to the first vertex
+//     * offset to the deleted objects section
+//     * offset to the mapper section
+//     * offset to the metadata section
+//
+// 3) Changed edges and vertices, encoded the same way as in snapshots
+//
+// 4) Deleted objects
+//     * gids of the deleted vertices
+//     * gids of the deleted edges
+//
+// 5) Name to ID mapper data (same as above)
+//
+// 6) Metadata
+//     * storage UUID
+//     * epoch id
+//     * start timestamp of the full snapshot the chain starts with
+//     * start timestamp of the previous snapshot in the chain
+//     * snapshot transaction start timestamp
+//     * durable timestamp
+//     * number of edges
+//     * number of vertices
+//     * number of committed transactions
+//
 // IMPORTANT: When changing snapshot encoding/decoding bump the snapshot/WAL
 // version in `version.hpp`.
 
@@ -640,6 +675,111 @@ void OverwriteSnapshotUUID(std::filesystem::path const &path, utils::UUID const
   snapshot.Sync();
 }
 
+IncrementalSnapshotInfo ReadIncrementalSnapshotInfo(const std::filesystem::path &path) {
+  // Check magic and version.
+  Decoder snapshot;
+  auto version = snapshot.Initialize(path, kIncrementalSnapshotMagic);
+  if (!version) throw RecoveryFailure("Couldn't read incremental snapshot magic and/or version!");
+  if (!IsVersionSupported(*version)) throw RecoveryFailure("Invalid incremental snapshot version!");
+
+  // Prepare return value.
+  IncrementalSnapshotInfo info;
+
+  // Read offsets.
+  {
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_OFFSETS)
+      throw RecoveryFailure("Couldn't read marker for section offsets!");
+
+    auto snapshot_size = snapshot.GetSize();
+    if (!snapshot_size) throw RecoveryFailure("Couldn't read incremental snapshot size!");
+
+    auto read_offset = [&snapshot, snapshot_size] {
+      auto maybe_offset = snapshot.ReadUint();
+      if (!maybe_offset) throw RecoveryFailure("Invalid incremental snapshot format!");
+      auto offset = *maybe_offset;
+      if (offset > *snapshot_size) throw RecoveryFailure("Invalid incremental snapshot format!");
+      return offset;
+    };
+
+    info.offset_edges = read_offset();
+    info.offset_vertices = read_offset();
+    info.offset_deleted = read_offset();
+    info.offset_mapper = read_offset();
+    info.offset_metadata = read_offset();
+  }
+
+  // Read metadata.
+  {
+    if (!snapshot.SetPosition(info.offset_metadata)) throw RecoveryFailure("Couldn't read metadata offset!");
+
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_METADATA)
+      throw RecoveryFailure("Couldn't read marker for section metadata!");
+
+    auto maybe_uuid = snapshot.ReadString();
+    if (!maybe_uuid) throw RecoveryFailure("Couldn't read storage_uuid!");
+    info.uuid = std::move(*maybe_uuid);
+
+    auto maybe_epoch_id = snapshot.ReadString();
+    if (!maybe_epoch_id) throw RecoveryFailure("Couldn't read epoch id!");
+    info.epoch_id = std::move(*maybe_epoch_id);
+
+    auto maybe_base_timestamp = snapshot.ReadUint();
+    if (!maybe_base_timestamp) throw RecoveryFailure("Couldn't read base start timestamp!");
+    info.base_start_timestamp = *maybe_base_timestamp;
+
+    auto maybe_parent_timestamp = snapshot.ReadUint();
+    if (!maybe_parent_timestamp) throw RecoveryFailure("Couldn't read parent start timestamp!");
+    info.parent_start_timestamp = *maybe_parent_timestamp;
+
+    auto maybe_timestamp = snapshot.ReadUint();
+    if (!maybe_timestamp) throw RecoveryFailure("Couldn't read start timestamp!");
+    info.start_timestamp = *maybe_timestamp;
+
+    auto maybe_durable_timestamp = snapshot.ReadUint();
+    if (!maybe_durable_timestamp) throw RecoveryFailure("Couldn't read durable timestamp!");
+    info.durable_timestamp = *maybe_durable_timestamp;
+
+    auto maybe_edges = snapshot.ReadUint();
+    if (!maybe_edges) throw RecoveryFailure("Couldn't read the number of edges!");
+    info.edges_count = *maybe_edges;
+
+    auto maybe_vertices = snapshot.ReadUint();
+    if (!maybe_vertices) throw RecoveryFailure("Couldn't read the number of vertices!");
+    info.vertices_count = *maybe_vertices;
+
+    auto maybe_num_committed_txns = snapshot.ReadUint();
+    if (!maybe_num_committed_txns) throw RecoveryFailure("Couldn't read the number of committed txns!");
+    info.num_committed_txns = *maybe_num_committed_txns;
+  }
+
+  return info;
+}
+
+std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> GetIncrementalSnapshotFiles(
+    const std::filesystem::path &snapshot_directory) {
+  std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> snapshot_files;
+  std::error_code error_code;
+  if (!utils::DirExists(snapshot_directory)) return snapshot_files;
+  for (const auto &item : std::filesystem::directory_iterator(snapshot_directory, error_code)) {
+    if (!item.is_regular_file()) continue;
+    try {
+      snapshot_files.emplace_back(item.path(), ReadIncrementalSnapshotInfo(item.path()));
+    } catch (const RecoveryFailure &) {
+      // Full snapshots and incomplete incremental snapshots.
+      continue;
+    }
+  }
+  if (error_code) {
+    spdlog::error("Couldn't read the incremental snapshots because an error occurred: {}.", error_code.message());
+  }
+  std::sort(snapshot_files.begin(), snapshot_files.end(), [](const auto &lhs, const auto &rhs) {
+    return lhs.second.start_timestamp < rhs.second.start_timestamp;
+  });
+  return snapshot_files;
+}
+
 std::vector<BatchInfo> ReadBatchInfos(Decoder &snapshot) {
   std::vector<BatchInfo> infos;
   const auto infos_size = snapshot.ReadUint();
@@ -667,9 +807,10 @@ template <typename TFunc>
 void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &edges, const uint64_t from_offset,
                       const uint64_t edges_count, const SalientConfig::Items items, TFunc get_property_from_id,
                       NameIdMapper *name_id_mapper,
-                      std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt) {
+                      std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt,
+                      bool const mapped = false) {
   Decoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic);
+  snapshot.Initialize(path, kSnapshotMagic, mapped);
 
   // Recover edges.
   auto edge_acc = edges.access();
@@ -753,13 +894,17 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipList<
                              SharedSchemaTracking *schema_info, const uint64_t from_offset,
                              const uint64_t vertices_count, TLabelFromIdFunc get_label_from_id,
                              TPropertyFromIdFunc get_property_from_id, NameIdMapper *name_id_mapper,
-                             std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt) {
+                             std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt,
+                             bool const mapped = false) {
   Decoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic);
+  snapshot.Initialize(path, kSnapshotMagic, mapped);
   if (!snapshot.SetPosition(from_offset))
     throw RecoveryFailure("Couldn't set offset for reading vertices from a snapshot!");
 
   auto vertex_acc = vertices.access();
+  // The vertices of a batch are sorted by their gids and the batches don't
+  // overlap, so each batch is linked into the list as a single run.
+  auto vertex_builder = vertex_acc.builder();
   uint64_t last_vertex_gid = 0;
   spdlog::info("Recovering {} vertices.", vertices_count);
   std::vector<std::pair<PropertyId, PropertyValue>> read_properties;
@@ -794,8 +939,7 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipList<
       throw RecoveryFailure("Read vertex gid is invalid!");
     }
     last_vertex_gid = *gid;
-    auto [it, inserted] = vertex_acc.insert(Vertex{Gid::FromUint(*gid), nullptr});
-    if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
+    auto it = vertex_builder.append(Vertex{Gid::FromUint(*gid), nullptr});
 
     // Recover labels.
     {
@@ -860,6 +1004,7 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipList<
       snapshot_info->Update(UpdateType::VERTICES);
     }
   }
+  if (!vertex_builder.link()) throw RecoveryFailure("The vertices must be inserted here!");
   spdlog::info("Process of recovering {} vertices is finished.", vertices_count);
 
   return last_vertex_gid;
@@ -878,10 +1023,10 @@ LoadPartialConnectivityResult LoadPartialConnectivity(
     const std::filesystem::path &path, utils::SkipList<Vertex> &vertices, utils::SkipList<Edge> &edges,
     utils::SkipList<EdgeMetadata> &edges_metadata, SharedSchemaTracking *schema_info, const uint64_t from_offset,
     const uint64_t vertices_count, const SalientConfig::Items items, const bool snapshot_has_edges,
-    TEdgeTypeFromIdFunc get_edge_type_from_id,
-    std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt) {
+    TEdgeTypeFromIdFunc get_edge_type_from_id, std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt,
+    bool const mapped = false) {
   Decoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic);
+  snapshot.Initialize(path, kSnapshotMagic, mapped);
   if (!snapshot.SetPosition(from_offset))
     throw RecoveryFailure("Couldn't set snapshot offset position doing loading partial connectivity!");
 
@@ -1002,6 +1147,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(
           snapshot_info->Update(UpdateType::EDGES);
         }
       }
+      SortAdjacencyIfNeeded(vertex.in_edges, vertex.in_edges_sorted);
     }
 
     // Recover out edges.
@@ -1052,6 +1198,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(
           snapshot_info->Update(UpdateType::EDGES);
         }
       }
+      SortAdjacencyIfNeeded(vertex.out_edges, vertex.out_edges_sorted);
     }
     ++vertex_it;
   }
@@ -1375,6 +1522,7 @@ RecoveredSnapshot LoadSnapshotVersion14(Decoder &snapshot, const std::filesystem
                        name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), from_vertex->gid.AsUint());
           vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
         }
+        SortAdjacencyIfNeeded(vertex.in_edges, vertex.in_edges_sorted);
       }
 
       // Recover out edges.
@@ -1416,6 +1564,7 @@ RecoveredSnapshot LoadSnapshotVersion14(Decoder &snapshot, const std::filesystem
             schema_info->RecoverEdge(get_edge_type_from_id(*edge_type), edge_ref, &vertex, &*to_vertex,
                                      items.properties_on_edges);
         }
+        SortAdjacencyIfNeeded(vertex.out_edges, vertex.out_edges_sorted);
         // Increment edge count. We only increment the count here because the
         // information is duplicated in in_edges.
         edge_count->fetch_add(*out_size, std::memory_order_acq_rel);
@@ -7212,10 +7361,11 @@ RecoveredSnapshot LoadCurrentVersionSnapshot(Decoder &snapshot, std::filesystem:
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
           [path, vertices, schema_info, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid,
-           &snapshot_info, name_id_mapper](const size_t batch_index, const BatchInfo &batch) {
+           &snapshot_info, name_id_mapper, mapped = config.durability.recovery_memory_mapped](
+              const size_t batch_index, const BatchInfo &batch) {
             const auto last_vertex_gid_in_batch =
                 LoadPartialVertices(path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id,
-                                    get_property_from_id, name_id_mapper, snapshot_info);
+                                    get_property_from_id, name_id_mapper, snapshot_info, mapped);
             if (batch_index == vertex_batches.size() - 1) {
               last_vertex_gid = last_vertex_gid_in_batch;
             }
@@ -7241,10 +7391,10 @@ RecoveredSnapshot LoadCurrentVersionSnapshot(Decoder &snapshot, std::filesystem:
       {
         RecoverOnMultipleThreads(
             config.durability.recovery_thread_count,
-            [path, edges, items = config.salient.items, &get_property_from_id, &snapshot_info, name_id_mapper](
-                const size_t /*batch_index*/, const BatchInfo &batch) {
+            [path, edges, items = config.salient.items, &get_property_from_id, &snapshot_info, name_id_mapper,
+             mapped = config.durability.recovery_memory_mapped](const size_t /*batch_index*/, const BatchInfo &batch) {
               LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id, name_id_mapper,
-                               snapshot_info);
+                               snapshot_info, mapped);
             },
             edge_batches);
       }
@@ -7263,11 +7413,11 @@ RecoveredSnapshot LoadCurrentVersionSnapshot(Decoder &snapshot, std::filesystem:
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
           [path, vertices, edges, edges_metadata, schema_info, edge_count, items = config.salient.items,
-           snapshot_has_edges, &get_edge_type_from_id, &highest_edge_gid, &recovery_info,
-           &snapshot_info](const size_t batch_index, const BatchInfo &batch) {
-            const auto result =
-                LoadPartialConnectivity(path, *vertices, *edges, *edges_metadata, schema_info, batch.offset,
-                                        batch.count, items, snapshot_has_edges, get_edge_type_from_id, snapshot_info);
+           snapshot_has_edges, &get_edge_type_from_id, &highest_edge_gid, &recovery_info, &snapshot_info,
+           mapped = config.durability.recovery_memory_mapped](const size_t batch_index, const BatchInfo &batch) {
+            const auto result = LoadPartialConnectivity(path, *vertices, *edges, *edges_metadata, schema_info,
+                                                        batch.offset, batch.count, items, snapshot_has_edges,
+                                                        get_edge_type_from_id, snapshot_info, mapped);
             edge_count->fetch_add(result.edge_count);
             atomic_fetch_max_explicit(&highest_edge_gid, result.highest_edge_id, std::memory_order_acq_rel);
             recovery_info.vertex_batches[batch_index].first = result.first_vertex_gid;
@@ -7777,7 +7927,9 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       return LoadSnapshotVersion29(snapshot, path, vertices, edges, edges_metadata, epoch_history, name_id_mapper,
                                    edge_count, config, enum_store, schema_info, snapshot_info);
     }
-    case 30U: {
+    case 30U:
+    case 31U: {
+      // Version 31 can contain compressed blocks which are handled by the Decoder
       return LoadCurrentVersionSnapshot(snapshot, path, vertices, edges, edges_metadata, epoch_history, name_id_mapper,
                                         edge_count, config, enum_store, schema_info, snapshot_info);
     }
@@ -7790,6 +7942,285 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   }
 }
 
+namespace {
+
+// Properties of an object as read from an incremental snapshot.
+using RecoveredProperties = std::vector<std::pair<PropertyId, PropertyValue>>;
+
+struct IncrementalEdge {
+  Gid gid;
+  RecoveredProperties properties;
+};
+
+struct IncrementalConnectivity {
+  Gid edge;
+  Gid vertex;
+  EdgeTypeId edge_type;
+};
+
+struct IncrementalVertex {
+  Gid gid;
+  std::vector<LabelId> labels;
+  RecoveredProperties properties;
+  std::vector<IncrementalConnectivity> in_edges;
+  std::vector<IncrementalConnectivity> out_edges;
+};
+
+// Applies a single incremental snapshot. The whole file is read before the
+// storage is modified, so a corrupted file leaves the storage untouched.
+void LoadIncrementalSnapshot(std::filesystem::path const &path, IncrementalSnapshotInfo const &info,
+                             utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges,
+                             utils::SkipList<EdgeMetadata> *edges_metadata, NameIdMapper *name_id_mapper,
+                             std::atomic<uint64_t> *edge_count, SalientConfig::Items const items,
+                             RecoveryInfo *recovery_info) {
+  Decoder snapshot;
+  if (!snapshot.Initialize(path, kIncrementalSnapshotMagic))
+    throw RecoveryFailure("Couldn't read incremental snapshot magic and/or version!");
+
+  // Recover mapper.
+  std::unordered_map<uint64_t, uint64_t> snapshot_id_map;
+  {
+    if (!snapshot.SetPosition(info.offset_mapper)) throw RecoveryFailure("Couldn't read data from snapshot!");
+
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_MAPPER) throw RecoveryFailure("Failed to read section mapper!");
+
+    auto size = snapshot.ReadUint();
+    if (!size) throw RecoveryFailure("Failed to read name-id mapper size!");
+
+    for (uint64_t i = 0; i < *size; ++i) {
+      auto id = snapshot.ReadUint();
+      if (!id) throw RecoveryFailure("Failed to read id for name-id mapper!");
+      auto name = snapshot.ReadString();
+      if (!name) throw RecoveryFailure("Failed to read name for name-id mapper!");
+      snapshot_id_map.emplace(*id, name_id_mapper->NameToId(*name));
+    }
+  }
+
+  auto get_id = [&snapshot_id_map](uint64_t snapshot_id) {
+    auto it = snapshot_id_map.find(snapshot_id);
+    if (it == snapshot_id_map.end()) throw RecoveryFailure("Couldn't find id in snapshot_id_map!");
+    return it->second;
+  };
+  auto read_uint = [&snapshot](std::string_view what) {
+    auto value = snapshot.ReadUint();
+    if (!value) throw RecoveryFailure("Couldn't read {} from the incremental snapshot!", what);
+    return *value;
+  };
+  auto read_properties = [&]() {
+    RecoveredProperties properties;
+    auto const size = read_uint("the number of properties");
+    properties.reserve(size);
+    for (uint64_t i = 0; i < size; ++i) {
+      auto const key = read_uint("property id");
+      auto value = snapshot.ReadExternalPropertyValue();
+      if (!value) throw RecoveryFailure("Couldn't read property value from the incremental snapshot!");
+      properties.emplace_back(PropertyId::FromUint(get_id(key)), ToPropertyValue(*value, name_id_mapper));
+    }
+    return properties;
+  };
+  auto read_connectivity = [&]() {
+    std::vector<IncrementalConnectivity> connectivity;
+    auto const size = read_uint("the number of edges");
+    connectivity.reserve(size);
+    for (uint64_t i = 0; i < size; ++i) {
+      auto const edge_gid = read_uint("edge gid");
+      auto const vertex_gid = read_uint("vertex gid");
+      auto const edge_type = read_uint("edge type");
+      connectivity.push_back(
+          {Gid::FromUint(edge_gid), Gid::FromUint(vertex_gid), EdgeTypeId::FromUint(get_id(edge_type))});
+    }
+    return connectivity;
+  };
+
+  // Read edges.
+  std::vector<IncrementalEdge> changed_edges;
+  if (info.offset_edges != 0) {
+    if (!snapshot.SetPosition(info.offset_edges)) throw RecoveryFailure("Couldn't read data from snapshot!");
+    changed_edges.reserve(info.edges_count);
+    for (uint64_t i = 0; i < info.edges_count; ++i) {
+      auto marker = snapshot.ReadMarker();
+      if (!marker || *marker != Marker::SECTION_EDGE) throw RecoveryFailure("Couldn't read section edge marker!");
+      auto const gid = Gid::FromUint(read_uint("edge gid"));
+      changed_edges.push_back({gid, read_properties()});
+    }
+  }
+
+  // Read vertices.
+  std::vector<IncrementalVertex> changed_vertices;
+  {
+    if (!snapshot.SetPosition(info.offset_vertices)) throw RecoveryFailure("Couldn't read data from snapshot!");
+    changed_vertices.reserve(info.vertices_count);
+    for (uint64_t i = 0; i < info.vertices_count; ++i) {
+      auto marker = snapshot.ReadMarker();
+      if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Couldn't read section vertex marker!");
+      auto &vertex = changed_vertices.emplace_back();
+      vertex.gid = Gid::FromUint(read_uint("vertex gid"));
+      auto const labels_size = read_uint("the number of labels");
+      vertex.labels.reserve(labels_size);
+      for (uint64_t j = 0; j < labels_size; ++j) {
+        vertex.labels.push_back(LabelId::FromUint(get_id(read_uint("label"))));
+      }
+      vertex.properties = read_properties();
+      vertex.in_edges = read_connectivity();
+      vertex.out_edges = read_connectivity();
+    }
+  }
+
+  // Read deleted objects.
+  std::vector<Gid> deleted_vertices;
+  std::vector<Gid> deleted_edges;
+  {
+    if (!snapshot.SetPosition(info.offset_deleted)) throw RecoveryFailure("Couldn't read data from snapshot!");
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_DELTA) throw RecoveryFailure("Couldn't read section deleted marker!");
+    auto const vertices_size = read_uint("the number of deleted vertices");
+    for (uint64_t i = 0; i < vertices_size; ++i) deleted_vertices.push_back(Gid::FromUint(read_uint("vertex gid")));
+    auto const edges_size = read_uint("the number of deleted edges");
+    for (uint64_t i = 0; i < edges_size; ++i) deleted_edges.push_back(Gid::FromUint(read_uint("edge gid")));
+  }
+
+  if (!items.properties_on_edges && !changed_edges.empty()) {
+    throw RecoveryFailure(
+        "The snapshot has properties on edges, but the storage is configured without properties on edges!");
+  }
+
+  auto vertex_acc = vertices->access();
+  auto edge_acc = edges->access();
+  auto edge_metadata_acc = edges_metadata->access();
+
+  auto update_next_vertex_id = [recovery_info](Gid gid) {
+    recovery_info->next_vertex_id = std::max(recovery_info->next_vertex_id, gid.AsUint() + 1);
+  };
+  auto update_next_edge_id = [recovery_info](Gid gid) {
+    recovery_info->next_edge_id = std::max(recovery_info->next_edge_id, gid.AsUint() + 1);
+  };
+
+  // Upsert edges and vertices. Only the objects themselves are created here
+  // because the connectivity can point to any of them.
+  for (auto &edge : changed_edges) {
+    auto [it, _] = edge_acc.insert(Edge{edge.gid, nullptr});
+    it->properties.ClearProperties();
+    it->properties.InitProperties(std::move(edge.properties));
+    update_next_edge_id(edge.gid);
+  }
+  for (auto &vertex : changed_vertices) {
+    auto [it, _] = vertex_acc.insert(Vertex{vertex.gid, nullptr});
+    it->labels.clear();
+    it->labels.reserve(vertex.labels.size());
+    for (auto const label : vertex.labels) it->labels.emplace_back(label);
+    it->properties.ClearProperties();
+    it->properties.InitProperties(std::move(vertex.properties));
+    update_next_vertex_id(vertex.gid);
+  }
+
+  // Rebuild the connectivity of the changed vertices.
+  auto find_vertex = [&vertex_acc](Gid gid) {
+    auto it = vertex_acc.find(gid);
+    if (it == vertex_acc.end()) {
+      throw RecoveryFailure("Couldn't find vertex {} of the incremental snapshot!", gid.AsUint());
+    }
+    return &*it;
+  };
+  auto find_edge = [&edge_acc, items](Gid gid) {
+    if (!items.properties_on_edges) return EdgeRef(gid);
+    auto it = edge_acc.find(gid);
+    if (it == edge_acc.end()) {
+      throw RecoveryFailure("Couldn't find edge {} of the incremental snapshot!", gid.AsUint());
+    }
+    return EdgeRef(&*it);
+  };
+  uint64_t added_edges = 0;
+  uint64_t removed_edges = 0;
+  for (auto const &changed : changed_vertices) {
+    auto *vertex = find_vertex(changed.gid);
+    removed_edges += vertex->out_edges.size();
+    vertex->in_edges.clear();
+    vertex->out_edges.clear();
+    vertex->in_edges_sorted = false;
+    vertex->out_edges_sorted = false;
+    vertex->in_edges.reserve(changed.in_edges.size());
+    for (auto const &[edge_gid, from_gid, edge_type] : changed.in_edges) {
+      vertex->in_edges.emplace_back(edge_type, find_vertex(from_gid), find_edge(edge_gid));
+      update_next_edge_id(edge_gid);
+    }
+    SortAdjacencyIfNeeded(vertex->in_edges, vertex->in_edges_sorted);
+    vertex->out_edges.reserve(changed.out_edges.size());
+    for (auto const &[edge_gid, to_gid, edge_type] : changed.out_edges) {
+      vertex->out_edges.emplace_back(edge_type, find_vertex(to_gid), find_edge(edge_gid));
+      if (items.properties_on_edges && items.enable_edges_metadata) {
+        edge_metadata_acc.insert(EdgeMetadata{edge_gid, vertex});
+      }
+      update_next_edge_id(edge_gid);
+    }
+    SortAdjacencyIfNeeded(vertex->out_edges, vertex->out_edges_sorted);
+    added_edges += vertex->out_edges.size();
+  }
+
+  // Remove the deleted objects. Every vertex which was connected to them was
+  // changed as well, so nothing points to them anymore.
+  for (auto const gid : deleted_edges) {
+    if (items.properties_on_edges) edge_acc.remove(gid);
+    if (items.enable_edges_metadata) edge_metadata_acc.remove(gid);
+    update_next_edge_id(gid);
+  }
+  for (auto const gid : deleted_vertices) {
+    if (auto it = vertex_acc.find(gid); it != vertex_acc.end()) {
+      removed_edges += it->out_edges.size();
+      vertex_acc.remove(gid);
+    }
+    update_next_vertex_id(gid);
+  }
+
+  edge_count->fetch_add(added_edges, std::memory_order_acq_rel);
+  edge_count->fetch_sub(removed_edges, std::memory_order_acq_rel);
+  recovery_info->next_timestamp = std::max(recovery_info->next_timestamp, info.start_timestamp + 1);
+  recovery_info->num_committed_txns = info.num_committed_txns;
+}
+
+}  // namespace
+
+std::optional<IncrementalSnapshotInfo> LoadIncrementalSnapshots(
+    std::filesystem::path const &snapshot_directory, SnapshotInfo const &base, utils::SkipList<Vertex> *vertices,
+    utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata, NameIdMapper *name_id_mapper,
+    std::atomic<uint64_t> *edge_count, Config const &config, SharedSchemaTracking *schema_info,
+    RecoveryInfo *recovery_info) {
+  std::optional<IncrementalSnapshotInfo> last_applied;
+  auto parent_start_timestamp = base.start_timestamp;
+  for (auto const &[path, info] : GetIncrementalSnapshotFiles(snapshot_directory)) {
+    if (info.uuid != base.uuid || info.epoch_id != base.epoch_id ||
+        info.base_start_timestamp != base.start_timestamp) {
+      continue;
+    }
+    if (info.parent_start_timestamp != parent_start_timestamp) {
+      spdlog::warn("The incremental snapshot {} doesn't continue the chain of the recovered snapshots!", path);
+      break;
+    }
+    spdlog::info("Applying incremental snapshot {} with {} vertices and {} edges.", path, info.vertices_count,
+                 info.edges_count);
+    LoadIncrementalSnapshot(path, info, vertices, edges, edges_metadata, name_id_mapper, edge_count,
+                            config.salient.items, recovery_info);
+    parent_start_timestamp = info.start_timestamp;
+    last_applied = info;
+  }
+
+  // The schema info can't be updated object by object because the removed
+  // labels and properties aren't known, so it is recomputed.
+  if (last_applied && schema_info) {
+    schema_info->Clear();
+    auto vertex_acc = vertices->access();
+    for (auto &vertex : vertex_acc) {
+      schema_info->RecoverVertex(&vertex);
+    }
+    for (auto &vertex : vertex_acc) {
+      for (auto const &[edge_type, to_vertex, edge_ref] : vertex.out_edges) {
+        schema_info->RecoverEdge(edge_type, edge_ref, &vertex, to_vertex, config.salient.items.properties_on_edges);
+      }
+    }
+  }
+  return last_applied;
+}
+
 using OldSnapshotFiles = std::vector<std::pair<uint64_t, std::filesystem::path>>;
 void EnsureNecessaryWalFilesExist(const std::filesystem::path &wal_directory, const std::string &uuid,
                                   OldSnapshotFiles old_snapshot_files, Transaction *transaction,
@@ -7883,15 +8314,37 @@ auto EnsureRetentionCountSnapshotsExist(const std::filesystem::path &snapshot_di
   return old_snapshot_files;
 }
 
-std::optional<std::filesystem::path> CreateSnapshot(
-    Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
-    const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges,
-    utils::UUID const &uuid, const memgraph::replication::ReplicationEpoch &epoch,
-    const std::deque<std::pair<std::string, uint64_t>> &epoch_history, utils::FileRetainer *file_retainer,
-    std::atomic_bool *abort_snapshot) {
-  utils::Timer timer;
+// Incremental snapshots can't be recovered without the full snapshot their
+// chain starts with, so they are deleted together with it.
+void DeleteObsoleteIncrementalSnapshots(const std::filesystem::path &snapshot_directory,
+                                        utils::FileRetainer *file_retainer) {
+  auto const incremental_snapshots = GetIncrementalSnapshotFiles(snapshot_directory);
+  if (incremental_snapshots.empty()) return;
+
+  std::set<std::pair<std::string, uint64_t>> base_snapshots;
+  std::error_code error_code;
+  for (const auto &item : std::filesystem::directory_iterator(snapshot_directory, error_code)) {
+    if (!item.is_regular_file()) continue;
+    try {
+      auto info = ReadSnapshotInfo(item.path());
+      base_snapshots.emplace(std::move(info.uuid), info.start_timestamp);
+    } catch (const RecoveryFailure &) {
+      continue;
+    }
+  }
+  // Don't delete anything if not all of the full snapshots could be listed.
+  if (error_code) return;
+
+  for (const auto &[path, info] : incremental_snapshots) {
+    if (base_snapshots.contains({info.uuid, info.base_start_timestamp})) continue;
+    spdlog::trace("Deleting incremental snapshot {} because its full snapshot doesn't exist.", path);
+    file_retainer->DeleteFile(path);
+  }
+}
 
-  auto const snapshot_aborted = [abort_snapshot, &timer]() -> bool {
+// Returns a function which checks whether the snapshot creation was aborted.
+auto MakeSnapshotAbortedCheck(std::atomic_bool *abort_snapshot, utils::Timer &timer) {
+  return [abort_snapshot, &timer]() -> bool {
     if (abort_snapshot == nullptr) return false;
     if (timer.Elapsed() >= kCheckIfSnapshotAborted) {
       const bool abort = abort_snapshot->load(std::memory_order_acquire);
@@ -7900,6 +8353,160 @@ std::optional<std::filesystem::path> CreateSnapshot(
     }
     return false;
   };
+}
+
+// Vertices and edges are written in compressed blocks if the compression is enabled.
+template <typename TEncoder>
+void StartCompression(TEncoder &encoder, Config::Durability const &config) {
+  if (config.compression_enabled) encoder.StartCompressedBlocks(config.compression_level);
+}
+
+template <typename TEncoder>
+void WriteMapping(TEncoder &encoder, std::unordered_set<uint64_t> &used_ids, auto mapping) {
+  used_ids.insert(mapping.AsUint());
+  encoder.WriteUint(mapping.AsUint());
+}
+
+// Writes the edge as seen by the transaction. Returns false if the edge isn't
+// visible to it.
+template <typename TEncoder>
+bool EncodeEdge(Edge &edge, Storage *storage, Transaction *transaction, TEncoder &encoder,
+                std::unordered_set<uint64_t> &used_ids) {
+  // The edge visibility check must be done here manually because we don't
+  // allow direct access to the edges through the public API.
+  bool is_visible = true;
+  Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{edge.lock};
+    is_visible = !edge.deleted;
+    delta = edge.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+      case Delta::Action::RECREATE_OBJECT: {
+        is_visible = true;
+        break;
+      }
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT: {
+        is_visible = false;
+        break;
+      }
+    }
+  });
+  if (!is_visible) return false;
+  EdgeRef edge_ref(&edge);
+  // Here we create an edge accessor that we will use to get the
+  // properties of the edge. The accessor is created with an invalid
+  // type and invalid from/to pointers because we don't know them here,
+  // but that isn't an issue because we won't use that part of the API
+  // here.
+  auto ea = EdgeAccessor{edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, storage, transaction};
+
+  // Get edge data.
+  auto maybe_props = ea.Properties(View::OLD);
+  MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+
+  // Store the edge.
+  {
+    encoder.WriteMarker(Marker::SECTION_EDGE);
+    encoder.WriteUint(edge.gid.AsUint());
+    const auto &props = maybe_props.GetValue();
+    encoder.WriteUint(props.size());
+    for (const auto &item : props) {
+      WriteMapping(encoder, used_ids, item.first);
+      encoder.WriteExternalPropertyValue(ToExternalPropertyValue(item.second, storage->name_id_mapper_.get()));
+    }
+  }
+  return true;
+}
+
+// Writes the vertex with its labels, properties and connectivity as seen by
+// the transaction. Returns false if the vertex isn't visible to it.
+template <typename TEncoder>
+bool EncodeVertex(Vertex &vertex, Storage *storage, Transaction *transaction, TEncoder &encoder,
+                  std::unordered_set<uint64_t> &used_ids) {
+  // The visibility check is implemented for vertices so we use it here.
+  auto va = VertexAccessor::Create(&vertex, storage, transaction, View::OLD);
+  if (!va) return false;
+
+  // Get vertex data.
+  // TODO (mferencevic): All of these functions could be written into a
+  // single function so that we traverse the undo deltas only once.
+  auto maybe_labels = va->Labels(View::OLD);
+  MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
+  auto maybe_props = va->Properties(View::OLD);
+  MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+  auto maybe_in_edges = va->InEdges(View::OLD);
+  MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
+  auto maybe_out_edges = va->OutEdges(View::OLD);
+  MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+
+  // Store the vertex.
+  {
+    encoder.WriteMarker(Marker::SECTION_VERTEX);
+    encoder.WriteUint(vertex.gid.AsUint());
+    const auto &labels = maybe_labels.GetValue();
+    encoder.WriteUint(labels.size());
+    for (const auto &item : labels) {
+      WriteMapping(encoder, used_ids, item);
+    }
+    const auto &props = maybe_props.GetValue();
+    encoder.WriteUint(props.size());
+    for (const auto &item : props) {
+      WriteMapping(encoder, used_ids, item.first);
+      encoder.WriteExternalPropertyValue(ToExternalPropertyValue(item.second, storage->name_id_mapper_.get()));
+    }
+    const auto &in_edges = maybe_in_edges.GetValue().edges;
+    const auto &out_edges = maybe_out_edges.GetValue().edges;
+
+    if (storage->config_.salient.items.properties_on_edges) {
+      encoder.WriteUint(in_edges.size());
+      for (const auto &item : in_edges) {
+        encoder.WriteUint(item.GidPropertiesOnEdges().AsUint());
+        encoder.WriteUint(item.FromVertex().Gid().AsUint());
+        WriteMapping(encoder, used_ids, item.EdgeType());
+      }
+      encoder.WriteUint(out_edges.size());
+      for (const auto &item : out_edges) {
+        encoder.WriteUint(item.GidPropertiesOnEdges().AsUint());
+        encoder.WriteUint(item.ToVertex().Gid().AsUint());
+        WriteMapping(encoder, used_ids, item.EdgeType());
+      }
+    } else {
+      encoder.WriteUint(in_edges.size());
+      for (const auto &item : in_edges) {
+        encoder.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
+        encoder.WriteUint(item.FromVertex().Gid().AsUint());
+        WriteMapping(encoder, used_ids, item.EdgeType());
+      }
+      encoder.WriteUint(out_edges.size());
+      for (const auto &item : out_edges) {
+        encoder.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
+        encoder.WriteUint(item.ToVertex().Gid().AsUint());
+        WriteMapping(encoder, used_ids, item.EdgeType());
+      }
+    }
+  }
+  return true;
+}
+
+std::optional<std::filesystem::path> CreateSnapshot(
+    Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
+    const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges,
+    utils::UUID const &uuid, const memgraph::replication::ReplicationEpoch &epoch,
+    const std::deque<std::pair<std::string, uint64_t>> &epoch_history, utils::FileRetainer *file_retainer,
+    std::atomic_bool *abort_snapshot) {
+  utils::Timer timer;
+  auto const snapshot_aborted = MakeSnapshotAbortedCheck(abort_snapshot, timer);
 
   // Ensure that the storage directory exists.
   utils::EnsureDirOrDie(snapshot_directory);
@@ -7957,14 +8564,8 @@ std::optional<std::filesystem::path> CreateSnapshot(
     snapshot.WriteUint(mapping.AsUint());
   };
 
-  // Specify destination for the mapper data (used in multi-threaded)
-  auto write_mapping_to = [](auto &snapshot, auto &used_ids, auto mapping) {
-    used_ids.insert(mapping.AsUint());
-    snapshot.WriteUint(mapping.AsUint());
-  };
-
   // Store edges.
-  auto partial_edge_handler = [&edges, storage, transaction, &snapshot_aborted, &write_mapping_to](
+  auto partial_edge_handler = [&edges, storage, transaction, &snapshot_aborted](
                                   int64_t start_gid, int64_t end_gid, auto &edges_snapshot) -> SnapshotPartialRes {
     if (start_gid >= end_gid) return {};
 
@@ -7972,6 +8573,7 @@ std::optional<std::filesystem::path> CreateSnapshot(
     auto res = SnapshotPartialRes{.snapshot_path = edges_snapshot.GetPath()};
     auto items_in_current_batch{0UL};
     auto batch_start_offset = edges_snapshot.GetPosition();
+    StartCompression(edges_snapshot, storage->config_.durability);
 
     auto acc = edges->access();
     // edge_id_ is monotonically increasing, holds a value which is currently unused
@@ -7993,70 +8595,21 @@ std::optional<std::filesystem::path> CreateSnapshot(
         break;
       }
 
-      // The edge visibility check must be done here manually because we don't
-      // allow direct access to the edges through the public API.
-      bool is_visible = true;
-      Delta *delta = nullptr;
-      {
-        auto guard = std::shared_lock{edge.lock};
-        is_visible = !edge.deleted;
-        delta = edge.delta;
-      }
-      ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
-        switch (delta.action) {
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            break;
-          case Delta::Action::RECREATE_OBJECT: {
-            is_visible = true;
-            break;
-          }
-          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
-          case Delta::Action::DELETE_OBJECT: {
-            is_visible = false;
-            break;
-          }
-        }
-      });
-      if (!is_visible) continue;
-      EdgeRef edge_ref(&edge);
-      // Here we create an edge accessor that we will use to get the
-      // properties of the edge. The accessor is created with an invalid
-      // type and invalid from/to pointers because we don't know them here,
-      // but that isn't an issue because we won't use that part of the API
-      // here.
-      auto ea = EdgeAccessor{edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, storage, transaction};
-
-      // Get edge data.
-      auto maybe_props = ea.Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-
-      // Store the edge.
-      {
-        edges_snapshot.WriteMarker(Marker::SECTION_EDGE);
-        edges_snapshot.WriteUint(edge.gid.AsUint());
-        const auto &props = maybe_props.GetValue();
-        edges_snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping_to(edges_snapshot, res.used_ids, item.first);
-          edges_snapshot.WriteExternalPropertyValue(
-              ToExternalPropertyValue(item.second, storage->name_id_mapper_.get()));
-        }
-      }
+      if (!EncodeEdge(edge, storage, transaction, edges_snapshot, res.used_ids)) continue;
 
       ++res.count;
       ++items_in_current_batch;
       if (items_in_current_batch == storage->config_.durability.items_per_batch) {
+        // Batches are read independently, so each one ends with a block
+        edges_snapshot.EndCompressedBlock(true);
         res.batch_info.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
         batch_start_offset = edges_snapshot.GetPosition();
         items_in_current_batch = 0;
+      } else {
+        edges_snapshot.EndCompressedBlock();
       }
     }
+    edges_snapshot.FinishCompressedBlocks();
     res.snapshot_size = edges_snapshot.GetSize();
 
     if (items_in_current_batch > 0) {
@@ -8068,7 +8621,7 @@ std::optional<std::filesystem::path> CreateSnapshot(
   };
 
   // Store vertices.
-  auto partial_vertex_handler = [&vertices, storage, transaction, &snapshot_aborted, &write_mapping_to](
+  auto partial_vertex_handler = [&vertices, storage, transaction, &snapshot_aborted](
                                     int64_t start_gid, int64_t end_gid, auto &vertex_snapshot) -> SnapshotPartialRes {
     if (start_gid >= end_gid) return {};
 
@@ -8076,6 +8629,7 @@ std::optional<std::filesystem::path> CreateSnapshot(
     auto res = SnapshotPartialRes{.snapshot_path = vertex_snapshot.GetPath()};
     auto items_in_current_batch = 0UL;
     auto batch_start_offset = vertex_snapshot.GetPosition();
+    StartCompression(vertex_snapshot, storage->config_.durability);
 
     auto acc = vertices->access();
 
@@ -8098,78 +8652,21 @@ std::optional<std::filesystem::path> CreateSnapshot(
         break;
       }
 
-      // The visibility check is implemented for vertices so we use it here.
-      auto va = VertexAccessor::Create(&vertex, storage, transaction, View::OLD);
-      if (!va) continue;
-
-      // Get vertex data.
-      // TODO (mferencevic): All of these functions could be written into a
-      // single function so that we traverse the undo deltas only once.
-      auto maybe_labels = va->Labels(View::OLD);
-      MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
-      auto maybe_props = va->Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-      auto maybe_in_edges = va->InEdges(View::OLD);
-      MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
-      auto maybe_out_edges = va->OutEdges(View::OLD);
-      MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
-
-      // Store the vertex.
-      {
-        vertex_snapshot.WriteMarker(Marker::SECTION_VERTEX);
-        vertex_snapshot.WriteUint(vertex.gid.AsUint());
-        const auto &labels = maybe_labels.GetValue();
-        vertex_snapshot.WriteUint(labels.size());
-        for (const auto &item : labels) {
-          write_mapping_to(vertex_snapshot, res.used_ids, item);
-        }
-        const auto &props = maybe_props.GetValue();
-        vertex_snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping_to(vertex_snapshot, res.used_ids, item.first);
-          vertex_snapshot.WriteExternalPropertyValue(
-              ToExternalPropertyValue(item.second, storage->name_id_mapper_.get()));
-        }
-        const auto &in_edges = maybe_in_edges.GetValue().edges;
-        const auto &out_edges = maybe_out_edges.GetValue().edges;
-
-        if (storage->config_.salient.items.properties_on_edges) {
-          vertex_snapshot.WriteUint(in_edges.size());
-          for (const auto &item : in_edges) {
-            vertex_snapshot.WriteUint(item.GidPropertiesOnEdges().AsUint());
-            vertex_snapshot.WriteUint(item.FromVertex().Gid().AsUint());
-            write_mapping_to(vertex_snapshot, res.used_ids, item.EdgeType());
-          }
-          vertex_snapshot.WriteUint(out_edges.size());
-          for (const auto &item : out_edges) {
-            vertex_snapshot.WriteUint(item.GidPropertiesOnEdges().AsUint());
-            vertex_snapshot.WriteUint(item.ToVertex().Gid().AsUint());
-            write_mapping_to(vertex_snapshot, res.used_ids, item.EdgeType());
-          }
-        } else {
-          vertex_snapshot.WriteUint(in_edges.size());
-          for (const auto &item : in_edges) {
-            vertex_snapshot.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
-            vertex_snapshot.WriteUint(item.FromVertex().Gid().AsUint());
-            write_mapping_to(vertex_snapshot, res.used_ids, item.EdgeType());
-          }
-          vertex_snapshot.WriteUint(out_edges.size());
-          for (const auto &item : out_edges) {
-            vertex_snapshot.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
-            vertex_snapshot.WriteUint(item.ToVertex().Gid().AsUint());
-            write_mapping_to(vertex_snapshot, res.used_ids, item.EdgeType());
-          }
-        }
-      }
+      if (!EncodeVertex(vertex, storage, transaction, vertex_snapshot, res.used_ids)) continue;
 
       ++res.count;
       ++items_in_current_batch;
       if (items_in_current_batch == storage->config_.durability.items_per_batch) {
+        // Batches are read independently, so each one ends with a block
+        vertex_snapshot.EndCompressedBlock(true);
         res.batch_info.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
         batch_start_offset = vertex_snapshot.GetPosition();
         items_in_current_batch = 0;
+      } else {
+        vertex_snapshot.EndCompressedBlock();
       }
     }
+    vertex_snapshot.FinishCompressedBlocks();
 
     if (items_in_current_batch > 0) {
       // This needs to be updated
@@ -8588,6 +9085,7 @@ std::optional<std::filesystem::path> CreateSnapshot(
 
   OldSnapshotFiles old_snapshot_files =
       EnsureRetentionCountSnapshotsExist(snapshot_directory, path, uuid_str, file_retainer, storage);
+  DeleteObsoleteIncrementalSnapshots(snapshot_directory, file_retainer);
 
   if (old_snapshot_files.size() == storage->config_.durability.snapshot_retention_count - 1 &&
       utils::DirExists(wal_directory)) {
@@ -8599,4 +9097,142 @@ std::optional<std::filesystem::path> CreateSnapshot(
   return path;
 }
 
+
+std::optional<std::filesystem::path> CreateIncrementalSnapshot(
+    Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
+    utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, IncrementalSnapshotChain const &chain,
+    SnapshotChanges const &changes, utils::UUID const &uuid, const memgraph::replication::ReplicationEpoch &epoch,
+    std::atomic_bool *abort_snapshot) {
+  utils::Timer timer;
+  auto const snapshot_aborted = MakeSnapshotAbortedCheck(abort_snapshot, timer);
+
+  // Ensure that the storage directory exists.
+  utils::EnsureDirOrDie(snapshot_directory);
+
+  // Create snapshot file.
+  auto const durable_timestamp =
+      transaction->last_durable_ts_ ? *transaction->last_durable_ts_ : transaction->start_timestamp;
+  auto path = snapshot_directory / MakeIncrementalSnapshotName(durable_timestamp);
+  spdlog::info("Starting incremental snapshot creation to {} with {} changed vertices and {} changed edges", path,
+               changes.vertices.size(), changes.edges.size());
+  SnapshotEncoder snapshot;
+  snapshot.Initialize(path, kIncrementalSnapshotMagic, kVersion);
+
+  // Write placeholder offsets.
+  uint64_t offset_offsets = 0;
+  uint64_t offset_edges = 0;
+  uint64_t offset_vertices = 0;
+  uint64_t offset_deleted = 0;
+  uint64_t offset_mapper = 0;
+  uint64_t offset_metadata = 0;
+
+  auto write_offsets = [&] {
+    snapshot.WriteUint(offset_edges);
+    snapshot.WriteUint(offset_vertices);
+    snapshot.WriteUint(offset_deleted);
+    snapshot.WriteUint(offset_mapper);
+    snapshot.WriteUint(offset_metadata);
+  };
+
+  {
+    snapshot.WriteMarker(Marker::SECTION_OFFSETS);
+    offset_offsets = snapshot.GetPosition();
+    write_offsets();
+  }
+
+  uint64_t edges_count = 0;
+  uint64_t vertices_count = 0;
+  std::unordered_set<uint64_t> used_ids;
+  std::vector<Gid> deleted_edges;
+  std::vector<Gid> deleted_vertices;
+  auto counter = utils::ResettableCounter{50};  // Counter used to reduce the frequency of checking abort
+
+  // Store edges. The changed objects which aren't visible anymore were deleted.
+  if (storage->config_.salient.items.properties_on_edges) {
+    offset_edges = snapshot.GetPosition();
+    auto acc = edges->access();
+    for (auto const gid : changes.edges) {
+      if (counter() && snapshot_aborted()) [[unlikely]] {
+        return std::nullopt;
+      }
+      auto it = acc.find(gid);
+      if (it != acc.end() && EncodeEdge(*it, storage, transaction, snapshot, used_ids)) {
+        ++edges_count;
+      } else {
+        deleted_edges.push_back(gid);
+      }
+    }
+  }
+
+  // Store vertices.
+  {
+    offset_vertices = snapshot.GetPosition();
+    auto acc = vertices->access();
+    for (auto const gid : changes.vertices) {
+      if (counter() && snapshot_aborted()) [[unlikely]] {
+        return std::nullopt;
+      }
+      auto it = acc.find(gid);
+      if (it != acc.end() && EncodeVertex(*it, storage, transaction, snapshot, used_ids)) {
+        ++vertices_count;
+      } else {
+        deleted_vertices.push_back(gid);
+      }
+    }
+  }
+
+  // Write deleted objects.
+  {
+    offset_deleted = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_DELTA);
+    snapshot.WriteUint(deleted_vertices.size());
+    for (auto const gid : deleted_vertices) snapshot.WriteUint(gid.AsUint());
+    snapshot.WriteUint(deleted_edges.size());
+    for (auto const gid : deleted_edges) snapshot.WriteUint(gid.AsUint());
+  }
+
+  // Write mapper data.
+  {
+    offset_mapper = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_MAPPER);
+    snapshot.WriteUint(used_ids.size());
+    std::vector<uint64_t> sorted_ids(used_ids.begin(), used_ids.end());
+    std::sort(sorted_ids.begin(), sorted_ids.end());
+    for (auto item : sorted_ids) {
+      snapshot.WriteUint(item);
+      snapshot.WriteString(storage->name_id_mapper_->IdToName(item));
+    }
+  }
+
+  // Write metadata.
+  {
+    offset_metadata = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_METADATA);
+    snapshot.WriteString(std::string{uuid});
+    snapshot.WriteString(epoch.id());
+    snapshot.WriteUint(chain.base_start_timestamp);
+    snapshot.WriteUint(chain.parent_start_timestamp);
+    snapshot.WriteUint(transaction->start_timestamp);
+    snapshot.WriteUint(durable_timestamp);
+    snapshot.WriteUint(edges_count);
+    snapshot.WriteUint(vertices_count);
+    snapshot.WriteUint(
+        storage->repl_storage_state_.commit_ts_info_.load(std::memory_order_acquire).num_committed_txns_);
+  }
+
+  // Write true offsets.
+  {
+    snapshot.SetPosition(offset_offsets);
+    write_offsets();
+  }
+
+  if (snapshot_aborted()) {
+    return std::nullopt;
+  }
+
+  snapshot.Finalize();
+  spdlog::info("Incremental snapshot creation successful!");
+  return path;
+}
+
 }  // namespace memgraph::storage::durability
@@ -13,11 +13,15 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "replication/epoch.hpp"
 #include "storage/v2/config.hpp"
 #include "storage/v2/durability/metadata.hpp"
+#include "storage/v2/durability/snapshot_changes.hpp"
 #include "storage/v2/edge.hpp"
 #include "storage/v2/enum_store.hpp"
 #include "storage/v2/indices/indices.hpp"
@@ -62,12 +66,49 @@ struct RecoveredSnapshot {
   RecoveredIndicesAndConstraints indices_constraints;
 };
 
+/// Structure used to hold information about an incremental snapshot.
+struct IncrementalSnapshotInfo {
+  uint64_t offset_edges;
+  uint64_t offset_vertices;
+  uint64_t offset_deleted;
+  uint64_t offset_mapper;
+  uint64_t offset_metadata;
+
+  std::string uuid;
+  std::string epoch_id;
+  uint64_t base_start_timestamp;    // Start timestamp of the full snapshot the chain starts with
+  uint64_t parent_start_timestamp;  // Start timestamp of the previous snapshot in the chain
+  uint64_t start_timestamp;
+  uint64_t durable_timestamp;
+  uint64_t edges_count;
+  uint64_t vertices_count;
+  uint64_t num_committed_txns;
+};
+
+/// The last snapshot of a chain which starts with a full snapshot followed by
+/// incremental snapshots.
+struct IncrementalSnapshotChain {
+  std::string epoch_id;
+  uint64_t base_start_timestamp;
+  uint64_t parent_start_timestamp;
+  uint64_t length{0};  // Number of incremental snapshots in the chain
+};
+
 /// Function used to read information about the snapshot file.
 /// @throw RecoveryFailure
 SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path);
 
 void OverwriteSnapshotUUID(std::filesystem::path const &path, utils::UUID const &uuid);
 
+/// Function used to read information about the incremental snapshot file.
+/// @throw RecoveryFailure
+IncrementalSnapshotInfo ReadIncrementalSnapshotInfo(const std::filesystem::path &path);
+
+/// Returns the valid incremental snapshots in the directory sorted by their
+/// start timestamp.
+std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> GetIncrementalSnapshotFiles(
+    const std::filesystem::path &snapshot_directory);
+
 /// Function used to load the snapshot data into the storage.
 /// @throw RecoveryFailure
 RecoveredSnapshot LoadSnapshot(std::filesystem::path const &path, utils::SkipList<Vertex> *vertices,
@@ -78,6 +119,16 @@ RecoveredSnapshot LoadSnapshot(std::filesystem::path const &path, utils::SkipLis
                                memgraph::storage::SharedSchemaTracking *schema_info,
                                std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt);
 
+/// Function used to apply the incremental snapshots which continue the chain
+/// of the recovered snapshot `base`. Returns the information about the last
+/// applied incremental snapshot.
+/// @throw RecoveryFailure
+std::optional<IncrementalSnapshotInfo> LoadIncrementalSnapshots(
+    std::filesystem::path const &snapshot_directory, SnapshotInfo const &base, utils::SkipList<Vertex> *vertices,
+    utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata, NameIdMapper *name_id_mapper,
+    std::atomic<uint64_t> *edge_count, Config const &config, SharedSchemaTracking *schema_info,
+    RecoveryInfo *recovery_info);
+
 std::optional<std::filesystem::path> CreateSnapshot(
     Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
     const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges,
@@ -85,4 +136,12 @@ std::optional<std::filesystem::path> CreateSnapshot(
     const std::deque<std::pair<std::string, uint64_t>> &epoch_history, utils::FileRetainer *file_retainer,
     std::atomic_bool *abort_snapshot = nullptr);
 
+/// Writes only the vertices and edges in `changes` (or the fact that they
+/// were deleted) as seen by the transaction. The snapshot continues `chain`.
+std::optional<std::filesystem::path> CreateIncrementalSnapshot(
+    Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
+    utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, IncrementalSnapshotChain const &chain,
+    SnapshotChanges const &changes, utils::UUID const &uuid, const memgraph::replication::ReplicationEpoch &epoch,
+    std::atomic_bool *abort_snapshot = nullptr);
+
 }  // namespace memgraph::storage::durability
@@ -0,0 +1,85 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/durability/snapshot_changes.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace memgraph::storage::durability {
+
+namespace {
+void SortUnique(std::vector<Gid> &gids) {
+  std::sort(gids.begin(), gids.end());
+  gids.erase(std::unique(gids.begin(), gids.end()), gids.end());
+}
+}  // namespace
+
+void SnapshotChangeTracker::Arm() {
+  state_.WithLock([](auto &state) { state.armed = true; });
+}
+
+void SnapshotChangeTracker::Disarm() {
+  state_.WithLock([](auto &state) {
+    state.armed = false;
+    state.has_base = false;
+    state.commits.clear();
+  });
+}
+
+void SnapshotChangeTracker::SetBase(uint64_t const start_timestamp) {
+  Trim(start_timestamp);
+  state_.WithLock([](auto &state) { state.has_base = state.armed; });
+}
+
+void SnapshotChangeTracker::Register(uint64_t const commit_timestamp, std::vector<Gid> vertices,
+                                     std::vector<Gid> edges, bool const metadata_changed) {
+  state_.WithLock([&](auto &state) {
+    if (!state.armed) return;
+    state.commits.push_back(Commit{.timestamp = commit_timestamp,
+                                   .vertices = std::move(vertices),
+                                   .edges = std::move(edges),
+                                   .metadata_changed = metadata_changed});
+  });
+}
+
+std::optional<SnapshotChanges> SnapshotChangeTracker::Collect(uint64_t const start_timestamp) const {
+  auto changes = std::optional<SnapshotChanges>{SnapshotChanges{}};
+  state_.WithLock([&](auto const &state) {
+    if (!state.has_base) {
+      changes.reset();
+      return;
+    }
+    for (auto const &commit : state.commits) {
+      // Commits with a later timestamp aren't visible to the snapshot transaction.
+      if (commit.timestamp >= start_timestamp) continue;
+      if (commit.metadata_changed) {
+        changes.reset();
+        return;
+      }
+      changes->vertices.insert(changes->vertices.end(), commit.vertices.begin(), commit.vertices.end());
+      changes->edges.insert(changes->edges.end(), commit.edges.begin(), commit.edges.end());
+    }
+  });
+  if (changes) {
+    SortUnique(changes->vertices);
+    SortUnique(changes->edges);
+  }
+  return changes;
+}
+
+void SnapshotChangeTracker::Trim(uint64_t const start_timestamp) {
+  state_.WithLock([start_timestamp](auto &state) {
+    std::erase_if(state.commits, [start_timestamp](auto const &commit) { return commit.timestamp < start_timestamp; });
+  });
+}
+
+}  // namespace memgraph::storage::durability
@@ -0,0 +1,82 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::storage::durability {
+
+/// Vertices and edges changed by the transactions committed since the
+/// previous snapshot. Both vectors are sorted and without duplicates.
+struct SnapshotChanges {
+  std::vector<Gid> vertices;
+  std::vector<Gid> edges;
+};
+
+/// Collects the vertices and edges changed by the committed transactions so
+/// that an incremental snapshot has to visit only those objects.
+///
+/// Changes are recorded once the tracker is armed, which has to happen before
+/// the transaction of a full snapshot starts. That snapshot becomes the base
+/// of the following incremental snapshots (`SetBase`). Changes made in a way
+/// which isn't visible through the deltas, e.g. in the analytical storage
+/// mode, disarm the tracker and the next snapshot has to be a full one.
+class SnapshotChangeTracker {
+ public:
+  /// Starts recording the changes of committed transactions.
+  void Arm();
+
+  /// Stops recording and forgets all changes.
+  void Disarm();
+
+  /// Marks the full snapshot whose transaction started at `start_timestamp`
+  /// as the base of the following incremental snapshots. Has no effect if the
+  /// tracker was disarmed in the meantime.
+  void SetBase(uint64_t start_timestamp);
+
+  /// Records the changes of a committed transaction. Transactions which
+  /// changed metadata (indices, constraints, enums...) can't be written
+  /// incrementally.
+  void Register(uint64_t commit_timestamp, std::vector<Gid> vertices, std::vector<Gid> edges, bool metadata_changed);
+
+  /// Returns the changes visible to a snapshot transaction which started at
+  /// `start_timestamp`, or nullopt if the snapshot has to be a full one.
+  std::optional<SnapshotChanges> Collect(uint64_t start_timestamp) const;
+
+  /// Forgets the changes written by a snapshot transaction which started at
+  /// `start_timestamp`.
+  void Trim(uint64_t start_timestamp);
+
+ private:
+  struct Commit {
+    uint64_t timestamp;
+    std::vector<Gid> vertices;
+    std::vector<Gid> edges;
+    bool metadata_changed;
+  };
+
+  struct State {
+    bool armed{false};
+    bool has_base{false};
+    std::deque<Commit> commits;
+  };
+
+  mutable utils::Synchronized<State> state_;
+};
+
+}  // namespace memgraph::storage::durability
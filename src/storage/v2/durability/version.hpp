@@ -21,7 +21,7 @@ namespace memgraph::storage::durability {
 // IMPORTANT: Please bump this version for every snapshot and/or WAL format
 // change!!!
 
-constexpr uint64_t kVersion{30};
+constexpr uint64_t kVersion{31};
 
 constexpr uint64_t kOldestSupportedVersion{14};
 constexpr uint64_t kUniqueConstraintVersion{13};
@@ -44,9 +44,11 @@ constexpr uint64_t kVectorIndexWithEdgeTypeProp{27};
 constexpr uint64_t kTxnStart{28};
 constexpr uint64_t kTextIndexWithProperties{29};
 constexpr uint64_t kNumCommittedTxns{30};
+constexpr uint64_t kCompressedBlocks{31};
 
 // Magic values written to the start of a snapshot/WAL file to identify it.
 const std::string kSnapshotMagic{"MGsn"};
+const std::string kIncrementalSnapshotMagic{"MGsi"};
 const std::string kWalMagic{"MGwl"};
 
 static_assert(std::is_same_v<uint8_t, unsigned char>);
@@ -33,6 +33,7 @@
 #include "storage/v2/name_id_mapper.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/schema_info.hpp"
+#include "storage/v2/sorted_adjacency.hpp"
 #include "storage/v2/vertex.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
@@ -246,6 +247,7 @@ constexpr bool IsMarkerImplicitTransactionEndVersion15(Marker marker) {
     case SECTION_EDGE_INDICES:
     case SECTION_OFFSETS:
     case SECTION_ENUMS:
+    case SECTION_COMPRESSED:
     case VALUE_FALSE:
     case VALUE_TRUE:
       throw RecoveryFailure(kInvalidWalErrorMessage);
@@ -567,6 +569,7 @@ auto ReadSkipWalDeltaData(BaseDecoder *decoder, const uint64_t version)
     case Marker::SECTION_EDGE_INDICES:
     case Marker::SECTION_OFFSETS:
     case Marker::SECTION_ENUMS:
+    case Marker::SECTION_COMPRESSED:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       throw RecoveryFailure(kInvalidWalErrorMessage);
@@ -918,11 +921,11 @@ std::optional<RecoveryInfo> LoadWal(
         if (r::contains(from_vertex->out_edges, out_link))
           throw RecoveryFailure("The from vertex already has this edge! Current ldt is: {}",
                                 ret->last_durable_timestamp);
-        from_vertex->out_edges.push_back(out_link);
+        AddAdjacentEdge(from_vertex->out_edges, from_vertex->out_edges_sorted, out_link);
         auto in_link = std::tuple{edge_type_id, &*from_vertex, edge_ref};
         if (r::contains(to_vertex->in_edges, in_link))
           throw RecoveryFailure("The to vertex already has this edge! Current ldt is: {}", ret->last_durable_timestamp);
-        to_vertex->in_edges.push_back(in_link);
+        AddAdjacentEdge(to_vertex->in_edges, to_vertex->in_edges_sorted, in_link);
 
         ret->next_edge_id = std::max(ret->next_edge_id, data.gid.AsUint() + 1);
 
@@ -952,21 +955,15 @@ std::optional<RecoveryInfo> LoadWal(
 
         {
           auto out_link = std::tuple{edge_type_id, &*to_vertex, edge_ref};
-          auto it = r::find(from_vertex->out_edges, out_link);
-          if (it == from_vertex->out_edges.end())
+          if (!RemoveAdjacentEdge(from_vertex->out_edges, from_vertex->out_edges_sorted, out_link))
             throw RecoveryFailure("The from vertex doesn't have this edge! Current ldt is: {}",
                                   ret->last_durable_timestamp);
-          std::swap(*it, from_vertex->out_edges.back());
-          from_vertex->out_edges.pop_back();
         }
         {
           auto in_link = std::tuple{edge_type_id, &*from_vertex, edge_ref};
-          auto it = r::find(to_vertex->in_edges, in_link);
-          if (it == to_vertex->in_edges.end())
+          if (!RemoveAdjacentEdge(to_vertex->in_edges, to_vertex->in_edges_sorted, in_link))
             throw RecoveryFailure("The to vertex doesn't have this edge! Current ldt is: {}",
                                   ret->last_durable_timestamp);
-          std::swap(*it, to_vertex->in_edges.back());
-          to_vertex->in_edges.pop_back();
         }
         if (items.properties_on_edges) {
           if (!edge_acc.remove(data.gid))
@@ -1305,7 +1302,7 @@ std::optional<RecoveryInfo> LoadWal(
 
 WalFile::WalFile(const std::filesystem::path &wal_directory, utils::UUID const &uuid, const std::string_view epoch_id,
                  SalientConfig::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
-                 utils::FileRetainer *file_retainer)
+                 utils::FileRetainer *file_retainer, std::optional<utils::CompressionLevel> compression_level)
     : items_(items),
       name_id_mapper_(name_id_mapper),
       path_(wal_directory / MakeWalName()),
@@ -1313,6 +1310,7 @@ WalFile::WalFile(const std::filesystem::path &wal_directory, utils::UUID const &
       to_timestamp_(0),
       count_(0),
       seq_num_(seq_num),
+      compression_level_(compression_level),
       file_retainer_(file_retainer) {
   // Ensure that the storage directory exists.
   utils::EnsureDirOrDie(wal_directory);
@@ -1389,16 +1387,20 @@ WalFile::~WalFile() {
 void WalFile::AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t timestamp) {
   EncodeDelta(&wal_, name_id_mapper_, items_, delta, vertex, timestamp);
   UpdateStats(timestamp);
+  wal_.EndCompressedBlock();
 }
 
 void WalFile::AppendDelta(const Delta &delta, const Edge &edge, uint64_t timestamp) {
   EncodeDelta(&wal_, name_id_mapper_, delta, edge, timestamp);
   UpdateStats(timestamp);
+  wal_.EndCompressedBlock();
 }
 
 uint64_t WalFile::AppendTransactionStart(uint64_t const timestamp, bool const commit) {
   auto const flag_pos = EncodeTransactionStart(&wal_, timestamp, commit);
   UpdateStats(timestamp);
+  // The commit flag can be updated later, so only the following deltas are compressed
+  if (compression_level_) wal_.StartCompressedBlocks(*compression_level_);
   return flag_pos;
 }
 
@@ -1412,6 +1414,7 @@ void WalFile::UpdateCommitStatus(uint64_t const flag_pos, bool const new_decisio
 void WalFile::AppendTransactionEnd(uint64_t timestamp) {
   EncodeTransactionEnd(&wal_, timestamp);
   UpdateStats(timestamp);
+  wal_.FinishCompressedBlocks();
 }
 
 void WalFile::Sync() { wal_.Sync(); }
@@ -1432,6 +1435,8 @@ void WalFile::EnableFlushing() { wal_.EnableFlushing(); }
 
 void WalFile::TryFlushing() { wal_.TryFlushing(); }
 
+void WalFile::FlushBuffer() { wal_.FlushBuffer(); }
+
 std::pair<const uint8_t *, size_t> WalFile::CurrentFileBuffer() const { return wal_.CurrentFileBuffer(); }
 
 void EncodeEnumAlterAdd(BaseEncoder &encoder, EnumStore const &enum_store, Enum enum_val) {
@@ -13,6 +13,7 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <set>
 #include <string>
 
@@ -32,6 +33,7 @@
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/schema_info.hpp"
 #include "storage/v2/vertex.hpp"
+#include "utils/compressor.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/skip_list.hpp"
 
@@ -463,9 +465,12 @@ std::optional<RecoveryInfo> LoadWal(
 /// WalFile class used to append deltas and operations to the WAL file.
 class WalFile {
  public:
+  // If `compression_level` is set, the deltas of each transaction (except the
+  // transaction start which holds the commit flag) are written in compressed
+  // blocks.
   WalFile(const std::filesystem::path &wal_directory, utils::UUID const &uuid, const std::string_view epoch_id,
           SalientConfig::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
-          utils::FileRetainer *file_retainer);
+          utils::FileRetainer *file_retainer, std::optional<utils::CompressionLevel> compression_level = std::nullopt);
   WalFile(std::filesystem::path current_wal_path, SalientConfig::Items items, NameIdMapper *name_id_mapper,
           uint64_t seq_num, uint64_t from_timestamp, uint64_t to_timestamp, uint64_t count,
           utils::FileRetainer *file_retainer);
@@ -516,6 +521,10 @@ class WalFile {
   void EnableFlushing();
   // Try flushing the internal buffer.
   void TryFlushing();
+  // Write the internal buffer to the file without syncing it.
+  void FlushBuffer();
+  // Get the POSIX file handle of the current WAL file.
+  int native_handle() const { return wal_.native_handle(); }
   // Get the internal buffer with its size.
   std::pair<const uint8_t *, size_t> CurrentFileBuffer() const;
 
@@ -538,6 +547,7 @@ class WalFile {
   uint64_t to_timestamp_;
   uint64_t count_;
   uint64_t seq_num_;
+  std::optional<utils::CompressionLevel> compression_level_;
 
   utils::FileRetainer *file_retainer_;
 };
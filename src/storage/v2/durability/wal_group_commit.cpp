@@ -0,0 +1,93 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/durability/wal_group_commit.hpp"
+
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "utils/logging.hpp"
+#include "utils/thread.hpp"
+
+namespace memgraph::storage::durability {
+
+WalGroupCommit::WalGroupCommit() {
+  flusher_ = std::jthread{[this](std::stop_token stop_token) {
+    utils::ThreadSetName("wal flusher");
+    Run(std::move(stop_token));
+  }};
+}
+
+uint64_t WalGroupCommit::Submit(int const fd) {
+  uint64_t ticket = 0;
+  {
+    auto guard = std::lock_guard{mutex_};
+    fd_ = fd;
+    ticket = ++submitted_;
+  }
+  submitted_cv_.notify_one();
+  return ticket;
+}
+
+void WalGroupCommit::Wait(uint64_t const ticket) {
+  if (ticket == 0) return;
+  auto lock = std::unique_lock{mutex_};
+  synced_cv_.wait(lock, [&] { return synced_ >= ticket; });
+}
+
+void WalGroupCommit::MarkAllSynced() {
+  {
+    auto guard = std::lock_guard{mutex_};
+    fd_ = -1;
+    synced_ = submitted_;
+  }
+  synced_cv_.notify_all();
+}
+
+void WalGroupCommit::Run(std::stop_token stop_token) {
+  while (true) {
+    uint64_t target = 0;
+    {
+      auto lock = std::unique_lock{mutex_};
+      if (!submitted_cv_.wait(lock, stop_token, [this] { return submitted_ > synced_; })) return;
+      target = submitted_;
+    }
+
+    {
+      auto file_guard = std::lock_guard{file_mutex_};
+      int fd = -1;
+      {
+        auto guard = std::lock_guard{mutex_};
+        // The file was synced and closed in the meantime
+        if (synced_ >= target) continue;
+        fd = fd_;
+      }
+      // Transactions which submit while the file is being synced are grouped into the next sync.
+      int ret = 0;
+      do {
+        ret = fdatasync(fd);
+      } while (ret == -1 && errno == EINTR);
+      // Same as in `utils::OutputFile::Sync`, a failed sync can't be retried because it is unknown which writes were
+      // lost.
+      MG_ASSERT(ret == 0, "While trying to sync the WAL file an error occurred: {} ({})", strerror(errno), errno);
+    }
+
+    {
+      auto guard = std::lock_guard{mutex_};
+      synced_ = std::max(synced_, target);
+    }
+    synced_cv_.notify_all();
+  }
+}
+
+}  // namespace memgraph::storage::durability
@@ -0,0 +1,73 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace memgraph::storage::durability {
+
+/// Syncs the WAL file for many committing transactions at once.
+///
+/// A committing transaction writes its records to the WAL file while holding
+/// the engine lock and submits the file, getting a ticket. A single flusher
+/// thread syncs the file once for all the tickets submitted so far and wakes up
+/// all of their waiters together. Committers wait for their tickets after
+/// releasing the engine lock, so new transactions can write to the WAL while
+/// the previous ones are being synced.
+class WalGroupCommit {
+ public:
+  WalGroupCommit();
+  // The flusher is stopped first, since it is declared last.
+  ~WalGroupCommit() = default;
+
+  WalGroupCommit(const WalGroupCommit &) = delete;
+  WalGroupCommit(WalGroupCommit &&) = delete;
+  WalGroupCommit &operator=(const WalGroupCommit &) = delete;
+  WalGroupCommit &operator=(WalGroupCommit &&) = delete;
+
+  /// Requests a sync of the file `fd` whose data was already written to it.
+  /// Returns the ticket to wait for. Submissions have to be serialized by the
+  /// caller (the engine lock).
+  uint64_t Submit(int fd);
+
+  /// Blocks until the data submitted with `ticket` is synced. Ticket 0 is
+  /// always synced.
+  void Wait(uint64_t ticket);
+
+  /// Closes the submitted file with `close`, which has to sync it first. All
+  /// submitted tickets are synced afterwards.
+  template <typename TFunc>
+  void CloseFile(TFunc &&close) {
+    auto file_guard = std::lock_guard{file_mutex_};
+    close();
+    MarkAllSynced();
+  }
+
+ private:
+  void Run(std::stop_token stop_token);
+  void MarkAllSynced();
+
+  // Held while the flusher syncs the file, so that it can't be closed in the meantime
+  std::mutex file_mutex_;
+  std::mutex mutex_;
+  std::condition_variable_any submitted_cv_;
+  std::condition_variable synced_cv_;
+  int fd_{-1};
+  uint64_t submitted_{0};
+  uint64_t synced_{0};
+  std::jthread flusher_;
+};
+
+}  // namespace memgraph::storage::durability
@@ -0,0 +1,123 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/edge_direction.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+
+namespace memgraph::storage {
+
+/// Edges of a vertex as seen by a transaction.
+///
+/// The visible edges are copied out of the vertex as compact (edge type, other
+/// vertex, edge) triples while the vertex is locked, and an `EdgeAccessor` is
+/// created only once the iteration reaches the edge. Expanding a vertex doesn't
+/// allocate an accessor per edge, and consumers which stop early (e.g. because
+/// of a `LIMIT`) don't pay for the edges they never reach.
+class EdgesRange final {
+ public:
+  class Iterator final {
+   public:
+    using value_type = EdgeAccessor;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+
+    EdgeAccessor operator*() const { return range_->At(pos_); }
+
+    Iterator &operator++() {
+      ++pos_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator old = *this;
+      ++pos_;
+      return old;
+    }
+
+    friend bool operator==(const Iterator &lhs, const Iterator &rhs) { return lhs.pos_ == rhs.pos_; }
+
+   private:
+    friend class EdgesRange;
+
+    Iterator(const EdgesRange *range, size_t pos) : range_(range), pos_(pos) {}
+
+    const EdgesRange *range_{nullptr};
+    size_t pos_{0};
+  };
+
+  /// Edges of `vertex` in the given direction.
+  EdgesRange(edge_store edges, EdgeDirection direction, Vertex *vertex, Storage *storage, Transaction *transaction)
+      : edges_(std::move(edges)),
+        vertex_(vertex),
+        storage_(storage),
+        transaction_(transaction),
+        direction_(direction) {}
+
+  /// Edges which were already turned into accessors (on-disk storage).
+  explicit EdgesRange(std::vector<EdgeAccessor> edges) : materialized_(std::move(edges)) {}
+
+  /// The iterators point into the range, so they are invalidated when the range
+  /// is moved.
+  Iterator begin() const { return Iterator{this, 0}; }
+  Iterator end() const { return Iterator{this, size()}; }
+
+  size_t size() const { return materialized_ ? materialized_->size() : edges_.size(); }
+  bool empty() const { return size() == 0; }
+
+  EdgeAccessor At(size_t pos) const {
+    if (materialized_) [[unlikely]] {
+      return (*materialized_)[pos];
+    }
+    const auto &[edge_type, other_vertex, edge] = edges_[pos];
+    if (direction_ == EdgeDirection::OUT) {
+      return EdgeAccessor{edge, edge_type, vertex_, other_vertex, storage_, transaction_};
+    }
+    return EdgeAccessor{edge, edge_type, other_vertex, vertex_, storage_, transaction_};
+  }
+
+  std::vector<EdgeAccessor> ToVector() && {
+    if (materialized_) return std::move(*materialized_);
+    std::vector<EdgeAccessor> ret;
+    ret.reserve(edges_.size());
+    for (size_t pos = 0; pos < edges_.size(); ++pos) {
+      ret.emplace_back(At(pos));
+    }
+    return ret;
+  }
+
+ private:
+  edge_store edges_;
+  std::optional<std::vector<EdgeAccessor>> materialized_;
+  Vertex *vertex_{nullptr};
+  Storage *storage_{nullptr};
+  Transaction *transaction_{nullptr};
+  EdgeDirection direction_{EdgeDirection::OUT};
+};
+
+static_assert(std::forward_iterator<EdgesRange::Iterator>);
+
+struct EdgesVertexAccessorRange {
+  EdgesRange edges;
+  int64_t expanded_count;
+};
+
+}  // namespace memgraph::storage
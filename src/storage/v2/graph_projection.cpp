@@ -0,0 +1,179 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/graph_projection.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/edges_range.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/vertex_info_cache.hpp"
+#include "utils/atomic_utils.hpp"
+#include "utils/memory_tracker.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+// More tasks than threads, so that the threads which finish early take over the remaining work
+constexpr uint64_t kTasksPerThread = 4;
+
+double EdgeWeight(EdgeAccessor const &edge, GraphProjectionFilter const &filter, View view) {
+  auto const value = edge.GetProperty(*filter.weight_property, view);
+  if (value.HasError()) return filter.default_weight;
+  if (value->IsInt()) return static_cast<double>(value->ValueInt());
+  if (value->IsDouble()) return value->ValueDouble();
+  return filter.default_weight;
+}
+
+}  // namespace
+
+std::shared_ptr<GraphProjection> BuildGraphProjection(utils::SkipList<Vertex>::Accessor &vertices,
+                                                      GraphProjectionFilter const &filter, Storage *storage,
+                                                      Transaction *transaction, View view, uint64_t thread_count) {
+  thread_count = std::max(thread_count, uint64_t{1});
+
+  // Collect the projected vertices. As in `PopulateIndexOnRanges`, each range ends before the first vertex of the
+  // next one, so the ranges stay disjoint while vertices are inserted or removed.
+  auto const boundaries = vertices.chunk_boundaries(thread_count * kTasksPerThread);
+  std::vector<Gid> range_ends;
+  range_ends.reserve(boundaries.size());
+  for (auto const &boundary : boundaries) range_ends.push_back(boundary->gid);
+  auto const range_count = boundaries.size() + 1;
+
+  auto const is_projected = [&](VertexAccessor const &vertex) {
+    if (filter.labels.empty()) return true;
+    return std::ranges::any_of(filter.labels, [&](LabelId const label) {
+      auto const has_label = vertex.HasLabel(label, view);
+      return has_label.HasValue() && *has_label;
+    });
+  };
+  std::vector<std::vector<Vertex *>> range_vertices(range_count);
+  utils::ParallelFor(range_count, thread_count, [&](uint64_t const range) {
+    utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+    // The tasks read the transaction at the same time, so they can't share its cache of long delta chains
+    const ThreadVertexInfoCache thread_cache;
+    auto it = range == 0 ? vertices.begin() : boundaries[range - 1];
+    auto const end = range < range_ends.size() ? std::optional{range_ends[range]} : std::nullopt;
+    for (; it != vertices.end() && (!end || it->gid < *end); ++it) {
+      auto vertex = VertexAccessor::Create(&*it, storage, transaction, view);
+      if (vertex && is_projected(*vertex)) range_vertices[range].push_back(&*it);
+    }
+  });
+
+  auto projection = std::make_shared<GraphProjection>();
+  std::vector<Vertex *> projected;
+  for (auto &range : range_vertices) {
+    projected.insert(projected.end(), range.begin(), range.end());
+    range = {};
+  }
+  projection->gids.reserve(projected.size());
+  for (auto const *vertex : projected) projection->gids.push_back(vertex->gid);
+
+  // Collect the out edges of consecutive vertices in chunks and then concatenate the chunks
+  struct Chunk {
+    std::vector<uint64_t> degrees;
+    std::vector<uint64_t> targets;
+    std::vector<double> weights;
+  };
+  auto const &gids = projection->gids;
+  auto const chunk_count = std::min<uint64_t>(projected.size(), thread_count * kTasksPerThread);
+  std::vector<Chunk> chunks(chunk_count);
+  utils::ParallelFor(chunk_count, thread_count, [&](uint64_t const chunk_index) {
+    utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+    const ThreadVertexInfoCache thread_cache;
+    auto &chunk = chunks[chunk_index];
+    auto const first = projected.size() * chunk_index / chunk_count;
+    auto const last = projected.size() * (chunk_index + 1) / chunk_count;
+    chunk.degrees.reserve(last - first);
+    for (auto i = first; i < last; ++i) {
+      auto const vertex = VertexAccessor{projected[i], storage, transaction};
+      auto const edges = vertex.OutEdgesRange(view, filter.edge_types);
+      uint64_t degree = 0;
+      if (edges.HasValue()) {
+        for (auto const &edge : edges->edges) {
+          auto const target = std::ranges::lower_bound(gids, edge.ToVertex().Gid());
+          if (target == gids.end() || *target != edge.ToVertex().Gid()) continue;
+          chunk.targets.push_back(static_cast<uint64_t>(target - gids.begin()));
+          if (filter.weight_property) chunk.weights.push_back(EdgeWeight(edge, filter, view));
+          ++degree;
+        }
+      }
+      chunk.degrees.push_back(degree);
+    }
+  });
+
+  uint64_t edge_count = 0;
+  for (auto const &chunk : chunks) edge_count += chunk.targets.size();
+  projection->offsets.reserve(projected.size() + 1);
+  projection->targets.reserve(edge_count);
+  if (filter.weight_property) projection->weights.reserve(edge_count);
+  for (auto &chunk : chunks) {
+    for (auto const degree : chunk.degrees) projection->offsets.push_back(projection->offsets.back() + degree);
+    projection->targets.insert(projection->targets.end(), chunk.targets.begin(), chunk.targets.end());
+    projection->weights.insert(projection->weights.end(), chunk.weights.begin(), chunk.weights.end());
+    chunk = {};
+  }
+  return projection;
+}
+
+std::shared_ptr<GraphProjection const> GraphProjections::Get(GraphProjectionFilter const &filter,
+                                                             uint64_t const start_timestamp) const {
+  auto const changed = changed_.load(std::memory_order_acquire);
+  if (changed > start_timestamp) return nullptr;
+  return entries_.WithLock([&](auto const &entries) -> std::shared_ptr<GraphProjection const> {
+    auto const it = std::ranges::find_if(entries, [&](auto const &entry) { return entry.filter == filter; });
+    if (it == entries.end() || changed > it->start_timestamp) return nullptr;
+    return it->projection;
+  });
+}
+
+void GraphProjections::Set(GraphProjectionFilter const &filter, uint64_t const start_timestamp,
+                           std::shared_ptr<GraphProjection const> projection) {
+  entries_.WithLock([&](auto &entries) {
+    auto const changed = changed_.load(std::memory_order_acquire);
+    if (changed > start_timestamp) return;
+    std::erase_if(entries, [&](auto const &entry) { return changed > entry.start_timestamp; });
+    auto it = std::ranges::find_if(entries, [&](auto const &entry) { return entry.filter == filter; });
+    if (it != entries.end()) {
+      if (it->start_timestamp > start_timestamp) return;
+      it->start_timestamp = start_timestamp;
+      it->projection = std::move(projection);
+      return;
+    }
+    if (entries.size() >= kMaxProjections) {
+      // Drop the projection built the longest time ago
+      entries.erase(std::ranges::min_element(entries, {}, &Entry::start_timestamp));
+    }
+    entries.push_back(Entry{.filter = filter, .start_timestamp = start_timestamp, .projection = std::move(projection)});
+  });
+}
+
+void GraphProjections::GraphChanged(uint64_t const commit_timestamp) {
+  atomic_fetch_max_explicit(&changed_, commit_timestamp + 1);
+}
+
+void GraphProjections::DropStale() {
+  auto const changed = changed_.load(std::memory_order_acquire);
+  entries_.WithLock([changed](auto &entries) {
+    std::erase_if(entries, [changed](auto const &entry) { return changed > entry.start_timestamp; });
+  });
+}
+
+void GraphProjections::Clear(uint64_t const timestamp) {
+  atomic_fetch_max_explicit(&changed_, timestamp);
+  entries_.WithLock([](auto &entries) { entries.clear(); });
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,110 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/vertex.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::storage {
+
+class Storage;
+struct Transaction;
+
+/// Which part of the graph is projected.
+struct GraphProjectionFilter {
+  // Vertices with any of the labels, all vertices if empty
+  std::vector<LabelId> labels;
+  // Edges of any of the types, all edges if empty
+  std::vector<EdgeTypeId> edge_types;
+  // Numeric edge property used as the weight, the edges aren't weighted if not set
+  std::optional<PropertyId> weight_property;
+  // Weight of the edges without a numeric weight property
+  double default_weight{1.0};
+
+  friend bool operator==(GraphProjectionFilter const &, GraphProjectionFilter const &) = default;
+};
+
+/// Read-only compressed sparse row (CSR) view of the out edges between the
+/// projected vertices, as seen by the transaction which built it.
+///
+/// Vertices are numbered 0..n-1 in the order of their Gids. The out edges of
+/// vertex i are `targets[offsets[i]..offsets[i + 1])`, given as the numbers of
+/// their destination vertices. Edges whose destination isn't projected are
+/// left out.
+struct GraphProjection {
+  std::vector<Gid> gids;
+  std::vector<uint64_t> offsets{0};
+  std::vector<uint64_t> targets;
+  // Weight of each edge in `targets`, empty if the projection isn't weighted
+  std::vector<double> weights;
+};
+
+/// Builds the projection of the vertices visible to `transaction`. The
+/// vertices are scanned and their edges are collected on up to `thread_count`
+/// threads.
+std::shared_ptr<GraphProjection> BuildGraphProjection(utils::SkipList<Vertex>::Accessor &vertices,
+                                                      GraphProjectionFilter const &filter, Storage *storage,
+                                                      Transaction *transaction, View view, uint64_t thread_count);
+
+/// Projections kept for reuse by later transactions.
+///
+/// As with `PropertyColumns`, a projection is built by a transaction which
+/// didn't change anything, so it holds the committed graph visible at the start
+/// timestamp of that transaction. Every commit which changes the graph records
+/// its commit timestamp, and a projection is only given to a transaction if no
+/// such commit happened before the start of either transaction.
+class GraphProjections {
+ public:
+  /// Returns the projection if it is valid for a transaction with `start_timestamp`.
+  std::shared_ptr<GraphProjection const> Get(GraphProjectionFilter const &filter, uint64_t start_timestamp) const;
+
+  /// Stores a projection built by a transaction with `start_timestamp`, unless
+  /// the graph was changed in the meantime.
+  void Set(GraphProjectionFilter const &filter, uint64_t start_timestamp,
+           std::shared_ptr<GraphProjection const> projection);
+
+  /// Records a commit which changed the graph.
+  void GraphChanged(uint64_t commit_timestamp);
+
+  /// Frees the projections which can't be used anymore.
+  void DropStale();
+
+  /// Invalidates all projections for transactions that started before
+  /// `timestamp` and drops them. Used when the data changes without deltas.
+  void Clear(uint64_t timestamp);
+
+ private:
+  // The projections can be large, so only a few of them are kept
+  static constexpr size_t kMaxProjections = 8;
+
+  struct Entry {
+    GraphProjectionFilter filter;
+    uint64_t start_timestamp{0};
+    std::shared_ptr<GraphProjection const> projection;
+  };
+
+  // Commit timestamp + 1 of the last commit which changed the graph, 0 if none
+  std::atomic<uint64_t> changed_{0};
+  mutable utils::Synchronized<std::vector<Entry>, utils::SpinLock> entries_;
+};
+
+}  // namespace memgraph::storage
@@ -27,21 +27,44 @@
 
 namespace memgraph::storage {
 
-void Indices::RemoveObsoleteVertexEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const {
-  static_cast<InMemoryLabelIndex *>(label_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-  static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
-      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-  vector_index_.RemoveObsoleteEntries(token);
-}
-
-void Indices::RemoveObsoleteEdgeEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const {
-  static_cast<InMemoryEdgeTypeIndex *>(edge_type_index_.get())
-      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-  static_cast<InMemoryEdgeTypePropertyIndex *>(edge_type_property_index_.get())
-      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-  static_cast<InMemoryEdgePropertyIndex *>(edge_property_index_.get())
-      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-  vector_edge_index_.RemoveObsoleteEntries(token);
+std::vector<std::function<void()>> Indices::ObsoleteVertexEntriesCleanups(uint64_t oldest_active_start_timestamp,
+                                                                          std::stop_token token) const {
+  return {
+      [this, oldest_active_start_timestamp, token] {
+        static_cast<InMemoryLabelIndex *>(label_index_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      },
+      [this, oldest_active_start_timestamp, token] {
+        static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      },
+      [this, token] { vector_index_.RemoveObsoleteEntries(token); },
+  };
+}
+
+std::vector<std::function<void()>> Indices::ObsoleteEdgeEntriesCleanups(uint64_t oldest_active_start_timestamp,
+                                                                        std::stop_token token) const {
+  return {
+      [this, oldest_active_start_timestamp, token] {
+        static_cast<InMemoryEdgeTypeIndex *>(edge_type_index_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      },
+      [this, oldest_active_start_timestamp, token] {
+        static_cast<InMemoryEdgeTypePropertyIndex *>(edge_type_property_index_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      },
+      [this, oldest_active_start_timestamp, token] {
+        static_cast<InMemoryEdgePropertyIndex *>(edge_property_index_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      },
+      [this, token] { vector_edge_index_.RemoveObsoleteEntries(token); },
+  };
+}
+
+void Indices::RemoveDeletedVertices(std::span<Vertex *const> vertices) const {
+  static_cast<InMemoryLabelIndex *>(label_index_.get())->RemoveDeletedVertices(vertices);
+  static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())->RemoveDeletedVertices(vertices);
+  vector_index_.RemoveDeletedVertices(vertices);
 }
 
 void Indices::DropGraphClearIndices() {
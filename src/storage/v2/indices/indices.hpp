@@ -11,7 +11,10 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <span>
+#include <vector>
 
 #include "storage/v2/indices/active_indices.hpp"
 #include "storage/v2/indices/edge_property_index.hpp"
@@ -36,15 +39,26 @@ struct Indices {
   Indices &operator=(Indices &&) = delete;
   ~Indices() = default;
 
-  /// This function should be called from garbage collection to clean up the
-  /// vertex indices.
+  /// Returns the cleanups of the vertex indices, one per kind of index. They
+  /// should be run from garbage collection and are independent of each other,
+  /// so they can run concurrently.
   /// TODO: unused in disk indices
-  void RemoveObsoleteVertexEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const;
+  std::vector<std::function<void()>> ObsoleteVertexEntriesCleanups(uint64_t oldest_active_start_timestamp,
+                                                                   std::stop_token token) const;
 
-  /// This function should be called from garbage collection to clean up the
-  /// edge indices.
+  /// Returns the cleanups of the edge indices, one per kind of index. They
+  /// should be run from garbage collection and are independent of each other,
+  /// so they can run concurrently.
   /// TODO: unused in disk indices
-  void RemoveObsoleteEdgeEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const;
+  std::vector<std::function<void()>> ObsoleteEdgeEntriesCleanups(uint64_t oldest_active_start_timestamp,
+                                                                 std::stop_token token) const;
+
+  /// This function should be called from garbage collection to remove the
+  /// given deleted vertices from the vertex indices without scanning them. It
+  /// is valid only when the vertices have no entries left with any labels or
+  /// property values other than their current ones.
+  /// TODO: unused in disk indices
+  void RemoveDeletedVertices(std::span<Vertex *const> vertices) const;
 
   void DropGraphClearIndices();
 
@@ -19,11 +19,16 @@
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertex_info_helpers.hpp"
+#include "utils/parallel_for.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <exception>
+#include <optional>
 #include <thread>
+#include <vector>
 
 namespace memgraph::storage {
 
@@ -260,6 +265,36 @@ inline void PopulateIndexOnSingleThread(utils::SkipList<Vertex>::Accessor &verti
   }
 }
 
+/// Populates the index of a live database on multiple threads. There are no
+/// snapshot batches, so the vertices are split into ranges of roughly equal
+/// size. Each range ends before the Gid of the first vertex of the next one,
+/// which keeps the ranges disjoint even when vertices are inserted or removed
+/// concurrently. Any exception of a thread (cancellation, OOM) stops the other
+/// threads and is rethrown.
+template <typename TSkipListAccessorFactory, typename TFunc>
+inline void PopulateIndexOnRanges(utils::SkipList<Vertex>::Accessor &vertices,
+                                  TSkipListAccessorFactory &&accessor_factory, const TFunc &func,
+                                  uint64_t thread_count) {
+  // More ranges than threads, so that the threads which finish early take over the remaining work
+  constexpr uint64_t kRangesPerThread = 4;
+  auto const boundaries = vertices.chunk_boundaries(thread_count * kRangesPerThread);
+  std::vector<Gid> range_ends;
+  range_ends.reserve(boundaries.size());
+  for (auto const &boundary : boundaries) range_ends.push_back(boundary->gid);
+  auto const range_count = boundaries.size() + 1;
+
+  utils::ParallelFor(range_count, thread_count, [&](uint64_t const range_index) {
+    utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+    auto local_func = func;  // local copy incase there is local state
+    auto acc = accessor_factory();
+    auto it = range_index == 0 ? vertices.begin() : boundaries[range_index - 1];
+    auto const end = range_index < range_ends.size() ? std::optional{range_ends[range_index]} : std::nullopt;
+    for (; it != vertices.end() && (!end || it->gid < *end); ++it) {
+      local_func(*it, acc);
+    }
+  });
+}
+
 struct PopulateCancel : std::exception {};
 
 template <typename TSkipListAccessorFactory, typename TFunc>
@@ -277,8 +312,13 @@ inline void PopulateIndexDispatch(utils::SkipList<Vertex>::Accessor &vertices,
       };
 
   if (parallel_exec_info && parallel_exec_info->thread_count > 1) {
-    PopulateIndexOnMultipleThreads(vertices, std::forward<TSkipListAccessorFactory>(accessor_factory),
-                                   checked_insert_function, *parallel_exec_info);
+    if (parallel_exec_info->vertex_recovery_info.empty()) {
+      PopulateIndexOnRanges(vertices, std::forward<TSkipListAccessorFactory>(accessor_factory),
+                            checked_insert_function, parallel_exec_info->thread_count);
+    } else {
+      PopulateIndexOnMultipleThreads(vertices, std::forward<TSkipListAccessorFactory>(accessor_factory),
+                                     checked_insert_function, *parallel_exec_info);
+    }
   } else {
     PopulateIndexOnSingleThread(vertices, std::forward<TSkipListAccessorFactory>(accessor_factory),
                                 checked_insert_function);
@@ -11,6 +11,8 @@
 
 #include "storage/v2/indices/label_index_stats.hpp"
 
+#include <algorithm>
+
 #include <fmt/core.h>
 #include "utils/simple_json.hpp"
 
@@ -25,4 +27,22 @@ bool FromJson(std::string const &json, LabelIndexStats &out) {
   res &= utils::GetJsonValue(json, "avg_degree", out.avg_degree);
   return res;
 }
+
+std::optional<double> AverageDegree(LabelIndexStats const &stats, std::span<EdgeTypeId const> edge_types,
+                                    bool const out_edges, bool const in_edges) {
+  if (stats.edge_type_degrees.empty()) return std::nullopt;
+  auto const degree = [&](LabelEdgeTypeDegree const &entry) {
+    return (out_edges ? entry.avg_out_degree : 0.0) + (in_edges ? entry.avg_in_degree : 0.0);
+  };
+  double total = 0.0;
+  if (edge_types.empty()) {
+    for (auto const &entry : stats.edge_type_degrees) total += degree(entry);
+    return total;
+  }
+  for (auto const edge_type : edge_types) {
+    auto const it = std::ranges::lower_bound(stats.edge_type_degrees, edge_type, {}, &LabelEdgeTypeDegree::edge_type);
+    if (it != stats.edge_type_degrees.end() && it->edge_type == edge_type) total += degree(*it);
+  }
+  return total;
+}
 }  // namespace memgraph::storage
@@ -12,13 +12,30 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
+#include <span>
 #include <string>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
 
 namespace memgraph::storage {
 
+/// Average number of edges of one type per vertex with the label.
+struct LabelEdgeTypeDegree {
+  EdgeTypeId edge_type;
+  double avg_out_degree;
+  double avg_in_degree;
+
+  auto operator<=>(const LabelEdgeTypeDegree &) const = default;
+};
+
 struct LabelIndexStats {
   uint64_t count;
   double avg_degree;
+  // Degrees by edge type, sorted by the edge type. Built by ANALYZE GRAPH and
+  // only kept in memory, so they are empty after recovery and on replicas.
+  std::vector<LabelEdgeTypeDegree> edge_type_degrees{};
 
   auto operator<=>(const LabelIndexStats &) const = default;
 };
@@ -27,4 +44,9 @@ std::string ToJson(const LabelIndexStats &in);
 
 bool FromJson(const std::string &json, LabelIndexStats &out);
 
+/// Average number of out and/or in edges of the given types (of all types if
+/// empty) per vertex, nullopt if the degrees by edge type weren't computed.
+std::optional<double> AverageDegree(const LabelIndexStats &stats, std::span<const EdgeTypeId> edge_types,
+                                    bool out_edges, bool in_edges);
+
 }  // namespace memgraph::storage
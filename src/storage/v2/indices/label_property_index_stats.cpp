@@ -11,11 +11,27 @@
 
 #include "storage/v2/indices/label_property_index_stats.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include <fmt/core.h>
 #include "utils/simple_json.hpp"
 
 namespace memgraph::storage {
 
+namespace {
+
+constexpr uint64_t kMaxHistogramBuckets = 64;
+constexpr uint64_t kMaxMostCommonValues = 16;
+
+std::optional<double> NumericValue(PropertyValue const &value) {
+  if (value.IsInt()) return static_cast<double>(value.ValueInt());
+  if (value.IsDouble()) return value.ValueDouble();
+  return std::nullopt;
+}
+
+}  // namespace
+
 bool FromJson(std::string const &json, LabelPropertyIndexStats &out) {
   bool res = true;
   res &= utils::GetJsonValue(json, "count", out.count);
@@ -32,4 +48,119 @@ std::string ToJson(LabelPropertyIndexStats const &in) {
       in.distinct_values_count, in.statistic, in.avg_group_size, in.avg_degree);
 }
 
+void BuildKeyDistribution(std::map<std::vector<PropertyValue>, int64_t> const &key_counts,
+                          LabelPropertyIndexStats &stats) {
+  stats.histogram.clear();
+  stats.most_common_values.clear();
+  uint64_t total = 0;
+  for (auto const &[key, count] : key_counts) total += count;
+  if (total == 0) return;
+
+  auto const bucket_depth = (total + kMaxHistogramBuckets - 1) / kMaxHistogramBuckets;
+  std::optional<LabelPropertyHistogramBucket> bucket;
+  std::vector<PropertyValue> const *previous_key = nullptr;
+  for (auto const &[key, count] : key_counts) {
+    // A key which fills a bucket by itself gets its own bucket
+    if (bucket && static_cast<uint64_t>(count) >= bucket_depth) {
+      bucket->upper_bound = *previous_key;
+      stats.histogram.push_back(std::move(*bucket));
+      bucket.reset();
+    }
+    previous_key = &key;
+    if (!bucket) {
+      bucket.emplace(
+          LabelPropertyHistogramBucket{.lower_bound = key, .upper_bound = {}, .count = 0, .distinct_values_count = 0});
+    }
+    bucket->count += count;
+    ++bucket->distinct_values_count;
+    if (bucket->count >= bucket_depth) {
+      bucket->upper_bound = key;
+      stats.histogram.push_back(std::move(*bucket));
+      bucket.reset();
+    }
+  }
+  if (bucket) {
+    bucket->upper_bound = std::prev(key_counts.end())->first;
+    stats.histogram.push_back(std::move(*bucket));
+  }
+
+  auto const avg_group_size = static_cast<double>(total) / static_cast<double>(key_counts.size());
+  for (auto const &[key, count] : key_counts) {
+    if (static_cast<double>(count) > avg_group_size) {
+      stats.most_common_values.push_back({.key = key, .count = static_cast<uint64_t>(count)});
+    }
+  }
+  std::ranges::sort(stats.most_common_values, std::greater{}, &LabelPropertyValueCount::count);
+  if (stats.most_common_values.size() > kMaxMostCommonValues) stats.most_common_values.resize(kMaxMostCommonValues);
+}
+
+double EstimateEqualFraction(LabelPropertyIndexStats const &stats, std::vector<PropertyValue> const &key) {
+  if (stats.count == 0) return 0.0;
+  uint64_t common_count = 0;
+  for (auto const &value_count : stats.most_common_values) {
+    if (value_count.key == key) return static_cast<double>(value_count.count) / static_cast<double>(stats.count);
+    common_count += value_count.count;
+  }
+  // The other keys are assumed to be equally common
+  auto const other_keys = stats.distinct_values_count > stats.most_common_values.size()
+                              ? stats.distinct_values_count - stats.most_common_values.size()
+                              : 1;
+  auto const other_count = stats.count > common_count ? stats.count - common_count : 1;
+  return static_cast<double>(other_count) / static_cast<double>(other_keys) / static_cast<double>(stats.count);
+}
+
+std::optional<double> EstimateRangeFraction(LabelPropertyIndexStats const &stats,
+                                            std::optional<utils::Bound<PropertyValue>> const &lower,
+                                            std::optional<utils::Bound<PropertyValue>> const &upper) {
+  if (stats.histogram.empty() || stats.count == 0) return std::nullopt;
+
+  // Values of other types, e.g. strings for a numeric bound, never satisfy the bound
+  auto const above_lower = [&](PropertyValue const &value) {
+    if (!lower) return true;
+    if (!AreComparableTypes(value.type(), lower->value().type())) return false;
+    return lower->IsInclusive() ? value >= lower->value() : value > lower->value();
+  };
+  auto const below_upper = [&](PropertyValue const &value) {
+    if (!upper) return true;
+    if (!AreComparableTypes(value.type(), upper->value().type())) return false;
+    return upper->IsInclusive() ? value <= upper->value() : value < upper->value();
+  };
+  auto const comparable = [&](PropertyValue const &value) {
+    return (!lower || AreComparableTypes(value.type(), lower->value().type())) &&
+           (!upper || AreComparableTypes(value.type(), upper->value().type()));
+  };
+
+  double matching = 0.0;
+  for (auto const &bucket : stats.histogram) {
+    auto const &first = bucket.lower_bound.front();
+    auto const &last = bucket.upper_bound.front();
+    auto const first_in = above_lower(first) && below_upper(first);
+    auto const last_in = above_lower(last) && below_upper(last);
+    if (first_in && last_in) {
+      matching += static_cast<double>(bucket.count);
+      continue;
+    }
+    if (!comparable(first) && !comparable(last)) continue;
+    if ((lower && lower->value() > last) || (upper && upper->value() < first)) continue;
+    if (!first_in && !last_in && bucket.distinct_values_count == 1) continue;
+
+    // The range covers a part of the bucket. For numbers the part is
+    // interpolated, otherwise it is assumed to hold one or half of the keys.
+    auto const first_number = NumericValue(first);
+    auto const last_number = NumericValue(last);
+    auto const from = lower ? NumericValue(lower->value()) : first_number;
+    auto const to = upper ? NumericValue(upper->value()) : last_number;
+    if (first_number && last_number && from && to && *last_number > *first_number) {
+      auto const covered = std::min(*to, *last_number) - std::max(*from, *first_number);
+      matching += static_cast<double>(bucket.count) * std::clamp(covered / (*last_number - *first_number), 0.0, 1.0);
+    } else if (first_in || last_in) {
+      matching += static_cast<double>(bucket.count) / 2.0;
+    } else {
+      auto const distinct = std::max(bucket.distinct_values_count, uint64_t{1});
+      matching += static_cast<double>(bucket.count) / static_cast<double>(distinct);
+    }
+  }
+  return std::min(matching / static_cast<double>(stats.count), 1.0);
+}
+
 }  // namespace memgraph::storage
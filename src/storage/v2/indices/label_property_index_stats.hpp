@@ -12,13 +12,44 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
+#include <optional>
 #include <string>
+#include <vector>
+
+#include "storage/v2/property_value.hpp"
+#include "utils/bound.hpp"
 
 namespace memgraph::storage {
 
+/// Bucket of an equi-depth histogram of the index keys. Each bucket holds
+/// about the same number of vertices, and a key is never split between two
+/// buckets.
+struct LabelPropertyHistogramBucket {
+  // Smallest and largest key in the bucket
+  std::vector<PropertyValue> lower_bound;
+  std::vector<PropertyValue> upper_bound;
+  uint64_t count;
+  uint64_t distinct_values_count;
+
+  auto operator<=>(const LabelPropertyHistogramBucket &) const = default;
+};
+
+struct LabelPropertyValueCount {
+  std::vector<PropertyValue> key;
+  uint64_t count;
+
+  auto operator<=>(const LabelPropertyValueCount &) const = default;
+};
+
 struct LabelPropertyIndexStats {
   uint64_t count, distinct_values_count;
   double statistic, avg_group_size, avg_degree;
+  // Distribution of the keys, built by ANALYZE GRAPH and only kept in memory,
+  // so it is empty after recovery and on replicas.
+  std::vector<LabelPropertyHistogramBucket> histogram{};
+  // Keys which are more common than the average, the most common first
+  std::vector<LabelPropertyValueCount> most_common_values{};
 
   auto operator<=>(const LabelPropertyIndexStats &) const = default;
 };
@@ -27,4 +58,18 @@ std::string ToJson(const LabelPropertyIndexStats &in);
 
 bool FromJson(const std::string &json, LabelPropertyIndexStats &out);
 
+/// Fills the histogram and the most common values of `stats` from the number
+/// of vertices with each key.
+void BuildKeyDistribution(const std::map<std::vector<PropertyValue>, int64_t> &key_counts,
+                          LabelPropertyIndexStats &stats);
+
+/// Estimated fraction of the indexed vertices with the given key.
+double EstimateEqualFraction(const LabelPropertyIndexStats &stats, const std::vector<PropertyValue> &key);
+
+/// Estimated fraction of the indexed vertices whose first property is in the
+/// range, nullopt if there is no histogram.
+std::optional<double> EstimateRangeFraction(const LabelPropertyIndexStats &stats,
+                                            const std::optional<utils::Bound<PropertyValue>> &lower,
+                                            const std::optional<utils::Bound<PropertyValue>> &upper);
+
 }  // namespace memgraph::storage
@@ -310,6 +310,16 @@ void VectorIndex::RemoveObsoleteEntries(std::stop_token token) const {
   }
 }
 
+void VectorIndex::RemoveDeletedVertices(std::span<Vertex *const> vertices) const {
+  for (auto &[_, index_item] : pimpl->index_) {
+    auto &[mg_index, spec] = index_item;
+    auto locked_index = mg_index->MutableSharedLock();
+    for (auto *vertex : vertices) {
+      locked_index->remove(vertex);
+    }
+  }
+}
+
 VectorIndex::IndexStats VectorIndex::Analysis() const {
   IndexStats res{};
   for (const auto &[label_prop, _] : pimpl->index_) {
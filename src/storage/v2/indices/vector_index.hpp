@@ -148,6 +148,10 @@ class VectorIndex {
   /// @param token A stop token to allow for cancellation of the operation.
   void RemoveObsoleteEntries(std::stop_token token) const;
 
+  /// @brief Removes the given deleted vertices from all indexes, without exporting their keys.
+  /// @param vertices The deleted vertices.
+  void RemoveDeletedVertices(std::span<Vertex *const> vertices) const;
+
   /// @brief Returns the index statistics.
   /// @return The index statistics.
   IndexStats Analysis() const;
@@ -160,9 +160,10 @@ bool InMemoryEdgePropertyIndex::RegisterIndex(PropertyId property) {
   });
 }
 
-auto InMemoryEdgePropertyIndex::PopulateIndex(PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
-                                              std::optional<SnapshotObserverInfo> const &snapshot_info,
-                                              Transaction const *tx, CheckCancelFunction cancel_check)
+auto InMemoryEdgePropertyIndex::PopulateIndex(
+    PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+    std::optional<SnapshotObserverInfo> const &snapshot_info, Transaction const *tx, CheckCancelFunction cancel_check,
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info)
     -> utils::BasicResult<IndexPopulateError> {
   auto index = GetIndividualIndex(property);
   if (!index) {
@@ -176,15 +177,13 @@ auto InMemoryEdgePropertyIndex::PopulateIndex(PropertyId property, utils::SkipLi
       auto const insert_function = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgePropertyIndex(from_vertex, property, index_accessor, snapshot_info, *tx);
       };
-      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check),
-                            {} /*TODO: parallel*/);
+      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     } else {
       // If we are not in a transaction, we need to read the object as it is. (post recovery)
       auto const insert_function = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgePropertyIndex(from_vertex, property, index_accessor, snapshot_info);
       };
-      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check),
-                            {} /*TODO: parallel*/);
+      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     }
   } catch (const PopulateCancel &) {
     DropIndex(property);
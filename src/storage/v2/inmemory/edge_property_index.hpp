@@ -17,6 +17,7 @@
 
 #include "storage/v2/common_function_signatures.hpp"
 #include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/edge_property_index.hpp"
 #include "storage/v2/indices/errors.hpp"
@@ -157,7 +158,9 @@ class InMemoryEdgePropertyIndex : public EdgePropertyIndex {
   bool RegisterIndex(PropertyId property);
   auto PopulateIndex(PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
                      std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt,
-                     Transaction const *tx = nullptr, CheckCancelFunction cancel_check = neverCancel)
+                     Transaction const *tx = nullptr, CheckCancelFunction cancel_check = neverCancel,
+                     const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info =
+                         std::nullopt)
       -> utils::BasicResult<IndexPopulateError>;
   bool PublishIndex(PropertyId property, uint64_t commit_timestamp);
 
@@ -91,9 +91,10 @@ bool InMemoryEdgeTypeIndex::CreateIndexOnePass(EdgeTypeId edge_type, utils::Skip
   return PublishIndex(edge_type, 0);
 }
 
-auto InMemoryEdgeTypeIndex::PopulateIndex(EdgeTypeId edge_type, utils::SkipList<Vertex>::Accessor vertices,
-                                          std::optional<SnapshotObserverInfo> const &snapshot_info,
-                                          Transaction const *tx, CheckCancelFunction cancel_check)
+auto InMemoryEdgeTypeIndex::PopulateIndex(
+    EdgeTypeId edge_type, utils::SkipList<Vertex>::Accessor vertices,
+    std::optional<SnapshotObserverInfo> const &snapshot_info, Transaction const *tx, CheckCancelFunction cancel_check,
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info)
     -> utils::BasicResult<IndexPopulateError> {
   auto index = GetIndividualIndex(edge_type);
   if (!index) {
@@ -107,15 +108,13 @@ auto InMemoryEdgeTypeIndex::PopulateIndex(EdgeTypeId edge_type, utils::SkipList<
       auto const insert_function = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgeTypeIndex(from_vertex, edge_type, index_accessor, snapshot_info, *tx);
       };
-      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check),
-                            {} /*TODO: parallel*/);
+      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     } else {
       // If we are not in a transaction, we need to read the object as it is. (post recovery)
       auto const insert_function = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgeTypeIndex(from_vertex, edge_type, index_accessor, snapshot_info);
       };
-      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check),
-                            {} /*TODO: parallel*/);
+      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     }
   } catch (const PopulateCancel &) {
     DropIndex(edge_type);
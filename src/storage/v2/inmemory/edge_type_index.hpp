@@ -16,6 +16,7 @@
 
 #include "storage/v2/common_function_signatures.hpp"
 #include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/edge_type_index.hpp"
@@ -143,7 +144,9 @@ class InMemoryEdgeTypeIndex : public storage::EdgeTypeIndex {
   bool RegisterIndex(EdgeTypeId edge_type);
   auto PopulateIndex(EdgeTypeId insert_function, utils::SkipList<Vertex>::Accessor vertices,
                      std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt,
-                     Transaction const *tx = nullptr, CheckCancelFunction cancel_check = neverCancel)
+                     Transaction const *tx = nullptr, CheckCancelFunction cancel_check = neverCancel,
+                     const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info =
+                         std::nullopt)
       -> utils::BasicResult<IndexPopulateError>;
 
   bool PublishIndex(EdgeTypeId edge_type, uint64_t commit_timestamp);
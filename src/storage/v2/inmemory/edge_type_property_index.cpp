@@ -194,10 +194,10 @@ auto InMemoryEdgeTypePropertyIndex::GetActiveIndices() const -> std::unique_ptr<
   return std::make_unique<ActiveIndices>(index_.WithReadLock(std::identity{}));
 }
 
-auto InMemoryEdgeTypePropertyIndex::PopulateIndex(EdgeTypeId edge_type, PropertyId property,
-                                                  utils::SkipList<Vertex>::Accessor vertices,
-                                                  std::optional<SnapshotObserverInfo> const &snapshot_info,
-                                                  Transaction const *tx, CheckCancelFunction cancel_check)
+auto InMemoryEdgeTypePropertyIndex::PopulateIndex(
+    EdgeTypeId edge_type, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+    std::optional<SnapshotObserverInfo> const &snapshot_info, Transaction const *tx, CheckCancelFunction cancel_check,
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info)
     -> utils::BasicResult<IndexPopulateError> {
   auto index = GetIndividualIndex(edge_type, property);
   if (!index) {
@@ -211,15 +211,13 @@ auto InMemoryEdgeTypePropertyIndex::PopulateIndex(EdgeTypeId edge_type, Property
       auto const insert_function = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgeTypePropertyIndex(from_vertex, edge_type, property, index_accessor, snapshot_info, *tx);
       };
-      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check),
-                            {} /*TODO: parallel*/);
+      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     } else {
       // If we are not in a transaction, we need to read the object as it is. (post recovery)
       auto const insert_function = [&](Vertex &from_vertex, auto &index_accessor) {
         TryInsertEdgeTypePropertyIndex(from_vertex, edge_type, property, index_accessor, snapshot_info);
       };
-      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check),
-                            {} /*TODO: parallel*/);
+      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     }
   } catch (const PopulateCancel &) {
     DropIndex(edge_type, property);
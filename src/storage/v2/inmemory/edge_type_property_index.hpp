@@ -17,6 +17,7 @@
 
 #include "storage/v2/common_function_signatures.hpp"
 #include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/edge_type_property_index.hpp"
@@ -168,7 +169,9 @@ class InMemoryEdgeTypePropertyIndex : public storage::EdgeTypePropertyIndex {
   auto RegisterIndex(EdgeTypeId edge_type, PropertyId property) -> bool;
   auto PopulateIndex(EdgeTypeId edge_type, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
                      std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt,
-                     Transaction const *tx = nullptr, CheckCancelFunction cancel_check = neverCancel)
+                     Transaction const *tx = nullptr, CheckCancelFunction cancel_check = neverCancel,
+                     const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info =
+                         std::nullopt)
       -> utils::BasicResult<IndexPopulateError>;
   bool PublishIndex(EdgeTypeId edge_type, PropertyId property, uint64_t commit_timestamp);
 
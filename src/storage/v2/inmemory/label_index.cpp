@@ -260,6 +260,23 @@ void InMemoryLabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_time
   }
 }
 
+void InMemoryLabelIndex::RemoveDeletedVertices(std::span<Vertex *const> vertices) {
+  auto index_container = all_indices_.WithReadLock(std::identity{});
+
+  for (auto &[index, label] : *index_container) {
+    auto vertices_acc = index->skiplist.access();
+    for (auto *vertex : vertices) {
+      for (auto it = vertices_acc.find_equal_or_greater(Entry{vertex, 0}); it != vertices_acc.end();) {
+        if (it->vertex != vertex) break;
+        auto next_it = it;
+        ++next_it;
+        vertices_acc.remove(*it);
+        it = next_it;
+      }
+    }
+  }
+}
+
 void InMemoryLabelIndex::ActiveIndices::AbortEntries(LabelIndex::AbortableInfo const &info,
                                                      uint64_t exact_start_timestamp) {
   for (auto const &[label, to_remove] : info) {
@@ -316,6 +333,73 @@ void InMemoryLabelIndex::Iterable::Iterator::AdvanceUntilValid() {
   }
 }
 
+InMemoryLabelIndex::ChunkedIterable::ChunkedIterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                                     utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+                                                     LabelId label, View view, Storage *storage,
+                                                     Transaction *transaction, size_t num_chunks)
+    : pin_accessor_(std::move(vertices_accessor)),
+      index_accessor_(std::move(index_accessor)),
+      label_(label),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction) {
+  for (const auto &it : index_accessor_.chunk_boundaries(num_chunks)) {
+    // Multiple boundaries can fall on entries of the same vertex.
+    if (!chunk_starts_.empty() && chunk_starts_.back() == it->vertex) continue;
+    chunk_starts_.push_back(it->vertex);
+  }
+}
+
+InMemoryLabelIndex::ChunkedIterable::Chunk InMemoryLabelIndex::ChunkedIterable::get_chunk(size_t id) {
+  DMG_ASSERT(id < size(), "Chunk id out of range");
+  auto begin =
+      id == 0 ? index_accessor_.begin() : index_accessor_.find_equal_or_greater(Entry{chunk_starts_[id - 1], 0});
+  auto *upper_bound = id < chunk_starts_.size() ? chunk_starts_[id] : nullptr;
+  return {this, begin, upper_bound};
+}
+
+InMemoryLabelIndex::ChunkedIterable::Iterator::Iterator(ChunkedIterable *self,
+                                                        utils::SkipList<Entry>::Iterator index_iterator,
+                                                        Vertex *upper_bound)
+    : self_(self),
+      index_iterator_(index_iterator),
+      upper_bound_(upper_bound),
+      current_vertex_accessor_(nullptr, self_->storage_, nullptr),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+InMemoryLabelIndex::ChunkedIterable::Iterator &InMemoryLabelIndex::ChunkedIterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryLabelIndex::ChunkedIterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (upper_bound_ != nullptr && index_iterator_->vertex >= upper_bound_) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+
+    if (index_iterator_->vertex == current_vertex_) {
+      continue;
+    }
+
+    if (!CanSeeEntityWithTimestamp(index_iterator_->timestamp, self_->transaction_, self_->view_)) {
+      continue;
+    }
+
+    auto accessor = VertexAccessor{index_iterator_->vertex, self_->storage_, self_->transaction_};
+    auto res = accessor.HasLabel(self_->label_, self_->view_);
+    if (!res.HasError() and res.GetValue()) {
+      current_vertex_ = accessor.vertex_;
+      current_vertex_accessor_ = accessor;
+      break;
+    }
+  }
+}
+
 uint64_t InMemoryLabelIndex::ActiveIndices::ApproximateVertexCount(LabelId label) const {
   auto it = index_container_->find(label);
   MG_ASSERT(it != index_container_->end(), "Index for label {} doesn't exist", label.AsUint());
@@ -341,6 +425,19 @@ InMemoryLabelIndex::Iterable InMemoryLabelIndex::ActiveIndices::Vertices(LabelId
   return {it->second->skiplist.access(), std::move(vertices_acc), label, view, storage, transaction};
 }
 
+InMemoryLabelIndex::ChunkedIterable InMemoryLabelIndex::ActiveIndices::ChunkedVertices(LabelId label, View view,
+                                                                                       Storage *storage,
+                                                                                       Transaction *transaction,
+                                                                                       size_t num_chunks) {
+  DMG_ASSERT(storage->storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL ||
+                 storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL,
+             "LabelIndex trying to access InMemory vertices from OnDisk!");
+  auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
+  const auto it = index_container_->find(label);
+  MG_ASSERT(it != index_container_->end(), "Index for label {} doesn't exist", label.AsUint());
+  return {it->second->skiplist.access(), std::move(vertices_acc), label, view, storage, transaction, num_chunks};
+}
+
 InMemoryLabelIndex::Iterable InMemoryLabelIndex::ActiveIndices::Vertices(
     LabelId label, memgraph::utils::SkipList<memgraph::storage::Vertex>::ConstAccessor vertices_acc, View view,
     Storage *storage, Transaction *transaction) {
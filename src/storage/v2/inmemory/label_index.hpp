@@ -65,6 +65,10 @@ class InMemoryLabelIndex : public LabelIndex {
 
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
 
+  /// Removes all entries of the given deleted vertices. Entries are ordered by
+  /// vertex first, so they are found without scanning the indices.
+  void RemoveDeletedVertices(std::span<Vertex *const> vertices);
+
   class Iterable {
    public:
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
@@ -102,6 +106,67 @@ class InMemoryLabelIndex : public LabelIndex {
     Transaction *transaction_;
   };
 
+  /// Splits the index into chunks that can be consumed from different threads
+  /// at the same time. Chunks are delimited by vertex, so all entries of a
+  /// single vertex always end up in the same chunk.
+  class ChunkedIterable {
+   public:
+    ChunkedIterable(utils::SkipList<Entry>::Accessor index_accessor,
+                    utils::SkipList<Vertex>::ConstAccessor vertices_accessor, LabelId label, View view,
+                    Storage *storage, Transaction *transaction, size_t num_chunks);
+
+    class Iterator {
+     public:
+      Iterator(ChunkedIterable *self, utils::SkipList<Entry>::Iterator index_iterator, Vertex *upper_bound);
+
+      VertexAccessor const &operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      ChunkedIterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      // Exclusive; nullptr for the last chunk.
+      Vertex *upper_bound_;
+      VertexAccessor current_vertex_accessor_;
+      Vertex *current_vertex_;
+    };
+
+    class Chunk {
+     public:
+      Chunk(ChunkedIterable *self, utils::SkipList<Entry>::Iterator begin, Vertex *upper_bound)
+          : self_(self), begin_(begin), upper_bound_(upper_bound) {}
+
+      Iterator begin() { return {self_, begin_, upper_bound_}; }
+      Iterator end() { return {self_, self_->index_accessor_.end(), nullptr}; }
+
+     private:
+      ChunkedIterable *self_;
+      utils::SkipList<Entry>::Iterator begin_;
+      Vertex *upper_bound_;
+    };
+
+    size_t size() const { return chunk_starts_.size() + 1; }
+
+    /// Thread-safe; returns the chunk with the given index (0 <= id < size()).
+    Chunk get_chunk(size_t id);
+
+   private:
+    utils::SkipList<Vertex>::ConstAccessor pin_accessor_;
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    LabelId label_;
+    View view_;
+    Storage *storage_;
+    Transaction *transaction_;
+    // First vertex of chunks 1..n, chunk 0 starts at the beginning of the index.
+    std::vector<Vertex *> chunk_starts_;
+  };
+
   struct ActiveIndices : LabelIndex::ActiveIndices {
     ActiveIndices(std::shared_ptr<const IndexContainer> index_container = std::make_shared<IndexContainer>())
         : index_container_{std::move(index_container)} {}
@@ -127,6 +192,9 @@ class InMemoryLabelIndex : public LabelIndex {
     Iterable Vertices(LabelId label, memgraph::utils::SkipList<memgraph::storage::Vertex>::ConstAccessor vertices_acc,
                       View view, Storage *storage, Transaction *transaction);
 
+    ChunkedIterable ChunkedVertices(LabelId label, View view, Storage *storage, Transaction *transaction,
+                                    size_t num_chunks);
+
     auto GetAbortProcessor() const -> AbortProcessor override;
 
    private:
@@ -9,7 +9,10 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
 #include <cstdint>
+#include <functional>
+#include <iterator>
 #include <range/v3/algorithm/find.hpp>
 
 #include "storage/v2/id_types.hpp"
@@ -23,6 +26,8 @@
 #include "utils/counter.hpp"
 #include "utils/fnv.hpp"
 #include "utils/logging.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 
 namespace r = ranges;
 namespace rv = r::views;
@@ -47,6 +52,36 @@ auto PropertyValuesUpdate_ActionMethod(PropertiesPermutationHelper const &helper
       [&](Delta const &delta) { helper.Update(delta.property.key, *delta.property.value, values); });
 }
 
+// Used in place of an index accessor to collect the entries of the index on
+// each populating thread. The entries of all threads are gathered in
+// `collected` once the thread is done.
+template <typename TEntry>
+class EntryCollector {
+ public:
+  explicit EntryCollector(utils::Synchronized<std::vector<TEntry>, utils::SpinLock> *collected)
+      : collected_(collected) {}
+  EntryCollector(const EntryCollector &) = delete;
+  EntryCollector &operator=(const EntryCollector &) = delete;
+  EntryCollector(EntryCollector &&) = delete;
+  EntryCollector &operator=(EntryCollector &&) = delete;
+
+  ~EntryCollector() {
+    collected_->WithLock([&](auto &collected) {
+      if (collected.empty()) {
+        collected = std::move(entries_);
+      } else {
+        std::ranges::move(entries_, std::back_inserter(collected));
+      }
+    });
+  }
+
+  void insert(TEntry &&entry) { entries_.push_back(std::move(entry)); }
+
+ private:
+  utils::Synchronized<std::vector<TEntry>, utils::SpinLock> *collected_;
+  std::vector<TEntry> entries_;
+};
+
 /** Converts a span of `PropertyPaths` into a comma-separated string.
  */
 [[maybe_unused]] // Currently only used in DMG_ASSERT, maybe_unused to get rid of warning
@@ -87,7 +122,7 @@ bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, Prope
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction->manyDeltasCache;
+      auto const &cache = transaction->ManyDeltasCache();
       if (auto resError = HasError(view, cache, &vertex, false); resError) return false;
       auto resLabel = cache.GetHasLabel(view, &vertex, label);
       if (resLabel && *resLabel) {
@@ -127,7 +162,7 @@ bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, Prope
     });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction->manyDeltasCache;
+      auto &cache = transaction->ManyDeltasCache();
       cache.StoreExists(view, &vertex, exists);
       cache.StoreDeleted(view, &vertex, deleted);
       cache.StoreHasLabel(view, &vertex, label, has_label);
@@ -332,10 +367,24 @@ auto InMemoryLabelPropertyIndex::PopulateIndex(
       PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
     } else {
       // If we are not in a transaction, we need to read the object as it is. (post recovery)
+      // Nothing else can change the index during recovery, so the entries are collected and sorted first and then
+      // linked into the index as a single run instead of inserting them one by one.
+      utils::Synchronized<std::vector<Entry>, utils::SpinLock> collected;
+      auto const collector_factory = [&] { return EntryCollector<Entry>{&collected}; };
       auto const insert_function = [&](Vertex &vertex, auto &index_accessor) {
         TryInsertLabelPropertiesIndex(vertex, label, index->permutations_helper, index_accessor, snapshot_info);
       };
-      PopulateIndexDispatch(vertices, accessor_factory, insert_function, std::move(cancel_check), parallel_exec_info);
+      PopulateIndexDispatch(vertices, collector_factory, insert_function, std::move(cancel_check), parallel_exec_info);
+
+      auto entries = std::move(*collected.Lock());
+      std::ranges::sort(entries);
+      auto index_acc = index->skiplist.access();
+      auto builder = index_acc.builder();
+      for (auto &entry : entries) {
+        builder.append(std::move(entry));
+      }
+      auto const linked = builder.link();
+      MG_ASSERT(linked, "The index must be empty while it is being populated.");
     }
   } catch (const PopulateCancel &) {
     DropIndex(label, properties);
@@ -666,6 +715,32 @@ void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_st
   }
 }
 
+void InMemoryLabelPropertyIndex::RemoveDeletedVertices(std::span<Vertex *const> vertices) {
+  auto cpy = all_indices_.WithReadLock(std::identity{});
+
+  for (auto &[index, label_id, property_paths] : *cpy) {
+    auto const &permutationHelper = index->permutations_helper;
+    auto index_acc = index->skiplist.access();
+    for (auto *vertex : vertices) {
+      // The label isn't checked, the entries of a label removed earlier hold the current values as well
+      auto values = std::invoke([&] {
+        auto const guard = std::shared_lock{vertex->lock};
+        return permutationHelper.Extract(vertex->properties);
+      });
+      if (r::all_of(values, [](auto const &each) { return each.IsNull(); })) continue;
+
+      auto const key = Entry{permutationHelper.ApplyPermutation(std::move(values)), vertex, 0};
+      for (auto it = index_acc.find_equal_or_greater(key); it != index_acc.end();) {
+        if (it->vertex != vertex || it->values != key.values) break;
+        auto next_it = it;
+        ++next_it;
+        index_acc.remove(*it);
+        it = next_it;
+      }
+    }
+  }
+}
+
 InMemoryLabelPropertyIndex::Iterable::Iterator::Iterator(Iterable *self,
                                                          utils::SkipList<Entry>::Iterator index_iterator)
     : self_(self),
@@ -211,6 +211,11 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
 
+  /// Removes the entries of the given deleted vertices which hold their
+  /// current property values. It's up to the caller to know that the vertices
+  /// have no entries with any older values left.
+  void RemoveDeletedVertices(std::span<Vertex *const> vertices);
+
   bool DropIndex(LabelId label, std::vector<PropertyPath> const &properties) override;
 
   std::vector<std::pair<LabelId, std::vector<PropertyPath>>> ClearIndexStats();
@@ -47,6 +47,7 @@
 #include "storage/v2/inmemory/unique_constraints.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/schema_info.hpp"
+#include "storage/v2/sorted_adjacency.hpp"
 #include "storage/v2/storage.hpp"
 #include "storage/v2/storage_mode.hpp"
 #include "utils/atomic_memory_block.hpp"
@@ -55,6 +56,7 @@
 #include "utils/exceptions.hpp"
 #include "utils/file.hpp"
 #include "utils/on_scope_exit.hpp"
+#include "utils/parallel_for.hpp"
 #include "utils/resource_lock.hpp"
 #include "utils/scheduler.hpp"
 #include "utils/stat.hpp"
@@ -112,6 +114,26 @@ constexpr auto ActionToStorageOperation(MetadataDelta::Action const action) -> d
 #undef add_case
 }
 
+// More GC tasks than threads, so that the threads which finish early take over the remaining work
+constexpr uint64_t kGcTasksPerThread = 4;
+
+// The deleted vertices are looked up in the vertex indices only while there are at least this many vertices per
+// deleted vertex, a scan of the whole indices is cheaper above that
+constexpr uint64_t kTargetedIndexCleanupRatio = 8;
+
+/// Removes the objects with the given gids from the skip list on up to `thread_count` threads.
+template <typename TObj>
+void RemoveFromSkipList(utils::SkipList<TObj> &skip_list, std::vector<Gid> const &gids, uint64_t thread_count) {
+  auto const task_count = std::min<uint64_t>(gids.size(), thread_count * kGcTasksPerThread);
+  utils::ParallelFor(task_count, thread_count, [&](uint64_t const task) {
+    auto acc = skip_list.access();
+    auto const last = gids.size() * (task + 1) / task_count;
+    for (auto i = gids.size() * task / task_count; i < last; ++i) {
+      MG_ASSERT(acc.remove(gids[i]), "Invalid database state!");
+    }
+  });
+}
+
 auto FindEdges(const View view, EdgeTypeId edge_type, const VertexAccessor *from_vertex, VertexAccessor *to_vertex)
     -> Result<EdgesVertexAccessorResult> {
   auto use_out_edges = [](Vertex const *from_vertex, Vertex const *to_vertex) {
@@ -129,7 +151,8 @@ auto FindEdges(const View view, EdgeTypeId edge_type, const VertexAccessor *from
       guard_from.lock();
     }
 
-    // With the potentially cheaper side FindEdges
+    // With the potentially cheaper side FindEdges, a sorted side is searched without a scan
+    if (from_vertex->out_edges_sorted != to_vertex->in_edges_sorted) return from_vertex->out_edges_sorted;
     const auto out_n = from_vertex->out_edges.size();
     const auto in_n = to_vertex->in_edges.size();
     return out_n <= in_n;
@@ -167,6 +190,18 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
       global_locker_(file_retainer_.AddLocker()) {
   MG_ASSERT(config.salient.storage_mode != StorageMode::ON_DISK_TRANSACTIONAL,
             "Invalid storage mode sent to InMemoryStorage constructor!");
+  if (!config_.columnar_properties.empty()) {
+    std::vector<std::pair<LabelId, PropertyId>> columns;
+    columns.reserve(config_.columnar_properties.size());
+    for (auto const &[label, property] : config_.columnar_properties) {
+      columns.emplace_back(NameToLabel(label), NameToProperty(property));
+    }
+    property_columns_ = PropertyColumns{columns};
+  }
+  if (config_.durability.wal_group_commit &&
+      config_.durability.snapshot_wal_mode == Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL) {
+    wal_group_commit_.emplace();
+  }
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
       config_.durability.snapshot_on_exit || config_.durability.recover_on_startup) {
     // Create the directory initially to crash the database in case of
@@ -304,8 +339,7 @@ InMemoryStorage::~InMemoryStorage() {
     repl_storage_state_.Reset();
   }
   if (wal_file_) {
-    wal_file_->FinalizeWal();
-    wal_file_.reset();
+    CloseWalFile();
   }
   snapshot_runner_.Stop();
   if (config_.durability.snapshot_on_exit && this->create_snapshot_handler) {
@@ -509,10 +543,10 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
   utils::AtomicMemoryBlock(
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex, &schema_acc]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-        from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        AddAdjacentEdge(from_vertex->out_edges, from_vertex->out_edges_sorted, {edge_type, to_vertex, edge});
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-        to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        AddAdjacentEdge(to_vertex->in_edges, to_vertex->in_edges_sorted, {edge_type, from_vertex, edge});
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -625,10 +659,10 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
   utils::AtomicMemoryBlock(
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex, &schema_acc]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-        from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        AddAdjacentEdge(from_vertex->out_edges, from_vertex->out_edges_sorted, {edge_type, to_vertex, edge});
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-        to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        AddAdjacentEdge(to_vertex->in_edges, to_vertex->in_edges_sorted, {edge_type, from_vertex, edge});
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -764,6 +798,9 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
       return StorageManipulationError{*maybe_violation};
     }
 
+    // Declared before the engine guard, so that the WAL group commit is awaited after the engine lock is released
+    auto const wait_for_wal_sync =
+        utils::OnScopeExit{[&] { mem_storage->WaitForWalSync(std::exchange(wal_sync_ticket_, 0)); }};
     auto engine_guard = std::unique_lock{storage_->engine_lock_};
     commit_timestamp_.emplace(mem_storage->GetCommitTimestamp());
 
@@ -842,7 +879,7 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
         // We need to finalize WAL file after running FinalizeCommitPhase because we update there commit value in WAL
         // (commit_flag_wal_position_
         if (mem_storage->wal_file_) {
-          mem_storage->FinalizeWalFile();
+          wal_sync_ticket_ = mem_storage->FinalizeWalFile();
         }
         // Send to all replicas they can finalize a transaction
         replicating_txn.FinalizeTransaction(true, mem_storage->uuid(), std::move(db_acc), durability_commit_timestamp);
@@ -850,7 +887,7 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
         // One of replica didn't vote for committing, you can finalize WAL file freely here because WAL file doesn't
         // need to be updated since by default we write to WAL that the txn should be aborted
         if (mem_storage->wal_file_) {
-          mem_storage->FinalizeWalFile();
+          wal_sync_ticket_ = mem_storage->FinalizeWalFile();
         }
         // Aborting on replica before than on main shouldn't be a problem. Even if MAIN goes down, by default it will
         // not load the current txn. When commiting, the situation is different as explained above.
@@ -888,6 +925,66 @@ void InMemoryStorage::InMemoryAccessor::FinalizeCommitPhase(uint64_t const durab
     mem_storage->wal_file_->UpdateCommitStatus(commit_flag_wal_position_, commit);
   }
 
+  // Remember the changed objects for the next incremental snapshot. This has to be done before the commit because
+  // the deltas of committed transactions can get new deltas in front of them.
+  if (mem_storage->config_.durability.snapshot_incremental_count > 0 &&
+      transaction_.storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    std::vector<Gid> vertices;
+    std::vector<Gid> edges;
+    for (const auto &delta : transaction_.deltas) {
+      auto prev = delta.prev.Get();
+      switch (prev.type) {
+        case PreviousPtr::Type::VERTEX:
+          vertices.push_back(prev.vertex->gid);
+          break;
+        case PreviousPtr::Type::EDGE:
+          edges.push_back(prev.edge->gid);
+          break;
+        case PreviousPtr::Type::DELTA:
+        case PreviousPtr::Type::NULLPTR:
+          break;
+      }
+    }
+    mem_storage->snapshot_changes_.Register(*commit_timestamp_, std::move(vertices), std::move(edges),
+                                            !transaction_.md_deltas.empty());
+  }
+
+  // Invalidate the columns of changed labels and properties before the changes become visible
+  if (!mem_storage->property_columns_.empty() && transaction_.storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    auto &columns = mem_storage->property_columns_;
+    for (const auto &delta : transaction_.deltas) {
+      switch (delta.action) {
+        case Delta::Action::SET_PROPERTY:
+          columns.PropertyChanged(delta.property.key, *commit_timestamp_);
+          break;
+        case Delta::Action::ADD_LABEL:
+        case Delta::Action::REMOVE_LABEL:
+          columns.LabelChanged(delta.label.value, *commit_timestamp_);
+          break;
+        case Delta::Action::RECREATE_OBJECT: {
+          // Deletion is the last change of an object, so the delta is the head of the vertex's chain
+          auto prev = delta.prev.Get();
+          if (prev.type != PreviousPtr::Type::VERTEX) break;
+          auto guard = std::shared_lock{prev.vertex->lock};
+          for (auto const label : prev.vertex->labels) columns.LabelChanged(label, *commit_timestamp_);
+          break;
+        }
+        case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+        case Delta::Action::DELETE_OBJECT:
+        case Delta::Action::ADD_IN_EDGE:
+        case Delta::Action::ADD_OUT_EDGE:
+        case Delta::Action::REMOVE_IN_EDGE:
+        case Delta::Action::REMOVE_OUT_EDGE:
+          break;
+      }
+    }
+  }
+
+  // Same for the graph projections, any change of vertices or edges can change a projection
+  if (!transaction_.deltas.empty()) {
+    mem_storage->graph_projections_.GraphChanged(*commit_timestamp_);
+  }
+
   MG_ASSERT(transaction_.commit_timestamp != nullptr, "Invalid database state!");
   transaction_.commit_timestamp->store(*commit_timestamp_, std::memory_order_release);
 
@@ -1090,8 +1187,12 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
     // To track which edge type indexes need cleaning up, we need the edge type which is held in vertices in/out edges
     // Hence need to first once to modify edges, so it can read vectices information intact.
 
+    // The abort processor removes only the index entries it collects, a full index cleanup removes any others
+    auto index_impact = IndexPerformanceTracker{};
+
     // Edges pass
     for (const auto &delta : transaction_.deltas) {
+      index_impact.update(delta.action);
       auto prev = delta.prev.Get();
       switch (prev.type) {
         case PreviousPtr::Type::EDGE: {
@@ -1193,6 +1294,8 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
 
           auto remove_in_edges = absl::flat_hash_set<EdgeRef>{};
           auto remove_out_edges = absl::flat_hash_set<EdgeRef>{};
+          bool in_edges_added = false;
+          bool out_edges_added = false;
 
           while (current != nullptr &&
                  current->timestamp->load(std::memory_order_acquire) == transaction_.transaction_id) {
@@ -1271,6 +1374,7 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                 DMG_ASSERT(std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link) == vertex->in_edges.end(),
                            "Invalid database state!");
                 vertex->in_edges.push_back(link);
+                in_edges_added = true;
                 break;
               }
               case Delta::Action::ADD_OUT_EDGE: {
@@ -1280,6 +1384,7 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                     std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link) == vertex->out_edges.end(),
                     "Invalid database state!");
                 vertex->out_edges.push_back(link);
+                out_edges_added = true;
                 // Increment edge count. We only increment the count here because
                 // the information in `ADD_IN_EDGE` and `Edge/RECREATE_OBJECT` is
                 // redundant. Also, `Edge/RECREATE_OBJECT` isn't available when
@@ -1327,21 +1432,23 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
 
           // bulk remove in_edges
           if (!remove_in_edges.empty()) {
-            auto mid = std::partition(vertex->in_edges.begin(), vertex->in_edges.end(), [&](auto const &edge_tuple) {
+            auto mid = PartitionAdjacency(vertex->in_edges, vertex->in_edges_sorted, [&](auto const &edge_tuple) {
               return !remove_in_edges.contains(std::get<EdgeRef>(edge_tuple));
             });
             vertex->in_edges.erase(mid, vertex->in_edges.end());
             vertex->in_edges.shrink_to_fit();
           }
+          if (in_edges_added) RestoreAdjacencyOrder(vertex->in_edges, vertex->in_edges_sorted);
 
           // bulk remove out_edges
           if (!remove_out_edges.empty()) {
-            auto mid = std::partition(vertex->out_edges.begin(), vertex->out_edges.end(), [&](auto const &edge_tuple) {
+            auto mid = PartitionAdjacency(vertex->out_edges, vertex->out_edges_sorted, [&](auto const &edge_tuple) {
               return !remove_out_edges.contains(std::get<EdgeRef>(edge_tuple));
             });
             vertex->out_edges.erase(mid, vertex->out_edges.end());
             vertex->out_edges.shrink_to_fit();
           }
+          if (out_edges_added) RestoreAdjacencyOrder(vertex->out_edges, vertex->out_edges_sorted);
 
           vertex->delta = current;
           if (current != nullptr) {
@@ -1379,6 +1486,12 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
 
     // Cleanup INDICES
     index_abort_processor.Process(storage_->indices_, transaction_.active_indices_, transaction_.start_timestamp);
+    if (index_impact.impacts_vertex_indexes()) {
+      mem_storage->gc_index_cleanup_vertex_performance_.store(true, std::memory_order_release);
+    }
+    if (index_impact.impacts_edge_indexes()) {
+      mem_storage->gc_index_cleanup_edge_performance_.store(true, std::memory_order_release);
+    }
 
     for (auto const &[label_prop, vertices] : vector_label_property_cleanup) {
       storage_->indices_.vector_index_.AbortEntries(label_prop, vertices);
@@ -1449,8 +1562,8 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   }
   DowngradeToReadIfValid();
   if (mem_label_index
-          ->PopulateIndex(label, in_memory->vertices_.access(), std::nullopt, std::nullopt, &transaction_,
-                          std::move(cancel_check))
+          ->PopulateIndex(label, in_memory->vertices_.access(), in_memory->IndexPopulationInfo(), std::nullopt,
+                          &transaction_, std::move(cancel_check))
           .HasError()) {
     return StorageIndexDefinitionError{IndexDefinitionCancelationError{}};
   }
@@ -1479,8 +1592,8 @@ auto InMemoryStorage::InMemoryAccessor::CreateIndex(LabelId label, PropertiesPat
   }
   DowngradeToReadIfValid();
   if (mem_label_property_index
-          ->PopulateIndex(label, properties, in_memory->vertices_.access(), std::nullopt, std::nullopt, &transaction_,
-                          std::move(cancel_check))
+          ->PopulateIndex(label, properties, in_memory->vertices_.access(), in_memory->IndexPopulationInfo(),
+                          std::nullopt, &transaction_, std::move(cancel_check))
           .HasError()) {
     return StorageIndexDefinitionError{IndexDefinitionCancelationError{}};
   }
@@ -1513,7 +1626,7 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   DowngradeToReadIfValid();
   if (mem_edge_type_index
           ->PopulateIndex(edge_type, in_memory->vertices_.access(), std::nullopt, &transaction_,
-                          std::move(cancel_check))
+                          std::move(cancel_check), in_memory->IndexPopulationInfo())
           .HasError()) {
     return StorageIndexDefinitionError{IndexDefinitionCancelationError{}};
   }
@@ -1543,7 +1656,7 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   DowngradeToReadIfValid();
   if (mem_edge_type_property_index
           ->PopulateIndex(edge_type, property, in_memory->vertices_.access(), std::nullopt, &transaction_,
-                          std::move(cancel_check))
+                          std::move(cancel_check), in_memory->IndexPopulationInfo())
           .HasError()) {
     return StorageIndexDefinitionError{IndexDefinitionCancelationError{}};
   }
@@ -1573,7 +1686,8 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   }
   DowngradeToReadIfValid();
   if (mem_edge_property_index
-          ->PopulateIndex(property, in_memory->vertices_.access(), std::nullopt, &transaction_, std::move(cancel_check))
+          ->PopulateIndex(property, in_memory->vertices_.access(), std::nullopt, &transaction_, std::move(cancel_check),
+                          in_memory->IndexPopulationInfo())
           .HasError()) {
     return StorageIndexDefinitionError{IndexDefinitionCancelationError{}};
   }
@@ -1861,6 +1975,69 @@ VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, View
   return VerticesIterable(active_indices->Vertices(label, view, storage_, &transaction_));
 }
 
+std::shared_ptr<PropertyColumn const> InMemoryStorage::InMemoryAccessor::GetPropertyColumn(LabelId label,
+                                                                                         PropertyId property) {
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  auto &columns = mem_storage->property_columns_;
+  if (!columns.Contains(label, property)) return nullptr;
+  // Columns hold committed values, so they can't be used by transactions which see their own changes or the changes
+  // committed after they started
+  if (transaction_.storage_mode != StorageMode::IN_MEMORY_TRANSACTIONAL ||
+      transaction_.isolation_level != IsolationLevel::SNAPSHOT_ISOLATION || !transaction_.deltas.empty()) {
+    return nullptr;
+  }
+  if (auto column = columns.Get(label, property, transaction_.start_timestamp)) return column;
+  if (!LabelIndexReady(label)) return nullptr;
+
+  auto column = std::make_shared<PropertyColumn>();
+  for (auto vertex : Vertices(label, View::OLD)) {
+    ++column->vertex_count;
+    auto const value = vertex.GetProperty(property, View::OLD);
+    if (value.HasError()) return nullptr;
+    switch (value->type()) {
+      case PropertyValueType::Null:
+        break;
+      case PropertyValueType::Int:
+        column->ints.push_back(value->ValueInt());
+        break;
+      case PropertyValueType::Double:
+        column->doubles.push_back(value->ValueDouble());
+        break;
+      default:
+        ++column->other_count;
+        break;
+    }
+  }
+  columns.Set(label, property, transaction_.start_timestamp, column);
+  return column;
+}
+
+std::shared_ptr<GraphProjection const> InMemoryStorage::InMemoryAccessor::GetGraphProjection(
+    GraphProjectionFilter const &filter, View view) {
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  // Same as columns, projections hold the committed graph, so they are shared only by transactions which don't see
+  // their own changes or the changes committed after they started
+  bool const shared = transaction_.storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL &&
+                      transaction_.isolation_level == IsolationLevel::SNAPSHOT_ISOLATION &&
+                      transaction_.deltas.empty();
+  auto &projections = mem_storage->graph_projections_;
+  if (shared) {
+    if (auto projection = projections.Get(filter, transaction_.start_timestamp)) return projection;
+  }
+
+  auto vertices = mem_storage->vertices_.access();
+  std::shared_ptr<GraphProjection const> projection = BuildGraphProjection(
+      vertices, filter, storage_, &transaction_, view, mem_storage->config_.graph_projection_thread_count);
+  if (shared) projections.Set(filter, transaction_.start_timestamp, projection);
+  return projection;
+}
+
+VerticesChunkedIterable InMemoryStorage::InMemoryAccessor::ChunkedVertices(LabelId label, View view,
+                                                                            size_t num_chunks) {
+  auto *active_indices = static_cast<InMemoryLabelIndex::ActiveIndices *>(transaction_.active_indices_.label_.get());
+  return VerticesChunkedIterable(active_indices->ChunkedVertices(label, view, storage_, &transaction_, num_chunks));
+}
+
 VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
     LabelId label, std::span<storage::PropertyPath const> properties,
     std::span<storage::PropertyValueRange const> property_ranges, View view) {
@@ -1982,6 +2159,13 @@ void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
       snapshot_runner_.Resume();
     }
     storage_mode_ = new_storage_mode;
+    // Changes made in the analytical mode aren't tracked, the next snapshot has to be a full one
+    snapshot_changes_.Disarm();
+    property_columns_.Clear(timestamp_);
+    graph_projections_.Clear(timestamp_);
+    // Index entries made stale in the analytical mode have no deltas hinting their cleanup
+    gc_index_cleanup_vertex_performance_.store(true, std::memory_order_release);
+    gc_index_cleanup_edge_performance_.store(true, std::memory_order_release);
     FreeMemory(std::move(main_guard), false);
   }
 }
@@ -2040,6 +2224,9 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // in the second GC phase in this GC iteration or some of the following
   // ones.
 
+  // Projections of a graph which was changed since can't be given to any transaction anymore
+  graph_projections_.DropStale();
+
   uint64_t oldest_active_start_timestamp = commit_log_->OldestActive();
 
   {
@@ -2080,165 +2267,198 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   auto const need_full_scan_vertices = gc_full_scan_vertices_delete_.exchange(false, std::memory_order_acq_rel);
   auto const need_full_scan_edges = gc_full_scan_edges_delete_.exchange(false, std::memory_order_acq_rel);
 
+  auto const thread_count = std::max(config_.gc.thread_count, uint64_t{1});
+
   // Short lock, to move to local variable. Hence, allows other transactions to commit.
   auto linked_undo_buffers = std::list<GCDeltas>{};
   committed_transactions_.WithLock(
       [&](auto &committed_transactions) { committed_transactions.swap(linked_undo_buffers); });
 
-  // This is to track if any of the unlinked deltas would have an impact on index performance, i.e. do they hint that
-  // there are possible stale/duplicate entries that can be removed
-  auto index_impact = IndexPerformanceTracker{};
-
   auto const end_linked_undo_buffers = linked_undo_buffers.end();
   for (auto linked_entry = linked_undo_buffers.begin(); linked_entry != end_linked_undo_buffers;) {
-    auto const *const commit_timestamp_ptr = linked_entry->commit_timestamp_.get();
-    auto const commit_timestamp = commit_timestamp_ptr->load(std::memory_order_acquire);
+    auto const commit_timestamp = linked_entry->commit_timestamp_->load(std::memory_order_acquire);
+    auto const to_move = linked_entry;
+    ++linked_entry;  // advanced to next before we move the list node
 
     // only process those that are no longer active
-    if (commit_timestamp >= oldest_active_start_timestamp) {
-      ++linked_entry;  // can not process, skip
-      continue;        // must continue to next transaction, because committed_transactions_ was not ordered
-    }
-
-    // When unlinking a delta which is the first delta in its version chain,
-    // special care has to be taken to avoid the following race condition:
-    //
-    // [Vertex] --> [Delta A]
-    //
-    //    GC thread: Delta A is the first in its chain, it must be unlinked from
-    //               vertex and marked for deletion
-    //    TX thread: Update vertex and add Delta B with Delta A as next
-    //
-    // [Vertex] --> [Delta B] <--> [Delta A]
-    //
-    //    GC thread: Unlink delta from Vertex
-    //
-    // [Vertex] --> (nullptr)
-    //
-    // When processing a delta that is the first one in its chain, we
-    // obtain the corresponding vertex or edge lock, and then verify that this
-    // delta still is the first in its chain.
-    // When processing a delta that is in the middle of the chain we only
-    // process the final delta of the given transaction in that chain. We
-    // determine the owner of the chain (either a vertex or an edge), obtain the
-    // corresponding lock, and then verify that this delta is still in the same
-    // position as it was before taking the lock.
-    //
-    // Even though the delta chain is lock-free (both `next` and `prev`) the
-    // chain should not be modified without taking the lock from the object that
-    // owns the chain (either a vertex or an edge). Modifying the chain without
-    // taking the lock will cause subtle race conditions that will leave the
-    // chain in a broken state.
-    // The chain can be only read without taking any locks.
-
-    for (Delta &delta : linked_entry->deltas_) {
-      index_impact.update(delta.action);
-      while (true) {
-        auto prev = delta.prev.Get();
-        switch (prev.type) {
-          case PreviousPtr::Type::VERTEX: {
-            Vertex *vertex = prev.vertex;
-            auto vertex_guard = std::unique_lock{vertex->lock};
-            if (vertex->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            vertex->delta = nullptr;
-            if (vertex->deleted) {
-              DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
-              current_deleted_vertices.push_back(vertex->gid);
-            }
-            break;
+    // must continue to next transaction, because committed_transactions_ was not ordered
+    if (commit_timestamp >= oldest_active_start_timestamp) continue;
+
+    // will be unlinked, move to unlinked_undo_buffers
+    unlinked_undo_buffers.splice(unlinked_undo_buffers.end(), linked_undo_buffers, to_move);
+  }
+
+  if (!linked_undo_buffers.empty()) {
+    // some were not able to be collected, add them back to committed_transactions_ for the next GC run
+    committed_transactions_.WithLock([&linked_undo_buffers](auto &committed_transactions) {
+      committed_transactions.splice(committed_transactions.begin(), std::move(linked_undo_buffers));
+    });
+  }
+
+  // When unlinking a delta which is the first delta in its version chain,
+  // special care has to be taken to avoid the following race condition:
+  //
+  // [Vertex] --> [Delta A]
+  //
+  //    GC thread: Delta A is the first in its chain, it must be unlinked from
+  //               vertex and marked for deletion
+  //    TX thread: Update vertex and add Delta B with Delta A as next
+  //
+  // [Vertex] --> [Delta B] <--> [Delta A]
+  //
+  //    GC thread: Unlink delta from Vertex
+  //
+  // [Vertex] --> (nullptr)
+  //
+  // When processing a delta that is the first one in its chain, we
+  // obtain the corresponding vertex or edge lock, and then verify that this
+  // delta still is the first in its chain.
+  // When processing a delta that is in the middle of the chain we only
+  // process the final delta of the given transaction in that chain. We
+  // determine the owner of the chain (either a vertex or an edge), obtain the
+  // corresponding lock, and then verify that this delta is still in the same
+  // position as it was before taking the lock.
+  //
+  // Even though the delta chain is lock-free (both `next` and `prev`) the
+  // chain should not be modified without taking the lock from the object that
+  // owns the chain (either a vertex or an edge). Modifying the chain without
+  // taking the lock will cause subtle race conditions that will leave the
+  // chain in a broken state.
+  // The chain can be only read without taking any locks.
+  //
+  // Every delta is unlinked on its own under the lock of the object owning its
+  // chain, so the deltas are split into batches of slabs which are unlinked
+  // concurrently, even when they belong to the same transaction.
+  struct UnlinkResult {
+    std::list<Gid> deleted_vertices;
+    std::list<Gid> deleted_edges;
+    // This is to track if any of the unlinked deltas would have an impact on index performance, i.e. do they hint
+    // that there are possible stale/duplicate entries that can be removed
+    IndexPerformanceTracker index_impact;
+  };
+
+  auto const unlink_delta = [oldest_active_start_timestamp](Delta &delta,
+                                                            std::atomic<uint64_t> const *commit_timestamp_ptr,
+                                                            UnlinkResult &result) {
+    result.index_impact.update(delta.action);
+    while (true) {
+      auto prev = delta.prev.Get();
+      switch (prev.type) {
+        case PreviousPtr::Type::VERTEX: {
+          Vertex *vertex = prev.vertex;
+          auto vertex_guard = std::unique_lock{vertex->lock};
+          if (vertex->delta != &delta) {
+            // Something changed, we're not the first delta in the chain
+            // anymore.
+            continue;
           }
-          case PreviousPtr::Type::EDGE: {
-            Edge *edge = prev.edge;
-            auto edge_guard = std::unique_lock{edge->lock};
-            if (edge->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            edge->delta = nullptr;
-            if (edge->deleted) {
-              DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
-              current_deleted_edges.push_back(edge->gid);
-            }
+          vertex->delta = nullptr;
+          if (vertex->deleted) {
+            DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
+            result.deleted_vertices.push_back(vertex->gid);
+          }
+          break;
+        }
+        case PreviousPtr::Type::EDGE: {
+          Edge *edge = prev.edge;
+          auto edge_guard = std::unique_lock{edge->lock};
+          if (edge->delta != &delta) {
+            // Something changed, we're not the first delta in the chain
+            // anymore.
+            continue;
+          }
+          edge->delta = nullptr;
+          if (edge->deleted) {
+            DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
+            result.deleted_edges.push_back(edge->gid);
+          }
+          break;
+        }
+        case PreviousPtr::Type::DELTA: {
+          //              kTransactionInitialId
+          //                     │
+          //                     ▼
+          // ┌───────────────────┬─────────────┐
+          // │     Committed     │ Uncommitted │
+          // ├──────────┬────────┴─────────────┤
+          // │ Inactive │      Active          │
+          // └──────────┴──────────────────────┘
+          //            ▲
+          //            │
+          //  oldest_active_start_timestamp
+
+          if (prev.delta->timestamp == commit_timestamp_ptr) {
+            // The delta that is newer than this one is also a delta from this
+            // transaction. We skip the current delta and will remove it as a
+            // part of the suffix later.
             break;
           }
-          case PreviousPtr::Type::DELTA: {
-            //              kTransactionInitialId
-            //                     │
-            //                     ▼
-            // ┌───────────────────┬─────────────┐
-            // │     Committed     │ Uncommitted │
-            // ├──────────┬────────┴─────────────┤
-            // │ Inactive │      Active          │
-            // └──────────┴──────────────────────┘
-            //            ▲
-            //            │
-            //  oldest_active_start_timestamp
-
-            if (prev.delta->timestamp == commit_timestamp_ptr) {
-              // The delta that is newer than this one is also a delta from this
-              // transaction. We skip the current delta and will remove it as a
-              // part of the suffix later.
-              break;
-            }
 
-            if (prev.delta->timestamp->load() < oldest_active_start_timestamp) {
-              // If previous is from another inactive transaction, no need to
-              // lock the edge/vertex, nothing will read this far or relink to
-              // us directly
-              break;
-            }
+          if (prev.delta->timestamp->load() < oldest_active_start_timestamp) {
+            // If previous is from another inactive transaction, no need to
+            // lock the edge/vertex, nothing will read this far or relink to
+            // us directly
+            break;
+          }
 
-            // Previous is either active (committed or uncommitted), we need to find
-            // the parent object in order to be able to use its lock.
-            auto parent = prev;
-            while (parent.type == PreviousPtr::Type::DELTA) {
-              parent = parent.delta->prev.Get();
-            }
+          // Previous is either active (committed or uncommitted), we need to find
+          // the parent object in order to be able to use its lock.
+          auto parent = prev;
+          while (parent.type == PreviousPtr::Type::DELTA) {
+            parent = parent.delta->prev.Get();
+          }
 
-            auto const guard = std::invoke([&] {
-              switch (parent.type) {
-                case PreviousPtr::Type::VERTEX:
-                  return std::unique_lock{parent.vertex->lock};
-                case PreviousPtr::Type::EDGE:
-                  return std::unique_lock{parent.edge->lock};
-                case PreviousPtr::Type::DELTA:
-                case PreviousPtr::Type::NULLPTR:
-                  LOG_FATAL("Invalid database state!");
-              }
-            });
-            if (delta.prev.Get() != prev) {
-              // Something changed, we could now be the first delta in the
-              // chain.
-              continue;
+          auto const guard = std::invoke([&] {
+            switch (parent.type) {
+              case PreviousPtr::Type::VERTEX:
+                return std::unique_lock{parent.vertex->lock};
+              case PreviousPtr::Type::EDGE:
+                return std::unique_lock{parent.edge->lock};
+              case PreviousPtr::Type::DELTA:
+              case PreviousPtr::Type::NULLPTR:
+                LOG_FATAL("Invalid database state!");
             }
-            Delta *prev_delta = prev.delta;
-            prev_delta->next.store(nullptr, std::memory_order_release);
-            break;
-          }
-          case PreviousPtr::Type::NULLPTR: {
-            LOG_FATAL("Invalid pointer!");
+          });
+          if (delta.prev.Get() != prev) {
+            // Something changed, we could now be the first delta in the
+            // chain.
+            continue;
           }
+          Delta *prev_delta = prev.delta;
+          prev_delta->next.store(nullptr, std::memory_order_release);
+          break;
+        }
+        case PreviousPtr::Type::NULLPTR: {
+          LOG_FATAL("Invalid pointer!");
         }
-        break;
       }
+      break;
     }
+  };
 
-    // Now unlinked, move to unlinked_undo_buffers
-    auto const to_move = linked_entry;
-    ++linked_entry;  // advanced to next before we move the list node
-    unlinked_undo_buffers.splice(unlinked_undo_buffers.end(), linked_undo_buffers, to_move);
+  std::vector<std::pair<delta_slab *, std::atomic<uint64_t> const *>> slabs;
+  for (auto &unlinked_undo_buffer : unlinked_undo_buffers) {
+    for (auto &slab : unlinked_undo_buffer.deltas_.slabs()) {
+      slabs.emplace_back(&slab, unlinked_undo_buffer.commit_timestamp_.get());
+    }
   }
+  auto const unlink_task_count = std::min<uint64_t>(slabs.size(), thread_count * kGcTasksPerThread);
+  std::vector<UnlinkResult> unlink_results(unlink_task_count);
+  utils::ParallelFor(unlink_task_count, thread_count, [&](uint64_t const task) {
+    auto const last = slabs.size() * (task + 1) / unlink_task_count;
+    for (auto i = slabs.size() * task / unlink_task_count; i < last; ++i) {
+      auto const &[slab, commit_timestamp_ptr] = slabs[i];
+      for (Delta &delta : *slab) {
+        unlink_delta(delta, commit_timestamp_ptr, unlink_results[task]);
+      }
+    }
+  });
 
-  if (!linked_undo_buffers.empty()) {
-    // some were not able to be collected, add them back to committed_transactions_ for the next GC run
-    committed_transactions_.WithLock([&linked_undo_buffers](auto &committed_transactions) {
-      committed_transactions.splice(committed_transactions.begin(), std::move(linked_undo_buffers));
-    });
+  auto index_impact = IndexPerformanceTracker{};
+  for (auto &result : unlink_results) {
+    current_deleted_vertices.splice(current_deleted_vertices.end(), result.deleted_vertices);
+    current_deleted_edges.splice(current_deleted_edges.end(), result.deleted_edges);
+    index_impact.update(result.index_impact);
   }
 
   // Index cleanup runs can be expensive, we want to avoid high CPU usage when the GC doesn't have to clean up any
@@ -2253,28 +2473,61 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   bool const index_cleanup_edge_needed = need_full_scan_edges || !current_deleted_edges.empty();
 
   // Used to determine whether the Index GC should be run for performance reasons (removing redundant entries). It
-  // should be run when hinted by FastDiscardOfDeltas or by the deltas we processed this GC run.
+  // should be run when hinted by FastDiscardOfDeltas, Abort or by the deltas we processed this GC run.
   auto index_cleanup_vertex_performance =
       gc_index_cleanup_vertex_performance_.exchange(false, std::memory_order_acq_rel) ||
       index_impact.impacts_vertex_indexes();
   auto index_cleanup_edge_performance = gc_index_cleanup_edge_performance_.exchange(false, std::memory_order_acq_rel) ||
                                         index_impact.impacts_edge_indexes();
 
+  // Any change of the labels or properties of a vertex hints a full cleanup in the GC run which unlinks its delta, and
+  // that cleanup removes the entries the change made stale. So when nothing but deletions is left to clean up, the
+  // deleted vertices have no entries other than those of their current labels and properties. Those are looked up
+  // directly instead of scanning all vertex indices, unless so many vertices were deleted that a scan is cheaper.
+  bool const targeted_vertex_cleanup =
+      !need_full_scan_vertices && !index_cleanup_vertex_performance && !current_deleted_vertices.empty() &&
+      current_deleted_vertices.size() * kTargetedIndexCleanupRatio <= vertices_.size();
+
+  auto const deleted_vertices = std::vector<Gid>(current_deleted_vertices.begin(), current_deleted_vertices.end());
+  auto const deleted_edges = std::vector<Gid>(current_deleted_edges.begin(), current_deleted_edges.end());
+
   // After unlinking deltas from vertices, we refresh the indices. That way
   // we're sure that none of the vertices from `current_deleted_vertices`
   // appears in an index, and we can safely remove the from the main storage
   // after the last currently active transaction is finished.
-  // This operation is very expensive as it traverses through all of the items
-  // in every index every time.
+  // A full cleanup is very expensive as it traverses through all of the items
+  // in every index. The cleanups of the different indices are independent, so
+  // they run concurrently.
   if (auto token = stop_source.get_token(); !token.stop_requested()) {
-    if (index_cleanup_vertex_needed || index_cleanup_vertex_performance) {
-      indices_.RemoveObsoleteVertexEntries(oldest_active_start_timestamp, token);
-      auto *mem_unique_constraints = static_cast<InMemoryUniqueConstraints *>(constraints_.unique_constraints_.get());
-      mem_unique_constraints->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+    auto *mem_unique_constraints = static_cast<InMemoryUniqueConstraints *>(constraints_.unique_constraints_.get());
+    std::vector<std::function<void()>> index_cleanups;
+    if (targeted_vertex_cleanup) {
+      auto const task_count = std::min<uint64_t>(deleted_vertices.size(), thread_count * kGcTasksPerThread);
+      for (uint64_t task = 0; task < task_count; ++task) {
+        index_cleanups.emplace_back([this, mem_unique_constraints, &deleted_vertices, task, task_count] {
+          std::vector<Vertex *> vertices;
+          auto vertex_acc = vertices_.access();
+          auto const last = deleted_vertices.size() * (task + 1) / task_count;
+          for (auto i = deleted_vertices.size() * task / task_count; i < last; ++i) {
+            auto it = vertex_acc.find(deleted_vertices[i]);
+            MG_ASSERT(it != vertex_acc.end(), "Invalid database state!");
+            vertices.push_back(&*it);
+          }
+          indices_.RemoveDeletedVertices(vertices);
+          mem_unique_constraints->RemoveDeletedVertices(vertices);
+        });
+      }
+    } else if (index_cleanup_vertex_needed || index_cleanup_vertex_performance) {
+      index_cleanups = indices_.ObsoleteVertexEntriesCleanups(oldest_active_start_timestamp, token);
+      index_cleanups.emplace_back([mem_unique_constraints, oldest_active_start_timestamp, token] {
+        mem_unique_constraints->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      });
     }
     if (index_cleanup_edge_needed || index_cleanup_edge_performance) {
-      indices_.RemoveObsoleteEdgeEntries(oldest_active_start_timestamp, token);
+      auto edge_cleanups = indices_.ObsoleteEdgeEntriesCleanups(oldest_active_start_timestamp, token);
+      std::ranges::move(edge_cleanups, std::back_inserter(index_cleanups));
     }
+    utils::ParallelFor(index_cleanups.size(), thread_count, [&](uint64_t const cleanup) { index_cleanups[cleanup](); });
   }
 
   {
@@ -2304,28 +2557,15 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   }
 
   // EDGES METADATA (has ptr to Vertices, must be before removing vertices)
-  if (!current_deleted_edges.empty() && config_.salient.items.enable_edges_metadata) {
-    auto edge_metadata_acc = edges_metadata_.access();
-    for (auto edge : current_deleted_edges) {
-      MG_ASSERT(edge_metadata_acc.remove(edge), "Invalid database state!");
-    }
+  if (config_.salient.items.enable_edges_metadata) {
+    RemoveFromSkipList(edges_metadata_, deleted_edges, thread_count);
   }
 
   // VERTICES (has ptr to Edges, must be before removing edges)
-  if (!current_deleted_vertices.empty()) {
-    auto vertex_acc = vertices_.access();
-    for (auto vertex : current_deleted_vertices) {
-      MG_ASSERT(vertex_acc.remove(vertex), "Invalid database state!");
-    }
-  }
+  RemoveFromSkipList(vertices_, deleted_vertices, thread_count);
 
   // EDGES
-  if (!current_deleted_edges.empty()) {
-    auto edge_acc = edges_.access();
-    for (auto edge : current_deleted_edges) {
-      MG_ASSERT(edge_acc.remove(edge), "Invalid database state!");
-    }
-  }
+  RemoveFromSkipList(edges_, deleted_edges, thread_count);
 
   // EXPENSIVE full scan, is only run if an IN_MEMORY_ANALYTICAL transaction involved any deletions
   // TODO: implement a fast internal iteration inside the skip_list (to avoid unnecessary find_node calls),
@@ -2429,21 +2669,30 @@ bool InMemoryStorage::InitializeWalFile(memgraph::replication::ReplicationEpoch
   if (!wal_file_) {
     wal_file_ =
         std::make_unique<durability::WalFile>(recovery_.wal_directory_, uuid(), epoch.id(), config_.salient.items,
-                                              name_id_mapper_.get(), wal_seq_num_++, &file_retainer_);
+                                              name_id_mapper_.get(), wal_seq_num_++, &file_retainer_,
+                                              config_.durability.compression_enabled
+                                                  ? std::optional{config_.durability.compression_level}
+                                                  : std::nullopt);
   }
 
   return true;
 }
 
-void InMemoryStorage::FinalizeWalFile() {
+uint64_t InMemoryStorage::FinalizeWalFile() {
+  uint64_t sync_ticket = 0;
   ++wal_unsynced_transactions_;
-  if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
+  if (wal_group_commit_) {
+    // The records are written to the file here to keep the WAL ordered by the commit timestamps, the flusher thread
+    // only syncs the file.
+    wal_file_->FlushBuffer();
+    sync_ticket = wal_group_commit_->Submit(wal_file_->native_handle());
+    wal_unsynced_transactions_ = 0;
+  } else if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
     wal_file_->Sync();
     wal_unsynced_transactions_ = 0;
   }
   if (wal_file_->GetSize() / 1024 >= config_.durability.wal_file_size_kibibytes) {
-    wal_file_->FinalizeWal();
-    wal_file_.reset();
+    CloseWalFile();
     wal_unsynced_transactions_ = 0;
   } else {
     // Try writing the internal buffer if possible, if not
@@ -2452,6 +2701,30 @@ void InMemoryStorage::FinalizeWalFile() {
     // reading thread EnabledFlushing)
     wal_file_->TryFlushing();
   }
+  return sync_ticket;
+}
+
+auto InMemoryStorage::IndexPopulationInfo() const -> std::optional<durability::ParallelizedSchemaCreationInfo> {
+  if (config_.index_population_thread_count < 2) return std::nullopt;
+  // There are no snapshot batches at runtime, `PopulateIndexDispatch` splits the vertices into ranges
+  return durability::ParallelizedSchemaCreationInfo{.vertex_recovery_info = {},
+                                                    .thread_count = config_.index_population_thread_count};
+}
+
+void InMemoryStorage::WaitForWalSync(uint64_t const ticket) {
+  if (wal_group_commit_) wal_group_commit_->Wait(ticket);
+}
+
+void InMemoryStorage::CloseWalFile(bool const finalize) {
+  auto close = [this, finalize] {
+    if (finalize) wal_file_->FinalizeWal();
+    wal_file_.reset();
+  };
+  if (wal_group_commit_) {
+    wal_group_commit_->CloseFile(close);
+  } else {
+    close();
+  }
 }
 
 bool InMemoryStorage::InMemoryAccessor::HandleDurabilityAndReplicate(uint64_t durability_commit_timestamp,
@@ -2805,7 +3078,7 @@ bool InMemoryStorage::InMemoryAccessor::HandleDurabilityAndReplicate(uint64_t du
   // If main executes this and committing immediately we need to finalize wal file before sending deltas to replicas
   // If replica executes this and committing immediately, it is OK to finalize wal here
   if (commit_flag) {
-    mem_storage->FinalizeWalFile();
+    wal_sync_ticket_ = mem_storage->FinalizeWalFile();
   }
 
   // Ships deltas to instances and waits for the reply
@@ -2817,6 +3090,8 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError, std::filesystem::path>
     memgraph::replication_coordination_glue::ReplicationRole replication_role, bool force) {
   using memgraph::replication_coordination_glue::ReplicationRole;
   if (replication_role == ReplicationRole::REPLICA) {
+    // Replicas don't create snapshots, so there is no point in tracking the changes
+    snapshot_changes_.Disarm();
     return CreateSnapshotError::DisabledForReplica;
   }
 
@@ -2842,6 +3117,12 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError, std::filesystem::path>
   // stuff are mutually exclusive from each other
   auto const snapshot_guard = std::unique_lock(snapshot_lock_);
 
+  // Changes have to be recorded from before the snapshot transaction starts, otherwise the commits which happen while
+  // a full snapshot is being written would be missing from the next incremental one
+  if (config_.durability.snapshot_incremental_count > 0 && storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    snapshot_changes_.Arm();
+  }
+
   auto accessor = std::invoke([&]() {
     if (storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL) {
       // For analytical no other write txn can be in play
@@ -2865,14 +3146,48 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError, std::filesystem::path>
     last_snapshot_digest_ = std::move(current_digest);
   }
 
+  // Changes made in the analytical mode aren't tracked, so only a full snapshot can be written
+  bool const track_changes = config_.durability.snapshot_incremental_count > 0 &&
+                             transaction->storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL;
+  auto changes = std::optional<durability::SnapshotChanges>{};
+  if (track_changes && incremental_snapshot_chain_ &&
+      incremental_snapshot_chain_->length < config_.durability.snapshot_incremental_count &&
+      incremental_snapshot_chain_->epoch_id == epoch.id()) {
+    changes = snapshot_changes_.Collect(transaction->start_timestamp);
+  }
+
   // At the moment, the only way in which create snapshot can fail is if it got aborted
-  const auto snapshot_path =
-      durability::CreateSnapshot(this, transaction, recovery_.snapshot_directory_, recovery_.wal_directory_, &vertices_,
-                                 &edges_, storage_uuid, epoch, epochHistory, &file_retainer_, &abort_snapshot_);
+  const auto snapshot_path = std::invoke([&]() {
+    if (changes) {
+      return durability::CreateIncrementalSnapshot(this, transaction, recovery_.snapshot_directory_, &vertices_,
+                                                   &edges_, *incremental_snapshot_chain_, *changes, storage_uuid,
+                                                   epoch, &abort_snapshot_);
+    }
+    return durability::CreateSnapshot(this, transaction, recovery_.snapshot_directory_, recovery_.wal_directory_,
+                                      &vertices_, &edges_, storage_uuid, epoch, epochHistory, &file_retainer_,
+                                      &abort_snapshot_);
+  });
   if (!snapshot_path) {
     return CreateSnapshotError::AbortSnapshot;
   }
 
+  if (changes) {
+    incremental_snapshot_chain_->parent_start_timestamp = transaction->start_timestamp;
+    ++incremental_snapshot_chain_->length;
+    snapshot_changes_.Trim(transaction->start_timestamp);
+  } else if (track_changes) {
+    // A full snapshot starts a new chain
+    incremental_snapshot_chain_ = durability::IncrementalSnapshotChain{
+        .epoch_id = std::string{epoch.id()},
+        .base_start_timestamp = transaction->start_timestamp,
+        .parent_start_timestamp = transaction->start_timestamp,
+    };
+    snapshot_changes_.SetBase(transaction->start_timestamp);
+  } else {
+    incremental_snapshot_chain_.reset();
+    snapshot_changes_.Disarm();
+  }
+
   memgraph::metrics::Measure(memgraph::metrics::SnapshotCreationLatency_us,
                              std::chrono::duration_cast<std::chrono::microseconds>(timer.Elapsed()).count());
 
@@ -2925,6 +3240,11 @@ utils::BasicResult<InMemoryStorage::RecoverSnapshotError> InMemoryStorage::Recov
   auto gc_lock = std::unique_lock{gc_lock_};
   auto engine_lock = std::unique_lock{engine_lock_};
 
+  // The recovered data doesn't build on the previous snapshots
+  snapshot_changes_.Disarm();
+  property_columns_.Clear(timestamp_);
+  graph_projections_.Clear(timestamp_);
+
   try {
     spdlog::debug("Recovering from a snapshot {}", local_path);
     auto recovered_snapshot = storage::durability::LoadSnapshot(
@@ -2958,7 +3278,7 @@ utils::BasicResult<InMemoryStorage::RecoverSnapshotError> InMemoryStorage::Recov
     spdlog::trace("Successfully recovered from snapshot {}", local_path);
 
     // Destroying current wal file
-    wal_file_.reset();
+    if (wal_file_) CloseWalFile(false);
 
     std::string old_dir = ".old_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count());
     spdlog::trace("Moving old snapshots and WALs to {}", old_dir);
@@ -2996,6 +3316,10 @@ utils::BasicResult<InMemoryStorage::RecoverSnapshotError> InMemoryStorage::Recov
         durability::OverwriteSnapshotUUID(local_path, uuid());
       }
     }
+    for (const auto &[snapshot_path, _] : durability::GetIncrementalSnapshotFiles(recovery_.snapshot_directory_)) {
+      spdlog::trace("Moving incremental snapshot file {}", snapshot_path);
+      file_retainer_.RenameFile(snapshot_path, recovery_.snapshot_directory_ / old_dir / snapshot_path.filename());
+    }
     std::filesystem::remove(recovery_.snapshot_directory_ / old_dir, ec);  // remove dir if empty
     auto wal_files = storage::durability::GetWalFiles(recovery_.wal_directory_);
     if (wal_files) {
@@ -3066,8 +3390,7 @@ uint64_t InMemoryStorage::GetCommitTimestamp() { return timestamp_++; }
 void InMemoryStorage::PrepareForNewEpoch() {
   std::unique_lock engine_guard{engine_lock_};
   if (wal_file_) {
-    wal_file_->FinalizeWal();
-    wal_file_.reset();
+    CloseWalFile();
   }
   repl_storage_state_.SaveLatestHistory();
 }
@@ -3207,6 +3530,10 @@ void InMemoryStorage::Clear() {
   auto gc_lock = std::unique_lock{gc_lock_};
   auto engine_lock = std::unique_lock{engine_lock_};
 
+  snapshot_changes_.Disarm();
+  property_columns_.Clear(timestamp_);
+  graph_projections_.Clear(timestamp_);
+
   // Clear main memory
   vertices_.clear();
   vertices_.run_gc();
@@ -3222,7 +3549,7 @@ void InMemoryStorage::Clear() {
 
   // Reset WALs
   wal_seq_num_ = 0;
-  wal_file_.reset();
+  if (wal_file_) CloseWalFile(false);
   wal_unsynced_transactions_ = 0;
 
   // Reset the commit log
@@ -3322,6 +3649,12 @@ void InMemoryStorage::InMemoryAccessor::DropGraph() {
   // also, we're the only transaction running, so we can safely remove the data as well
   mem_storage->indices_.DropGraphClearIndices();
   mem_storage->constraints_.DropGraphClearConstraints();
+  mem_storage->snapshot_changes_.Disarm();
+  {
+    auto engine_guard = std::unique_lock{mem_storage->engine_lock_};
+    mem_storage->property_columns_.Clear(mem_storage->timestamp_);
+    mem_storage->graph_projections_.Clear(mem_storage->timestamp_);
+  }
 
   if (mem_storage->auto_indexer_) {
     mem_storage->auto_indexer_->Clear();
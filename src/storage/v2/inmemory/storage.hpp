@@ -16,6 +16,8 @@
 #include <utility>
 #include "flags/run_time_configurable.hpp"
 #include "storage/v2/commit_log.hpp"
+#include "storage/v2/durability/snapshot.hpp"
+#include "storage/v2/durability/wal_group_commit.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
@@ -76,6 +78,11 @@ struct IndexPerformanceTracker {
     }
   }
 
+  void update(IndexPerformanceTracker const &other) {
+    impacts_vertex_indexes_ |= other.impacts_vertex_indexes_;
+    impacts_edge_indexes_ |= other.impacts_edge_indexes_;
+  }
+
   bool impacts_vertex_indexes() { return impacts_vertex_indexes_; }
   bool impacts_edge_indexes() { return impacts_edge_indexes_; }
 
@@ -179,6 +186,14 @@ class InMemoryStorage final : public Storage {
     VerticesIterable Vertices(LabelId label, std::span<storage::PropertyPath const> properties,
                               std::span<storage::PropertyValueRange const> property_ranges, View view) override;
 
+    VerticesChunkedIterable ChunkedVertices(View view, size_t num_chunks) override {
+      auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+      return VerticesChunkedIterable(
+          AllVerticesChunkedIterable(mem_storage->vertices_.access(), storage_, &transaction_, view, num_chunks));
+    }
+
+    VerticesChunkedIterable ChunkedVertices(LabelId label, View view, size_t num_chunks) override;
+
     std::optional<EdgeAccessor> FindEdge(Gid gid, View view) override;
 
     EdgesIterable Edges(EdgeTypeId edge_type, View view) override;
@@ -198,6 +213,10 @@ class InMemoryStorage final : public Storage {
     EdgesIterable Edges(PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                         const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
 
+    std::shared_ptr<PropertyColumn const> GetPropertyColumn(LabelId label, PropertyId property) override;
+
+    std::shared_ptr<GraphProjection const> GetGraphProjection(GraphProjectionFilter const &filter, View view) override;
+
     /// Return approximate number of all vertices in the database.
     /// Note that this is always an over-estimate and never an under-estimate.
     uint64_t ApproximateVertexCount() const override {
@@ -546,6 +565,8 @@ class InMemoryStorage final : public Storage {
 
     uint64_t commit_flag_wal_position_{0};
     bool needs_wal_update_{false};
+    // Ticket of the WAL group commit which has to be synced before the commit returns
+    uint64_t wal_sync_ticket_{0};
   };
 
   using Storage::Access;
@@ -599,7 +620,15 @@ class InMemoryStorage final : public Storage {
   void CollectGarbage(std::unique_lock<utils::ResourceLock> main_guard, bool periodic);
 
   bool InitializeWalFile(memgraph::replication::ReplicationEpoch &epoch);
-  void FinalizeWalFile();
+  /// Returns the ticket to wait for with `WaitForWalSync` if the WAL is synced by the group commit, 0 otherwise.
+  uint64_t FinalizeWalFile();
+  /// Blocks until the WAL records of the committed transaction with `ticket` are synced. Has to be called without
+  /// holding the engine lock.
+  void WaitForWalSync(uint64_t ticket);
+  /// Parallel population of the indices created at runtime, nullopt if a single thread should be used.
+  auto IndexPopulationInfo() const -> std::optional<durability::ParallelizedSchemaCreationInfo>;
+  /// Finalizes and closes the current WAL file. If `finalize` is false, the file is closed without being synced.
+  void CloseWalFile(bool finalize = true);
 
   StorageInfo GetBaseInfo() override;
   StorageInfo GetInfo() override;
@@ -635,6 +664,8 @@ class InMemoryStorage final : public Storage {
 
   std::unique_ptr<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
+  // Syncs the WAL for concurrent commits if `--storage-wal-group-commit` is set
+  std::optional<durability::WalGroupCommit> wal_group_commit_;
 
   utils::FileRetainer file_retainer_;
 
@@ -676,6 +707,8 @@ class InMemoryStorage final : public Storage {
   // storage.
   utils::Synchronized<std::list<Gid>, utils::SpinLock> deleted_edges_;
 
+  // Hints to CollectGarbage that the indices may have stale entries. Until a full index cleanup removes them, the
+  // deleted vertices can't be removed from the indices by looking up their current entries only.
   std::atomic<bool> gc_index_cleanup_vertex_performance_ = false;
   std::atomic<bool> gc_index_cleanup_edge_performance_ = false;
 
@@ -706,6 +739,13 @@ class InMemoryStorage final : public Storage {
 
   std::optional<SnapshotDigest> last_snapshot_digest_;
 
+  PropertyColumns property_columns_;
+  GraphProjections graph_projections_;
+
+  // Objects changed since the last snapshot and the snapshots the next incremental one builds on
+  durability::SnapshotChangeTracker snapshot_changes_;
+  std::optional<durability::IncrementalSnapshotChain> incremental_snapshot_chain_;  // Protected by snapshot_lock_
+
   void Clear();
 };
 
@@ -536,6 +536,28 @@ void InMemoryUniqueConstraints::RemoveObsoleteEntries(uint64_t const oldest_acti
   }
 }
 
+void InMemoryUniqueConstraints::RemoveDeletedVertices(std::span<Vertex *const> vertices) {
+  for (auto &[label_props, storage] : constraints_) {
+    auto acc = storage.access();
+    for (auto const *vertex : vertices) {
+      auto values = std::invoke([&] {
+        auto const guard = std::shared_lock{vertex->lock};
+        return vertex->properties.ExtractPropertyValues(label_props.second);
+      });
+      if (!values) continue;
+
+      auto const key = Entry{std::move(*values), vertex, 0};
+      for (auto it = acc.find_equal_or_greater(key); it != acc.end();) {
+        if (it->vertex != vertex || it->values != key.values) break;
+        auto next_it = it;
+        ++next_it;
+        acc.remove(*it);
+        it = next_it;
+      }
+    }
+  }
+}
+
 void InMemoryUniqueConstraints::Clear() {
   constraints_.clear();
   constraints_by_label_.clear();
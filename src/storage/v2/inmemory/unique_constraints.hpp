@@ -131,6 +131,10 @@ class InMemoryUniqueConstraints : public UniqueConstraints {
   /// GC method that removes outdated entries from constraints' storages.
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
 
+  /// GC method that removes the entries of deleted vertices which hold their
+  /// current property values, without scanning the constraints' storages.
+  void RemoveDeletedVertices(std::span<Vertex *const> vertices);
+
   void Clear() override;
 
   void DropGraphClearConstraints();
@@ -0,0 +1,85 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/property_columns.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "utils/atomic_utils.hpp"
+
+namespace memgraph::storage {
+
+PropertyColumns::PropertyColumns(std::vector<std::pair<LabelId, PropertyId>> const &columns) {
+  entries_.reserve(columns.size());
+  for (auto const &[label, property] : columns) {
+    if (Contains(label, property)) continue;
+    auto entry = std::make_unique<Entry>();
+    entry->label = label;
+    entry->property = property;
+    entries_.push_back(std::move(entry));
+  }
+}
+
+PropertyColumns::Entry *PropertyColumns::Find(LabelId const label, PropertyId const property) const {
+  auto const it = std::ranges::find_if(
+      entries_, [&](auto const &entry) { return entry->label == label && entry->property == property; });
+  return it == entries_.end() ? nullptr : it->get();
+}
+
+bool PropertyColumns::Contains(LabelId const label, PropertyId const property) const {
+  return Find(label, property) != nullptr;
+}
+
+std::shared_ptr<PropertyColumn const> PropertyColumns::Get(LabelId const label, PropertyId const property,
+                                                           uint64_t const start_timestamp) const {
+  auto *entry = Find(label, property);
+  if (!entry) return nullptr;
+  auto const changed = entry->changed.load(std::memory_order_acquire);
+  if (changed > start_timestamp) return nullptr;
+  return entry->built.WithLock([changed](auto const &built) -> std::shared_ptr<PropertyColumn const> {
+    if (!built.column || changed > built.start_timestamp) return nullptr;
+    return built.column;
+  });
+}
+
+void PropertyColumns::Set(LabelId const label, PropertyId const property, uint64_t const start_timestamp,
+                          std::shared_ptr<PropertyColumn const> column) {
+  auto *entry = Find(label, property);
+  if (!entry) return;
+  entry->built.WithLock([&](auto &built) {
+    if (entry->changed.load(std::memory_order_acquire) > start_timestamp) return;
+    if (built.column && built.start_timestamp > start_timestamp) return;
+    built.start_timestamp = start_timestamp;
+    built.column = std::move(column);
+  });
+}
+
+void PropertyColumns::LabelChanged(LabelId const label, uint64_t const commit_timestamp) {
+  for (auto &entry : entries_) {
+    if (entry->label == label) atomic_fetch_max_explicit(&entry->changed, commit_timestamp + 1);
+  }
+}
+
+void PropertyColumns::PropertyChanged(PropertyId const property, uint64_t const commit_timestamp) {
+  for (auto &entry : entries_) {
+    if (entry->property == property) atomic_fetch_max_explicit(&entry->changed, commit_timestamp + 1);
+  }
+}
+
+void PropertyColumns::Clear(uint64_t const timestamp) {
+  for (auto &entry : entries_) {
+    atomic_fetch_max_explicit(&entry->changed, timestamp);
+    entry->built.WithLock([](auto &built) { built = {}; });
+  }
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,92 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::storage {
+
+/// Values of a property of all vertices with a label, as seen by the
+/// transaction which built the column. Integers and doubles are stored in
+/// dense arrays in the order in which the vertices are returned by
+/// `Vertices(label, view)`, so that analytical scans don't have to decode the
+/// property store of every vertex.
+struct PropertyColumn {
+  // Number of vertices with the label
+  uint64_t vertex_count{0};
+  // Number of non-null values which are neither integers nor doubles
+  uint64_t other_count{0};
+  std::vector<int64_t> ints;
+  std::vector<double> doubles;
+};
+
+/// Columns of the (label, property) pairs configured with
+/// `--storage-columnar-properties`.
+///
+/// A column is built by a transaction which didn't change anything, so it
+/// contains the committed state visible at the start timestamp of that
+/// transaction. Each commit that changes a label or a property of a column
+/// records its commit timestamp. A column can be used by a transaction only if
+/// no such commit happened before the start of either transaction, i.e. both
+/// transactions see the same committed values.
+class PropertyColumns {
+ public:
+  PropertyColumns() = default;
+  explicit PropertyColumns(std::vector<std::pair<LabelId, PropertyId>> const &columns);
+
+  bool empty() const { return entries_.empty(); }
+
+  bool Contains(LabelId label, PropertyId property) const;
+
+  /// Returns the column if it is valid for a transaction with `start_timestamp`.
+  std::shared_ptr<PropertyColumn const> Get(LabelId label, PropertyId property, uint64_t start_timestamp) const;
+
+  /// Stores a column built by a transaction with `start_timestamp`, unless it
+  /// was changed in the meantime.
+  void Set(LabelId label, PropertyId property, uint64_t start_timestamp, std::shared_ptr<PropertyColumn const> column);
+
+  /// Records a commit which changed the label of some vertices.
+  void LabelChanged(LabelId label, uint64_t commit_timestamp);
+
+  /// Records a commit which changed the property of some vertices.
+  void PropertyChanged(PropertyId property, uint64_t commit_timestamp);
+
+  /// Invalidates all columns for transactions that started before `timestamp`
+  /// and drops the stored columns. Used when the data changes without deltas.
+  void Clear(uint64_t timestamp);
+
+ private:
+  struct Entry {
+    LabelId label;
+    PropertyId property;
+    // Commit timestamp + 1 of the last commit which changed the column, 0 if none
+    std::atomic<uint64_t> changed{0};
+    struct Built {
+      uint64_t start_timestamp{0};
+      std::shared_ptr<PropertyColumn const> column;
+    };
+    utils::Synchronized<Built, utils::SpinLock> built;
+  };
+
+  Entry *Find(LabelId label, PropertyId property) const;
+
+  std::vector<std::unique_ptr<Entry>> entries_;
+};
+
+}  // namespace memgraph::storage
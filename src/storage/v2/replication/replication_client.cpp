@@ -12,6 +12,7 @@
 #include "replication/replication_client.hpp"
 
 #include "flags/coord_flag_env_handler.hpp"
+#include "flags/replication.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/replication/enums.hpp"
 #include "storage/v2/replication/recovery.hpp"
@@ -28,11 +29,14 @@
 
 #include <algorithm>
 #include <atomic>
+#include <utility>
 #include "utils/compile_time.hpp"
 
 namespace {
 constexpr auto kHeartbeatRpcTimeout = std::chrono::milliseconds(5000);
 constexpr auto kCommitRpcTimeout = std::chrono::milliseconds(50);
+// Larger transactions aren't kept in memory for an ASYNC replica, the replica is recovered instead
+constexpr uint64_t kMaxBufferedTransactionSize = 64UL * 1024 * 1024;
 
 using memgraph::storage::replication::ReplicaState;
 using namespace std::string_view_literals;
@@ -285,11 +289,12 @@ void ReplicationStorageClient::TryCheckReplicaStateSync(Storage *main_storage, D
 
 // The method which updates replication state machine. Used for all replication modes.
 // If replica is in state RECOVERY -> skip
-// If replica is REPLICATING old txn (ASYNC), set the state to MAYBE_BEHIND
+// If replica is REPLICATING old txn (ASYNC), set the state to MAYBE_BEHIND, or buffer the txn if there is a send queue
 // If replica is MAYBE_BEHIND, skip and asynchronously check the state of the replica
 // If replica is DIVERGED_FROM_MAIN, skip
 // If replica is READY, set it to replicating and create optional stream
 //    If creating stream fails, set the state to MAYBE_BEHIND. RPC lock is taken.
+//    ASYNC replica with a send queue gets a buffered stream, the state is set once the txn is queued.
 auto ReplicationStorageClient::StartTransactionReplication(Storage *storage, DatabaseAccessProtector db_acc,
                                                            bool const commit_immediately,
                                                            uint64_t const durability_commit_timestamp)
@@ -305,6 +310,11 @@ auto ReplicationStorageClient::StartTransactionReplication(Storage *storage, Dat
       return std::nullopt;
     }
     case REPLICATING: {
+      if (QueuesTransactions()) {
+        auto const previous_commit_timestamp =
+            storage->repl_storage_state_.commit_ts_info_.load(std::memory_order_acquire).ldt_;
+        return ReplicaStream(storage, previous_commit_timestamp);
+      }
       spdlog::debug("Replica {} missed a transaction", client_.name_);
       // We missed a transaction because we're still replicating
       // the previous transaction. We will go to MAYBE_BEHIND state so that frequent heartbeat enqueues the recovery
@@ -324,6 +334,11 @@ auto ReplicationStorageClient::StartTransactionReplication(Storage *storage, Dat
       return std::nullopt;
     }
     case READY: {
+      if (QueuesTransactions()) {
+        auto const previous_commit_timestamp =
+            storage->repl_storage_state_.commit_ts_info_.load(std::memory_order_acquire).ldt_;
+        return ReplicaStream(storage, previous_commit_timestamp);
+      }
       try {
         utils::MetricsTimer const replica_stream_timer{metrics::ReplicaStream_us};
         std::optional<rpc::Client::StreamHandler<replication::PrepareCommitRpc>> maybe_stream_handler;
@@ -470,6 +485,11 @@ bool ReplicationStorageClient::FinalizeTransactionReplication(DatabaseAccessProt
   // that this and other transaction replication functions can only be
   // called from a one thread stands)
   utils::MetricsTimer const timer{metrics::FinalizeTxnReplication_us};
+  if (replica_stream && replica_stream->IsBuffered()) {
+    EnqueueTransaction(std::move(db_acc), *replica_stream, durability_commit_timestamp);
+    return true;
+  }
+
   auto const continue_finalize = replica_state_.WithLock([this, &replica_stream](auto &state) mutable {
     spdlog::trace("Finalizing transaction on replica {} in state {}", client_.name_, StateToString(state));
 
@@ -557,6 +577,92 @@ bool ReplicationStorageClient::FinalizeTransactionReplication(DatabaseAccessProt
   return task();
 }
 
+bool ReplicationStorageClient::QueuesTransactions() const {
+  return client_.mode_ == replication_coordination_glue::ReplicationMode::ASYNC &&
+         FLAGS_replication_async_queue_size > 0;
+}
+
+void ReplicationStorageClient::EnqueueTransaction(DatabaseAccessProtector db_acc, ReplicaStream &replica_stream,
+                                                  uint64_t const durability_commit_timestamp) const {
+  auto *main_storage = replica_stream.GetStorage();
+  auto transaction = replica_stream.TakeBuffer(durability_commit_timestamp);
+  bool schedule_shipping{false};
+  replica_state_.WithLock([&](auto &state) {
+    // The replica got behind since the txn started, the recovery will replicate the txn
+    if (state != ReplicaState::READY && state != ReplicaState::REPLICATING) {
+      return;
+    }
+    send_queue_.WithLock([&](auto &queue) {
+      if (!transaction || queue.transactions.size() >= FLAGS_replication_async_queue_size) {
+        spdlog::warn("Send queue of replica {} overflowed, the replica will be recovered.", client_.name_);
+        queue.transactions.clear();
+        state = ReplicaState::MAYBE_BEHIND;
+        return;
+      }
+      queue.transactions.push_back(std::move(*transaction));
+      state = ReplicaState::REPLICATING;
+      schedule_shipping = !std::exchange(queue.shipping, true);
+    });
+  });
+
+  if (schedule_shipping) {
+    client_.thread_pool_.AddTask(
+        [main_storage, gk = std::move(db_acc), this] { this->ShipQueuedTransactions(main_storage); });
+  }
+}
+
+void ReplicationStorageClient::ShipQueuedTransactions(Storage *main_storage) const {
+  while (true) {
+    // Txns committed while the previous batch was shipped make up the next batch
+    std::deque<QueuedTransaction> batch;
+    send_queue_.WithLock([&batch](auto &queue) {
+      batch.swap(queue.transactions);
+      if (batch.empty()) {
+        queue.shipping = false;
+      }
+    });
+    if (batch.empty()) {
+      return;
+    }
+
+    bool shipped{false};
+    try {
+      ReplicaStream stream{main_storage, client_.rpc_client_.Stream<replication::PrepareCommitRpc>(
+                                             main_uuid_, main_storage->uuid(), batch.front().previous_commit_timestamp,
+                                             /*commit_immediately*/ true, batch.back().durability_commit_timestamp,
+                                             batch.size())};
+      auto encoder = stream.encoder();
+      for (auto const &transaction : batch) {
+        encoder.WriteBuffer(transaction.deltas.data(), transaction.deltas.size());
+      }
+      shipped = stream.Finalize().success;
+    } catch (const rpc::RpcFailedException &) {
+      LogRpcFailure();
+    }
+
+    replica_state_.WithLock([&](auto &state) {
+      if (!shipped) {
+        // The replica committed the txns up to the failed one, the recovery continues from there
+        send_queue_.WithLock([](auto &queue) { queue.transactions.clear(); });
+        if (state == ReplicaState::READY || state == ReplicaState::REPLICATING) {
+          state = ReplicaState::MAYBE_BEHIND;
+        }
+        return;
+      }
+
+      auto update_func = [&batch](CommitTsInfo const &commit_ts_info) -> CommitTsInfo {
+        return {.ldt_ = batch.back().durability_commit_timestamp,
+                .num_committed_txns_ = commit_ts_info.num_committed_txns_ + batch.size()};
+      };
+      atomic_struct_update<CommitTsInfo>(commit_ts_info_, std::move(update_func));
+
+      if (state == ReplicaState::REPLICATING && send_queue_.Lock()->transactions.empty()) {
+        state = ReplicaState::READY;
+      }
+    });
+  }
+}
+
 void ReplicationStorageClient::Start(Storage *storage, DatabaseAccessProtector db_acc) {
   spdlog::trace("Replication client started for database \"{}\"", storage->name());
   TryCheckReplicaStateSync(storage, std::move(db_acc));
@@ -784,31 +890,66 @@ auto ReplicationStorageClient::GetNumCommittedTxns() const -> uint64_t {
   return commit_ts_info_.load(std::memory_order_acquire).num_committed_txns_;
 }
 
+////// BufferedTransaction //////
+BufferedTransaction::BufferedTransaction(uint64_t const previous_commit_timestamp)
+    : previous_commit_timestamp{previous_commit_timestamp},
+      builder{[this](const uint8_t *segment, size_t const size, bool const have_more) {
+        if (overflowed) return;
+        // Keep only the data of the segment, the data is framed again when it is written into the RPC stream
+        auto const header_size = sizeof(slk::SegmentSize);
+        auto const footer_size = have_more ? 0 : sizeof(slk::SegmentSize);
+        auto const data_size = size - header_size - footer_size;
+        if (deltas.size() + data_size > kMaxBufferedTransactionSize) {
+          overflowed = true;
+          deltas = {};
+          return;
+        }
+        deltas.insert(deltas.end(), segment + header_size, segment + header_size + data_size);
+      }} {}
+
 ////// ReplicaStream //////
 ReplicaStream::ReplicaStream(Storage *storage, rpc::Client::StreamHandler<replication::PrepareCommitRpc> stream)
     : storage_{storage}, stream_(std::move(stream)) {
-  replication::Encoder encoder{stream_.GetBuilder()};
+  replication::Encoder encoder{stream_->GetBuilder()};
   encoder.WriteString(storage->repl_storage_state_.epoch_.id());
 }
 
+// The epoch isn't buffered, it is written when the queued txns are shipped
+ReplicaStream::ReplicaStream(Storage *storage, uint64_t const previous_commit_timestamp)
+    : storage_{storage}, buffer_{std::make_unique<BufferedTransaction>(previous_commit_timestamp)} {}
+
+auto ReplicaStream::TakeBuffer(uint64_t const durability_commit_timestamp) -> std::optional<QueuedTransaction> {
+  MG_ASSERT(buffer_, "Only a buffered stream can hand over its deltas");
+  auto buffer = std::move(buffer_);
+  if (!buffer->builder.IsEmpty()) {
+    buffer->builder.Finalize();
+  }
+  if (buffer->overflowed) {
+    return std::nullopt;
+  }
+  return QueuedTransaction{.previous_commit_timestamp = buffer->previous_commit_timestamp,
+                           .durability_commit_timestamp = durability_commit_timestamp,
+                           .deltas = std::move(buffer->deltas)};
+}
+
 void ReplicaStream::AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t const final_commit_timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+  replication::Encoder encoder(GetBuilder());
   EncodeDelta(&encoder, storage_->name_id_mapper_.get(), storage_->config_.salient.items, delta, vertex,
               final_commit_timestamp);
 }
 
 auto ReplicaStream::AppendDelta(const Delta &delta, const Edge &edge, uint64_t const final_commit_timestamp) -> void {
-  replication::Encoder encoder(stream_.GetBuilder());
+  replication::Encoder encoder(GetBuilder());
   EncodeDelta(&encoder, storage_->name_id_mapper_.get(), delta, edge, final_commit_timestamp);
 }
 
 void ReplicaStream::AppendTransactionEnd(uint64_t const final_commit_timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+  replication::Encoder encoder(GetBuilder());
   EncodeTransactionEnd(&encoder, final_commit_timestamp);
 }
 
 replication::PrepareCommitRes ReplicaStream::Finalize() {
   utils::MetricsTimer const timer{metrics::PrepareCommitRpc_us};
-  return stream_.SendAndWaitProgress();
+  return stream_->SendAndWaitProgress();
 }
 }  // namespace memgraph::storage
@@ -25,8 +25,11 @@
 #include "utils/uuid.hpp"
 
 #include <concepts>
+#include <deque>
+#include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace memgraph::storage {
 
@@ -36,11 +39,38 @@ struct Edge;
 class Storage;
 class ReplicationStorageClient;
 
+// Committed transaction waiting in the send queue of an ASYNC replica
+struct QueuedTransaction {
+  uint64_t previous_commit_timestamp;
+  uint64_t durability_commit_timestamp;
+  // Encoded deltas, without the SLK segment framing
+  std::vector<uint8_t> deltas;
+};
+
+// Deltas of a transaction being encoded into memory instead of into the RPC stream
+struct BufferedTransaction {
+  explicit BufferedTransaction(uint64_t previous_commit_timestamp);
+  // The builder writes into this object
+  BufferedTransaction(BufferedTransaction const &) = delete;
+  BufferedTransaction &operator=(BufferedTransaction const &) = delete;
+  BufferedTransaction(BufferedTransaction &&) = delete;
+  BufferedTransaction &operator=(BufferedTransaction &&) = delete;
+  ~BufferedTransaction() = default;
+
+  uint64_t previous_commit_timestamp;
+  std::vector<uint8_t> deltas;
+  // Set if the transaction was too large to be kept in memory
+  bool overflowed{false};
+  slk::Builder builder;
+};
+
 // Handler used for transferring the current transaction.
-// You need to acquire the RPC lock before creating ReplicaStream object
+// You need to acquire the RPC lock before creating ReplicaStream object, unless the stream is buffered
 class ReplicaStream {
  public:
   explicit ReplicaStream(Storage *storage, rpc::Client::StreamHandler<replication::PrepareCommitRpc> stream);
+  // Stream which encodes the deltas into memory, doesn't need the RPC lock
+  ReplicaStream(Storage *storage, uint64_t previous_commit_timestamp);
   ReplicaStream(ReplicaStream const &) = delete;
   ReplicaStream &operator=(ReplicaStream const &) = delete;
   ReplicaStream(ReplicaStream &&) = default;
@@ -59,15 +89,28 @@ class ReplicaStream {
   /// @throw rpc::RpcFailedException
   replication::PrepareCommitRes Finalize();
 
-  bool IsDefunct() const { return stream_.IsDefunct(); }
+  bool IsDefunct() const { return stream_ && stream_->IsDefunct(); }
 
-  auto encoder() -> replication::Encoder { return replication::Encoder{stream_.GetBuilder()}; }
+  bool IsBuffered() const { return buffer_ != nullptr; }
 
-  auto GetStreamHandler() -> rpc::Client::StreamHandler<replication::PrepareCommitRpc> && { return std::move(stream_); }
+  /// Finishes the encoding of a buffered stream and hands over its deltas,
+  /// nullopt if the transaction was too large to be kept in memory.
+  auto TakeBuffer(uint64_t durability_commit_timestamp) -> std::optional<QueuedTransaction>;
+
+  auto encoder() -> replication::Encoder { return replication::Encoder{GetBuilder()}; }
+
+  auto GetStorage() const -> Storage * { return storage_; }
+
+  auto GetStreamHandler() -> rpc::Client::StreamHandler<replication::PrepareCommitRpc> && {
+    return std::move(*stream_);
+  }
 
  private:
+  slk::Builder *GetBuilder() { return stream_ ? stream_->GetBuilder() : &buffer_->builder; }
+
   Storage *storage_;
-  rpc::Client::StreamHandler<replication::PrepareCommitRpc> stream_;
+  std::optional<rpc::Client::StreamHandler<replication::PrepareCommitRpc>> stream_;
+  std::unique_ptr<BufferedTransaction> buffer_;
 };
 
 class ReplicaStreamExecutor {
@@ -136,6 +179,11 @@ class ReplicationStorageClient {
   // StartTransactionReplication, stream is created.
   template <InvocableWithStream F>
   void IfStreamingTransaction(F &&callback, std::optional<ReplicaStream> &replica_stream) {
+    // Buffered streams don't depend on the replica, they are queued or dropped when the transaction finishes
+    if (replica_stream && replica_stream->IsBuffered()) {
+      callback(*replica_stream);
+      return;
+    }
     // We can only check the state because it guarantees to be only
     // valid during a single transaction replication (if the assumption
     // that this and other transaction replication functions can only be
@@ -233,9 +281,41 @@ class ReplicationStorageClient {
    */
   void TryCheckReplicaStateSync(Storage *main_storage, DatabaseAccessProtector db_acc);
 
+  /**
+   * @brief Whether the transactions of an ASYNC replica are buffered and shipped from the send queue
+   */
+  bool QueuesTransactions() const;
+
+  /**
+   * @brief Put the transaction of a buffered stream into the send queue and make sure it gets shipped.
+   * If the queue overflows, the queued transactions are dropped and the replica is left to the recovery.
+   *
+   * @param db_acc gatekeeper access that protects the database; std::any to have separation between dbms and storage
+   * @param replica_stream buffered stream of the transaction
+   * @param durability_commit_timestamp
+   */
+  void EnqueueTransaction(DatabaseAccessProtector db_acc, ReplicaStream &replica_stream,
+                          uint64_t durability_commit_timestamp) const;
+
+  /**
+   * @brief Ship the queued transactions until the send queue is empty. All of the transactions queued at the time
+   * are shipped in a single PrepareCommitRpc. Executed on the thread pool of the client.
+   *
+   * @param main_storage pointer to the storage associated with the client
+   */
+  void ShipQueuedTransactions(Storage *main_storage) const;
+
+  struct SendQueue {
+    std::deque<QueuedTransaction> transactions;
+    // Set while a task shipping the queue is scheduled on the thread pool
+    bool shipping{false};
+  };
+
   ::memgraph::replication::ReplicationClient &client_;
+  // Lock order: replica_state_ before send_queue_
   mutable utils::Synchronized<replication::ReplicaState, utils::SpinLock> replica_state_{
       replication::ReplicaState::MAYBE_BEHIND};
+  mutable utils::Synchronized<SendQueue, utils::SpinLock> send_queue_;
   mutable std::atomic<CommitTsInfo> commit_ts_info_;
   const utils::UUID main_uuid_;
 };
@@ -11,78 +11,128 @@
 
 #include "storage/v2/replication/replication_transaction.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <ranges>
+#include <thread>
+
+#include "utils/spin_lock.hpp"
+
 namespace memgraph::storage {
 
+namespace {
+
+// Calls `func(index)` for each of the indices, all but the last one on their
+// own threads, and returns once all of the calls finished. Used for the replicas
+// which are waited for, so a commit waits for the slowest of them instead of
+// the sum of their round trips. Every call is bounded by the timeout of its RPC.
+// An exception of any of the calls is rethrown after all of them finished.
+template <typename TFunc>
+void ForEachConcurrently(std::vector<size_t> const &indices, TFunc const &func) {
+  if (indices.empty()) return;
+  auto maybe_error = utils::Synchronized<std::exception_ptr, utils::SpinLock>{};
+  auto const guarded_func = [&](size_t const index) {
+    try {
+      func(index);
+    } catch (...) {
+      auto error = maybe_error.Lock();
+      if (!*error) *error = std::current_exception();
+    }
+  };
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(indices.size() - 1);
+    for (auto const index : indices | std::views::take(indices.size() - 1)) {
+      threads.emplace_back(guarded_func, index);
+    }
+    guarded_func(indices.back());
+  }
+  if (auto error = *maybe_error.Lock()) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace
+
 // For all replicas, we append transaction end
 // When handling STRICT_SYNC replica, we send deltas as part of the 1st phase of the 2PC protocol and wait for the
 // response.
 // When handling some other type of replica, it is checked whether there is another STRICT_SYNC replica. There are 2
 // possible cluster combinations: STRICT_SYNC and ASYNC or SYNC and ASYNC. If there are no STRICT_SYNC replicas in the
 // cluster, we send all deltas and commit immediately on replicas.
+// The replicas whose responses are waited for are finalized concurrently.
 auto TransactionReplication::ShipDeltas(uint64_t durability_commit_timestamp, DatabaseAccessProtector db_acc) -> bool {
-  bool success{true};
   MG_ASSERT(locked_clients->empty() || db_acc.has_value(),
             "Any clients assumes we are MAIN, we should have gatekeeper_access_wrapper so we can correctly "
             "handle ASYNC tasks");
 
   bool const should_run_2pc = ShouldRunTwoPC();
-  for (auto &&[client, replica_stream] : ranges::views::zip(*locked_clients, streams)) {
+  auto &clients = *locked_clients;
+  // Replicas whose responses are waited for
+  std::vector<size_t> waited_replicas;
+  for (size_t i = 0; i < clients.size(); ++i) {
+    auto &client = clients[i];
+    auto &replica_stream = streams[i];
     client->IfStreamingTransaction([&](auto &stream) { stream.AppendTransactionEnd(durability_commit_timestamp); },
                                    replica_stream);
-    // NOLINTNEXTLINE
-    auto const finalized = std::invoke([&]() -> bool {
-      // If I am STRICT SYNC replica, ship deltas as part of the 1st phase and preserve replica stream.
-      // NOLINTNEXTLINE
-      if (client->Mode() == replication_coordination_glue::ReplicationMode::STRICT_SYNC) {
-        // NOLINTNEXTLINE
-        return client->FinalizePrepareCommitPhase(db_acc, replica_stream, durability_commit_timestamp);
-      }
-      // If there are no STRICT_SYNC replicas, shipping deltas means finalizing the transaction
-      // RPC stream gets destroyed => RPC lock released.
-      if (!should_run_2pc) {
-        // NOLINTNEXTLINE
-        bool const res =
-            client->FinalizeTransactionReplication(db_acc, std::move(replica_stream), durability_commit_timestamp);
-        // Even if fails, we don't care, it's ASYNC
-        if (client->Mode() == replication_coordination_glue::ReplicationMode::ASYNC) {
-          return true;
-        }
-        return res;
-      }
-      // If ASYNC replica which is part of 2PC, just skip this
-      // SYNC replica cannot be part of 2PC
-      return true;
-    });
-
-    success &= finalized;
+    auto const mode = client->Mode();
+    if (mode == replication_coordination_glue::ReplicationMode::STRICT_SYNC ||
+        (mode == replication_coordination_glue::ReplicationMode::SYNC && !should_run_2pc)) {
+      waited_replicas.push_back(i);
+    } else if (mode == replication_coordination_glue::ReplicationMode::ASYNC && !should_run_2pc) {
+      // The ASYNC replica is finalized on the thread pool of its client. Even if it fails, we don't care, it's ASYNC
+      client->FinalizeTransactionReplication(db_acc, std::move(replica_stream), durability_commit_timestamp);
+    }
+    // If ASYNC replica which is part of 2PC, just skip this
+    // SYNC replica cannot be part of 2PC
   }
-  return success;
+
+  // Not std::vector<bool>, the elements are written from different threads
+  std::vector<uint8_t> finalized(clients.size(), 1);
+  ForEachConcurrently(waited_replicas, [&](size_t const i) {
+    auto &client = clients[i];
+    // If I am STRICT SYNC replica, ship deltas as part of the 1st phase and preserve replica stream.
+    if (client->Mode() == replication_coordination_glue::ReplicationMode::STRICT_SYNC) {
+      finalized[i] = client->FinalizePrepareCommitPhase(db_acc, streams[i], durability_commit_timestamp);
+      return;
+    }
+    // If there are no STRICT_SYNC replicas, shipping deltas means finalizing the transaction
+    // RPC stream gets destroyed => RPC lock released.
+    finalized[i] = client->FinalizeTransactionReplication(db_acc, std::move(streams[i]), durability_commit_timestamp);
+  });
+  return std::ranges::all_of(finalized, [](auto const replica_finalized) { return replica_finalized != 0; });
 }
 
 // RPC locks will get released at the end of this function for all STRICT_SYNC and ASYNC replicas
 // We shouldn't execute this code for SYNC replicas, this is only executed if these replicas are part of STRICT_SYNC
 // cluster
+// The STRICT_SYNC replicas are sent the decision concurrently.
 auto TransactionReplication::FinalizeTransaction(bool const decision, utils::UUID const &storage_uuid,
                                                  DatabaseAccessProtector db_acc,
                                                  uint64_t const durability_commit_timestamp) -> bool {
-  bool strict_sync_replicas_succ{true};
-
-  for (auto &&[client, replica_stream] : ranges::views::zip(*locked_clients, streams)) {
+  auto &clients = *locked_clients;
+  std::vector<size_t> strict_sync_replicas;
+  for (size_t i = 0; i < clients.size(); ++i) {
+    auto &client = clients[i];
     if (client->Mode() == replication_coordination_glue::ReplicationMode::STRICT_SYNC) {
-      auto const commit_res = client->SendFinalizeCommitRpc(decision, storage_uuid, db_acc, durability_commit_timestamp,
-                                                            std::move(replica_stream));
-      strict_sync_replicas_succ &= commit_res;
+      strict_sync_replicas.push_back(i);
     } else if (client->Mode() == replication_coordination_glue::ReplicationMode::ASYNC) {
       if (decision) {
-        client->FinalizeTransactionReplication(db_acc, std::move(replica_stream), durability_commit_timestamp);
-      } else if (replica_stream.has_value()) {
+        client->FinalizeTransactionReplication(db_acc, std::move(streams[i]), durability_commit_timestamp);
+      } else if (streams[i].has_value() && !streams[i]->IsBuffered()) {
         // Reconnect needed because we optimistically prepared PrepareCommitReq message already.
-        // We should only do this if we own the RPC lock.
+        // We should only do this if we own the RPC lock. Buffered txn is just dropped.
         client->AbortRpcClient();
       }
     }
   }
-  return strict_sync_replicas_succ;
+
+  std::vector<uint8_t> committed(clients.size(), 1);
+  ForEachConcurrently(strict_sync_replicas, [&](size_t const i) {
+    committed[i] = clients[i]->SendFinalizeCommitRpc(decision, storage_uuid, db_acc, durability_commit_timestamp,
+                                                     std::move(streams[i]));
+  });
+  return std::ranges::all_of(committed, [](auto const replica_committed) { return replica_committed != 0; });
 }
 
 auto TransactionReplication::ShouldRunTwoPC() const -> bool {
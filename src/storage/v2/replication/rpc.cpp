@@ -238,6 +238,7 @@ void Save(const memgraph::storage::replication::PrepareCommitReq &self, memgraph
   slk::Save(self.previous_commit_timestamp, builder);
   slk::Save(self.commit_immediately, builder);
   slk::Save(self.durability_commit_timestamp, builder);
+  slk::Save(self.num_txns, builder);
 }
 
 void Load(memgraph::storage::replication::PrepareCommitReq *self, memgraph::slk::Reader *reader) {
@@ -246,6 +247,7 @@ void Load(memgraph::storage::replication::PrepareCommitReq *self, memgraph::slk:
   slk::Load(&self->previous_commit_timestamp, reader);
   slk::Load(&self->commit_immediately, reader);
   slk::Load(&self->durability_commit_timestamp, reader);
+  slk::Load(&self->num_txns, reader);
 }
 
 // Serialize code for FinalizeCommitRes
@@ -68,18 +68,21 @@ struct PrepareCommitReq {
   PrepareCommitReq() = default;
   PrepareCommitReq(const utils::UUID &main_uuid_arg, const utils::UUID &storage_uuid_arg,
                    uint64_t const previous_commit_timestamp_arg, bool const commit_immediately_arg,
-                   uint64_t const durability_commit_timestamp_arg)
+                   uint64_t const durability_commit_timestamp_arg, uint64_t const num_txns_arg = 1)
       : main_uuid{main_uuid_arg},
         storage_uuid{storage_uuid_arg},
         previous_commit_timestamp(previous_commit_timestamp_arg),
         commit_immediately(commit_immediately_arg),
-        durability_commit_timestamp(durability_commit_timestamp_arg) {}
+        durability_commit_timestamp(durability_commit_timestamp_arg),
+        num_txns(num_txns_arg) {}
 
   utils::UUID main_uuid;
   utils::UUID storage_uuid;
   uint64_t previous_commit_timestamp;
   bool commit_immediately;
   uint64_t durability_commit_timestamp;
+  // Number of transactions whose deltas follow, more than one only for the queued transactions of an ASYNC replica
+  uint64_t num_txns{1};
 };
 
 struct PrepareCommitRes {
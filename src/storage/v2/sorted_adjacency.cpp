@@ -0,0 +1,18 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/sorted_adjacency.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_sorted_adjacency_threshold, 0,
+              "Keep the edges of vertices with at least this many in or out edges sorted by edge type and the other "
+              "vertex, so that expanding over an edge type and finding the edges between two vertices doesn't scan "
+              "all of the vertex's edges. 0 disables it.");
@@ -0,0 +1,115 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+#include <gflags/gflags.h>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/small_vector.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(storage_sorted_adjacency_threshold);
+
+namespace memgraph::storage {
+
+/// Adjacency lists of high degree vertices are kept sorted by edge type and by
+/// the other vertex within the edge type. Such a list is made of one group of
+/// edges per edge type, so the edges of a type and the edges between two
+/// vertices can be found with a binary search instead of a scan.
+///
+/// A list is sorted once its size reaches `--storage-sorted-adjacency-threshold`
+/// and stays sorted afterwards. Whether a list is sorted is tracked by
+/// `Vertex::in_edges_sorted` and `Vertex::out_edges_sorted`. All of the
+/// functions have to be called while holding the vertex lock.
+using Adjacency = utils::small_vector<Vertex::EdgeTriple>;
+
+inline auto AdjacencyKey(Vertex::EdgeTriple const &edge) {
+  return std::pair{std::get<kEdgeTypeIdPos>(edge), std::get<kVertexPos>(edge)};
+}
+
+inline EdgeTypeId AdjacencyEdgeType(Vertex::EdgeTriple const &edge) { return std::get<kEdgeTypeIdPos>(edge); }
+
+/// Sorts `edges` if they aren't sorted yet and there are enough of them.
+inline void SortAdjacencyIfNeeded(Adjacency &edges, bool &sorted) {
+  if (sorted) return;
+  auto const threshold = FLAGS_storage_sorted_adjacency_threshold;
+  if (threshold == 0 || edges.size() < threshold) return;
+  std::ranges::sort(edges, {}, AdjacencyKey);
+  sorted = true;
+}
+
+/// Sorts `edges` again after edges were appended to them with `push_back`.
+/// Cheaper than adding each of many edges with `AddAdjacentEdge`.
+inline void RestoreAdjacencyOrder(Adjacency &edges, bool &sorted) {
+  if (!sorted) {
+    SortAdjacencyIfNeeded(edges, sorted);
+    return;
+  }
+  std::ranges::sort(edges, {}, AdjacencyKey);
+}
+
+/// Appends the edge, or inserts it at its place if `edges` are sorted.
+inline void AddAdjacentEdge(Adjacency &edges, bool &sorted, Vertex::EdgeTriple const &edge) {
+  edges.push_back(edge);
+  if (!sorted) {
+    SortAdjacencyIfNeeded(edges, sorted);
+    return;
+  }
+  auto const last = std::prev(edges.end());
+  auto const pos = std::ranges::upper_bound(edges.begin(), last, AdjacencyKey(edge), {}, AdjacencyKey);
+  std::rotate(pos, last, edges.end());
+}
+
+/// Edges of the given type. `edges` have to be sorted.
+inline auto AdjacentEdges(Adjacency const &edges, EdgeTypeId const edge_type) {
+  return std::ranges::equal_range(edges, edge_type, {}, AdjacencyEdgeType);
+}
+
+/// Edges of the given type to or from `other_vertex`. `edges` have to be sorted.
+inline auto AdjacentEdges(Adjacency const &edges, EdgeTypeId const edge_type, Vertex *other_vertex) {
+  return std::ranges::equal_range(edges, std::pair{edge_type, other_vertex}, {}, AdjacencyKey);
+}
+
+/// Removes the edge, returns false if it isn't in `edges`. The order of the
+/// remaining edges is kept only if they are sorted.
+inline bool RemoveAdjacentEdge(Adjacency &edges, bool const sorted, Vertex::EdgeTriple const &edge) {
+  if (sorted) {
+    auto const matching = AdjacentEdges(edges, std::get<kEdgeTypeIdPos>(edge), std::get<kVertexPos>(edge));
+    auto const it = std::ranges::find(matching, edge);
+    if (it == matching.end()) return false;
+    edges.erase(it);
+    return true;
+  }
+  auto const it = std::ranges::find(edges, edge);
+  if (it == edges.end()) return false;
+  std::swap(*it, edges.back());
+  edges.pop_back();
+  return true;
+}
+
+/// Moves the edges for which `pred` is false to the end of `edges` and returns
+/// the first of them. The order of the kept edges is preserved if `edges` are
+/// sorted.
+template <typename TPred>
+auto PartitionAdjacency(Adjacency &edges, bool const sorted, TPred &&pred) {
+  if (sorted) return std::stable_partition(edges.begin(), edges.end(), std::forward<TPred>(pred));
+  return std::partition(edges.begin(), edges.end(), std::forward<TPred>(pred));
+}
+
+}  // namespace memgraph::storage
@@ -21,6 +21,7 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/text_index_utils.hpp"
 #include "storage/v2/schema_info_glue.hpp"
+#include "storage/v2/sorted_adjacency.hpp"
 #include "storage/v2/storage.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex.hpp"
@@ -573,12 +574,13 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
     if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
     MG_ASSERT(!vertex_ptr->deleted, "Invalid database state!");
 
-    auto mid = std::partition(
-        edges_attached_to_vertex->begin(), edges_attached_to_vertex->end(), [this, &set_for_erasure](auto &edge) {
-          auto const &[edge_type, opposing_vertex, edge_ref] = edge;
-          auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
-          return !set_for_erasure.contains(edge_gid);
-        });
+    bool const edges_sorted = edges_attached_to_vertex == &vertex_ptr->in_edges ? vertex_ptr->in_edges_sorted
+                                                                                  : vertex_ptr->out_edges_sorted;
+    auto mid = PartitionAdjacency(*edges_attached_to_vertex, edges_sorted, [this, &set_for_erasure](auto &edge) {
+      auto const &[edge_type, opposing_vertex, edge_ref] = edge;
+      auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
+      return !set_for_erasure.contains(edge_gid);
+    });
 
     // Creating deltas and erasing edge only at the end -> we might have incomplete state as
     // delta might cause OOM, so we don't remove edges from edges_attached_to_vertex
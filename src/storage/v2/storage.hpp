@@ -18,15 +18,18 @@
 #include "storage/v2/database_access.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/edges_iterable.hpp"
+#include "storage/v2/graph_projection.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/indices.hpp"
 #include "storage/v2/indices/text_index_utils.hpp"
 #include "storage/v2/isolation_level.hpp"
+#include "storage/v2/property_columns.hpp"
 #include "storage/v2/replication/enums.hpp"
 #include "storage/v2/replication/replication_client.hpp"
 #include "storage/v2/replication/replication_storage_state.hpp"
 #include "storage/v2/storage_error.hpp"
 #include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/vertices_chunked_iterable.hpp"
 #include "storage/v2/vertices_iterable.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/resource_lock.hpp"
@@ -266,6 +269,12 @@ class Storage {
                       view);
     };
 
+    /// Same as `Vertices`, but split into (at most) `num_chunks` chunks which
+    /// can be scanned concurrently.
+    virtual VerticesChunkedIterable ChunkedVertices(View view, size_t num_chunks) = 0;
+
+    virtual VerticesChunkedIterable ChunkedVertices(LabelId label, View view, size_t num_chunks) = 0;
+
     virtual std::optional<EdgeAccessor> FindEdge(Gid gid, View view) = 0;
 
     virtual EdgesIterable Edges(EdgeTypeId edge_type, View view) = 0;
@@ -305,6 +314,20 @@ class Storage {
     virtual uint64_t ApproximateVertexCount(LabelId label, std::span<PropertyPath const> properties,
                                             std::span<PropertyValueRange const> bounds) const = 0;
 
+    /// Returns the values of `property` of all vertices with `label` if the
+    /// pair is configured as columnar and the column can be used by this
+    /// transaction, nullptr otherwise.
+    virtual std::shared_ptr<PropertyColumn const> GetPropertyColumn(LabelId /*label*/, PropertyId /*property*/) {
+      return nullptr;
+    }
+
+    /// Returns the CSR projection of the part of the graph selected by
+    /// `filter`, nullptr if the storage can't build one.
+    virtual std::shared_ptr<GraphProjection const> GetGraphProjection(GraphProjectionFilter const & /*filter*/,
+                                                                      View /*view*/) {
+      return nullptr;
+    }
+
     virtual uint64_t ApproximateEdgeCount() const = 0;
 
     virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type) const = 0;
@@ -182,6 +182,12 @@ struct Transaction {
   // Used to speedup getting info about a vertex when there is a long delta
   // chain involved in rebuilding that info.
   mutable VertexInfoCache manyDeltasCache{};
+  /// The cache to read through on the calling thread: `manyDeltasCache`, unless the thread reads in parallel with the
+  /// transaction and has a cache of its own (see `ThreadVertexInfoCache`)
+  VertexInfoCache &ManyDeltasCache() const {
+    if (auto *cache = ThreadVertexInfoCache::Current()) return *cache;
+    return manyDeltasCache;
+  }
   mutable std::optional<ConstraintVerificationInfo> constraint_verification_info{};
 
   // Store modified edges GID mapped to changed Delta and serialized edge key
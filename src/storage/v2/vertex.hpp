@@ -46,8 +46,10 @@ struct Vertex {
   PropertyStore properties;
   mutable utils::RWSpinLock lock;
   bool deleted;
+  // Whether `in_edges` and `out_edges` are sorted, see `sorted_adjacency.hpp`
+  bool in_edges_sorted{false};
+  bool out_edges_sorted{false};
   // uint8_t PAD;
-  // uint16_t PAD;
 
   Delta *delta;
 };
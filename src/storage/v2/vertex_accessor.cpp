@@ -25,12 +25,14 @@
 #include "storage/v2/edge.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/edge_direction.hpp"
+#include "storage/v2/edges_range.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/result.hpp"
 #include "storage/v2/schema_info.hpp"
 #include "storage/v2/schema_info_glue.hpp"
+#include "storage/v2/sorted_adjacency.hpp"
 #include "storage/v2/storage.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex_info_cache.hpp"
@@ -74,7 +76,7 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
     auto const useCache = transaction->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
 
     if (useCache) {
-      auto const &cache = transaction->manyDeltasCache;
+      auto const &cache = transaction->ManyDeltasCache();
       auto existsRes = cache.GetExists(view, vertex);
       auto deletedRes = cache.GetDeleted(view, vertex);
       if (existsRes && deletedRes) return {*existsRes, *deletedRes};
@@ -90,7 +92,7 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
     });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction->manyDeltasCache;
+      auto &cache = transaction->ManyDeltasCache();
       cache.StoreExists(view, vertex, exists);
       cache.StoreDeleted(view, vertex, deleted);
     }
@@ -269,7 +271,7 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction_->manyDeltasCache;
+      auto const &cache = transaction_->ManyDeltasCache();
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resLabel = cache.GetHasLabel(view, vertex_, label); resLabel) return {resLabel.value()};
     }
@@ -285,7 +287,7 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
     });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction_->manyDeltasCache;
+      auto &cache = transaction_->ManyDeltasCache();
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreHasLabel(view, vertex_, label, has_label);
@@ -316,7 +318,7 @@ Result<utils::small_vector<LabelId>> VertexAccessor::Labels(View view) const {
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction_->manyDeltasCache;
+      auto const &cache = transaction_->ManyDeltasCache();
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resLabels = cache.GetLabels(view, vertex_); resLabels) return {*resLabels};
     }
@@ -332,7 +334,7 @@ Result<utils::small_vector<LabelId>> VertexAccessor::Labels(View view) const {
     });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction_->manyDeltasCache;
+      auto &cache = transaction_->ManyDeltasCache();
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreLabels(view, vertex_, labels);
@@ -586,7 +588,7 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction_->manyDeltasCache;
+      auto const &cache = transaction_->ManyDeltasCache();
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resProperty = cache.GetProperty(view, vertex_, property); resProperty) return {*resProperty};
     }
@@ -603,7 +605,7 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
         });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction_->manyDeltasCache;
+      auto &cache = transaction_->ManyDeltasCache();
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreProperty(view, vertex_, property, value);
@@ -654,7 +656,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction_->manyDeltasCache;
+      auto const &cache = transaction_->ManyDeltasCache();
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resProperties = cache.GetProperties(view, vertex_); resProperties) return {*resProperties};
     }
@@ -671,7 +673,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
         });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction_->manyDeltasCache;
+      auto &cache = transaction_->ManyDeltasCache();
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreProperties(view, vertex_, properties);
@@ -712,7 +714,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::PropertiesByProperty
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction_->manyDeltasCache;
+      auto const &cache = transaction_->ManyDeltasCache();
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       // Note: We don't have specific cache for properties by IDs, so we skip caching for now
     }
@@ -729,7 +731,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::PropertiesByProperty
         });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction_->manyDeltasCache;
+      auto &cache = transaction_->ManyDeltasCache();
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       // Note: We don't cache this specific subset of properties for now
@@ -793,6 +795,15 @@ auto VertexAccessor::BuildResultWithDisk(edge_store const &in_memory_edges, std:
 Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::vector<EdgeTypeId> &edge_types,
                                                           const VertexAccessor *destination,
                                                           query::HopsLimit *hops_limit) const {
+  auto maybe_edges = InEdgesRange(view, edge_types, destination, hops_limit);
+  if (maybe_edges.HasError()) return maybe_edges.GetError();
+  auto const expanded_count = maybe_edges->expanded_count;
+  return EdgesVertexAccessorResult{.edges = std::move(maybe_edges->edges).ToVector(), .expanded_count = expanded_count};
+}
+
+Result<EdgesVertexAccessorRange> VertexAccessor::InEdgesRange(View view, const std::vector<EdgeTypeId> &edge_types,
+                                                              const VertexAccessor *destination,
+                                                              query::HopsLimit *hops_limit) const {
   DMG_ASSERT(!destination || destination->transaction_ == transaction_, "Invalid accessor!");
 
   std::vector<EdgeAccessor> disk_edges{};
@@ -808,7 +819,8 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
 
     disk_edges = disk_storage->InEdges(this, edge_types, destination, transaction_, view, hops_limit);
     if (view == View::OLD && !edges_modified_in_tx) {
-      return EdgesVertexAccessorResult{.edges = disk_edges, .expanded_count = static_cast<int64_t>(disk_edges.size())};
+      auto const disk_edges_count = static_cast<int64_t>(disk_edges.size());
+      return EdgesVertexAccessorRange{.edges = EdgesRange{std::move(disk_edges)}, .expanded_count = disk_edges_count};
     }
   }
 
@@ -837,10 +849,12 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction_->manyDeltasCache;
+      auto const &cache = transaction_->ManyDeltasCache();
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resInEdges = cache.GetInEdges(view, vertex_, destination_vertex, edge_types); resInEdges)
-        return EdgesVertexAccessorResult{.edges = BuildResultInEdges(*resInEdges), .expanded_count = expanded_count};
+        return EdgesVertexAccessorRange{
+            .edges = EdgesRange{resInEdges->get(), EdgeDirection::IN, vertex_, storage_, transaction_},
+            .expanded_count = expanded_count};
     }
 
     auto const n_processed = ApplyDeltasForRead(
@@ -856,7 +870,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
         });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction_->manyDeltasCache;
+      auto &cache = transaction_->ManyDeltasCache();
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreInEdges(view, vertex_, destination_vertex, edge_types, in_edges);
@@ -869,16 +883,27 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
     return Error::DELETED_OBJECT;
 
   if (transaction_->IsDiskStorage()) [[unlikely]] {
-    return EdgesVertexAccessorResult{.edges = BuildResultWithDisk(in_edges, disk_edges, view, "IN"),
-                                     .expanded_count = expanded_count};
+    return EdgesVertexAccessorRange{.edges = EdgesRange{BuildResultWithDisk(in_edges, disk_edges, view, "IN")},
+                                    .expanded_count = expanded_count};
   }
 
-  return EdgesVertexAccessorResult{.edges = BuildResultInEdges(in_edges), .expanded_count = expanded_count};
+  return EdgesVertexAccessorRange{
+      .edges = EdgesRange{std::move(in_edges), EdgeDirection::IN, vertex_, storage_, transaction_},
+      .expanded_count = expanded_count};
 }
 
 Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std::vector<EdgeTypeId> &edge_types,
                                                            const VertexAccessor *destination,
                                                            query::HopsLimit *hops_limit) const {
+  auto maybe_edges = OutEdgesRange(view, edge_types, destination, hops_limit);
+  if (maybe_edges.HasError()) return maybe_edges.GetError();
+  auto const expanded_count = maybe_edges->expanded_count;
+  return EdgesVertexAccessorResult{.edges = std::move(maybe_edges->edges).ToVector(), .expanded_count = expanded_count};
+}
+
+Result<EdgesVertexAccessorRange> VertexAccessor::OutEdgesRange(View view, const std::vector<EdgeTypeId> &edge_types,
+                                                               const VertexAccessor *destination,
+                                                               query::HopsLimit *hops_limit) const {
   DMG_ASSERT(!destination || destination->transaction_ == transaction_, "Invalid accessor!");
 
   /// TODO: (andi) I think that here should be another check:
@@ -894,7 +919,8 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
     disk_edges = disk_storage->OutEdges(this, edge_types, destination, transaction_, view, hops_limit);
 
     if (view == View::OLD && !edges_modified_in_tx) {
-      return EdgesVertexAccessorResult{.edges = disk_edges, .expanded_count = static_cast<int64_t>(disk_edges.size())};
+      auto const disk_edges_count = static_cast<int64_t>(disk_edges.size());
+      return EdgesVertexAccessorRange{.edges = EdgesRange{std::move(disk_edges)}, .expanded_count = disk_edges_count};
     }
   }
 
@@ -924,10 +950,12 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction_->manyDeltasCache;
+      auto const &cache = transaction_->ManyDeltasCache();
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resOutEdges = cache.GetOutEdges(view, vertex_, dst_vertex, edge_types); resOutEdges)
-        return EdgesVertexAccessorResult{.edges = BuildResultOutEdges(*resOutEdges), .expanded_count = expanded_count};
+        return EdgesVertexAccessorRange{
+            .edges = EdgesRange{resOutEdges->get(), EdgeDirection::OUT, vertex_, storage_, transaction_},
+            .expanded_count = expanded_count};
     }
 
     auto const n_processed = ApplyDeltasForRead(
@@ -942,7 +970,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
         });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction_->manyDeltasCache;
+      auto &cache = transaction_->ManyDeltasCache();
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreOutEdges(view, vertex_, dst_vertex, edge_types, out_edges);
@@ -955,11 +983,13 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
     return Error::DELETED_OBJECT;
 
   if (transaction_->IsDiskStorage()) [[unlikely]] {
-    return EdgesVertexAccessorResult{.edges = BuildResultWithDisk(out_edges, disk_edges, view, "OUT"),
-                                     .expanded_count = expanded_count};
+    return EdgesVertexAccessorRange{.edges = EdgesRange{BuildResultWithDisk(out_edges, disk_edges, view, "OUT")},
+                                    .expanded_count = expanded_count};
   }
   /// InMemoryStorage
-  return EdgesVertexAccessorResult{.edges = BuildResultOutEdges(out_edges), .expanded_count = expanded_count};
+  return EdgesVertexAccessorRange{
+      .edges = EdgesRange{std::move(out_edges), EdgeDirection::OUT, vertex_, storage_, transaction_},
+      .expanded_count = expanded_count};
 }
 
 Result<size_t> VertexAccessor::InDegree(View view) const {
@@ -990,7 +1020,7 @@ Result<size_t> VertexAccessor::InDegree(View view) const {
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction_->manyDeltasCache;
+      auto const &cache = transaction_->ManyDeltasCache();
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resInDegree = cache.GetInDegree(view, vertex_); resInDegree) return {*resInDegree};
     }
@@ -1007,7 +1037,7 @@ Result<size_t> VertexAccessor::InDegree(View view) const {
         });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction_->manyDeltasCache;
+      auto &cache = transaction_->ManyDeltasCache();
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreInDegree(view, vertex_, degree);
@@ -1046,7 +1076,7 @@ Result<size_t> VertexAccessor::OutDegree(View view) const {
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
     if (useCache) {
-      auto const &cache = transaction_->manyDeltasCache;
+      auto const &cache = transaction_->ManyDeltasCache();
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resOutDegree = cache.GetOutDegree(view, vertex_); resOutDegree) return {*resOutDegree};
     }
@@ -1063,7 +1093,7 @@ Result<size_t> VertexAccessor::OutDegree(View view) const {
         });
 
     if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
-      auto &cache = transaction_->manyDeltasCache;
+      auto &cache = transaction_->ManyDeltasCache();
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreOutDegree(view, vertex_, degree);
@@ -1103,6 +1133,32 @@ int64_t VertexAccessor::HandleExpansionsWithEdgeTypes(edge_store &result_edges,
   const auto &edges = direction == EdgeDirection::IN ? vertex_->in_edges : vertex_->out_edges;
   if (edges.empty()) return 0;
 
+  bool const edges_sorted = direction == EdgeDirection::IN ? vertex_->in_edges_sorted : vertex_->out_edges_sorted;
+  // Hops are counted per scanned edge, not per matching one, so with a hops limit the sorted list is scanned like an
+  // unsorted one. That way the limit stops at the same edge on both paths.
+  if (edges_sorted && !(hops_limit && hops_limit->IsUsed())) {
+    // Only the matching edges are visited.
+    auto const expand = [&](auto const &matching) { std::ranges::copy(matching, std::back_inserter(result_edges)); };
+    auto *const destination_vertex = destination ? destination->vertex_ : nullptr;
+    if (edge_types.empty()) {
+      // Only the destination is given, look it up in the group of each edge type.
+      for (auto it = edges.begin(); it != edges.end();) {
+        auto const edge_type = AdjacencyEdgeType(*it);
+        expand(AdjacentEdges(edges, edge_type, destination_vertex));
+        it = std::ranges::upper_bound(it, edges.end(), edge_type, {}, AdjacencyEdgeType);
+      }
+    } else {
+      for (auto type_it = edge_types.begin(); type_it != edge_types.end(); ++type_it) {
+        // The same edge type could be given more than once
+        if (std::find(edge_types.begin(), type_it, *type_it) != type_it) continue;
+        expand(destination_vertex ? AdjacentEdges(edges, *type_it, destination_vertex)
+                                  : AdjacentEdges(edges, *type_it));
+      }
+    }
+    // The scan below counts every edge of the vertex as expanded.
+    return static_cast<int64_t>(edges.size());
+  }
+
   int64_t expanded_count = 0;
   for (const auto &[edge_type, vertex, edge] : edges) {
     if (hops_limit && hops_limit->IsUsed()) {
@@ -29,6 +29,7 @@ class Storage;
 struct Constraints;
 struct Indices;
 struct EdgesVertexAccessorResult;
+struct EdgesVertexAccessorRange;
 struct Transaction;
 using edge_store = utils::small_vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>>;
 
@@ -121,6 +122,20 @@ class VertexAccessor final {
                                              const VertexAccessor *destination = nullptr,
                                              query::HopsLimit *hops_limit = nullptr) const;
 
+  /// Same as `InEdges`, but the edge accessors are created lazily while the
+  /// returned `EdgesRange` is iterated (see storage/v2/edges_range.hpp).
+  /// @throw std::bad_alloc
+  Result<EdgesVertexAccessorRange> InEdgesRange(View view, const std::vector<EdgeTypeId> &edge_types = {},
+                                                const VertexAccessor *destination = nullptr,
+                                                query::HopsLimit *hops_limit = nullptr) const;
+
+  /// Same as `OutEdges`, but the edge accessors are created lazily while the
+  /// returned `EdgesRange` is iterated (see storage/v2/edges_range.hpp).
+  /// @throw std::bad_alloc
+  Result<EdgesVertexAccessorRange> OutEdgesRange(View view, const std::vector<EdgeTypeId> &edge_types = {},
+                                                 const VertexAccessor *destination = nullptr,
+                                                 query::HopsLimit *hops_limit = nullptr) const;
+
   Result<size_t> InDegree(View view) const;
 
   Result<size_t> OutDegree(View view) const;
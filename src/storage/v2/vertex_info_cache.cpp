@@ -19,6 +19,7 @@
 #include <functional>
 #include <optional>
 #include <span>
+#include <utility>
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(delta_chain_cache_threshold, 128,
@@ -56,6 +57,17 @@ void Store(Value &&value, VertexInfoCache &caches, Func &&getCache, View view, K
   cache.emplace(key_type{std::forward<Keys>(keys)...}, std::forward<Value>(value));
 }
 
+namespace {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local VertexInfoCache *thread_cache = nullptr;
+}  // namespace
+
+ThreadVertexInfoCache::ThreadVertexInfoCache() : previous_{std::exchange(thread_cache, &cache_)} {}
+
+ThreadVertexInfoCache::~ThreadVertexInfoCache() { thread_cache = previous_; }
+
+auto ThreadVertexInfoCache::Current() -> VertexInfoCache * { return thread_cache; }
+
 VertexInfoCache::VertexInfoCache(VertexInfoCache &&) noexcept = default;
 VertexInfoCache &VertexInfoCache::operator=(VertexInfoCache &&) noexcept = default;
 
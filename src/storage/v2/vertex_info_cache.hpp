@@ -168,4 +168,31 @@ struct VertexInfoCache final {
   template <typename Value, typename Func, typename... Keys>
   friend void Store(Value &&value, VertexInfoCache &caches, Func &&getCache, View view, Keys &&...keys);
 };
+
+/** The cache of a transaction isn't synchronized, so threads reading on behalf
+ * of a transaction in parallel with it (e.g. parallel scans and expansions)
+ * can't share it. While such a thread holds a `ThreadVertexInfoCache`, its
+ * reads use this cache instead of the transaction's one (see
+ * `Transaction::ManyDeltasCache`).
+ *
+ * The cache isn't invalidated, so the transaction must not be modified while
+ * the thread holds it.
+ */
+class ThreadVertexInfoCache final {
+ public:
+  ThreadVertexInfoCache();
+  ~ThreadVertexInfoCache();
+
+  ThreadVertexInfoCache(ThreadVertexInfoCache const &) = delete;
+  ThreadVertexInfoCache &operator=(ThreadVertexInfoCache const &) = delete;
+  ThreadVertexInfoCache(ThreadVertexInfoCache &&) = delete;
+  ThreadVertexInfoCache &operator=(ThreadVertexInfoCache &&) = delete;
+
+  /// The cache of the calling thread, nullptr if it doesn't hold one
+  static auto Current() -> VertexInfoCache *;
+
+ private:
+  VertexInfoCache cache_;
+  VertexInfoCache *previous_;
+};
 }  // namespace memgraph::storage
@@ -0,0 +1,83 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <variant>
+
+#include "storage/v2/all_vertices_iterable.hpp"
+#include "storage/v2/inmemory/label_index.hpp"
+
+namespace memgraph::storage {
+
+/// Vertices split into chunks (morsels) which can be scanned by multiple
+/// threads in parallel. Chunks are handed out by index, the caller is
+/// responsible for distributing them between threads.
+class VerticesChunkedIterable final {
+  using Impl = std::variant<AllVerticesChunkedIterable, InMemoryLabelIndex::ChunkedIterable>;
+
+ public:
+  class Iterator final {
+    using ImplIt = std::variant<AllVerticesChunkedIterable::Iterator, InMemoryLabelIndex::ChunkedIterable::Iterator>;
+
+   public:
+    explicit Iterator(ImplIt it) : it_(std::move(it)) {}
+
+    VertexAccessor const &operator*() const {
+      return std::visit([](auto const &it) -> VertexAccessor const & { return *it; }, it_);
+    }
+
+    Iterator &operator++() {
+      std::visit([](auto &it) { ++it; }, it_);
+      return *this;
+    }
+
+    bool operator==(const Iterator &other) const { return it_ == other.it_; }
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+   private:
+    ImplIt it_;
+  };
+
+  class Chunk final {
+    using ImplChunk = std::variant<AllVerticesChunkedIterable::Chunk, InMemoryLabelIndex::ChunkedIterable::Chunk>;
+
+   public:
+    explicit Chunk(ImplChunk chunk) : chunk_(std::move(chunk)) {}
+
+    Iterator begin() {
+      return std::visit([](auto &chunk) { return Iterator{chunk.begin()}; }, chunk_);
+    }
+    Iterator end() {
+      return std::visit([](auto &chunk) { return Iterator{chunk.end()}; }, chunk_);
+    }
+
+   private:
+    ImplChunk chunk_;
+  };
+
+  explicit VerticesChunkedIterable(AllVerticesChunkedIterable impl) : impl_(std::move(impl)) {}
+  explicit VerticesChunkedIterable(InMemoryLabelIndex::ChunkedIterable impl) : impl_(std::move(impl)) {}
+
+  size_t size() const {
+    return std::visit([](auto const &impl) { return impl.size(); }, impl_);
+  }
+
+  /// Thread-safe; returns the chunk with the given index (0 <= id < size()).
+  Chunk get_chunk(size_t id) {
+    return std::visit([id](auto &impl) { return Chunk{impl.get_chunk(id)}; }, impl_);
+  }
+
+ private:
+  Impl impl_;
+};
+
+}  // namespace memgraph::storage
@@ -45,9 +45,11 @@ bool ValidStoragePropertyStoreCompressionLevel(std::string_view value) {
 }
 
 utils::CompressionLevel ParseCompressionLevel() {
-  return memgraph::utils::StringToEnum<utils::CompressionLevel>(FLAGS_storage_property_store_compression_level,
-                                                                compression_level_mappings)
-      .value();
+  return ParseCompressionLevel(FLAGS_storage_property_store_compression_level);
+}
+
+utils::CompressionLevel ParseCompressionLevel(std::string_view value) {
+  return memgraph::utils::StringToEnum<utils::CompressionLevel>(value, compression_level_mappings).value();
 }
 
 }  // namespace memgraph::flags
@@ -79,6 +81,11 @@ std::string_view CompressionLevelToString(CompressionLevel level) {
 }
 
 auto ZlibCompressor::Compress(std::span<uint8_t const> uncompressed_data) const -> std::optional<CompressedBuffer> {
+  return Compress(uncompressed_data, memgraph::flags::ParseCompressionLevel());
+}
+
+auto ZlibCompressor::Compress(std::span<uint8_t const> uncompressed_data, CompressionLevel level) const
+    -> std::optional<CompressedBuffer> {
   if (uncompressed_data.empty()) {
     return CompressedBuffer{nullptr, 0, 0};
   }
@@ -95,8 +102,7 @@ auto ZlibCompressor::Compress(std::span<uint8_t const> uncompressed_data) const
   auto const buffer_size = static_cast<uint32_t>(compress_bound);
   auto compressed_data = std::make_unique<uint8_t[]>(buffer_size);
 
-  auto compression_level =
-      CompressionLevelToZlibCompressionLevel(static_cast<CompressionLevel>(memgraph::flags::ParseCompressionLevel()));
+  auto compression_level = CompressionLevelToZlibCompressionLevel(level);
 
   auto actual_size = compress_bound;
   const int result =
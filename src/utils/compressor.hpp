@@ -41,6 +41,7 @@ inline const std::string storage_property_store_compression_level_help_string =
 
 bool ValidStoragePropertyStoreCompressionLevel(std::string_view value);
 utils::CompressionLevel ParseCompressionLevel();
+utils::CompressionLevel ParseCompressionLevel(std::string_view value);
 }  // namespace memgraph::flags
 
 namespace memgraph::utils {
@@ -93,6 +94,9 @@ struct Compressor {
 
   virtual auto Compress(std::span<uint8_t const> uncompressed_data) const -> std::optional<CompressedBuffer> = 0;
 
+  virtual auto Compress(std::span<uint8_t const> uncompressed_data, CompressionLevel level) const
+      -> std::optional<CompressedBuffer> = 0;
+
   virtual auto Decompress(std::span<uint8_t const> compressed_data, uint32_t original_size) const
       -> std::optional<DecompressedBuffer> = 0;
 };
@@ -102,6 +106,9 @@ struct ZlibCompressor : public Compressor {
 
   auto Compress(std::span<uint8_t const> uncompressed_data) const -> std::optional<CompressedBuffer> override;
 
+  auto Compress(std::span<uint8_t const> uncompressed_data, CompressionLevel level) const
+      -> std::optional<CompressedBuffer> override;
+
   auto Decompress(std::span<uint8_t const> compressed_data, uint32_t original_size) const
       -> std::optional<DecompressedBuffer> override;
 };
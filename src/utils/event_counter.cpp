@@ -64,6 +64,7 @@
   M(SkipOperator, Operator, "Number of times Skip operator was used.")                                                 \
   M(LimitOperator, Operator, "Number of times Limit operator was used.")                                               \
   M(OrderByOperator, Operator, "Number of times OrderBy operator was used.")                                           \
+  M(TopKOperator, Operator, "Number of times TopK operator was used.")                                                 \
   M(MergeOperator, Operator, "Number of times Merge operator was used.")                                               \
   M(OptionalOperator, Operator, "Number of times Optional operator was used.")                                         \
   M(UnwindOperator, Operator, "Number of times Unwind operator was used.")                                             \
@@ -79,6 +80,7 @@
   M(RollUpApplyOperator, Operator, "Number of times RollUpApply operator was used.")                                   \
   M(PeriodicCommitOperator, Operator, "Number of times PeriodicCommit operator was used.")                             \
   M(PeriodicSubqueryOperator, Operator, "Number of times PeriodicSubquery operator was used.")                         \
+  M(GatherOperator, Operator, "Number of times Gather operator was used.")                                             \
                                                                                                                        \
   M(ActiveLabelIndices, Index, "Number of active label indices in the system.")                                        \
   M(ActiveLabelPropertyIndices, Index, "Number of active label property indices in the system.")                       \
@@ -12,6 +12,7 @@
 #include "utils/file.hpp"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include <cstdint>
@@ -92,6 +93,7 @@ InputFile::InputFile(InputFile &&other) noexcept
       path_(std::move(other.path_)),
       file_size_(other.file_size_),
       file_position_(other.file_position_),
+      mapping_(other.mapping_),
       buffer_start_(other.buffer_start_),
       buffer_size_(other.buffer_size_),
       buffer_position_(other.buffer_position_) {
@@ -99,6 +101,7 @@ InputFile::InputFile(InputFile &&other) noexcept
   other.fd_ = -1;
   other.file_size_ = 0;
   other.file_position_ = 0;
+  other.mapping_ = nullptr;
   other.buffer_start_ = std::nullopt;
   other.buffer_size_ = 0;
   other.buffer_position_ = 0;
@@ -111,6 +114,7 @@ InputFile &InputFile::operator=(InputFile &&other) noexcept {
   path_ = std::move(other.path_);
   file_size_ = other.file_size_;
   file_position_ = other.file_position_;
+  mapping_ = other.mapping_;
   buffer_start_ = other.buffer_start_;
   buffer_size_ = other.buffer_size_;
   buffer_position_ = other.buffer_position_;
@@ -119,6 +123,7 @@ InputFile &InputFile::operator=(InputFile &&other) noexcept {
   other.fd_ = -1;
   other.file_size_ = 0;
   other.file_position_ = 0;
+  other.mapping_ = nullptr;
   other.buffer_start_ = std::nullopt;
   other.buffer_size_ = 0;
   other.buffer_position_ = 0;
@@ -126,7 +131,7 @@ InputFile &InputFile::operator=(InputFile &&other) noexcept {
   return *this;
 }
 
-bool InputFile::Open(const std::filesystem::path &path) {
+bool InputFile::Open(const std::filesystem::path &path, bool mapped) {
   if (IsOpen()) return false;
 
   path_ = path;
@@ -153,6 +158,17 @@ bool InputFile::Open(const std::filesystem::path &path) {
   }
   file_size_ = *size;
 
+  if (mapped && file_size_ != 0) {
+    auto *mapping = mmap(nullptr, file_size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapping == MAP_FAILED) {
+      Close();
+      return false;
+    }
+    // The file is usually read sequentially from a few offsets, let the kernel read ahead aggressively.
+    madvise(mapping, file_size_, MADV_SEQUENTIAL);
+    mapping_ = static_cast<const uint8_t *>(mapping);
+  }
+
   return true;
 }
 
@@ -161,6 +177,13 @@ bool InputFile::IsOpen() const { return fd_ != -1; }
 const std::filesystem::path &InputFile::path() const { return path_; }
 
 bool InputFile::Read(uint8_t *data, size_t size) {
+  if (mapping_) {
+    if (file_position_ > file_size_ || size > file_size_ - file_position_) return false;
+    memcpy(data, mapping_ + file_position_, size);
+    file_position_ += size;
+    return true;
+  }
+
   uint8_t *write_ptr = data;
   while (size != 0) {
     auto buffer_left = buffer_size_ - buffer_position_;
@@ -179,6 +202,12 @@ bool InputFile::Read(uint8_t *data, size_t size) {
 }
 
 bool InputFile::Peek(uint8_t *data, size_t size) {
+  if (mapping_) {
+    if (file_position_ > file_size_ || size > file_size_ - file_position_) return false;
+    memcpy(data, mapping_ + file_position_, size);
+    return true;
+  }
+
   auto old_buffer_start = buffer_start_;
   auto old_buffer_position = buffer_position_;
   auto real_position = GetPosition();
@@ -205,6 +234,24 @@ size_t InputFile::GetPosition() {
 }
 
 std::optional<size_t> InputFile::SetPosition(Position position, ssize_t offset) {
+  if (mapping_) {
+    // Mapped reads never move the file offset, the position is tracked only in `file_position_`.
+    ssize_t base = 0;
+    switch (position) {
+      case Position::SET:
+        break;
+      case Position::RELATIVE_TO_CURRENT:
+        base = static_cast<ssize_t>(file_position_);
+        break;
+      case Position::RELATIVE_TO_END:
+        base = static_cast<ssize_t>(file_size_);
+        break;
+    }
+    if (offset < -base) return std::nullopt;
+    file_position_ = base + offset;
+    return file_position_;
+  }
+
   int whence;
   switch (position) {
     case Position::SET:
@@ -234,6 +281,14 @@ std::optional<size_t> InputFile::SetPosition(Position position, ssize_t offset)
 void InputFile::Close() noexcept {
   if (!IsOpen()) return;
 
+  if (mapping_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    if (munmap(const_cast<uint8_t *>(mapping_), file_size_) != 0) {
+      spdlog::error("While trying to unmap {} an error occured: {} ({})", path_, strerror(errno), errno);
+    }
+    mapping_ = nullptr;
+  }
+
   int ret = 0;
   while (true) {
     ret = close(fd_);
@@ -97,8 +97,9 @@ class InputFile {
   InputFile &operator=(InputFile &&other) noexcept;
 
   /// This method opens the file used for reading. If the file can't be opened
-  /// or doesn't exist it returns `false`.
-  bool Open(const std::filesystem::path &path);
+  /// or doesn't exist it returns `false`. A `mapped` file is memory-mapped
+  /// and read directly from the page cache instead of through the buffer.
+  bool Open(const std::filesystem::path &path, bool mapped = false);
 
   /// Returns a boolean indicating whether a file is opened.
   bool IsOpen() const;
@@ -140,6 +141,8 @@ class InputFile {
   size_t file_size_{0};
   size_t file_position_{0};
 
+  const uint8_t *mapping_{nullptr};
+
   uint8_t buffer_[kFileBufferSize];
   std::optional<size_t> buffer_start_;
   size_t buffer_size_{0};
@@ -250,6 +253,10 @@ class OutputFile {
   /// Try flushing the internal buffer.
   void TryFlushing();
 
+  /// Writes the internal buffer to the file without syncing it. Waits until
+  /// the flushing is enabled.
+  void FlushBuffer();
+
   /// Get the internal buffer with its current size.
   std::pair<const uint8_t *, size_t> CurrentBuffer() const;
 
@@ -260,7 +267,6 @@ class OutputFile {
   auto fd() const { return fd_; }
 
  private:
-  void FlushBuffer();
   void FlushBufferInternal();
   void FlushBufferInternal(size_t to_write);
 
@@ -0,0 +1,67 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "utils/memory_tracker.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::utils {
+
+/// Calls `func(task)` for each task in [0, task_count) on up to `thread_count`
+/// threads. The tasks are handed out one by one, so the threads which finish
+/// early take over the remaining work. Any exception of a thread (e.g. OOM)
+/// stops the other threads and is rethrown.
+template <typename TFunc>
+void ParallelFor(uint64_t const task_count, uint64_t thread_count, TFunc const &func) {
+  thread_count = std::min(thread_count, task_count);
+  if (thread_count <= 1) {
+    for (uint64_t task = 0; task < task_count; ++task) func(task);
+    return;
+  }
+
+  std::atomic<uint64_t> task_counter = 0;
+  std::atomic<bool> failed = false;
+  auto maybe_error = Synchronized<std::exception_ptr, SpinLock>{};
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count);
+    for (uint64_t i = 0; i < thread_count; ++i) {
+      threads.emplace_back([&]() {
+        try {
+          while (!failed.load(std::memory_order_acquire)) {
+            auto const task = task_counter++;
+            if (task >= task_count) return;
+            func(task);
+          }
+        } catch (...) {
+          MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+          failed.store(true, std::memory_order_release);
+          auto error = maybe_error.Lock();
+          if (!*error) *error = std::current_exception();
+        }
+      });
+    }
+  }
+  if (auto error = *maybe_error.Lock()) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace memgraph::utils
@@ -75,6 +75,10 @@ void QueryMemoryTracker::TryCreateProcTracker(int64_t procedure_id, size_t limit
   it->second.SetHardLimit(static_cast<int64_t>(limit));
 }
 
+int64_t QueryMemoryTracker::Amount() const { return query_tracker_ ? query_tracker_->Amount() : 0; }
+
+int64_t QueryMemoryTracker::HardLimit() const { return query_tracker_ ? query_tracker_->HardLimit() : 0; }
+
 void QueryMemoryTracker::InitializeQueryTracker() { query_tracker_.emplace(); }
 
 }  // namespace memgraph::utils
@@ -60,6 +60,12 @@ class QueryMemoryTracker {
   // Stop procedure tracking
   void StopProcTracking();
 
+  // Memory currently used by the query, 0 if the query has no limit
+  int64_t Amount() const;
+
+  // Query memory limit, 0 if the query has no limit
+  int64_t HardLimit() const;
+
  private:
   static constexpr int64_t NO_PROCEDURE{-1};
   void InitializeQueryTracker();
@@ -18,7 +18,9 @@
 #include "utils/rw_spin_lock.hpp"
 #include "utils/stack.hpp"
 
+#include <bit>
 #include <random>
+#include <vector>
 
 // This code heavily depends on atomic operations. For a more detailed
 // description of how exactly atomic operations work, see:
@@ -725,6 +727,114 @@ class SkipList final : detail::SkipListNode_base {
     SamplingIterator end_;
   };
 
+  /// Builds a run of objects outside of the list and links the whole run into
+  /// the list at once. The objects have to be appended in ascending order, so
+  /// each node is linked in a single pass and gets a deterministic height
+  /// (every 2^k-th node of the run is k + 1 layers high) instead of a random
+  /// height and a search of the whole list. This is much cheaper than
+  /// inserting the objects one by one when loading large amounts of sorted
+  /// data.
+  ///
+  /// The appended objects aren't visible until `link` is called, but their
+  /// addresses are already stable, so they can still be modified. Objects that
+  /// weren't linked are destroyed together with the builder. The builder
+  /// mustn't outlive the accessor that created it.
+  class Builder final {
+   private:
+    friend class SkipList;
+
+    explicit Builder(SkipList *skiplist) : skiplist_(skiplist) {}
+
+   public:
+    ~Builder() { clear(); }
+
+    Builder(const Builder &) = delete;
+    Builder &operator=(const Builder &) = delete;
+    Builder(Builder &&) = delete;
+    Builder &operator=(Builder &&) = delete;
+
+    /// Appends an object to the end of the run.
+    ///
+    /// @return Iterator to the appended item, it is equal to `Iterator{}` when
+    ///         the object isn't greater than the last item of the run
+    Iterator append(const TObj &object) { return append_impl(object); }
+    Iterator append(TObj &&object) { return append_impl(std::move(object)); }
+
+    /// Links the run into the list and starts a new, empty run. Nothing is
+    /// linked if the list already contains an item within the range of the
+    /// run. Runs that don't overlap can be linked concurrently with each other
+    /// and with the other operations on the list.
+    ///
+    /// @return bool indicating whether the run was linked into the list
+    bool link() {
+      if (size_ == 0) return true;
+      if (!skiplist_->link_run(*this)) return false;
+      reset();
+      return true;
+    }
+
+    /// Destroys all objects of the run that weren't linked.
+    void clear() {
+      TNode *curr = firsts_[0];
+      while (curr != nullptr) {
+        TNode *succ = curr->nexts[0].load(std::memory_order_relaxed);
+        size_t bytes = SkipListNodeSize(*curr);
+        curr->~TNode();
+        skiplist_->GetMemoryResource()->deallocate(curr, bytes, SkipListNodeAlign<TObj>());
+        curr = succ;
+      }
+      reset();
+    }
+
+    /// Returns the number of items in the run.
+    uint64_t size() const { return size_; }
+
+   private:
+    template <typename TObjUniv>
+    Iterator append_impl(TObjUniv &&object) {
+      if (size_ != 0 && !(lasts_[0]->obj < object)) return Iterator{nullptr};
+
+      ++size_;
+      const int height = std::min(std::countr_zero(size_) + 1, static_cast<int>(kSkipListMaxHeight));
+      size_t node_bytes = sizeof(TNode) + height * sizeof(std::atomic<TNode *>);
+
+      MemoryResource *memoryResource = skiplist_->GetMemoryResource();
+      void *ptr = memoryResource->allocate(node_bytes, SkipListNodeAlign<TObj>());
+      auto *new_node = static_cast<TNode *>(ptr);
+      Allocator<TNode> allocator(memoryResource);
+      allocator.construct(new_node, height, std::forward<TObjUniv>(object));
+
+      for (int layer = 0; layer < height; ++layer) {
+        new_node->nexts[layer].store(nullptr, std::memory_order_relaxed);
+        if (lasts_[layer] == nullptr) {
+          firsts_[layer] = new_node;
+        } else {
+          lasts_[layer]->nexts[layer].store(new_node, std::memory_order_relaxed);
+        }
+        lasts_[layer] = new_node;
+      }
+      height_ = std::max(height_, height);
+      // The node can't be reached before the run is linked.
+      new_node->fully_linked.store(true, std::memory_order_relaxed);
+      return Iterator{new_node};
+    }
+
+    void reset() {
+      firsts_.fill(nullptr);
+      lasts_.fill(nullptr);
+      size_ = 0;
+      height_ = 0;
+    }
+
+    SkipList *skiplist_;
+    // The first and the last node of the run in each layer
+    std::array<TNode *, kSkipListMaxHeight> firsts_{};
+    std::array<TNode *, kSkipListMaxHeight> lasts_{};
+    uint64_t size_{0};
+    // Height of the tallest node in the run
+    int height_{0};
+  };
+
   class Accessor final {
    private:
     friend class SkipList;
@@ -788,6 +898,10 @@ class SkipList final : detail::SkipListNode_base {
     ///         bool indicates whether the item was inserted into the list
     std::pair<Iterator, bool> insert(TObj &&object) { return skiplist_->insert(std::move(object)); }
 
+    /// Returns a builder for linking runs of sorted objects into the list, see
+    /// `Builder`.
+    Builder builder() { return Builder{skiplist_}; }
+
     /// Checks whether the key exists in the list.
     ///
     /// @return bool indicating whether the item exists
@@ -887,6 +1001,19 @@ class SkipList final : detail::SkipListNode_base {
       return skiplist_->remove(key);
     }
 
+    /// Splits the list into at most `num_chunks` ranges of roughly equal size
+    /// by sampling one of the upper layers of the list. The returned iterators
+    /// point to the first item of every chunk except the first one (which
+    /// starts at `begin()`), so `n` boundaries describe `n + 1` chunks. Items
+    /// that are inserted concurrently can land in any of the chunks.
+    ///
+    /// @return sorted iterators to the first item of chunks 1..n
+    std::vector<Iterator> chunk_boundaries(uint64_t num_chunks) {
+      std::vector<Iterator> ret;
+      for (auto *node : skiplist_->chunk_boundaries(num_chunks)) ret.emplace_back(Iterator{node});
+      return ret;
+    }
+
     /// Returns the number of items contained in the list.
     ///
     /// @return size of the list
@@ -971,6 +1098,12 @@ class SkipList final : detail::SkipListNode_base {
       return skiplist_->estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    std::vector<ConstIterator> chunk_boundaries(uint64_t num_chunks) const {
+      std::vector<ConstIterator> ret;
+      for (auto *node : skiplist_->chunk_boundaries(num_chunks)) ret.emplace_back(ConstIterator{node});
+      return ret;
+    }
+
     uint64_t size() const { return skiplist_->size(); }
 
    private:
@@ -1186,6 +1319,63 @@ class SkipList final : detail::SkipListNode_base {
     }
   }
 
+  bool link_run(const Builder &run) {
+    TNode *first = run.firsts_[0];
+    TNode *last = run.lasts_[0];
+    std::array<TNode *, kSkipListMaxHeight> preds{};
+    std::array<TNode *, kSkipListMaxHeight> succs{};
+    while (true) {
+      int layer_found = find_node(first->obj, preds, succs);
+      // The nodes of the run are linked between the same predecessors and
+      // successors in each layer, so there mustn't be any item in the list
+      // between the first and the last object of the run.
+      if (layer_found != -1 || (succs[0] != nullptr && !(last->obj < succs[0]->obj))) {
+        TNode *node_found = layer_found != -1 ? succs[layer_found] : succs[0];
+        if (!node_found->marked.load(std::memory_order_acquire)) return false;
+        continue;
+      }
+
+      {
+        TNode *previous_locked = nullptr;
+        bool valid = true;
+
+        auto locked_count = 0;
+        TNode *locked[kSkipListMaxHeight];
+        auto guard = OnScopeExit{[&] {
+          for (auto i = 0; i != locked_count; ++i) {
+            locked[i]->lock.unlock();
+          }
+        }};
+
+        for (int layer = 0; valid && (layer < run.height_); ++layer) {
+          TNode *pred = preds[layer];
+          TNode *succ = succs[layer];
+          if (pred != previous_locked) {
+            pred->lock.lock();
+            locked[locked_count] = pred;
+            ++locked_count;
+            previous_locked = pred;
+          }
+          valid = !pred->marked.load(std::memory_order_acquire) &&
+                  pred->nexts[layer].load(std::memory_order_acquire) == succ &&
+                  (succ == nullptr || !succ->marked.load(std::memory_order_acquire));
+        }
+
+        if (!valid) continue;
+
+        for (int layer = 0; layer < run.height_; ++layer) {
+          run.lasts_[layer]->nexts[layer].store(succs[layer], std::memory_order_release);
+        }
+        for (int layer = 0; layer < run.height_; ++layer) {
+          preds[layer]->nexts[layer].store(run.firsts_[layer], std::memory_order_release);
+        }
+      }
+
+      size_.fetch_add(run.size_, std::memory_order_acq_rel);
+      return true;
+    }
+  }
+
   template <typename TKey>
   SkipListNode<TObj> *find_(const TKey &key) const {
     std::array<TNode *, kSkipListMaxHeight> preds{};
@@ -1423,6 +1613,37 @@ class SkipList final : detail::SkipListNode_base {
     return nodes_traversed / unique_count;
   }
 
+  std::vector<TNode *> chunk_boundaries(uint64_t num_chunks) const {
+    std::vector<TNode *> boundaries;
+    if (num_chunks < 2) return boundaries;
+
+    // Pick the highest layer that still has a couple of nodes per chunk. Each
+    // upper layer has (on average) two times less items than the layer below
+    // it, so the sampled nodes are evenly distributed over the whole list.
+    const auto size = size_.load(std::memory_order_acquire);
+    uint32_t layer = 0;
+    while (layer + 1 < kSkipListMaxHeight && (size >> (layer + 1)) >= num_chunks * 4) {
+      ++layer;
+    }
+
+    std::vector<TNode *> sampled;
+    sampled.reserve(size >> layer);
+    for (TNode *curr = head_->nexts[layer].load(std::memory_order_acquire); curr != nullptr;
+         curr = curr->nexts[layer].load(std::memory_order_acquire)) {
+      if (curr->marked.load(std::memory_order_acquire)) continue;
+      sampled.push_back(curr);
+    }
+    if (sampled.empty()) return boundaries;
+
+    boundaries.reserve(num_chunks - 1);
+    for (uint64_t i = 1; i < num_chunks; ++i) {
+      auto *node = sampled[i * sampled.size() / num_chunks];
+      if (!boundaries.empty() && boundaries.back() == node) continue;
+      boundaries.push_back(node);
+    }
+    return boundaries;
+  }
+
   bool ok_to_delete(TNode *candidate, int layer_found) {
     // The paper has an incorrect check here. It expects the `layer_found`
     // variable to be 1-indexed, but in fact it is 0-indexed.
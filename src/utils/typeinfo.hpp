@@ -80,6 +80,8 @@ enum class TypeId : uint64_t {
   ROLLUP_APPLY,
   PERIODIC_COMMIT,
   PERIODIC_SUBQUERY,
+  GATHER,
+  TOPK,
 
   // Replication
   // NOTE: these NEED to be stable in the 2000+ range (see rpc version)
@@ -174,6 +174,11 @@ startup_config_dict = {
         "",
         "Directory where modules with custom query procedures are stored. NOTE: Multiple comma-separated directories can be defined.",
     ),
+    "replication_async_queue_size": (
+        "1000",
+        "1000",
+        "Maximum number of committed transactions queued for shipping to an ASYNC replica. When the queue overflows, the replica is recovered from the durability files. If 0, a transaction isn't replicated to an ASYNC replica which is still busy with the previous one.",
+    ),
     "replication_replica_check_frequency_sec": (
         "1",
         "1",
@@ -184,17 +189,62 @@ startup_config_dict = {
         "true",
         "Controls whether updating a property with the same value should create a delta object.",
     ),
+    "storage_columnar_properties": (
+        "",
+        "",
+        "Comma-separated list of Label.property pairs whose numeric values are cached in dense columns. "
+        "Aggregations over all vertices with the label read the columns instead of the vertices.",
+    ),
     "storage_access_timeout_sec": ("1", "1", "Query's storage level access timeout in seconds."),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
+    "storage_gc_thread_count": (
+        "1",
+        "1",
+        "The number of threads used by a storage garbage collector cycle to unlink deltas, clean up indices and "
+        "remove deleted vertices and edges.",
+    ),
     "storage_python_gc_cycle_sec": ("180", "180", "Storage python full garbage collection interval (in seconds)."),
     "storage_items_per_batch": (
         "1000000",
         "1000000",
         "The number of edges and vertices stored in a batch in a snapshot file.",
     ),
+    "storage_durability_compression_enabled": (
+        "false",
+        "false",
+        "Controls whether the vertices and edges in snapshots and the deltas in WAL files are compressed.",
+    ),
+    "storage_durability_compression_level": (
+        "mid",
+        "mid",
+        "Compression level of snapshot and WAL files. Allowed values: low, mid, high.",
+    ),
     "storage_properties_on_edges": ("false", "true", "Controls whether edges have properties."),
     "storage_snapshot_thread_count": ("12", "12", "The number of threads used to create snapshots."),
     "storage_recovery_thread_count": ("12", "12", "The number of threads used to recover persisted data from disk."),
+    "storage_index_population_thread_count": (
+        "1",
+        "1",
+        "The number of threads used to populate an index created at runtime. The vertices are split into ranges "
+        "which are indexed in parallel.",
+    ),
+    "storage_graph_projection_thread_count": (
+        "12",
+        "12",
+        "The number of threads used to build the graph projections requested by query modules.",
+    ),
+    "storage_recovery_memory_mapped": (
+        "false",
+        "false",
+        "Controls whether snapshot files are memory-mapped during recovery. The recovery threads then decode "
+        "the snapshot directly from the page cache instead of reading it through per-thread buffers.",
+    ),
+    "storage_snapshot_incremental_count": (
+        "0",
+        "0",
+        "The number of incremental snapshots created between two full snapshots. An incremental snapshot contains "
+        "only the vertices and edges changed since the previous snapshot. Set to 0 to always create full snapshots.",
+    ),
     "storage_snapshot_interval_sec": (
         "0",
         "300",
@@ -223,6 +273,12 @@ startup_config_dict = {
         "Default storage mode Memgraph uses. Allowed values: IN_MEMORY_TRANSACTIONAL, IN_MEMORY_ANALYTICAL, ON_DISK_TRANSACTIONAL",
     ),
     "storage_wal_file_size_kib": ("20480", "20480", "Minimum file size of each WAL file."),
+    "storage_wal_group_commit": (
+        "false",
+        "false",
+        "Every commit waits until its WAL records are synced to disk. A single thread syncs the WAL once for all "
+        "transactions committed in the meantime. When enabled, storage_wal_file_flush_every_n_tx is ignored.",
+    ),
     "stream_transaction_conflict_retries": (
         "30",
         "30",
@@ -245,12 +301,42 @@ startup_config_dict = {
     ),
     "query_cost_planner": ("true", "true", "Use the cost-estimating query planner."),
     "query_plan_cache_max_size": ("1000", "1000", "Maximum number of query plans to cache."),
+    "query_plan_cache_max_variants": (
+        "4",
+        "4",
+        "Maximum number of cached plans of a query, one for each order of magnitude of the estimated number of vertices matched by its parameters.",
+    ),
+    "query_plan_feedback_sample_rate": (
+        "0",
+        "0",
+        "Profile every this many executions of a cached plan to compare the rows produced by its scans, expansions and filters with the estimates. The observed degrees of expansions and selectivities of filters are used by the cost estimator. Sampled executions are neither batched nor parallel. Default is 0, which disables sampling.",
+    ),
+    "query_plan_replan_factor": (
+        "100",
+        "100",
+        "A cached plan is planned again when it or any of its sampled operators produces this many times more or fewer rows than estimated.",
+    ),
     "query_vertex_count_to_expand_existing": (
         "10",
         "10",
         "Maximum count of indexed vertices which provoke indexed lookup and then expand to existing, instead of a regular expand. Default is 10, to turn off use -1.",
     ),
     "query_max_plans": ("1000", "1000", "Maximum number of generated plans for a query."),
+    "query_max_join_order_expansions": (
+        "0",
+        "0",
+        "Maximum number of expansions in a pattern for which all orders of the expansions are considered when picking the cheapest one. Larger patterns are ordered greedily. Default is 0, which keeps the breadth-first order of the expansions.",
+    ),
+    "query_parallel_workers": (
+        "1",
+        "1",
+        "Number of threads used to execute a single aggregation over a scan or a level of a breadth-first expansion. Default is 1, which disables parallel execution.",
+    ),
+    "query_parallel_expansion_min_frontier": (
+        "1024",
+        "1024",
+        "Levels of a breadth-first expansion with at least this many vertices are expanded by --query-parallel-workers threads.",
+    ),
     "flag_file": ("", "", "load flags from file"),
     "hops_limit_partial_results": (
         "true",
@@ -278,6 +364,11 @@ startup_config_dict = {
         "128",
         "The threshold for when to cache long delta chains. This is used for heavy read + write workloads where repeated processing of delta chains can become costly.",
     ),
+    "storage_sorted_adjacency_threshold": (
+        "0",
+        "0",
+        "Keep the edges of vertices with at least this many in or out edges sorted by edge type and the other vertex, so that expanding over an edge type and finding the edges between two vertices doesn't scan all of the vertex's edges. 0 disables it.",
+    ),
     "experimental_enabled": (
         "",
         "",
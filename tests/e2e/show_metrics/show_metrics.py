@@ -148,6 +148,7 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "ExpandVariableOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "FilterOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ForeachOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "GatherOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "HashJoinOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "IndexedJoinOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "LimitOperator", "type": "Operator", "metric type": "Counter"},
@@ -180,6 +181,7 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "SetPropertiesOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "SetPropertyOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "SkipOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "TopKOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "UnionOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "UnwindOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "QueryExecutionLatency_us_50p", "type": "Query", "metric type": "Histogram"},
@@ -291,10 +291,12 @@ class Database {
   virtual ~Database() = default;
 
   void BfsTest(Database *db, int lower_bound, int upper_bound, memgraph::query::EdgeAtom::Direction direction,
-               std::vector<std::string> edge_types, bool known_sink, FilterLambdaType filter_lambda_type) {
+               std::vector<std::string> edge_types, bool known_sink, FilterLambdaType filter_lambda_type,
+               memgraph::utils::ThreadPool *worker_pool = nullptr) {
     auto storage_dba = db->Access();
     memgraph::query::DbAccessor dba(storage_dba.get());
     memgraph::query::ExecutionContext context{.db_accessor = &dba};
+    context.worker_pool = worker_pool;
     memgraph::query::Symbol blocked_sym = context.symbol_table.CreateSymbol("blocked", true);
     memgraph::query::Symbol source_sym = context.symbol_table.CreateSymbol("source", true);
     memgraph::query::Symbol sink_sym = context.symbol_table.CreateSymbol("sink", true);
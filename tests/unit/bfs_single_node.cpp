@@ -9,11 +9,17 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+
 #include "bfs_common.hpp"
 
 #include "disk_test_utils.hpp"
+#include "query/plan/rewrite/parallel.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/vertex_info_cache.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/thread_pool.hpp"
 
 using namespace memgraph::query;
 using namespace memgraph::query::plan;
@@ -127,6 +133,149 @@ INSTANTIATE_TEST_SUITE_P(FilterLambda, SingleNodeBfsTestInMemory,
                                                           FilterLambdaType::USE_FRAME_NULL, FilterLambdaType::USE_CTX,
                                                           FilterLambdaType::ERROR)));
 
+// Every level is expanded on the worker pool.
+class SingleNodeBfsTestInMemoryParallel
+    : public ::testing::TestWithParam<
+          std::tuple<int, int, EdgeAtom::Direction, std::vector<std::string>, bool, FilterLambdaType>> {
+ public:
+  using StorageType = memgraph::storage::InMemoryStorage;
+  static void SetUpTestCase() {
+    db_ = std::make_unique<SingleNodeDb<StorageType>>();
+    worker_pool_ = std::make_unique<memgraph::utils::ThreadPool>(3);
+    FLAGS_query_parallel_workers = 4;
+    FLAGS_query_parallel_expansion_min_frontier = 1;
+  }
+  static void TearDownTestCase() {
+    FLAGS_query_parallel_workers = 1;
+    FLAGS_query_parallel_expansion_min_frontier = 1024;
+    worker_pool_ = nullptr;
+    db_ = nullptr;
+  }
+
+ protected:
+  static std::unique_ptr<SingleNodeDb<StorageType>> db_;
+  static std::unique_ptr<memgraph::utils::ThreadPool> worker_pool_;
+};
+
+TEST_P(SingleNodeBfsTestInMemoryParallel, All) {
+  int lower_bound;
+  int upper_bound;
+  EdgeAtom::Direction direction;
+  std::vector<std::string> edge_types;
+  bool known_sink;
+  FilterLambdaType filter_lambda_type;
+  std::tie(lower_bound, upper_bound, direction, edge_types, known_sink, filter_lambda_type) = GetParam();
+  this->db_->BfsTest(db_.get(), lower_bound, upper_bound, direction, edge_types, known_sink, filter_lambda_type,
+                     worker_pool_.get());
+}
+
+std::unique_ptr<SingleNodeDb<SingleNodeBfsTestInMemoryParallel::StorageType>>
+    SingleNodeBfsTestInMemoryParallel::db_{nullptr};
+std::unique_ptr<memgraph::utils::ThreadPool> SingleNodeBfsTestInMemoryParallel::worker_pool_{nullptr};
+
+INSTANTIATE_TEST_SUITE_P(DirectionAndExpansionDepth, SingleNodeBfsTestInMemoryParallel,
+                         testing::Combine(testing::Range(-1, kVertexCount), testing::Range(-1, kVertexCount),
+                                          testing::Values(EdgeAtom::Direction::OUT, EdgeAtom::Direction::IN,
+                                                          EdgeAtom::Direction::BOTH),
+                                          testing::Values(std::vector<std::string>{}), testing::Bool(),
+                                          testing::Values(FilterLambdaType::NONE)));
+
+INSTANTIATE_TEST_SUITE_P(FilterLambda, SingleNodeBfsTestInMemoryParallel,
+                         testing::Combine(testing::Values(-1), testing::Values(-1),
+                                          testing::Values(EdgeAtom::Direction::OUT, EdgeAtom::Direction::IN,
+                                                          EdgeAtom::Direction::BOTH),
+                                          testing::Values(std::vector<std::string>{}), testing::Bool(),
+                                          testing::Values(FilterLambdaType::NONE, FilterLambdaType::USE_FRAME,
+                                                          FilterLambdaType::USE_FRAME_NULL, FilterLambdaType::USE_CTX,
+                                                          FilterLambdaType::ERROR)));
+
+// The expanded vertices are changed after the expanding transaction started, so
+// the workers and the calling thread read them through long delta chains, which
+// get cached.
+TEST(SingleNodeBfsTestInMemoryParallelLongDeltaChains, Star) {
+  constexpr int64_t kWidth = 2000;
+  const auto default_cache_threshold = FLAGS_delta_chain_cache_threshold;
+  FLAGS_delta_chain_cache_threshold = 2;
+  FLAGS_query_parallel_workers = 4;
+  const memgraph::utils::OnScopeExit restore_flags{[default_cache_threshold] {
+    FLAGS_delta_chain_cache_threshold = default_cache_threshold;
+    FLAGS_query_parallel_workers = 1;
+    FLAGS_query_parallel_expansion_min_frontier = 1024;
+  }};
+  memgraph::utils::ThreadPool worker_pool(3);
+  SingleNodeDb<memgraph::storage::InMemoryStorage> db;
+
+  // source -> middle_i -> leaf_i
+  memgraph::storage::PropertyId id;
+  memgraph::storage::EdgeTypeId type;
+  memgraph::storage::Gid source_gid;
+  {
+    auto acc = db.Access();
+    id = acc->NameToProperty("id");
+    type = acc->NameToEdgeType("a");
+    auto source = acc->CreateVertex();
+    source_gid = source.Gid();
+    ASSERT_FALSE(source.SetProperty(id, memgraph::storage::PropertyValue(int64_t{0})).HasError());
+    for (int64_t i = 0; i < kWidth; ++i) {
+      auto middle = acc->CreateVertex();
+      auto leaf = acc->CreateVertex();
+      ASSERT_FALSE(middle.SetProperty(id, memgraph::storage::PropertyValue(i + 1)).HasError());
+      ASSERT_FALSE(leaf.SetProperty(id, memgraph::storage::PropertyValue(kWidth + i + 1)).HasError());
+      ASSERT_FALSE(acc->CreateEdge(&source, &middle, type).HasError());
+      ASSERT_FALSE(acc->CreateEdge(&middle, &leaf, type).HasError());
+    }
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  {
+    // Changes that the expanding transaction mustn't see: every vertex gets new
+    // ids and an edge to a new vertex.
+    auto acc = db.Access();
+    std::vector<memgraph::storage::VertexAccessor> vertices;
+    for (auto vertex : acc->Vertices(memgraph::storage::View::OLD)) vertices.push_back(vertex);
+    for (auto &vertex : vertices) {
+      for (int64_t i = 1; i <= 8; ++i) {
+        ASSERT_FALSE(vertex.SetProperty(id, memgraph::storage::PropertyValue(-i)).HasError());
+      }
+      auto added = acc->CreateVertex();
+      ASSERT_FALSE(acc->CreateEdge(&vertex, &added, type).HasError());
+    }
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  memgraph::query::AstStorage storage;
+  memgraph::query::ExecutionContext context{.db_accessor = &dba};
+  context.worker_pool = &worker_pool;
+  auto source_sym = context.symbol_table.CreateSymbol("source", true);
+  auto sink_sym = context.symbol_table.CreateSymbol("sink", true);
+  auto edges_sym = context.symbol_table.CreateSymbol("edges", true);
+  auto inner_edge_sym = context.symbol_table.CreateSymbol("inner_edge", true);
+  auto inner_node_sym = context.symbol_table.CreateSymbol("inner_node", true);
+  auto source = dba.FindVertex(source_gid, memgraph::storage::View::OLD);
+  ASSERT_TRUE(source);
+  std::shared_ptr<LogicalOperator> input_op = std::make_shared<Yield>(
+      nullptr, std::vector<Symbol>{source_sym}, std::vector<std::vector<TypedValue>>{{TypedValue(*source)}});
+  input_op = db.MakeBfsOperator(source_sym, sink_sym, edges_sym, EdgeAtom::Direction::OUT, {}, input_op, false,
+                                nullptr, nullptr, ExpansionLambda{inner_edge_sym, inner_node_sym, nullptr});
+
+  // Alternates between expanding every level in parallel and every level on the calling thread
+  for (int run = 0; run < 6; ++run) {
+    FLAGS_query_parallel_expansion_min_frontier = run % 2 == 0 ? 1 : 1024;
+    auto results = PullResults(input_op.get(), &context, std::vector<Symbol>{sink_sym, edges_sym});
+    ASSERT_EQ(results.size(), 2 * kWidth);
+    std::vector<int64_t> ids;
+    for (const auto &row : results) {
+      const auto sink_id = GetProp(row[0].ValueVertex(), "id", &dba).ValueInt();
+      ASSERT_EQ(row[1].ValueList().size(), sink_id <= kWidth ? 1U : 2U);
+      ids.push_back(sink_id);
+    }
+    std::ranges::sort(ids);
+    for (int64_t i = 0; i < 2 * kWidth; ++i) ASSERT_EQ(ids[i], i + 1);
+  }
+}
+
 class SingleNodeBfsTestOnDisk
     : public ::testing::TestWithParam<
           std::tuple<int, int, EdgeAtom::Direction, std::vector<std::string>, bool, FilterLambdaType>> {
@@ -785,6 +785,72 @@ TYPED_TEST(InterpreterTest, ExplainQueryWithParams) {
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
+TYPED_TEST(InterpreterTest, PlanCacheParameterSensitiveVariants) {
+  if (std::is_same<TypeParam, memgraph::storage::DiskStorage>::value) {
+    GTEST_SKIP() << "Disk storage doesn't estimate the number of vertices in a range";
+  }
+  this->Interpret("CREATE INDEX ON :Person(country)");
+  this->Interpret("UNWIND range(1, 100) AS i CREATE (:Person {country: 'big'})");
+  this->Interpret("CREATE (:Person {country: 'small'}), (:Person {country: 'tiny'})");
+
+  const std::string query = "MATCH (n:Person) WHERE n.country = $country RETURN n;";
+  auto variants_count = [&] {
+    return this->db->plan_cache()->WithLock([&](auto &cache) -> size_t {
+      auto entry = cache.get(memgraph::query::frontend::StrippedQuery(query).stripped_query());
+      return entry ? (*entry)->variants.size() : 0;
+    });
+  };
+  auto interpret = [&](const char *country) {
+    return this->Interpret(query, {{"country", memgraph::storage::ExternalPropertyValue(country)}});
+  };
+
+  EXPECT_EQ(interpret("small").GetResults().size(), 1U);
+  EXPECT_EQ(variants_count(), 1U);
+  // A value matching 100 times more vertices gets its own plan...
+  EXPECT_EQ(interpret("big").GetResults().size(), 100U);
+  EXPECT_EQ(variants_count(), 2U);
+  // ...while values matching a similar number of vertices share a plan.
+  EXPECT_EQ(interpret("tiny").GetResults().size(), 1U);
+  EXPECT_EQ(interpret("small").GetResults().size(), 1U);
+  EXPECT_EQ(variants_count(), 2U);
+  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+}
+
+TYPED_TEST(InterpreterTest, PlanCacheCardinalityFeedback) {
+  if (std::is_same<TypeParam, memgraph::storage::DiskStorage>::value) {
+    GTEST_SKIP() << "Disk storage doesn't count the vertices with a label";
+  }
+  this->Interpret("CREATE INDEX ON :Hub");
+  this->Interpret("CREATE (:Hub)");
+  this->Interpret("MATCH (h:Hub) UNWIND range(1, 2000) AS i CREATE (h)-[:LINK]->()");
+
+  // The number of rows of an aggregation isn't estimated, so only the sampled
+  // rows of the expansion tell that the estimate is off
+  const std::string query = "MATCH (h:Hub)-[:LINK]->(m) RETURN count(m) AS c;";
+  auto cached_plan = [&] {
+    return this->db->plan_cache()->WithLock([&](auto &cache) -> std::shared_ptr<memgraph::query::PlanWrapper> {
+      auto entry = cache.get(memgraph::query::frontend::StrippedQuery(query).stripped_query());
+      return entry ? (*entry)->variants.front().second : nullptr;
+    });
+  };
+
+  FLAGS_query_plan_feedback_sample_rate = 1;
+  auto stream = this->Interpret(query);
+  ASSERT_EQ(stream.GetResults().size(), 1U);
+  EXPECT_EQ(stream.GetResults()[0][0].ValueInt(), 2000);
+  auto plan = cached_plan();
+  ASSERT_TRUE(plan);
+  EXPECT_TRUE(plan->IsStale());
+
+  // The plan made again uses the observed degree of the expansion
+  EXPECT_EQ(this->Interpret(query).GetResults()[0][0].ValueInt(), 2000);
+  auto replanned = cached_plan();
+  ASSERT_TRUE(replanned);
+  EXPECT_NE(replanned, plan);
+  EXPECT_FALSE(replanned->IsStale());
+  FLAGS_query_plan_feedback_sample_rate = 0;
+}
+
 TYPED_TEST(InterpreterTest, ProfileQuery) {
   EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
@@ -113,6 +113,13 @@ class QueryCostEstimator : public ::testing::Test {
     return cost_estimator.cost();
   }
 
+  auto Cardinality() {
+    CostEstimator<memgraph::query::DbAccessor> cost_estimator(&*dba, symbol_table_, parameters_,
+                                                              memgraph::query::plan::IndexHints());
+    last_op_->Accept(cost_estimator);
+    return cost_estimator.cardinality();
+  }
+
   template <typename TLogicalOperator, typename... TArgs>
   void MakeOp(TArgs... args) {
     last_op_ = std::make_shared<TLogicalOperator>(args...);
@@ -309,6 +316,28 @@ TEST_F(QueryCostEstimator, Expand) {
   EXPECT_COST(CardParam::kExpand * CostParam::kExpand);
 }
 
+TEST_F(QueryCostEstimator, ExpandEdgeTypeDegrees) {
+  AddVertices(100, 30, 0);
+  auto knows = db->NameToEdgeType("KNOWS");
+  auto likes = db->NameToEdgeType("LIKES");
+  dba->SetIndexStats(label, ms::LabelIndexStats{.count = 30,
+                                                .avg_degree = 4.0,
+                                                .edge_type_degrees = {{.edge_type = knows, .avg_out_degree = 3.0,
+                                                                       .avg_in_degree = 0.5},
+                                                                      {.edge_type = likes, .avg_out_degree = 0.0,
+                                                                       .avg_in_degree = 0.5}}});
+  auto scan = std::make_shared<ScanAllByLabel>(last_op_, NextSymbol(), label);
+  auto input_symbol = scan->output_symbol_;
+  auto expand = [&](EdgeAtom::Direction direction, std::vector<ms::EdgeTypeId> edge_types) {
+    MakeOp<Expand>(scan, input_symbol, NextSymbol(), NextSymbol(), direction, edge_types, false, ms::View::OLD);
+    return Cardinality();
+  };
+  EXPECT_FLOAT_EQ(expand(EdgeAtom::Direction::OUT, {knows}), 30 * 3.0);
+  EXPECT_FLOAT_EQ(expand(EdgeAtom::Direction::IN, {knows}), 30 * 0.5);
+  EXPECT_FLOAT_EQ(expand(EdgeAtom::Direction::BOTH, {knows, likes}), 30 * 4.0);
+  EXPECT_FLOAT_EQ(expand(EdgeAtom::Direction::IN, {}), 30 * 1.0);
+}
+
 TEST_F(QueryCostEstimator, ExpandVariable) {
   MakeOp<ExpandVariable>(last_op_, NextSymbol(), NextSymbol(), NextSymbol(), EdgeAtom::Type::DEPTH_FIRST,
                          EdgeAtom::Direction::IN, std::vector<ms::EdgeTypeId>{}, false, nullptr, nullptr, false,
@@ -374,6 +403,41 @@ TEST_F(QueryCostEstimator, Filter) {
           CardParam::kFilter);
 }
 
+TEST_F(QueryCostEstimator, FilterKeyDistribution) {
+  AddVertices(100, 30, 0);
+  dba->SetIndexStats(label, ms::LabelIndexStats{.count = 30, .avg_degree = 0});
+  // One very common value and 100 rare ones
+  std::map<std::vector<ms::PropertyValue>, int64_t> key_counts{{{ms::PropertyValue(0)}, 900}};
+  for (int i = 1; i <= 100; ++i) key_counts[{ms::PropertyValue(i)}] = 1;
+  ms::LabelPropertyIndexStats stats{
+      .count = 1000, .distinct_values_count = 101, .statistic = 0, .avg_group_size = 1000.0 / 101, .avg_degree = 0};
+  ms::BuildKeyDistribution(key_counts, stats);
+  auto properties = std::vector{ms::PropertyPath{prop_a}};
+  dba->SetIndexStats(label, properties, stats);
+
+  auto scan = std::make_shared<ScanAllByLabel>(last_op_, NextSymbol(), label);
+  auto symbol = scan->output_symbol_;
+  auto filter_cardinality = [&](PropertyFilter property_filter) {
+    Filters filters;
+    filters.SetFilters({FilterInfo{FilterInfo::Type::Property, nullptr, {symbol}, std::move(property_filter)}});
+    MakeOp<Filter>(scan, std::vector<std::shared_ptr<LogicalOperator>>{}, Literal(true), std::move(filters));
+    return Cardinality();
+  };
+  auto property = storage_.GetPropertyIx("a");
+  EXPECT_FLOAT_EQ(
+      filter_cardinality(PropertyFilter(symbol_table_, symbol, property, Literal(0), PropertyFilter::Type::EQUAL)),
+      30 * 0.9);
+  EXPECT_FLOAT_EQ(
+      filter_cardinality(PropertyFilter(symbol_table_, symbol, property, Parameter(7), PropertyFilter::Type::EQUAL)),
+      30 * 0.001);
+  EXPECT_NEAR(filter_cardinality(PropertyFilter(symbol_table_, symbol, property, InclusiveBound(Literal(1)),
+                                                InclusiveBound(Literal(50)))),
+              30 * 0.05, 30 * 0.01);
+  // Strings never satisfy a range over numbers
+  auto string_bound = InclusiveBound(Literal(std::string("a")));
+  EXPECT_FLOAT_EQ(filter_cardinality(PropertyFilter(symbol_table_, symbol, property, string_bound, nullopt)), 0);
+}
+
 TEST_F(QueryCostEstimator, EdgeUniquenessFilter) {
   TEST_OP(MakeOp<EdgeUniquenessFilter>(last_op_, NextSymbol(), std::vector<Symbol>()), CostParam::kEdgeUniquenessFilter,
           CardParam::kEdgeUniquenessFilter);
@@ -0,0 +1,167 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "query/context.hpp"
+#include "query/db_accessor.hpp"
+#include "query/exceptions.hpp"
+#include "query/frontend/ast/ast.hpp"
+#include "query/interpret/compiled_expression.hpp"
+#include "query/interpret/eval.hpp"
+#include "query/interpret/frame.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+#include "query_common.hpp"
+
+using namespace memgraph::query;
+
+namespace {
+
+class CompiledExpressionsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.SetProperty(dba.NameToProperty("int"), memgraph::storage::PropertyValue(5)).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(dba.NameToProperty("double"), memgraph::storage::PropertyValue(5.0)).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(dba.NameToProperty("string"), memgraph::storage::PropertyValue("abc")).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(dba.NameToProperty("bool"), memgraph::storage::PropertyValue(true)).HasValue());
+    dba.AdvanceCommand();
+    n = CreateIdentifierWithValue("n", TypedValue(vertex));
+    null = CreateIdentifierWithValue("null", TypedValue());
+    map = CreateIdentifierWithValue("map", TypedValue(std::map<std::string, TypedValue>{{"int", TypedValue(5)}}));
+    ctx.parameters.Add(0, memgraph::storage::ExternalPropertyValue(5));
+    ctx.parameters.Add(1, memgraph::storage::ExternalPropertyValue("abd"));
+  }
+
+  Identifier *CreateIdentifierWithValue(const std::string &name, const TypedValue &value) {
+    auto *id = storage.Create<Identifier>(name, true);
+    auto symbol = symbol_table.CreateSymbol(name, true);
+    id->MapTo(symbol);
+    frame[symbol] = value;
+    return id;
+  }
+
+  Expression *Lookup(Expression *expression, const std::string &property) {
+    return storage.Create<PropertyLookup>(expression, storage.GetPropertyIx(property));
+  }
+
+  template <class TValue>
+  Expression *Literal(TValue value) {
+    return storage.Create<PrimitiveLiteral>(value);
+  }
+
+  Expression *Parameter(int position) { return storage.Create<ParameterLookup>(position); }
+
+  /// Checks that the compiled expressions evaluate to the same values and
+  /// throw the same errors as the ExpressionEvaluator.
+  void ExpectSameAsEvaluator(const std::vector<Expression *> &expressions) {
+    ctx.properties = NamesToProperties(storage.properties_, &dba);
+    CompiledExpressions compiled(expressions);
+    auto constants = compiled.Bind(eval);
+    for (size_t i = 0; i < expressions.size(); ++i) {
+      std::optional<TypedValue> expected;
+      try {
+        expected = expressions[i]->Accept(eval);
+      } catch (const QueryRuntimeException &) {
+      }
+      if (!expected) {
+        EXPECT_THROW(compiled.Evaluate(i, eval, constants), QueryRuntimeException) << i;
+        EXPECT_THROW(compiled.EvaluateFilter(i, eval, constants), QueryRuntimeException) << i;
+        continue;
+      }
+      EXPECT_TRUE(TypedValue::BoolEqual{}(*expected, compiled.Evaluate(i, eval, constants))) << i;
+      if (expected->IsNull() || expected->IsBool()) {
+        EXPECT_EQ(compiled.EvaluateFilter(i, eval, constants), !expected->IsNull() && expected->ValueBool()) << i;
+      } else {
+        EXPECT_THROW(compiled.EvaluateFilter(i, eval, constants), QueryRuntimeException) << i;
+      }
+    }
+  }
+
+  memgraph::storage::Config config;
+  std::unique_ptr<memgraph::storage::Storage> db{std::make_unique<memgraph::storage::InMemoryStorage>(config)};
+  std::unique_ptr<memgraph::storage::Storage::Accessor> storage_dba{db->Access()};
+  DbAccessor dba{storage_dba.get()};
+
+  AstStorage storage;
+  EvaluationContext ctx;
+  SymbolTable symbol_table;
+  Frame frame{16};
+  ExpressionEvaluator eval{&frame, symbol_table, ctx, &dba, memgraph::storage::View::OLD};
+
+  Identifier *n{nullptr};
+  Identifier *null{nullptr};
+  Identifier *map{nullptr};
+};
+
+TEST_F(CompiledExpressionsTest, Comparisons) {
+  std::vector<Expression *> expressions;
+  std::vector<Expression *> operands{Lookup(n, "int"),    Lookup(n, "double"),   Lookup(n, "string"),
+                                     Lookup(n, "bool"),   Lookup(n, "missing"),  Lookup(null, "int"),
+                                     Lookup(map, "int"),  Literal(4),            Literal(5.5),
+                                     Literal("abc"),      Literal(false),        Parameter(0),
+                                     Parameter(1),        n,                     null};
+  for (auto *lhs : operands) {
+    for (auto *rhs : operands) {
+      expressions.push_back(storage.Create<EqualOperator>(lhs, rhs));
+      expressions.push_back(storage.Create<NotEqualOperator>(lhs, rhs));
+      expressions.push_back(storage.Create<LessOperator>(lhs, rhs));
+      expressions.push_back(storage.Create<GreaterOperator>(lhs, rhs));
+      expressions.push_back(storage.Create<LessEqualOperator>(lhs, rhs));
+      expressions.push_back(storage.Create<GreaterEqualOperator>(lhs, rhs));
+    }
+  }
+  ExpectSameAsEvaluator(expressions);
+}
+
+TEST_F(CompiledExpressionsTest, Logical) {
+  std::vector<Expression *> operands{Literal(true), Literal(false), null, Lookup(n, "int"),
+                                     storage.Create<LessOperator>(Lookup(n, "int"), Parameter(0))};
+  std::vector<Expression *> expressions;
+  for (auto *lhs : operands) {
+    expressions.push_back(storage.Create<NotOperator>(lhs));
+    expressions.push_back(storage.Create<IsNullOperator>(lhs));
+    for (auto *rhs : operands) {
+      expressions.push_back(storage.Create<AndOperator>(lhs, rhs));
+      expressions.push_back(storage.Create<OrOperator>(lhs, rhs));
+      expressions.push_back(storage.Create<NotOperator>(storage.Create<AndOperator>(lhs, rhs)));
+    }
+  }
+  ExpectSameAsEvaluator(expressions);
+}
+
+TEST_F(CompiledExpressionsTest, Fallback) {
+  // Unsupported expressions are evaluated by the ExpressionEvaluator.
+  ExpectSameAsEvaluator({storage.Create<AdditionOperator>(Lookup(n, "int"), Literal(1)),
+                         storage.Create<LessOperator>(storage.Create<AdditionOperator>(Lookup(n, "int"), Literal(1)),
+                                                      Lookup(n, "double")),
+                         Lookup(map, "missing"), n});
+}
+
+TEST_F(CompiledExpressionsTest, Cache) {
+  CompiledExpressionsCache cache;
+  std::vector<Expression *> expressions{Literal(1)};
+  auto compiled = cache.Get(expressions);
+  EXPECT_EQ(compiled, cache.Get(expressions));
+  EXPECT_NE(compiled, cache.Get({Literal(2)}));
+  CompiledExpressionsCache copy(cache);
+  EXPECT_NE(compiled, copy.Get(expressions));
+}
+
+}  // namespace
@@ -758,10 +758,21 @@ TYPED_TEST(TestPlanner, ReturnDistinctOrderBySkipLimit) {
   // Test RETURN DISTINCT 1 ORDER BY 1 SKIP 1 LIMIT 1
   auto *query = QUERY(
       SINGLE_QUERY(RETURN_DISTINCT(LITERAL(1), AS("1"), ORDER_BY(LITERAL(1)), SKIP(LITERAL(1)), LIMIT(LITERAL(1)))));
-  CheckPlan<TypeParam>(query, this->storage, ExpectProduce(), ExpectDistinct(), ExpectOrderBy(), ExpectSkip(),
+  CheckPlan<TypeParam>(query, this->storage, ExpectProduce(), ExpectDistinct(), ExpectTopK(), ExpectSkip(),
                        ExpectLimit());
 }
 
+TYPED_TEST(TestPlanner, MatchReturnOrderByLimit) {
+  // Test MATCH (n) RETURN n ORDER BY n.prop DESC LIMIT 10
+  FakeDbAccessor dba;
+  auto prop = dba.Property("prop");
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n"))),
+      RETURN(IDENT("n"), AS("n"), ORDER_BY(PROPERTY_LOOKUP(dba, "n", prop), memgraph::query::Ordering::DESC),
+             LIMIT(LITERAL(10)))));
+  CheckPlan<TypeParam>(query, this->storage, ExpectScanAll(), ExpectProduce(), ExpectTopK(), ExpectLimit());
+}
+
 TYPED_TEST(TestPlanner, CreateWithDistinctSumWhereReturn) {
   // Test CREATE (n) WITH DISTINCT SUM(n.prop) AS s WHERE s < 42 RETURN s
   FakeDbAccessor dba;
@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <numeric>
+#include <random>
 #include <vector>
 
 #include "disk_test_utils.hpp"
@@ -264,6 +266,50 @@ TYPED_TEST(QueryPlanTest, OrderByMultiple) {
   }
 }
 
+TYPED_TEST(QueryPlanTest, TopK) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  SymbolTable symbol_table;
+  auto prop = dba.NameToProperty("prop");
+
+  const int N = 100;
+  std::vector<int> values(N);
+  std::iota(values.begin(), values.end(), 0);
+  std::random_device rd;
+  std::mt19937 g(rd());
+  std::shuffle(values.begin(), values.end(), g);
+  for (auto value : values) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(value)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  auto check = [&](int64_t limit, int64_t skip) {
+    // MATCH (n) RETURN n.prop ORDER BY n.prop DESC SKIP skip LIMIT limit
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+    auto top_k = std::make_shared<plan::TopK>(n.op_, std::vector<SortItem>{{Ordering::DESC, n_p}},
+                                              std::vector<Symbol>{n.sym_}, LITERAL(limit), LITERAL(skip));
+    auto skip_op = std::make_shared<plan::Skip>(top_k, LITERAL(skip));
+    auto limit_op = std::make_shared<plan::Limit>(skip_op, LITERAL(limit));
+    auto n_p_ne = NEXPR("n.p", n_p)->MapTo(symbol_table.CreateSymbol("n.p", true));
+    auto produce = MakeProduce(limit_op, n_p_ne);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto results = CollectProduce(*produce, &context);
+    ASSERT_EQ(std::clamp<int64_t>(N - skip, 0, limit), results.size());
+    for (int j = 0; j < results.size(); ++j) {
+      ASSERT_EQ(results[j][0].type(), TypedValue::Type::Int);
+      EXPECT_EQ(results[j][0].ValueInt(), N - 1 - skip - j);
+    }
+  };
+  check(10, 0);
+  check(10, 5);
+  check(10, 95);
+  check(0, 0);
+  check(N, 0);
+  check(2 * N, 0);
+  check(10, 2 * N);
+}
+
 TYPED_TEST(QueryPlanTest, OrderByExceptions) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
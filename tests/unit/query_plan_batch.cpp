@@ -0,0 +1,189 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "query/context.hpp"
+#include "query/interpret/frame_batch.hpp"
+#include "query/plan/operator.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+#include "query_plan_common.hpp"
+
+using namespace memgraph::query;
+using namespace memgraph::query::plan;
+
+namespace {
+
+/// Same as `CollectProduce`, but pulls the plan in batches of `capacity` rows.
+std::vector<std::vector<TypedValue>> CollectProduceBatched(const Produce &produce, ExecutionContext *context,
+                                                           size_t capacity) {
+  Frame frame(context->symbol_table.max_position());
+  std::vector<Symbol> symbols;
+  for (auto *named_expression : produce.named_expressions_)
+    symbols.emplace_back(context->symbol_table.at(*named_expression));
+
+  auto cursor = produce.MakeCursor(memgraph::utils::NewDeleteResource());
+  BatchedInput input;
+  input.Enable(context->symbol_table.max_position(), capacity, memgraph::utils::NewDeleteResource());
+  std::vector<std::vector<TypedValue>> results;
+  while (input.Pull(*cursor, frame, *context)) {
+    std::vector<TypedValue> values;
+    for (auto &symbol : symbols) values.emplace_back(frame[symbol]);
+    results.emplace_back(values);
+  }
+  return results;
+}
+
+void ExpectSameResults(const std::vector<std::vector<TypedValue>> &expected,
+                       const std::vector<std::vector<TypedValue>> &actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i].size(), actual[i].size());
+    for (size_t j = 0; j < expected[i].size(); ++j) {
+      EXPECT_TRUE(TypedValue::BoolEqual{}(expected[i][j], actual[i][j])) << i << " " << j;
+    }
+  }
+}
+
+}  // namespace
+
+class QueryPlanBatchTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    // Each vertex `i` has an edge to vertices `i + 1` and `i + 2`.
+    std::vector<VertexAccessor> vertices;
+    for (int i = 0; i < kNumVertices; ++i) {
+      auto vertex = dba_.InsertVertex();
+      ASSERT_TRUE(vertex.SetProperty(prop_, memgraph::storage::PropertyValue(i)).HasValue());
+      vertices.push_back(vertex);
+    }
+    for (int i = 0; i < kNumVertices; ++i) {
+      for (int j = i + 1; j < std::min(i + 3, kNumVertices); ++j) {
+        ASSERT_TRUE(dba_.InsertEdge(&vertices[i], &vertices[j], edge_type_).HasValue());
+      }
+    }
+    dba_.AdvanceCommand();
+  }
+
+  static constexpr int kNumVertices = 100;
+
+  memgraph::storage::Config config_;
+  std::unique_ptr<memgraph::storage::Storage> db_{std::make_unique<memgraph::storage::InMemoryStorage>(config_)};
+  std::unique_ptr<memgraph::storage::Storage::Accessor> storage_dba_{db_->Access()};
+  DbAccessor dba_{storage_dba_.get()};
+  memgraph::storage::PropertyId prop_{dba_.NameToProperty("prop")};
+  memgraph::storage::EdgeTypeId edge_type_{dba_.NameToEdgeType("Edge")};
+  AstStorage storage;
+  SymbolTable symbol_table_;
+};
+
+TEST_F(QueryPlanBatchTest, FrameBatch) {
+  Symbol a("a", 0, true);
+  Symbol b("b", 1, true);
+  Frame frame(2);
+  FrameBatch batch(2, 4, memgraph::utils::NewDeleteResource());
+  for (int i = 0; i < 4; ++i) {
+    frame[a] = TypedValue(i);
+    frame[b] = TypedValue(-i);
+    batch.Append(frame);
+  }
+  EXPECT_TRUE(batch.full());
+  EXPECT_EQ(batch.at(2, a).ValueInt(), 2);
+  EXPECT_EQ(batch.at(3, b).ValueInt(), -3);
+
+  // Keep only the odd rows.
+  size_t kept = 0;
+  for (size_t row = 0; row < batch.size(); ++row) {
+    batch.MoveRowToFrame(row, frame);
+    if (frame[a].ValueInt() % 2 == 1) batch.MoveFrameToRow(frame, kept++);
+  }
+  batch.Truncate(kept);
+  ASSERT_EQ(batch.size(), 2);
+  EXPECT_EQ(batch.at(0, a).ValueInt(), 1);
+  EXPECT_EQ(batch.at(1, b).ValueInt(), -3);
+
+  batch.Clear();
+  EXPECT_TRUE(batch.empty());
+}
+
+TEST_F(QueryPlanBatchTest, ScanExpandFilterProduce) {
+  // MATCH (n)-[r]->(m) WHERE m.prop < n.prop + 2 RETURN n.prop, m.prop
+  // Every other expanded row is filtered out.
+  auto n = MakeScanAll(storage, symbol_table_, "n");
+  auto r_m = MakeExpand(storage, symbol_table_, n.op_, n.sym_, "r", EdgeAtom::Direction::OUT, {}, "m", false,
+                        memgraph::storage::View::OLD);
+  auto m_p = PROPERTY_LOOKUP(dba_, IDENT("m")->MapTo(r_m.node_sym_), prop_);
+  auto n_p = PROPERTY_LOOKUP(dba_, IDENT("n")->MapTo(n.sym_), prop_);
+  auto filter = std::make_shared<Filter>(r_m.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                         LESS(m_p, ADD(n_p, LITERAL(2))));
+  auto produce = MakeProduce(filter, NEXPR("n.prop", n_p)->MapTo(symbol_table_.CreateSymbol("n.prop", true)),
+                             NEXPR("m.prop", m_p)->MapTo(symbol_table_.CreateSymbol("m.prop", true)));
+
+  auto context = MakeContext(storage, symbol_table_, &dba_);
+  auto expected = CollectProduce(*produce, &context);
+  EXPECT_EQ(expected.size(), kNumVertices - 1);
+  for (size_t capacity : {1UL, 7UL, 1024UL}) {
+    auto batch_context = MakeContext(storage, symbol_table_, &dba_);
+    ExpectSameResults(expected, CollectProduceBatched(*produce, &batch_context, capacity));
+  }
+}
+
+TEST_F(QueryPlanBatchTest, Aggregate) {
+  // MATCH (n)-[r]->(m) RETURN n, count(m), sum(m.prop)
+  auto n = MakeScanAll(storage, symbol_table_, "n");
+  auto r_m = MakeExpand(storage, symbol_table_, n.op_, n.sym_, "r", EdgeAtom::Direction::OUT, {}, "m", false,
+                        memgraph::storage::View::OLD);
+  auto m_p = PROPERTY_LOOKUP(dba_, IDENT("m")->MapTo(r_m.node_sym_), prop_);
+  auto count_sym = symbol_table_.CreateSymbol("count", true);
+  auto sum_sym = symbol_table_.CreateSymbol("sum", true);
+  auto aggregate = std::make_shared<Aggregate>(
+      r_m.op_,
+      std::vector<Aggregate::Element>{{nullptr, nullptr, Aggregation::Op::COUNT, count_sym, false},
+                                      {m_p, nullptr, Aggregation::Op::SUM, sum_sym, false}},
+      std::vector<Expression *>{IDENT("n")->MapTo(n.sym_)}, std::vector<Symbol>{n.sym_});
+  auto n_ne = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table_.CreateSymbol("n_ne", true));
+  auto count_ne = NEXPR("count", IDENT("count")->MapTo(count_sym))->MapTo(symbol_table_.CreateSymbol("c", true));
+  auto sum_ne = NEXPR("sum", IDENT("sum")->MapTo(sum_sym))->MapTo(symbol_table_.CreateSymbol("s", true));
+  auto produce = MakeProduce(aggregate, n_ne, count_ne, sum_ne);
+
+  auto context = MakeContext(storage, symbol_table_, &dba_);
+  auto results = CollectProduceBatched(*produce, &context, 16);
+  ASSERT_EQ(results.size(), kNumVertices - 1);
+  for (const auto &result : results) {
+    auto value = result[0].ValueVertex().GetProperty(memgraph::storage::View::OLD, prop_)->ValueInt();
+    auto degree = std::min<int64_t>(2, kNumVertices - 1 - value);
+    EXPECT_EQ(result[1].ValueInt(), degree);
+    EXPECT_EQ(result[2].ValueInt(), degree == 2 ? 2 * value + 3 : value + 1);
+  }
+}
+
+TEST_F(QueryPlanBatchTest, RowAdapter) {
+  // MATCH (n) WITH n SKIP 10 MATCH (n)-[r]->(m) RETURN m.prop
+  // Skip has no batch implementation, so Expand reads it through the row
+  // adapter while itself being pulled in batches.
+  auto n = MakeScanAll(storage, symbol_table_, "n");
+  auto skip = std::make_shared<Skip>(n.op_, LITERAL(10));
+  auto r_m = MakeExpand(storage, symbol_table_, skip, n.sym_, "r", EdgeAtom::Direction::OUT, {}, "m", false,
+                        memgraph::storage::View::OLD);
+  auto m_p = PROPERTY_LOOKUP(dba_, IDENT("m")->MapTo(r_m.node_sym_), prop_);
+  auto produce = MakeProduce(r_m.op_, NEXPR("m.prop", m_p)->MapTo(symbol_table_.CreateSymbol("m.prop", true)));
+
+  auto context = MakeContext(storage, symbol_table_, &dba_);
+  auto expected = CollectProduce(*produce, &context);
+  auto batch_context = MakeContext(storage, symbol_table_, &dba_);
+  ExpectSameResults(expected, CollectProduceBatched(*produce, &batch_context, 5));
+}
@@ -90,6 +90,7 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(Skip);
   PRE_VISIT(Limit);
   PRE_VISIT(OrderBy);
+  PRE_VISIT(TopK);
   PRE_VISIT(EvaluatePatternFilter);
 
   bool PreVisit(Merge &op) override {
@@ -208,6 +209,7 @@ using ExpectEdgeUniquenessFilter = OpChecker<EdgeUniquenessFilter>;
 using ExpectSkip = OpChecker<Skip>;
 using ExpectLimit = OpChecker<Limit>;
 using ExpectOrderBy = OpChecker<OrderBy>;
+using ExpectTopK = OpChecker<TopK>;
 using ExpectUnwind = OpChecker<Unwind>;
 using ExpectDistinct = OpChecker<Distinct>;
 using ExpectEvaluatePatternFilter = OpChecker<EvaluatePatternFilter>;
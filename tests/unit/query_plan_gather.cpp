@@ -0,0 +1,126 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "query/context.hpp"
+#include "query/plan/operator.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/vertex_info_cache.hpp"
+#include "utils/thread_pool.hpp"
+
+#include "query_plan_common.hpp"
+
+using namespace memgraph::query;
+using namespace memgraph::query::plan;
+
+class QueryPlanGatherTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    {
+      auto acc = db_->Access();
+      for (int64_t i = 0; i < kNumVertices; ++i) {
+        auto vertex = acc->CreateVertex();
+        ASSERT_FALSE(vertex.AddLabel(label_).HasError());
+        ASSERT_FALSE(vertex.SetProperty(prop_, memgraph::storage::PropertyValue(i)).HasError());
+      }
+      ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+    }
+    storage_dba_ = db_->Access();
+    dba_.emplace(storage_dba_.get());
+  }
+
+  void TearDown() override { FLAGS_delta_chain_cache_threshold = default_cache_threshold_; }
+
+  /// Changes every vertex `changes` times after the scanning transaction started, so that the scans have to apply
+  /// long delta chains (which get cached) to see the original vertices.
+  void ChangeVertices(int changes) {
+    auto acc = db_->Access();
+    for (auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+      for (int i = 0; i < changes; ++i) {
+        ASSERT_FALSE(vertex.SetProperty(prop_, memgraph::storage::PropertyValue(-i)).HasError());
+      }
+    }
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  /// MATCH (n) RETURN n.prop, with the scan split between the calling thread and the worker pool
+  std::vector<std::vector<TypedValue>> CollectScan(std::shared_ptr<LogicalOperator> scan, Symbol symbol) {
+    auto gather = std::make_shared<Gather>(scan, 4);
+    auto n_p = PROPERTY_LOOKUP(*dba_, IDENT("n")->MapTo(symbol), prop_);
+    auto produce = MakeProduce(gather, NEXPR("n.prop", n_p)->MapTo(symbol_table_.CreateSymbol("n.prop", true)));
+    auto context = MakeContext(storage, symbol_table_, &*dba_);
+    context.worker_pool = &worker_pool_;
+    return CollectProduce(*produce, &context);
+  }
+
+  void ExpectAllVertices(const std::vector<std::vector<TypedValue>> &results) {
+    ASSERT_EQ(results.size(), kNumVertices);
+    std::vector<int64_t> values;
+    for (const auto &row : results) values.push_back(row[0].ValueInt());
+    std::ranges::sort(values);
+    for (int64_t i = 0; i < kNumVertices; ++i) ASSERT_EQ(values[i], i);
+  }
+
+  static constexpr int64_t kNumVertices = 2000;
+
+  uint64_t default_cache_threshold_{FLAGS_delta_chain_cache_threshold};
+  memgraph::storage::Config config_;
+  std::unique_ptr<memgraph::storage::Storage> db_{std::make_unique<memgraph::storage::InMemoryStorage>(config_)};
+  memgraph::storage::LabelId label_{db_->NameToLabel("label")};
+  memgraph::storage::PropertyId prop_{db_->NameToProperty("prop")};
+  std::unique_ptr<memgraph::storage::Storage::Accessor> storage_dba_;
+  std::optional<DbAccessor> dba_;
+  memgraph::utils::ThreadPool worker_pool_{3};
+  AstStorage storage;
+  SymbolTable symbol_table_;
+};
+
+TEST_F(QueryPlanGatherTest, ScanAll) {
+  auto n = MakeScanAll(storage, symbol_table_, "n");
+  ExpectAllVertices(CollectScan(n.op_, n.sym_));
+}
+
+TEST_F(QueryPlanGatherTest, ScanAllLongDeltaChains) {
+  // Every vertex read by the scans gets cached, by the workers and by the calling thread at the same time
+  FLAGS_delta_chain_cache_threshold = 2;
+  ChangeVertices(8);
+  for (int run = 0; run < 10; ++run) {
+    auto n = MakeScanAll(storage, symbol_table_, "n");
+    ExpectAllVertices(CollectScan(n.op_, n.sym_));
+  }
+  {
+    auto n = MakeScanAllByLabel(storage, symbol_table_, "n", label_);
+    ExpectAllVertices(CollectScan(n.op_, n.sym_));
+  }
+}
+
+TEST(ThreadVertexInfoCache, Nesting) {
+  using memgraph::storage::ThreadVertexInfoCache;
+  EXPECT_EQ(ThreadVertexInfoCache::Current(), nullptr);
+  {
+    const ThreadVertexInfoCache outer;
+    auto *outer_cache = ThreadVertexInfoCache::Current();
+    ASSERT_NE(outer_cache, nullptr);
+    {
+      const ThreadVertexInfoCache inner;
+      EXPECT_NE(ThreadVertexInfoCache::Current(), outer_cache);
+    }
+    EXPECT_EQ(ThreadVertexInfoCache::Current(), outer_cache);
+  }
+  EXPECT_EQ(ThreadVertexInfoCache::Current(), nullptr);
+}
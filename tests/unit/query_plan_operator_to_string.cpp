@@ -576,6 +576,18 @@ TYPED_TEST(OperatorToStringTest, OrderBy) {
   EXPECT_EQ(last_op->ToString(), expected_string);
 }
 
+TYPED_TEST(OperatorToStringTest, TopK) {
+  Symbol person_sym = this->GetSymbol("person");
+  memgraph::storage::PropertyId name = this->dba.NameToProperty("name");
+  std::shared_ptr<LogicalOperator> last_op;
+  last_op = std::make_shared<TopK>(nullptr,
+                                   std::vector<SortItem>{{Ordering::ASC, PROPERTY_LOOKUP(this->dba, "person", name)}},
+                                   std::vector<Symbol>{person_sym}, LITERAL(10));
+
+  std::string expected_string{"TopK {person}"};
+  EXPECT_EQ(last_op->ToString(), expected_string);
+}
+
 TYPED_TEST(OperatorToStringTest, Merge) {
   Symbol node_sym = this->GetSymbol("node");
   memgraph::storage::LabelId label = this->dba.NameToLabel("label");
@@ -0,0 +1,238 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "flags/general.hpp"
+#include "query/context.hpp"
+#include "query/plan/operator.hpp"
+#include "query/plan/spill.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/query_memory_tracker.hpp"
+
+#include "query_plan_common.hpp"
+
+using namespace memgraph::query;
+using namespace memgraph::query::plan;
+
+class QueryPlanSpillTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    FLAGS_data_directory = data_directory_.string();
+    FLAGS_query_spill_threshold = 10;
+    // Pretend that the query already uses half of its memory limit, so
+    // operators start spilling as soon as they hold enough rows.
+    auto &tracker = storage_dba_->GetQueryMemoryTracker();
+    tracker = std::make_unique<memgraph::utils::QueryMemoryTracker>();
+    tracker->SetQueryLimit(1UL << 30U);
+    tracker->TrackAlloc(1UL << 29U);
+  }
+
+  void TearDown() override {
+    FLAGS_query_spill_threshold = 0;
+    std::filesystem::remove_all(data_directory_);
+  }
+
+  /// Creates vertices, in random order, with `prop` set to 0..num_vertices-1
+  /// modulo `modulo`.
+  void CreateVertices(int num_vertices, int modulo) {
+    std::vector<int> values(num_vertices);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937{42});
+    for (auto value : values) {
+      ASSERT_TRUE(dba_.InsertVertex().SetProperty(prop_, memgraph::storage::PropertyValue(value % modulo)).HasValue());
+    }
+    dba_.AdvanceCommand();
+  }
+
+  std::filesystem::path data_directory_{std::filesystem::temp_directory_path() / "MG_tests_unit_query_plan_spill"};
+  memgraph::storage::Config config_;
+  std::unique_ptr<memgraph::storage::Storage> db_{std::make_unique<memgraph::storage::InMemoryStorage>(config_)};
+  std::unique_ptr<memgraph::storage::Storage::Accessor> storage_dba_{db_->Access()};
+  DbAccessor dba_{storage_dba_.get()};
+  memgraph::storage::PropertyId prop_{dba_.NameToProperty("prop")};
+  AstStorage storage;
+  SymbolTable symbol_table_;
+};
+
+TEST_F(QueryPlanSpillTest, SpillThresholdExceeded) {
+  EXPECT_TRUE(SpillThresholdExceeded(&dba_));
+  FLAGS_query_spill_threshold = 60;
+  EXPECT_FALSE(SpillThresholdExceeded(&dba_));
+  FLAGS_query_spill_threshold = 0;
+  EXPECT_FALSE(SpillThresholdExceeded(&dba_));
+}
+
+TEST_F(QueryPlanSpillTest, SpillFileRoundTrip) {
+  auto vertex = dba_.InsertVertex();
+  dba_.AdvanceCommand();
+
+  std::vector<TypedValue> row;
+  row.emplace_back();
+  row.emplace_back(true);
+  row.emplace_back(42);
+  row.emplace_back(3.5);
+  row.emplace_back("spill");
+  row.emplace_back(std::vector<TypedValue>{TypedValue(1), TypedValue("two")});
+  row.emplace_back(std::map<std::string, TypedValue>{{"key", TypedValue(1.5)}});
+  row.emplace_back(vertex);
+  row.emplace_back(memgraph::utils::Duration(1234));
+  row.emplace_back(memgraph::storage::Point2d(memgraph::storage::CoordinateReferenceSystem::Cartesian_2d, 1.0, 2.0));
+  row.emplace_back(memgraph::storage::Enum(memgraph::storage::EnumTypeId{1}, memgraph::storage::EnumValueId{2}));
+  for (const auto &value : row) ASSERT_TRUE(IsSpillable(value));
+
+  SpillFile file;
+  file.WriteRow(row);
+  file.WriteRow(std::vector<TypedValue>{});
+  EXPECT_EQ(file.rows(), 2);
+  file.FinishWriting();
+
+  memgraph::utils::pmr::vector<TypedValue> read(memgraph::utils::NewDeleteResource());
+  ASSERT_TRUE(file.ReadRow(&read));
+  ASSERT_EQ(read.size(), row.size());
+  for (size_t i = 0; i < row.size(); ++i) {
+    EXPECT_TRUE(TypedValue::BoolEqual{}(read[i], row[i])) << i;
+  }
+  ASSERT_TRUE(file.ReadRow(&read));
+  EXPECT_TRUE(read.empty());
+  EXPECT_FALSE(file.ReadRow(&read));
+}
+
+TEST_F(QueryPlanSpillTest, OrderBy) {
+  const int kNumVertices = 5000;
+  CreateVertices(kNumVertices, kNumVertices);
+
+  auto n = MakeScanAll(this->storage, symbol_table_, "n");
+  auto n_p = PROPERTY_LOOKUP(dba_, IDENT("n")->MapTo(n.sym_), prop_);
+  auto order_by = std::make_shared<plan::OrderBy>(n.op_, std::vector<SortItem>{{Ordering::DESC, n_p}},
+                                                  std::vector<Symbol>{n.sym_});
+  auto n_p_ne = NEXPR("n.p", n_p)->MapTo(symbol_table_.CreateSymbol("n.p", true));
+  auto produce = MakeProduce(order_by, n_p_ne);
+  auto context = MakeContext(this->storage, symbol_table_, &dba_);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), kNumVertices);
+  for (int i = 0; i < kNumVertices; ++i) {
+    EXPECT_EQ(results[i][0].ValueInt(), kNumVertices - 1 - i);
+  }
+}
+
+TEST_F(QueryPlanSpillTest, OrderByManyRuns) {
+  // The faked memory usage never goes down, like the usage of a real query
+  // after a spill, so a run is written every 1024 rows.
+  const int kNumRuns = 200;
+  const int kNumVertices = kNumRuns * 1024;
+  CreateVertices(kNumVertices, kNumVertices);
+
+  // The runs have to be merged while they're written, otherwise each of them
+  // holds a file descriptor until the end.
+  const auto open_files = std::distance(std::filesystem::directory_iterator("/proc/self/fd"), {});
+  rlimit old_limit{};
+  ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &old_limit), 0);
+  rlimit limit = old_limit;
+  limit.rlim_cur = open_files + kNumRuns / 2;
+  ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &limit), 0);
+  const memgraph::utils::OnScopeExit restore_limit{[&] { setrlimit(RLIMIT_NOFILE, &old_limit); }};
+
+  auto n = MakeScanAll(this->storage, symbol_table_, "n");
+  auto n_p = PROPERTY_LOOKUP(dba_, IDENT("n")->MapTo(n.sym_), prop_);
+  auto order_by = std::make_shared<plan::OrderBy>(n.op_, std::vector<SortItem>{{Ordering::ASC, n_p}},
+                                                  std::vector<Symbol>{n.sym_});
+  auto n_p_ne = NEXPR("n.p", n_p)->MapTo(symbol_table_.CreateSymbol("n.p", true));
+  auto produce = MakeProduce(order_by, n_p_ne);
+  auto context = MakeContext(this->storage, symbol_table_, &dba_);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), kNumVertices);
+  for (int i = 0; i < kNumVertices; ++i) {
+    ASSERT_EQ(results[i][0].ValueInt(), i);
+  }
+}
+
+TEST_F(QueryPlanSpillTest, Distinct) {
+  const int kNumValues = 3000;
+  CreateVertices(3 * kNumValues, kNumValues);
+
+  auto n = MakeScanAll(this->storage, symbol_table_, "n");
+  auto n_p = PROPERTY_LOOKUP(dba_, IDENT("n")->MapTo(n.sym_), prop_);
+  auto n_p_sym = symbol_table_.CreateSymbol("n.p", true);
+  auto produce = MakeProduce(n.op_, NEXPR("n.p", n_p)->MapTo(n_p_sym));
+  auto distinct = std::make_shared<plan::Distinct>(produce, std::vector<Symbol>{n_p_sym});
+  auto x_ne = NEXPR("x", IDENT("n.p")->MapTo(n_p_sym))->MapTo(symbol_table_.CreateSymbol("x", true));
+  auto context = MakeContext(this->storage, symbol_table_, &dba_);
+  auto results = CollectProduce(*MakeProduce(distinct, x_ne), &context);
+  ASSERT_EQ(results.size(), kNumValues);
+  std::vector<int64_t> values;
+  for (const auto &result : results) values.push_back(result[0].ValueInt());
+  std::ranges::sort(values);
+  for (int i = 0; i < kNumValues; ++i) EXPECT_EQ(values[i], i);
+}
+
+TEST_F(QueryPlanSpillTest, Aggregate) {
+  const int kNumGroups = 3000;
+  CreateVertices(3 * kNumGroups, kNumGroups);
+
+  auto n = MakeScanAll(this->storage, symbol_table_, "n");
+  auto n_p = PROPERTY_LOOKUP(dba_, IDENT("n")->MapTo(n.sym_), prop_);
+  auto count_sym = symbol_table_.CreateSymbol("count", true);
+  auto sum_sym = symbol_table_.CreateSymbol("sum", true);
+  auto aggregate = std::make_shared<plan::Aggregate>(
+      n.op_,
+      std::vector<Aggregate::Element>{{nullptr, nullptr, Aggregation::Op::COUNT, count_sym, false},
+                                      {n_p, nullptr, Aggregation::Op::SUM, sum_sym, false}},
+      std::vector<Expression *>{n_p}, std::vector<Symbol>{n.sym_});
+  auto n_ne = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table_.CreateSymbol("n_ne", true));
+  auto count_ne = NEXPR("count", IDENT("count")->MapTo(count_sym))->MapTo(symbol_table_.CreateSymbol("c", true));
+  auto sum_ne = NEXPR("sum", IDENT("sum")->MapTo(sum_sym))->MapTo(symbol_table_.CreateSymbol("s", true));
+  auto context = MakeContext(this->storage, symbol_table_, &dba_);
+  auto results = CollectProduce(*MakeProduce(aggregate, n_ne, count_ne, sum_ne), &context);
+  ASSERT_EQ(results.size(), kNumGroups);
+  std::vector<int64_t> groups;
+  for (const auto &result : results) {
+    // The remembered vertex belongs to the group.
+    auto value = result[0].ValueVertex().GetProperty(memgraph::storage::View::OLD, prop_)->ValueInt();
+    EXPECT_EQ(result[1].ValueInt(), 3);
+    EXPECT_EQ(result[2].ValueInt(), 3 * value);
+    groups.push_back(value);
+  }
+  std::ranges::sort(groups);
+  for (int i = 0; i < kNumGroups; ++i) EXPECT_EQ(groups[i], i);
+}
+
+TEST_F(QueryPlanSpillTest, HashJoin) {
+  const int kNumVertices = 3000;
+  CreateVertices(kNumVertices, kNumVertices);
+
+  auto n = MakeScanAll(this->storage, symbol_table_, "n");
+  auto m = MakeScanAll(this->storage, symbol_table_, "m");
+  auto n_p = PROPERTY_LOOKUP(dba_, IDENT("n")->MapTo(n.sym_), prop_);
+  auto m_p = PROPERTY_LOOKUP(dba_, IDENT("m")->MapTo(m.sym_), prop_);
+  auto hash_join = std::make_shared<plan::HashJoin>(n.op_, std::vector<Symbol>{n.sym_}, m.op_,
+                                                    std::vector<Symbol>{m.sym_}, EQ(n_p, m_p));
+  auto n_ne = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table_.CreateSymbol("n_ne", true));
+  auto m_ne = NEXPR("m", IDENT("m")->MapTo(m.sym_))->MapTo(symbol_table_.CreateSymbol("m_ne", true));
+  auto context = MakeContext(this->storage, symbol_table_, &dba_);
+  auto results = CollectProduce(*MakeProduce(hash_join, n_ne, m_ne), &context);
+  ASSERT_EQ(results.size(), kNumVertices);
+  for (const auto &result : results) {
+    EXPECT_EQ(result[0].ValueVertex(), result[1].ValueVertex());
+  }
+}
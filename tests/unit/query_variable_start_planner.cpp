@@ -22,6 +22,7 @@
 #include "query/frontend/semantic/symbol_generator.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/plan/planner.hpp"
+#include "query/plan/variable_start_planner.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "typed_value.hpp"
@@ -489,4 +490,62 @@ TYPED_TEST(TestVariableStartPlanner, TestSubqueryWithTripleUnion) {
                dba);
   });
 }
+
+// Prefers the expansions over `s` edges, which are much fewer than the `r` edges.
+class FewerSEdgesCostModel final : public ExpansionCostModel {
+ public:
+  double VerticesCount() const override { return 1000; }
+  double NodeSelectivity(const memgraph::query::Symbol &, const Filters &) const override { return 1; }
+  double Degree(const EdgeAtom &edge, const memgraph::query::Symbol &, EdgeAtom::Direction,
+                const Filters &) const override {
+    return edge.identifier_->name_ == "s" ? 1 : 100;
+  }
+};
+
+class TestExpansionOrder : public testing::Test {
+ protected:
+  void SetUp() override { FLAGS_query_max_join_order_expansions = 10; }
+  void TearDown() override { FLAGS_query_max_join_order_expansions = 0; }
+
+  AstStorage storage;
+};
+
+TEST_F(TestExpansionOrder, ExpansionsOrderedByCost) {
+  // Test MATCH (a) -[r]-> (b) <-[s]- (c) RETURN a
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("a"), EDGE("r", Direction::OUT), NODE("b"), EDGE("s", Direction::IN), NODE("c"))),
+      RETURN("a")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto query_parts = CollectQueryParts(symbol_table, storage, query, false);
+  const auto &matching = query_parts.query_parts.at(0).single_query_parts.at(0).matching;
+  ASSERT_EQ(matching.expansions.size(), 2);
+
+  std::vector<std::vector<Expansion>> breadth_first;
+  for (const auto &variant : impl::VaryMatchingStart(matching, symbol_table)) {
+    breadth_first.push_back(variant.expansions);
+  }
+  std::vector<std::vector<Expansion>> by_cost;
+  for (const auto &variant :
+       impl::VaryMatchingStart(matching, symbol_table, std::make_shared<FewerSEdgesCostModel>())) {
+    by_cost.push_back(variant.expansions);
+  }
+  // Starting nodes are `a`, `r`, `b`, `s` and `c`.
+  ASSERT_EQ(breadth_first.size(), 5);
+  ASSERT_EQ(by_cost.size(), 5);
+
+  // From `b`, the breadth-first order expands over `r` first, while the
+  // cheaper order expands over `s` first.
+  EXPECT_EQ(breadth_first[2][0].edge->identifier_->name_, "r");
+  EXPECT_EQ(by_cost[2][0].edge->identifier_->name_, "s");
+  EXPECT_EQ(by_cost[2][0].node1->identifier_->name_, "b");
+  EXPECT_FALSE(by_cost[2][0].is_flipped);
+  EXPECT_EQ(by_cost[2][1].edge->identifier_->name_, "r");
+  EXPECT_EQ(by_cost[2][1].node1->identifier_->name_, "b");
+  EXPECT_TRUE(by_cost[2][1].is_flipped);
+  EXPECT_EQ(by_cost[2][1].direction, Direction::IN);
+
+  // From `a` there is only a single order.
+  EXPECT_EQ(by_cost[0][0].edge->identifier_->name_, "r");
+  EXPECT_EQ(by_cost[0][1].edge->identifier_->name_, "s");
+}
 }  // namespace
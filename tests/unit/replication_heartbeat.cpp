@@ -0,0 +1,150 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rpc_messages.hpp"
+
+#include "replication/config.hpp"
+#include "replication/replication_client.hpp"
+#include "replication/replication_server.hpp"
+#include "replication_coordination_glue/messages.hpp"
+#include "rpc/utils.hpp"  // Needs to be included last so that SLK definitions are seen
+#include "utils/timer.hpp"
+
+using memgraph::io::network::Endpoint;
+using memgraph::replication::ReplicationClient;
+using memgraph::replication::ReplicationClientConfig;
+using memgraph::replication::ReplicationServer;
+using memgraph::replication::ReplicationServerConfig;
+using memgraph::replication_coordination_glue::FrequentHeartbeatRpc;
+using memgraph::replication_coordination_glue::ReplicationMode;
+using memgraph::slk::Load;
+using testing::ElementsAreArray;
+
+using namespace std::literals::chrono_literals;
+
+namespace memgraph::slk {
+void Save(const SumReq &sum, Builder *builder) {
+  Save(sum.x, builder);
+  Save(sum.y, builder);
+}
+
+void Load(SumReq *sum, Reader *reader) {
+  Load(&sum->x, reader);
+  Load(&sum->y, reader);
+}
+
+void Save(const SumRes &res, Builder *builder) { Save(res.sum, builder); }
+
+void Load(SumRes *res, Reader *reader) { Load(&res->sum, reader); }
+}  // namespace memgraph::slk
+
+void SumReq::Load(SumReq *obj, memgraph::slk::Reader *reader) { memgraph::slk::Load(obj, reader); }
+void SumReq::Save(const SumReq &obj, memgraph::slk::Builder *builder) { memgraph::slk::Save(obj, builder); }
+
+void SumRes::Load(SumRes *obj, memgraph::slk::Reader *reader) { memgraph::slk::Load(obj, reader); }
+void SumRes::Save(const SumRes &obj, memgraph::slk::Builder *builder) { memgraph::slk::Save(obj, builder); }
+
+// `Sum` stands in for the data RPCs (transactions, recovery), which main sends
+// over the ordered `rpc_client_`.
+class ReplicationHeartbeatTest : public testing::Test {
+ protected:
+  void TearDown() override { server_.Shutdown(); }
+
+  auto ClientConfig() -> ReplicationClientConfig {
+    return {.name = "REPLICA",
+            .mode = ReplicationMode::SYNC,
+            .repl_server_endpoint = server_.rpc_server_.endpoint(),
+            // The test sends the heartbeats itself
+            .replica_check_frequency = std::chrono::seconds(0)};
+  }
+
+  ReplicationServer server_{ReplicationServerConfig{.repl_server = Endpoint("127.0.0.1", 0)}};
+};
+
+TEST_F(ReplicationHeartbeatTest, HeartbeatWhileDataRpcHoldsClient) {
+  std::atomic<bool> data_rpc_started{false};
+  server_.rpc_server_.Register<Sum>([&](auto *req_reader, auto *res_builder) {
+    SumReq req;
+    Load(&req, req_reader);
+    data_rpc_started = true;
+    std::this_thread::sleep_for(1s);
+    SumRes res(req.x + req.y);
+    memgraph::rpc::SendFinalResponse(res, res_builder);
+  });
+  ASSERT_TRUE(server_.Start());
+  std::this_thread::sleep_for(100ms);
+
+  ReplicationClient client(ClientConfig());
+  std::jthread data_rpc([&client] {
+    auto stream = client.rpc_client_.Stream<Sum>(1, 2);
+    EXPECT_EQ(stream.SendAndWait().sum, 3);
+  });
+  while (!data_rpc_started) std::this_thread::sleep_for(1ms);
+
+  // The ordered client is locked and the server thread of its connection is
+  // busy, neither holds up the heartbeat
+  memgraph::utils::Timer timer;
+  client.heartbeat_client_pool_.Call<FrequentHeartbeatRpc>();
+  EXPECT_LT(timer.Elapsed(), 500ms);
+}
+
+TEST_F(ReplicationHeartbeatTest, DataRpcsStayOrdered) {
+  std::mutex lock;
+  std::vector<int> received;
+  std::atomic<int> running{0};
+  std::atomic<int> max_running{0};
+  server_.rpc_server_.Register<Sum>([&](auto *req_reader, auto *res_builder) {
+    SumReq req;
+    Load(&req, req_reader);
+    auto const now_running = ++running;
+    max_running = std::max(max_running.load(), now_running);
+    {
+      auto guard = std::lock_guard{lock};
+      received.push_back(req.x);
+    }
+    std::this_thread::sleep_for(1ms);
+    --running;
+    SumRes res(req.x + req.y);
+    memgraph::rpc::SendFinalResponse(res, res_builder);
+  });
+  ASSERT_TRUE(server_.Start());
+  std::this_thread::sleep_for(100ms);
+
+  constexpr int kDataRpcs = 200;
+  ReplicationClient client(ClientConfig());
+  std::vector<int> sent;
+  {
+    // Heartbeats keep the second server thread busy in the meantime
+    std::atomic<bool> done{false};
+    std::jthread heartbeats([&client, &done] {
+      while (!done) client.heartbeat_client_pool_.Call<FrequentHeartbeatRpc>();
+    });
+    for (int i = 0; i < kDataRpcs; ++i) {
+      auto stream = client.rpc_client_.Stream<Sum>(i, 0);
+      EXPECT_EQ(stream.SendAndWait().sum, i);
+      sent.push_back(i);
+    }
+    done = true;
+  }
+
+  EXPECT_THAT(received, ElementsAreArray(sent));
+  // The data RPCs of the single connection are never handled by both server threads at once
+  EXPECT_EQ(max_running, 1);
+}
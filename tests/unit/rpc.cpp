@@ -166,6 +166,46 @@ TEST(Rpc, ClientPool) {
   server.AwaitShutdown();
 }
 
+TEST(Rpc, ClientPoolMaxIdleClients) {
+  memgraph::communication::ServerContext server_context;
+  Server server({"127.0.0.1", 0}, &server_context, /* workers */ 4);
+  auto const on_exit = memgraph::utils::OnScopeExit{[&] {
+    server.Shutdown();
+    server.AwaitShutdown();
+  }};
+  server.Register<Sum>([](const auto &req_reader, auto *res_builder) {
+    SumReq req;
+    Load(&req, req_reader);
+    std::this_thread::sleep_for(100ms);
+    SumRes res(req.x + req.y);
+    memgraph::rpc::SendFinalResponse(res, res_builder);
+  });
+  ASSERT_TRUE(server.Start());
+  std::this_thread::sleep_for(100ms);
+
+  memgraph::communication::ClientContext pool_context;
+  ClientPool pool(server.endpoint(), &pool_context, Client::default_rpc_timeouts_ms, /* max_idle_clients */ 2);
+  EXPECT_EQ(pool.IdleClientCount(), 0);
+
+  auto get_sum = [&pool](int x, int y) {
+    auto sum = pool.Call<Sum>(x, y);
+    EXPECT_EQ(sum.sum, x + y);
+  };
+
+  // The concurrent calls open a connection each, only two of them are kept afterwards
+  {
+    std::vector<std::jthread> threads;
+    for (int i = 0; i < 4; ++i) {
+      threads.emplace_back(get_sum, 2 * i, 2 * i + 1);
+    }
+  }
+  EXPECT_EQ(pool.IdleClientCount(), 2);
+
+  // The idle connections are reused
+  get_sum(1, 2);
+  EXPECT_EQ(pool.IdleClientCount(), 2);
+}
+
 TEST(Rpc, LargeMessage) {
   memgraph::communication::ServerContext server_context;
   Server server({"127.0.0.1", 0}, &server_context);
@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <thread>
 #include <vector>
 
 #include <fmt/format.h>
@@ -899,3 +900,131 @@ TEST(SkipList, EstimateAverageNumberOfEquals5) {
     ASSERT_EQ(count, kMaxElements);
   }
 }
+
+TEST(SkipList, ChunkBoundaries) {
+  memgraph::utils::SkipList<int64_t> list;
+
+  {
+    auto acc = list.access();
+    // An empty list can't be split.
+    ASSERT_TRUE(acc.chunk_boundaries(8).empty());
+    for (int64_t i = 0; i < 100000; ++i) {
+      acc.insert(i);
+    }
+    // Asking for a single chunk yields no boundaries.
+    ASSERT_TRUE(acc.chunk_boundaries(1).empty());
+  }
+
+  const uint64_t kNumChunks = 16;
+  auto acc = list.access();
+  auto boundaries = acc.chunk_boundaries(kNumChunks);
+  ASSERT_GT(boundaries.size(), 0);
+  ASSERT_LT(boundaries.size(), kNumChunks);
+
+  // Boundaries are strictly increasing and together with `begin()` they cover
+  // the whole list exactly once.
+  std::vector<int64_t> starts{*acc.begin()};
+  for (const auto &it : boundaries) {
+    ASSERT_NE(it, acc.end());
+    ASSERT_GT(*it, starts.back());
+    starts.push_back(*it);
+  }
+  uint64_t covered = 0;
+  for (size_t i = 0; i < starts.size(); ++i) {
+    auto it = acc.find_equal_or_greater(starts[i]);
+    for (; it != acc.end() && (i + 1 == starts.size() || *it < starts[i + 1]); ++it) {
+      ++covered;
+    }
+  }
+  ASSERT_EQ(covered, list.size());
+
+  // No chunk should be wildly bigger than the average.
+  starts.push_back(100000);
+  for (size_t i = 0; i + 1 < starts.size(); ++i) {
+    ASSERT_LT(starts[i + 1] - starts[i], 4 * 100000 / kNumChunks);
+  }
+}
+
+TEST(SkipList, Builder) {
+  memgraph::utils::SkipList<int64_t> list;
+  {
+    auto acc = list.access();
+    acc.insert(5000);
+
+    // Runs can be linked before, after and between the existing items.
+    for (int64_t start : {0, 10000, 6000}) {
+      auto builder = acc.builder();
+      for (int64_t i = start; i < start + 1000; ++i) {
+        auto it = builder.append(i);
+        ASSERT_NE(it, acc.end());
+        ASSERT_EQ(*it, i);
+      }
+      // Objects have to be appended in ascending order.
+      ASSERT_EQ(builder.append(start), acc.end());
+      ASSERT_EQ(builder.size(), 1000);
+      // The run isn't visible before it is linked.
+      ASSERT_FALSE(acc.contains(start));
+      ASSERT_TRUE(builder.link());
+      ASSERT_EQ(builder.size(), 0);
+    }
+    ASSERT_EQ(acc.size(), 3001);
+
+    // A run overlapping the items in the list isn't linked.
+    auto builder = acc.builder();
+    builder.append(4000);
+    builder.append(5500);
+    ASSERT_FALSE(builder.link());
+    builder.clear();
+    builder.append(10999);
+    ASSERT_FALSE(builder.link());
+    ASSERT_EQ(acc.size(), 3001);
+  }
+
+  auto acc = list.access();
+  int64_t prev = -1;
+  for (auto item : acc) {
+    ASSERT_GT(item, prev);
+    prev = item;
+  }
+  for (int64_t i = 0; i < 11000; ++i) {
+    bool expected = (i < 1000) || i == 5000 || (i >= 6000 && i < 7000) || (i >= 10000);
+    ASSERT_EQ(acc.contains(i), expected);
+  }
+
+  // The linked items behave as the inserted ones.
+  ASSERT_TRUE(acc.insert(1500).second);
+  ASSERT_FALSE(acc.insert(500).second);
+  for (int64_t i = 0; i < 1000; i += 2) {
+    ASSERT_TRUE(acc.remove(i));
+  }
+  ASSERT_EQ(acc.size(), 2502);
+  ASSERT_EQ(*acc.find_equal_or_greater(6999), 6999);
+  ASSERT_EQ(*acc.find_equal_or_greater(7000), 10000);
+}
+
+TEST(SkipList, BuilderConcurrentLink) {
+  const int64_t kNumThreads = 8;
+  const int64_t kRunSize = 10000;
+  memgraph::utils::SkipList<int64_t> list;
+
+  std::vector<std::thread> threads;
+  for (int64_t t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&list, t] {
+      auto acc = list.access();
+      auto builder = acc.builder();
+      for (int64_t i = 0; i < kRunSize; ++i) {
+        builder.append(t * kRunSize + i);
+      }
+      ASSERT_TRUE(builder.link());
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  auto acc = list.access();
+  ASSERT_EQ(acc.size(), kNumThreads * kRunSize);
+  int64_t expected = 0;
+  for (auto item : acc) {
+    ASSERT_EQ(item, expected++);
+  }
+  ASSERT_EQ(expected, kNumThreads * kRunSize);
+}
@@ -412,6 +412,7 @@ TYPED_TEST(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case memgraph::storage::durability::Marker::SECTION_EDGE_INDICES:
         case memgraph::storage::durability::Marker::SECTION_OFFSETS:
         case memgraph::storage::durability::Marker::SECTION_ENUMS:
+        case memgraph::storage::durability::Marker::SECTION_COMPRESSED:
         case memgraph::storage::durability::Marker::DELTA_VERTEX_CREATE:
         case memgraph::storage::durability::Marker::DELTA_VERTEX_DELETE:
         case memgraph::storage::durability::Marker::DELTA_VERTEX_ADD_LABEL:
@@ -556,3 +557,43 @@ TYPED_TEST(DecoderEncoderTest, EncoderPosition) {
     ASSERT_EQ(pos, decoder.GetSize());
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(DecoderEncoderTest, CompressedBlocks) {
+  const std::string value(1000, 'x');
+  uint64_t blocks_end = 0;
+  {
+    memgraph::storage::durability::Encoder<TypeParam> encoder;
+    encoder.Initialize(this->storage_file, kTestMagic, kTestVersion);
+    encoder.WriteMarker(memgraph::storage::durability::Marker::SECTION_VERTEX);
+    encoder.StartCompressedBlocks(memgraph::utils::CompressionLevel::MID);
+    for (uint64_t i = 0; i < 100; ++i) {
+      encoder.WriteMarker(memgraph::storage::durability::Marker::SECTION_VERTEX);
+      encoder.WriteUint(i);
+      encoder.WriteString(value);
+      encoder.EndCompressedBlock(i % 30 == 29);
+    }
+    encoder.FinishCompressedBlocks();
+    blocks_end = encoder.GetPosition();
+    encoder.WriteMarker(memgraph::storage::durability::Marker::SECTION_EDGE);
+    encoder.Finalize();
+  }
+  {
+    memgraph::storage::durability::Decoder decoder;
+    auto version = decoder.Initialize(this->storage_file, kTestMagic);
+    ASSERT_TRUE(version);
+    ASSERT_EQ(*version, kTestVersion);
+    ASSERT_EQ(decoder.ReadMarker(), memgraph::storage::durability::Marker::SECTION_VERTEX);
+    for (uint64_t i = 0; i < 100; ++i) {
+      ASSERT_EQ(decoder.PeekMarker(), memgraph::storage::durability::Marker::SECTION_VERTEX);
+      ASSERT_EQ(decoder.ReadMarker(), memgraph::storage::durability::Marker::SECTION_VERTEX);
+      ASSERT_EQ(decoder.ReadUint(), i);
+      ASSERT_EQ(decoder.ReadString(), value);
+    }
+    ASSERT_EQ(decoder.GetPosition(), blocks_end);
+    ASSERT_EQ(decoder.ReadMarker(), memgraph::storage::durability::Marker::SECTION_EDGE);
+    ASSERT_EQ(decoder.GetPosition(), decoder.GetSize());
+    // The data was compressed
+    ASSERT_LT(*decoder.GetSize(), 100 * value.size());
+  }
+}
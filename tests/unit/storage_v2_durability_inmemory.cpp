@@ -28,6 +28,7 @@
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "dbms/database.hpp"
 #include "flags/experimental.hpp"
@@ -1815,6 +1816,120 @@ TEST_P(DurabilityTest, SnapshotBackup) {
   ASSERT_EQ(GetBackupWalsList().size(), 0);
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotIncremental) {
+  auto const is_incremental = [](std::filesystem::path const &path) {
+    return path.filename().string().ends_with("_incremental");
+  };
+  memgraph::storage::Gid gid_v1;
+  memgraph::storage::Gid gid_v4;
+  memgraph::storage::Gid gid_e2;
+  // Create a full snapshot followed by two incremental ones.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT,
+                       .snapshot_interval = memgraph::utils::SchedulerInterval{std::chrono::minutes(20)},
+                       .snapshot_incremental_count = 2},
+        .salient = {.items = {.properties_on_edges = GetParam(), .enable_schema_info = true}},
+    };
+    memgraph::utils::Synchronized<memgraph::replication::ReplicationState, memgraph::utils::RWSpinLock> repl_state{
+        memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    auto *mem_storage = static_cast<memgraph::storage::InMemoryStorage *>(db.storage());
+    auto const label = db.storage()->NameToLabel("L");
+    auto const property = db.storage()->NameToProperty("p");
+    auto const edge_type = db.storage()->NameToEdgeType("E");
+    std::vector<memgraph::storage::Gid> gids;
+    {
+      auto acc = db.Access();
+      for (int64_t i = 0; i < 3; ++i) {
+        auto vertex = acc->CreateVertex();
+        ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+        ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+        gids.push_back(vertex.Gid());
+      }
+      auto v1 = acc->FindVertex(gids[0], memgraph::storage::View::NEW);
+      auto v2 = acc->FindVertex(gids[1], memgraph::storage::View::NEW);
+      ASSERT_TRUE(acc->CreateEdge(&*v1, &*v2, edge_type).HasValue());
+      ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+    }
+    gid_v1 = gids[0];
+    auto full = mem_storage->CreateSnapshot(memgraph::replication_coordination_glue::ReplicationRole::MAIN);
+    ASSERT_FALSE(full.HasError());
+    ASSERT_FALSE(is_incremental(full.GetValue()));
+
+    {
+      auto acc = db.Access();
+      auto v1 = acc->FindVertex(gids[0], memgraph::storage::View::OLD);
+      ASSERT_TRUE(v1->SetProperty(property, memgraph::storage::PropertyValue(10)).HasValue());
+      auto v3 = acc->FindVertex(gids[2], memgraph::storage::View::OLD);
+      ASSERT_TRUE(acc->DeleteVertex(&*v3).HasValue());
+      auto v4 = acc->CreateVertex();
+      gid_v4 = v4.Gid();
+      auto edge = acc->CreateEdge(&v4, &*v1, edge_type);
+      ASSERT_TRUE(edge.HasValue());
+      gid_e2 = edge->Gid();
+      if (GetParam()) {
+        ASSERT_TRUE(edge->SetProperty(property, memgraph::storage::PropertyValue("e2")).HasValue());
+      }
+      ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+    }
+    auto first = mem_storage->CreateSnapshot(memgraph::replication_coordination_glue::ReplicationRole::MAIN);
+    ASSERT_FALSE(first.HasError());
+    ASSERT_TRUE(is_incremental(first.GetValue()));
+
+    {
+      auto acc = db.Access();
+      auto v2 = acc->FindVertex(gids[1], memgraph::storage::View::OLD);
+      ASSERT_TRUE(acc->DetachDeleteVertex(&*v2).HasValue());
+      ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+    }
+    auto second = mem_storage->CreateSnapshot(memgraph::replication_coordination_glue::ReplicationRole::MAIN);
+    ASSERT_FALSE(second.HasError());
+    ASSERT_TRUE(is_incremental(second.GetValue()));
+
+    // The chain is full, the next snapshot is a full one.
+    auto next = mem_storage->CreateSnapshot(memgraph::replication_coordination_glue::ReplicationRole::MAIN, true);
+    ASSERT_FALSE(next.HasError());
+    ASSERT_FALSE(is_incremental(next.GetValue()));
+    ASSERT_TRUE(std::filesystem::remove(next.GetValue()));
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 3);
+  ASSERT_EQ(GetBackupSnapshotsList().size(), 0);
+  ASSERT_EQ(GetWalsList().size(), 0);
+
+  // Recover the full snapshot and apply the incremental ones.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam(), .enable_schema_info = true}},
+  };
+  memgraph::utils::Synchronized<memgraph::replication::ReplicationState, memgraph::utils::RWSpinLock> repl_state{
+      memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  auto const property = db.storage()->NameToProperty("p");
+  auto acc = db.Access();
+  ASSERT_EQ(acc->ApproximateVertexCount(), 2);
+  ASSERT_EQ(acc->ApproximateEdgeCount(), 1);
+  auto v1 = acc->FindVertex(gid_v1, memgraph::storage::View::OLD);
+  ASSERT_TRUE(v1);
+  ASSERT_EQ(*v1->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(10));
+  ASSERT_THAT(*v1->Labels(memgraph::storage::View::OLD), UnorderedElementsAre(db.storage()->NameToLabel("L")));
+  ASSERT_EQ(v1->OutEdges(memgraph::storage::View::OLD)->edges.size(), 0);
+  auto in_edges = v1->InEdges(memgraph::storage::View::OLD);
+  ASSERT_EQ(in_edges->edges.size(), 1);
+  const auto &edge = in_edges->edges[0];
+  ASSERT_EQ(edge.Gid(), gid_e2);
+  ASSERT_EQ(edge.FromVertex().Gid(), gid_v4);
+  if (GetParam()) {
+    ASSERT_EQ(*edge.GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue("e2"));
+  }
+  auto v4 = acc->FindVertex(gid_v4, memgraph::storage::View::OLD);
+  ASSERT_TRUE(v4);
+  ASSERT_EQ(v4->OutEdges(memgraph::storage::View::OLD)->edges.size(), 1);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_F(DurabilityTest, SnapshotWithoutPropertiesOnEdgesRecoveryWithPropertiesOnEdges) {
   // Create snapshot.
@@ -2020,6 +2135,90 @@ TEST_P(DurabilityTest, WalBasic) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalGroupCommit) {
+  constexpr uint64_t kNumThreads = 8;
+  constexpr uint64_t kNumTransactions = 100;
+  // Commit concurrently, small WAL files are rotated while syncs are pending.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = memgraph::utils::SchedulerInterval{std::chrono::minutes(20)},
+                       .wal_file_size_kibibytes = 1,
+                       .wal_group_commit = true},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::utils::Synchronized<memgraph::replication::ReplicationState, memgraph::utils::RWSpinLock> repl_state{
+        memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    std::vector<std::jthread> threads;
+    for (uint64_t i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back([&db] {
+        for (uint64_t j = 0; j < kNumTransactions; ++j) {
+          auto acc = db.Access();
+          acc->CreateVertex();
+          ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+        }
+      });
+    }
+  }
+
+  ASSERT_GT(GetWalsList().size(), 1);
+
+  // Recover WALs.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::utils::Synchronized<memgraph::replication::ReplicationState, memgraph::utils::RWSpinLock> repl_state{
+      memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  auto acc = db.Access();
+  uint64_t count = 0;
+  for ([[maybe_unused]] auto const vertex : acc->Vertices(memgraph::storage::View::OLD)) ++count;
+  ASSERT_EQ(count, kNumThreads * kNumTransactions);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotAndWalCompressed) {
+  // Create a compressed snapshot and compressed WALs.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = memgraph::utils::SchedulerInterval{std::chrono::minutes(20)},
+                       .wal_file_flush_every_n_tx = kFlushWalEvery,
+                       .compression_enabled = true,
+                       .compression_level = memgraph::utils::CompressionLevel::HIGH},
+        .salient = {.items = {.properties_on_edges = GetParam(), .enable_schema_info = true}},
+    };
+    memgraph::utils::Synchronized<memgraph::replication::ReplicationState, memgraph::utils::RWSpinLock> repl_state{
+        memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+    auto *mem_storage = static_cast<memgraph::storage::InMemoryStorage *>(db.storage());
+    ASSERT_FALSE(
+        mem_storage->CreateSnapshot(memgraph::replication_coordination_glue::ReplicationRole::MAIN).HasError());
+    CreateExtendedDataset(db.storage());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover snapshot and WALs.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam(), .enable_schema_info = true}},
+  };
+  memgraph::utils::Synchronized<memgraph::replication::ReplicationState, memgraph::utils::RWSpinLock> repl_state{
+      memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam(), config.salient.items.enable_schema_info);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalBackup) {
   // Create WALs.
@@ -12,10 +12,18 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <limits>
+#include <optional>
+#include <string>
+#include <vector>
 
+#include "query/hops_limit.hpp"
+#include "storage/v2/edges_range.hpp"
 #include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/sorted_adjacency.hpp"
 #include "storage/v2/storage.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using memgraph::replication_coordination_glue::ReplicationRole;
 using testing::UnorderedElementsAre;
@@ -3273,6 +3281,231 @@ TEST_P(StorageEdgeTest, EdgeDeleteFromSameAbort) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, EdgesRange) {
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = GetParam()}}}));
+  memgraph::storage::Gid gid_from = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  memgraph::storage::Gid gid_to = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  auto et1 = store->NameToEdgeType("et1");
+  auto et2 = store->NameToEdgeType("et2");
+
+  {
+    auto acc = store->Access();
+    auto vertex_from = acc->CreateVertex();
+    auto vertex_to = acc->CreateVertex();
+    gid_from = vertex_from.Gid();
+    gid_to = vertex_to.Gid();
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_TRUE(acc->CreateEdge(&vertex_from, &vertex_to, et1).HasValue());
+      ASSERT_TRUE(acc->CreateEdge(&vertex_from, &vertex_from, et2).HasValue());
+    }
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  auto acc = store->Access();
+  auto vertex_from = acc->FindVertex(gid_from, memgraph::storage::View::OLD);
+  auto vertex_to = acc->FindVertex(gid_to, memgraph::storage::View::OLD);
+  ASSERT_TRUE(vertex_from);
+  ASSERT_TRUE(vertex_to);
+  // The changes of the transaction are applied to the range as well.
+  ASSERT_TRUE(acc->CreateEdge(&*vertex_from, &*vertex_to, et2).HasValue());
+
+  auto const check = [](auto const &range_result, auto const &vector_result) {
+    ASSERT_TRUE(range_result.HasValue());
+    ASSERT_TRUE(vector_result.HasValue());
+    auto const &range = range_result->edges;
+    auto const &edges = vector_result->edges;
+    ASSERT_EQ(range.size(), edges.size());
+    ASSERT_EQ(range_result->expanded_count, vector_result->expanded_count);
+    ASSERT_TRUE(std::ranges::equal(range, edges));
+  };
+
+  for (auto view : {memgraph::storage::View::OLD, memgraph::storage::View::NEW}) {
+    check(vertex_from->OutEdgesRange(view), vertex_from->OutEdges(view));
+    check(vertex_from->InEdgesRange(view), vertex_from->InEdges(view));
+    check(vertex_to->InEdgesRange(view), vertex_to->InEdges(view));
+    check(vertex_from->OutEdgesRange(view, {et2}), vertex_from->OutEdges(view, {et2}));
+    check(vertex_from->OutEdgesRange(view, {}, &*vertex_to), vertex_from->OutEdges(view, {}, &*vertex_to));
+  }
+  auto out_edges = vertex_from->OutEdgesRange(memgraph::storage::View::NEW);
+  ASSERT_TRUE(out_edges.HasValue());
+  EXPECT_EQ(out_edges->edges.size(), 7);
+  for (auto const &edge : out_edges->edges) {
+    EXPECT_EQ(edge.FromVertex(), *vertex_from);
+  }
+  auto in_edges = vertex_to->InEdgesRange(memgraph::storage::View::OLD);
+  ASSERT_TRUE(in_edges.HasValue());
+  EXPECT_EQ(in_edges->edges.size(), 3);
+  for (auto const &edge : in_edges->edges) {
+    EXPECT_EQ(edge.ToVertex(), *vertex_to);
+    EXPECT_EQ(edge.EdgeType(), et1);
+  }
+}
+
+TEST_P(StorageEdgeTest, SortedAdjacency) {
+  auto const old_threshold = FLAGS_storage_sorted_adjacency_threshold;
+  FLAGS_storage_sorted_adjacency_threshold = 4;
+  auto const restore_threshold =
+      memgraph::utils::OnScopeExit{[&] { FLAGS_storage_sorted_adjacency_threshold = old_threshold; }};
+
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = GetParam()}}}));
+  auto et1 = store->NameToEdgeType("et1");
+  auto et2 = store->NameToEdgeType("et2");
+  auto et3 = store->NameToEdgeType("et3");
+  memgraph::storage::Gid hub_gid = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  std::vector<memgraph::storage::Gid> other_gids;
+
+  auto const is_sorted = [](auto const &edges) {
+    return std::ranges::is_sorted(edges, {}, memgraph::storage::AdjacencyKey);
+  };
+
+  {
+    auto acc = store->Access();
+    auto hub = acc->CreateVertex();
+    hub_gid = hub.Gid();
+    for (int i = 0; i < 5; ++i) {
+      auto other = acc->CreateVertex();
+      other_gids.push_back(other.Gid());
+      ASSERT_TRUE(acc->CreateEdge(&hub, &other, et2).HasValue());
+      ASSERT_TRUE(acc->CreateEdge(&hub, &other, et1).HasValue());
+      ASSERT_TRUE(acc->CreateEdge(&other, &hub, et3).HasValue());
+    }
+    ASSERT_TRUE(acc->CreateEdge(&hub, &hub, et3).HasValue());
+    EXPECT_TRUE(hub.vertex_->out_edges_sorted);
+    EXPECT_TRUE(hub.vertex_->in_edges_sorted);
+    EXPECT_TRUE(is_sorted(hub.vertex_->out_edges));
+    EXPECT_TRUE(is_sorted(hub.vertex_->in_edges));
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(hub_gid, memgraph::storage::View::OLD);
+    auto other = acc->FindVertex(other_gids[2], memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    ASSERT_TRUE(other);
+    // Vertices with less edges than the threshold aren't sorted.
+    EXPECT_FALSE(other->vertex_->out_edges_sorted);
+
+    // Only the edges of the expanded types are visited, but all edges count as expanded, like in an unsorted list.
+    auto out_et1 = hub->OutEdges(memgraph::storage::View::OLD, {et1});
+    ASSERT_TRUE(out_et1.HasValue());
+    EXPECT_EQ(out_et1->edges.size(), 5);
+    EXPECT_EQ(out_et1->expanded_count, 11);
+    for (auto const &edge : out_et1->edges) EXPECT_EQ(edge.EdgeType(), et1);
+    auto out_et1_et3 = hub->OutEdges(memgraph::storage::View::OLD, {et3, et1, et3});
+    ASSERT_TRUE(out_et1_et3.HasValue());
+    EXPECT_EQ(out_et1_et3->edges.size(), 6);
+    EXPECT_EQ(out_et1_et3->expanded_count, 11);
+
+    auto to_other = hub->OutEdges(memgraph::storage::View::OLD, {}, &*other);
+    ASSERT_TRUE(to_other.HasValue());
+    EXPECT_EQ(to_other->edges.size(), 2);
+    EXPECT_EQ(to_other->expanded_count, 11);
+    for (auto const &edge : to_other->edges) EXPECT_EQ(edge.ToVertex(), *other);
+    auto to_other_et2 = hub->OutEdges(memgraph::storage::View::OLD, {et2}, &*other);
+    ASSERT_TRUE(to_other_et2.HasValue());
+    ASSERT_EQ(to_other_et2->edges.size(), 1);
+    EXPECT_EQ(to_other_et2->edges[0].EdgeType(), et2);
+    auto from_other = hub->InEdges(memgraph::storage::View::OLD, {et3}, &*other);
+    ASSERT_TRUE(from_other.HasValue());
+    ASSERT_EQ(from_other->edges.size(), 1);
+    EXPECT_EQ(from_other->edges[0].FromVertex(), *other);
+    auto none = hub->OutEdges(memgraph::storage::View::OLD, {et3}, &*other);
+    ASSERT_TRUE(none.HasValue());
+    EXPECT_TRUE(none->edges.empty());
+
+    // Delete one edge and create another one in an aborted transaction.
+    auto edge = to_other_et2->edges[0];
+    ASSERT_TRUE(acc->DeleteEdge(&edge).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&*hub, &*other, et3).HasValue());
+    EXPECT_TRUE(is_sorted(hub->vertex_->out_edges));
+    EXPECT_EQ(hub->vertex_->out_edges.size(), 11);
+    auto changed = hub->OutEdges(memgraph::storage::View::NEW, {et3}, &*other);
+    ASSERT_TRUE(changed.HasValue());
+    EXPECT_EQ(changed->edges.size(), 1);
+    acc->Abort();
+  }
+
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(hub_gid, memgraph::storage::View::OLD);
+    auto other = acc->FindVertex(other_gids[2], memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    ASSERT_TRUE(other);
+    EXPECT_TRUE(is_sorted(hub->vertex_->out_edges));
+    EXPECT_EQ(hub->vertex_->out_edges.size(), 11);
+    auto to_other = hub->OutEdges(memgraph::storage::View::OLD, {et1, et2, et3}, &*other);
+    ASSERT_TRUE(to_other.HasValue());
+    EXPECT_EQ(to_other->edges.size(), 2);
+
+    // Detaching the other vertex keeps the hub's edges sorted.
+    ASSERT_TRUE(acc->DetachDeleteVertex(&*other).HasValue());
+    EXPECT_TRUE(is_sorted(hub->vertex_->out_edges));
+    EXPECT_TRUE(is_sorted(hub->vertex_->in_edges));
+    EXPECT_EQ(hub->vertex_->out_edges.size(), 9);
+    EXPECT_EQ(hub->vertex_->in_edges.size(), 5);
+    auto out_et2 = hub->OutEdges(memgraph::storage::View::NEW, {et2});
+    ASSERT_TRUE(out_et2.HasValue());
+    EXPECT_EQ(out_et2->edges.size(), 4);
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, SortedAdjacencyHopsLimit) {
+  auto const old_threshold = FLAGS_storage_sorted_adjacency_threshold;
+  auto const restore_threshold =
+      memgraph::utils::OnScopeExit{[&] { FLAGS_storage_sorted_adjacency_threshold = old_threshold; }};
+
+  struct Expansion {
+    size_t edges;
+    int64_t expanded_count;
+    int64_t hops_counter;
+    bool limit_reached;
+  };
+  // Expands the same hub with a sorted and with an unsorted adjacency list.
+  auto const expand = [&](uint64_t threshold, std::optional<int64_t> limit, std::vector<std::string> const &types) {
+    FLAGS_storage_sorted_adjacency_threshold = threshold;
+    std::unique_ptr<memgraph::storage::Storage> store(
+        new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = GetParam()}}}));
+    auto acc = store->Access();
+    auto hub = acc->CreateVertex();
+    for (int i = 0; i < 5; ++i) {
+      auto other = acc->CreateVertex();
+      EXPECT_TRUE(acc->CreateEdge(&hub, &other, store->NameToEdgeType("et2")).HasValue());
+      EXPECT_TRUE(acc->CreateEdge(&hub, &other, store->NameToEdgeType("et1")).HasValue());
+    }
+    EXPECT_TRUE(acc->CreateEdge(&hub, &hub, store->NameToEdgeType("et3")).HasValue());
+    EXPECT_EQ(hub.vertex_->out_edges_sorted, threshold != 0);
+
+    std::vector<memgraph::storage::EdgeTypeId> edge_types;
+    for (auto const &type : types) edge_types.push_back(store->NameToEdgeType(type));
+    memgraph::query::HopsLimit hops_limit{.limit = limit};
+    auto result = hub.OutEdges(memgraph::storage::View::NEW, edge_types, nullptr, &hops_limit);
+    EXPECT_TRUE(result.HasValue());
+    return Expansion{.edges = result->edges.size(),
+                     .expanded_count = result->expanded_count,
+                     .hops_counter = hops_limit.GetHopsCounter(),
+                     .limit_reached = hops_limit.IsLimitReached()};
+  };
+
+  for (auto const limit : {std::optional<int64_t>{}, std::optional<int64_t>{7}, std::optional<int64_t>{20}}) {
+    for (auto const &types : {std::vector<std::string>{"et1"}, std::vector<std::string>{"et3", "et2"}}) {
+      auto const sorted = expand(4, limit, types);
+      auto const unsorted = expand(0, limit, types);
+      EXPECT_EQ(sorted.expanded_count, unsorted.expanded_count);
+      EXPECT_EQ(sorted.hops_counter, unsorted.hops_counter);
+      EXPECT_EQ(sorted.limit_reached, unsorted.limit_reached);
+      // The lists are in a different order, so a reached limit can cut off different edges.
+      if (!unsorted.limit_reached) EXPECT_EQ(sorted.edges, unsorted.edges);
+      EXPECT_EQ(sorted.expanded_count, limit == 7 ? 7 : 11);
+    }
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(StorageEdgeTest, VertexDetachDeleteSingleCommit) {
   std::unique_ptr<memgraph::storage::Storage> store(
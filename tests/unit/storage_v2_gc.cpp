@@ -204,3 +204,79 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// Verifies that a multithreaded GC leaves no index entries of deleted vertices,
+// both when few vertices are deleted (entries are looked up by their values)
+// and when most of them are (the indices are scanned).
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, IndicesOfDeletedVertices) {
+  using memgraph::storage::PropertyPath;
+  using memgraph::storage::PropertyValue;
+  using memgraph::storage::View;
+
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::NONE, .thread_count = 4}}));
+  auto const label = storage->NameToLabel("label");
+  auto const prop = storage->NameToProperty("prop");
+  auto const properties = std::array{PropertyPath{prop}};
+
+  {
+    auto unique_acc = storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(label).HasError());
+    ASSERT_FALSE(unique_acc->PrepareForCommitPhase().HasError());
+  }
+  {
+    auto unique_acc = storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(label, {PropertyPath{prop}}).HasError());
+    ASSERT_FALSE(unique_acc->PrepareForCommitPhase().HasError());
+  }
+
+  std::vector<memgraph::storage::Gid> gids;
+  {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < 1000; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(*vertex.AddLabel(label));
+      ASSERT_FALSE(vertex.SetProperty(prop, PropertyValue(i)).HasError());
+      gids.push_back(vertex.Gid());
+    }
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+  storage->FreeMemory({}, false);
+
+  auto delete_vertices = [&](auto const pred) {
+    auto acc = storage->Access();
+    for (uint64_t i = 0; i < gids.size(); ++i) {
+      if (!pred(i)) continue;
+      auto vertex = acc->FindVertex(gids[i], View::OLD);
+      ASSERT_TRUE(vertex.has_value());
+      ASSERT_FALSE(acc->DeleteVertex(&*vertex).HasError());
+    }
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+    // The first run unlinks the deltas and cleans up the indices, the second one frees the vertices
+    storage->FreeMemory({}, false);
+    storage->FreeMemory({}, false);
+  };
+
+  // Few deleted vertices
+  delete_vertices([](uint64_t i) { return i % 100 == 0; });
+  {
+    auto acc = storage->Access();
+    EXPECT_EQ(acc->ApproximateVertexCount(label), 990);
+    EXPECT_EQ(acc->ApproximateVertexCount(label, properties), 990);
+  }
+
+  // Most of the remaining vertices deleted
+  delete_vertices([](uint64_t i) { return i % 100 != 0 && i % 10 != 0; });
+  {
+    auto acc = storage->Access();
+    EXPECT_EQ(acc->ApproximateVertexCount(label), 90);
+    EXPECT_EQ(acc->ApproximateVertexCount(label, properties), 90);
+    std::set<memgraph::storage::Gid> found;
+    for (auto vertex : acc->Vertices(label, properties, View::OLD)) {
+      found.insert(vertex.Gid());
+    }
+    EXPECT_EQ(found.size(), 90);
+  }
+}
@@ -0,0 +1,187 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <optional>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/graph_projection.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/vertex_info_cache.hpp"
+#include "utils/on_scope_exit.hpp"
+
+using namespace memgraph::storage;
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+class GraphProjectionTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    storage = std::make_unique<InMemoryStorage>(Config{.graph_projection_thread_count = 4});
+    label = storage->NameToLabel("City");
+    road = storage->NameToEdgeType("ROAD");
+    rail = storage->NameToEdgeType("RAIL");
+    length = storage->NameToProperty("length");
+
+    // c0 -ROAD-> c1 -ROAD-> c2, c0 -RAIL-> c2, c2 -ROAD-> other
+    auto acc = storage->Access();
+    std::vector<VertexAccessor> cities;
+    for (int i = 0; i < 3; ++i) {
+      cities.push_back(acc->CreateVertex());
+      ASSERT_FALSE(cities.back().AddLabel(label).HasError());
+      gids.push_back(cities.back().Gid());
+    }
+    auto other = acc->CreateVertex();
+    gids.push_back(other.Gid());
+    auto c0_c1 = acc->CreateEdge(&cities[0], &cities[1], road);
+    ASSERT_TRUE(c0_c1.HasValue());
+    ASSERT_FALSE(c0_c1->SetProperty(length, PropertyValue(5)).HasError());
+    auto c1_c2 = acc->CreateEdge(&cities[1], &cities[2], road);
+    ASSERT_TRUE(c1_c2.HasValue());
+    ASSERT_FALSE(c1_c2->SetProperty(length, PropertyValue(2.5)).HasError());
+    ASSERT_TRUE(acc->CreateEdge(&cities[0], &cities[2], rail).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&cities[2], &other, road).HasValue());
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  std::unique_ptr<Storage> storage;
+  LabelId label;
+  EdgeTypeId road;
+  EdgeTypeId rail;
+  PropertyId length;
+  std::vector<Gid> gids;
+};
+
+TEST_F(GraphProjectionTest, Build) {
+  auto acc = storage->Access();
+  auto projection = acc->GetGraphProjection({}, View::OLD);
+  ASSERT_TRUE(projection);
+  EXPECT_EQ(projection->gids, gids);
+  EXPECT_THAT(projection->offsets, ElementsAre(0, 2, 3, 4, 4));
+  ASSERT_EQ(projection->targets.size(), 4);
+  EXPECT_THAT(std::vector(projection->targets.begin(), projection->targets.begin() + 2),
+              testing::UnorderedElementsAre(1, 2));
+  EXPECT_EQ(projection->targets[2], 2);
+  EXPECT_EQ(projection->targets[3], 3);
+  EXPECT_THAT(projection->weights, IsEmpty());
+}
+
+TEST_F(GraphProjectionTest, Filter) {
+  auto acc = storage->Access();
+  auto projection = acc->GetGraphProjection(
+      {.labels = {label}, .edge_types = {road}, .weight_property = length, .default_weight = 10.0}, View::OLD);
+  ASSERT_TRUE(projection);
+  // The vertex without the label and the edges to it are left out.
+  EXPECT_THAT(projection->gids, ElementsAre(gids[0], gids[1], gids[2]));
+  EXPECT_THAT(projection->offsets, ElementsAre(0, 1, 2, 2));
+  EXPECT_THAT(projection->targets, ElementsAre(1, 2));
+  EXPECT_THAT(projection->weights, ElementsAre(5.0, 2.5));
+
+  auto rail_projection = acc->GetGraphProjection(
+      {.labels = {label}, .edge_types = {rail}, .weight_property = length, .default_weight = 10.0}, View::OLD);
+  ASSERT_TRUE(rail_projection);
+  EXPECT_THAT(rail_projection->targets, ElementsAre(2));
+  EXPECT_THAT(rail_projection->weights, ElementsAre(10.0));
+}
+
+TEST_F(GraphProjectionTest, OwnChanges) {
+  auto acc = storage->Access();
+  auto projection = acc->GetGraphProjection({}, View::NEW);
+  ASSERT_FALSE(acc->CreateVertex().AddLabel(label).HasError());
+  auto changed = acc->GetGraphProjection({}, View::NEW);
+  ASSERT_TRUE(changed);
+  EXPECT_NE(changed, projection);
+  EXPECT_EQ(changed->gids.size(), 5);
+  // The projection with the uncommitted vertex isn't given to other transactions.
+  EXPECT_EQ(storage->Access()->GetGraphProjection({}, View::OLD), projection);
+}
+
+TEST_F(GraphProjectionTest, Invalidation) {
+  auto old_reader = storage->Access();
+  auto projection = storage->Access()->GetGraphProjection({}, View::OLD);
+  ASSERT_TRUE(projection);
+  // The projection is reused by the following readers.
+  EXPECT_EQ(storage->Access()->GetGraphProjection({}, View::OLD), projection);
+  EXPECT_EQ(old_reader->GetGraphProjection({}, View::OLD), projection);
+
+  {
+    auto acc = storage->Access();
+    acc->CreateVertex();
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  // Transactions which started before or after the commit don't see the same
+  // graph as the projection.
+  auto old_projection = old_reader->GetGraphProjection({}, View::OLD);
+  ASSERT_TRUE(old_projection);
+  EXPECT_NE(old_projection, projection);
+  EXPECT_EQ(old_projection->gids.size(), 4);
+  auto rebuilt = storage->Access()->GetGraphProjection({}, View::OLD);
+  ASSERT_TRUE(rebuilt);
+  EXPECT_NE(rebuilt, projection);
+  EXPECT_EQ(rebuilt->gids.size(), 5);
+  EXPECT_EQ(storage->Access()->GetGraphProjection({}, View::OLD), rebuilt);
+}
+
+TEST_F(GraphProjectionTest, LongDeltaChains) {
+  constexpr int kChainLength = 2000;
+  {
+    // c0 -ROAD-> c1 -ROAD-> c2 as above, then chain_0 -ROAD-> chain_1 -ROAD-> ...
+    auto acc = storage->Access();
+    std::optional<VertexAccessor> previous;
+    for (int i = 0; i < kChainLength; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_FALSE(vertex.AddLabel(label).HasError());
+      if (previous) ASSERT_TRUE(acc->CreateEdge(&*previous, &vertex, road).HasValue());
+      previous = vertex;
+    }
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  // Every vertex is changed after the reader started, so the projection threads
+  // read all of them through long delta chains, which get cached.
+  const auto default_cache_threshold = FLAGS_delta_chain_cache_threshold;
+  FLAGS_delta_chain_cache_threshold = 2;
+  const memgraph::utils::OnScopeExit restore_threshold{
+      [default_cache_threshold] { FLAGS_delta_chain_cache_threshold = default_cache_threshold; }};
+  auto reader = storage->Access();
+  {
+    auto acc = storage->Access();
+    std::vector<VertexAccessor> vertices;
+    for (auto vertex : acc->Vertices(View::OLD)) vertices.push_back(vertex);
+    for (auto &vertex : vertices) {
+      for (int i = 0; i < 4; ++i) {
+        ASSERT_FALSE(vertex.RemoveLabel(label).HasError());
+        ASSERT_FALSE(vertex.AddLabel(label).HasError());
+      }
+      ASSERT_FALSE(vertex.RemoveLabel(label).HasError());
+      auto added = acc->CreateVertex();
+      ASSERT_FALSE(added.AddLabel(label).HasError());
+      ASSERT_TRUE(acc->CreateEdge(&vertex, &added, road).HasValue());
+    }
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  auto projection = reader->GetGraphProjection({.labels = {label}, .edge_types = {road}}, View::OLD);
+  ASSERT_TRUE(projection);
+  ASSERT_EQ(projection->gids.size(), 3 + kChainLength);
+  EXPECT_TRUE(std::ranges::equal(std::vector(projection->gids.begin(), projection->gids.begin() + 3),
+                                 std::vector(gids.begin(), gids.begin() + 3)));
+  ASSERT_EQ(projection->offsets.size(), projection->gids.size() + 1);
+  EXPECT_EQ(projection->offsets.back(), 2 + kChainLength - 1);
+  EXPECT_THAT(std::vector(projection->targets.begin(), projection->targets.begin() + 2), ElementsAre(1, 2));
+  for (uint64_t i = 3; i + 1 < projection->gids.size(); ++i) {
+    ASSERT_EQ(projection->offsets[i + 1] - projection->offsets[i], 1);
+    ASSERT_EQ(projection->targets[projection->offsets[i]], i + 1);
+  }
+}
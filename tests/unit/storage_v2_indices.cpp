@@ -32,6 +32,7 @@ using namespace memgraph::storage;
 using testing::IsEmpty;
 using testing::Types;
 using testing::UnorderedElementsAre;
+using testing::UnorderedElementsAreArray;
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define ASSERT_NO_ERROR(result) ASSERT_FALSE((result).HasError())
@@ -538,6 +539,110 @@ TYPED_TEST(IndexTest, LabelIndexCountEstimate) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelIndexChunkedVertices) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto acc = this->CreateIndexAccessor();
+      EXPECT_FALSE(acc->CreateIndex(this->label1).HasError());
+      ASSERT_NO_ERROR(acc->PrepareForCommitPhase());
+    }
+
+    std::vector<int64_t> expected_all;
+    std::vector<int64_t> expected_label1;
+    {
+      auto acc = this->storage->Access();
+      for (int64_t i = 0; i < 1000; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        expected_all.push_back(i);
+        if (i % 3 == 0) {
+          ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+          expected_label1.push_back(i);
+        }
+      }
+      ASSERT_NO_ERROR(acc->PrepareForCommitPhase());
+    }
+
+    auto collect = [this](memgraph::storage::VerticesChunkedIterable &chunked) {
+      std::vector<int64_t> ret;
+      for (size_t i = 0; i < chunked.size(); ++i) {
+        auto chunk = chunked.get_chunk(i);
+        for (auto it = chunk.begin(); it != chunk.end(); ++it) {
+          ret.push_back((*it).GetProperty(this->prop_id, View::OLD)->ValueInt());
+        }
+      }
+      return ret;
+    };
+
+    auto acc = this->storage->Access();
+    // Every vertex has to appear in exactly one chunk.
+    auto all = acc->ChunkedVertices(View::OLD, 8);
+    EXPECT_GT(all.size(), 1);
+    EXPECT_THAT(collect(all), UnorderedElementsAreArray(expected_all));
+
+    auto by_label = acc->ChunkedVertices(this->label1, View::OLD, 8);
+    EXPECT_GT(by_label.size(), 1);
+    EXPECT_THAT(collect(by_label), UnorderedElementsAreArray(expected_label1));
+  }
+}
+
+TYPED_TEST(IndexTest, ParallelIndexPopulation) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    this->storage.reset();
+    this->config_.index_population_thread_count = 4;
+    this->storage = std::make_unique<TypeParam>(this->config_);
+
+    std::vector<int64_t> expected_label1;
+    std::vector<int64_t> expected_prop;
+    uint64_t expected_edges = 0;
+    {
+      auto acc = this->storage->Access();
+      std::optional<VertexAccessor> prev;
+      for (int64_t i = 0; i < 10000; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        if (i % 3 == 0) {
+          ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+          expected_label1.push_back(i);
+          if (i % 2 == 0) {
+            ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i)));
+            expected_prop.push_back(i);
+          }
+        }
+        if (prev && i % 5 == 0) {
+          ASSERT_TRUE(acc->CreateEdge(&*prev, &vertex, this->edge_type_id1).HasValue());
+          ++expected_edges;
+        }
+        prev = vertex;
+      }
+      ASSERT_NO_ERROR(acc->PrepareForCommitPhase());
+    }
+
+    {
+      auto acc = this->CreateIndexAccessor();
+      EXPECT_FALSE(acc->CreateIndex(this->label1).HasError());
+      EXPECT_FALSE(acc->CreateIndex(this->label1, {PropertyPath{this->prop_val}}).HasError());
+      ASSERT_NO_ERROR(acc->PrepareForCommitPhase());
+    }
+    {
+      auto acc = this->CreateIndexAccessor();
+      EXPECT_FALSE(acc->CreateIndex(this->edge_type_id1).HasError());
+      ASSERT_NO_ERROR(acc->PrepareForCommitPhase());
+    }
+
+    // Every vertex and edge is indexed exactly once.
+    auto acc = this->storage->Access();
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, View::OLD), View::OLD),
+                UnorderedElementsAreArray(expected_label1));
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, std::array{PropertyPath{this->prop_val}},
+                                           std::array{pvr::IsNotNull()}, View::OLD),
+                             View::OLD),
+                UnorderedElementsAreArray(expected_prop));
+    uint64_t edges = 0;
+    for ([[maybe_unused]] auto const edge : acc->Edges(this->edge_type_id1, View::OLD)) ++edges;
+    EXPECT_EQ(edges, expected_edges);
+  }
+}
+
 TYPED_TEST(IndexTest, LabelIndexDeletedVertex) {
   if constexpr ((std::is_same_v<TypeParam, memgraph::storage::DiskStorage>)) {
     {
@@ -0,0 +1,104 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_columns.hpp"
+
+using namespace memgraph::storage;
+using testing::ElementsAre;
+using testing::UnorderedElementsAre;
+
+class PropertyColumnsTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    storage = std::make_unique<InMemoryStorage>(Config{.columnar_properties = {{"Item", "price"}}});
+    label = storage->NameToLabel("Item");
+    price = storage->NameToProperty("price");
+    other = storage->NameToProperty("other");
+    {
+      auto acc = storage->Access();
+      for (int i = 0; i < 5; ++i) {
+        auto vertex = acc->CreateVertex();
+        ASSERT_FALSE(vertex.AddLabel(label).HasError());
+        ASSERT_FALSE(vertex.SetProperty(price, PropertyValue(i)).HasError());
+      }
+      ASSERT_FALSE(acc->CreateVertex().SetProperty(price, PropertyValue(100)).HasError());
+      ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+    }
+    {
+      auto acc = storage->ReadOnlyAccess();
+      ASSERT_FALSE(acc->CreateIndex(label).HasError());
+      ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+    }
+  }
+
+  std::unique_ptr<Storage> storage;
+  LabelId label;
+  PropertyId price;
+  PropertyId other;
+};
+
+TEST_F(PropertyColumnsTest, Build) {
+  auto acc = storage->Access();
+  auto column = acc->GetPropertyColumn(label, price);
+  ASSERT_TRUE(column);
+  EXPECT_EQ(column->vertex_count, 5);
+  EXPECT_EQ(column->other_count, 0);
+  EXPECT_THAT(column->ints, UnorderedElementsAre(0, 1, 2, 3, 4));
+  EXPECT_TRUE(column->doubles.empty());
+  // The column is reused by the following readers.
+  EXPECT_EQ(acc->GetPropertyColumn(label, price), column);
+  EXPECT_EQ(storage->Access()->GetPropertyColumn(label, price), column);
+  // Only the configured columns are built.
+  EXPECT_FALSE(acc->GetPropertyColumn(label, other));
+}
+
+TEST_F(PropertyColumnsTest, OwnChanges) {
+  auto acc = storage->Access();
+  ASSERT_FALSE(acc->CreateVertex().AddLabel(label).HasError());
+  EXPECT_FALSE(acc->GetPropertyColumn(label, price));
+}
+
+TEST_F(PropertyColumnsTest, Invalidation) {
+  auto old_reader = storage->Access();
+  auto column = storage->Access()->GetPropertyColumn(label, price);
+  ASSERT_TRUE(column);
+
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_FALSE(vertex.AddLabel(label).HasError());
+    ASSERT_FALSE(vertex.SetProperty(price, PropertyValue(2.5)).HasError());
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+
+  // Transactions which started before or after the commit don't see the same
+  // values as the column.
+  EXPECT_FALSE(old_reader->GetPropertyColumn(label, price));
+  auto acc = storage->Access();
+  auto rebuilt = acc->GetPropertyColumn(label, price);
+  ASSERT_TRUE(rebuilt);
+  EXPECT_NE(rebuilt, column);
+  EXPECT_EQ(rebuilt->vertex_count, 6);
+  EXPECT_THAT(rebuilt->doubles, ElementsAre(2.5));
+
+  // Changing an unrelated property doesn't invalidate the column.
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_FALSE(vertex.SetProperty(other, PropertyValue(1)).HasError());
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+  EXPECT_EQ(storage->Access()->GetPropertyColumn(label, price), rebuilt);
+}
@@ -25,6 +25,7 @@
 #include "auth/auth.hpp"
 #include "dbms/database.hpp"
 #include "dbms/dbms_handler.hpp"
+#include "flags/replication.hpp"
 #include "query/interpreter_context.hpp"
 #include "replication/config.hpp"
 #include "replication/state.hpp"
@@ -36,6 +37,7 @@
 #include "storage/v2/storage.hpp"
 #include "storage/v2/view.hpp"
 #include "tests/unit/storage_test_utils.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using testing::UnorderedElementsAre;
 
@@ -623,6 +625,62 @@ TEST_F(ReplicationTest, MultipleSynchronousReplicationTest) {
   }
 }
 
+TEST_F(ReplicationTest, MultipleSynchronousReplicationWithUnreachableReplicaTest) {
+  MinMemgraph main(main_conf);
+  std::optional<MinMemgraph> replica1(repl_conf);
+  MinMemgraph replica2(repl2_conf);
+
+  replica1->repl_handler.TrySetReplicationRoleReplica(ReplicationServerConfig{
+      .repl_server = Endpoint(local_host, ports[0]),
+  });
+  replica2.repl_handler.TrySetReplicationRoleReplica(ReplicationServerConfig{
+      .repl_server = Endpoint(local_host, ports[1]),
+  });
+
+  // The replicas are finalized concurrently, REPLICA1 on its own thread and
+  // REPLICA2 on the committing one
+  ASSERT_FALSE(main.repl_handler
+                   .TryRegisterReplica(ReplicationClientConfig{
+                       .name = replicas[0],
+                       .mode = ReplicationMode::SYNC,
+                       .repl_server_endpoint = Endpoint(local_host, ports[0]),
+                   })
+                   .HasError());
+  ASSERT_FALSE(main.repl_handler
+                   .TryRegisterReplica(ReplicationClientConfig{
+                       .name = replicas[1],
+                       .mode = ReplicationMode::SYNC,
+                       .repl_server_endpoint = Endpoint(local_host, ports[1]),
+                   })
+                   .HasError());
+
+  replica1.reset();
+
+  std::optional<Gid> vertex_gid;
+  {
+    auto acc = main.db.Access();
+    auto v = acc->CreateVertex();
+    vertex_gid.emplace(v.Gid());
+    auto const result = acc->PrepareForCommitPhase({}, main.db_acc);
+    // The commit fails on the unreachable replica only
+    ASSERT_TRUE(result.HasError());
+    ASSERT_TRUE(std::holds_alternative<memgraph::storage::SyncReplicationError>(result.GetError()));
+  }
+
+  // MAIN and the healthy REPLICA2 contain the new vertex
+  {
+    auto acc = main.db.Access();
+    ASSERT_TRUE(acc->FindVertex(*vertex_gid, View::OLD));
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+  {
+    auto acc = replica2.db.Access();
+    ASSERT_TRUE(acc->FindVertex(*vertex_gid, View::OLD));
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+  ASSERT_NE(main.db.storage()->GetReplicaState(replicas[0]), ReplicaState::READY);
+}
+
 TEST_F(ReplicationTest, RecoveryProcess) {
   std::vector<Gid> vertex_gids;
   // Force the creation of snapshot
@@ -760,8 +818,6 @@ TEST_F(ReplicationTest, RecoveryProcess) {
   }
 }
 
-// ASYNC replication currently doesn't work because tasks get pushed to thread pool with reference to replica
-// streams which get destroyed in between
 TEST_F(ReplicationTest, BasicAsynchronousReplicationTest) {
   MinMemgraph main(main_conf);
   MinMemgraph replica_async(repl_conf);
@@ -771,6 +827,53 @@ TEST_F(ReplicationTest, BasicAsynchronousReplicationTest) {
       .repl_server = Endpoint(local_host, ports[1]),
   });
 
+  ASSERT_FALSE(main.repl_handler
+                   .TryRegisterReplica(ReplicationClientConfig{
+                       .name = "REPLICA_ASYNC",
+                       .mode = ReplicationMode::ASYNC,
+                       .repl_server_endpoint = Endpoint(local_host, ports[1]),
+                   })
+                   .HasError());
+
+  // The transactions committed while the replica is busy are queued instead of skipped
+  static constexpr size_t vertices_create_num = 10;
+  std::vector<Gid> created_vertices;
+  for (size_t i = 0; i < vertices_create_num; ++i) {
+    auto acc = main.db.Access();
+    auto v = acc->CreateVertex();
+    created_vertices.push_back(v.Gid());
+    ASSERT_FALSE(acc->PrepareForCommitPhase({}, main.db_acc).HasError());
+
+    auto const state = main.db.storage()->GetReplicaState("REPLICA_ASYNC");
+    ASSERT_TRUE(state == ReplicaState::REPLICATING || state == ReplicaState::READY);
+  }
+
+  while (main.db.storage()->GetReplicaState("REPLICA_ASYNC") != ReplicaState::READY) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  ASSERT_TRUE(std::ranges::all_of(created_vertices, [&](const auto vertex_gid) {
+    auto acc = replica_async.db.Access();
+    auto v = acc->FindVertex(vertex_gid, View::OLD);
+    const bool exists = v.has_value();
+    EXPECT_FALSE(acc->PrepareForCommitPhase().HasError());
+    return exists;
+  }));
+}
+
+TEST_F(ReplicationTest, AsynchronousReplicationWithoutQueueTest) {
+  auto const queue_size = FLAGS_replication_async_queue_size;
+  FLAGS_replication_async_queue_size = 0;
+  memgraph::utils::OnScopeExit const restore_queue_size{[&] { FLAGS_replication_async_queue_size = queue_size; }};
+
+  MinMemgraph main(main_conf);
+  MinMemgraph replica_async(repl_conf);
+
+  auto replica_store_handler = replica_async.repl_handler;
+  replica_store_handler.TrySetReplicationRoleReplica(ReplicationServerConfig{
+      .repl_server = Endpoint(local_host, ports[1]),
+  });
+
   ASSERT_FALSE(main.repl_handler
                    .TryRegisterReplica(ReplicationClientConfig{
                        .name = "REPLICA_ASYNC",
@@ -199,6 +199,46 @@ TYPED_TEST(TTLFixture, Periodic) {
   }
 }
 
+TYPED_TEST(TTLFixture, Batches) {
+  auto ttl_lbl = this->db_->storage()->NameToLabel("TTL");
+  auto ttl_prop = this->db_->storage()->NameToProperty("ttl");
+  auto now = std::chrono::system_clock::now();
+  auto older = now - std::chrono::seconds(10);
+  auto older_ts = std::chrono::duration_cast<std::chrono::microseconds>(older.time_since_epoch()).count();
+  auto newer = now + std::chrono::hours(1);
+  auto newer_ts = std::chrono::duration_cast<std::chrono::microseconds>(newer.time_since_epoch()).count();
+  {
+    // Same index as ENABLE TTL creates
+    auto acc = this->db_->UniqueAccess();
+    ASSERT_FALSE(acc->CreateIndex(ttl_lbl, {memgraph::storage::PropertyPath{ttl_prop}}).HasError());
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+  // More expired vertices than fit into a single batch, with repeating ttls
+  constexpr int kExpired = 25000;
+  constexpr int kAlive = 10;
+  {
+    auto acc = this->db_->Access();
+    for (int i = 0; i < kExpired + kAlive; ++i) {
+      auto v = acc->CreateVertex();
+      ASSERT_FALSE(v.AddLabel(ttl_lbl).HasError());
+      auto const ttl = i < kExpired ? older_ts - (i % 1000) : newer_ts;
+      ASSERT_FALSE(v.SetProperty(ttl_prop, memgraph::storage::PropertyValue(ttl)).HasError());
+    }
+    ASSERT_FALSE(acc->PrepareForCommitPhase().HasError());
+  }
+  this->ttl_->Enable();
+  this->ttl_->Configure(memgraph::query::ttl::TtlInfo{std::chrono::milliseconds(700), {}});
+  EXPECT_NO_THROW(this->ttl_->Setup(this->db_, &this->interpreter_context_, this->RunEdgeTTL()));
+  std::this_thread::sleep_for(std::chrono::seconds(3));
+  {
+    auto acc = this->db_->Access();
+    size_t size = 0;
+    for (const auto v : acc->Vertices(memgraph::storage::View::NEW))
+      if (v.IsVisible(memgraph::storage::View::NEW)) ++size;
+    EXPECT_EQ(size, kAlive);
+  }
+}
+
 TYPED_TEST(TTLFixture, StartTime) {
   auto lbl = this->db_->storage()->NameToLabel("L");
   auto prop = this->db_->storage()->NameToProperty("prop");
@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <array>
 #include <chrono>
 #include <fstream>
 #include <map>
@@ -275,6 +276,44 @@ TEST_F(UtilsFileTest, OutputFileDescriptorLeackage) {
   }
 }
 
+TEST_F(UtilsFileTest, InputFileMapped) {
+  auto const path = storage / "existing_dir_777" / "mapped_file";
+  {
+    memgraph::utils::OutputFile handle;
+    handle.Open(path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    for (uint32_t i = 0; i < 100000; ++i) {
+      auto const value = static_cast<uint8_t>(i);
+      handle.Write(&value, 1);
+    }
+    handle.Sync();
+    handle.Close();
+  }
+  for (auto const mapped : {false, true}) {
+    memgraph::utils::InputFile input_handle;
+    ASSERT_TRUE(input_handle.Open(path, mapped));
+    ASSERT_EQ(input_handle.GetSize(), 100000);
+    std::array<uint8_t, 3> data{};
+    ASSERT_TRUE(input_handle.SetPosition(memgraph::utils::InputFile::Position::SET, 70000));
+    ASSERT_TRUE(input_handle.Peek(data.data(), data.size()));
+    ASSERT_EQ(data[0], static_cast<uint8_t>(70000));
+    ASSERT_TRUE(input_handle.Read(data.data(), data.size()));
+    ASSERT_EQ(data[2], static_cast<uint8_t>(70002));
+    ASSERT_EQ(input_handle.GetPosition(), 70003);
+    ASSERT_EQ(input_handle.SetPosition(memgraph::utils::InputFile::Position::RELATIVE_TO_CURRENT, 10), 70013);
+    ASSERT_TRUE(input_handle.Read(data.data(), 1));
+    ASSERT_EQ(data[0], static_cast<uint8_t>(70013));
+    ASSERT_EQ(input_handle.SetPosition(memgraph::utils::InputFile::Position::RELATIVE_TO_END, -2), 99998);
+    ASSERT_EQ(input_handle.GetPosition(), 99998);
+    ASSERT_FALSE(input_handle.Read(data.data(), data.size()));
+    ASSERT_EQ(input_handle.SetPosition(memgraph::utils::InputFile::Position::RELATIVE_TO_CURRENT, -100001),
+              std::nullopt);
+    memgraph::utils::InputFile moved(std::move(input_handle));
+    ASSERT_TRUE(moved.SetPosition(memgraph::utils::InputFile::Position::SET, 99998));
+    ASSERT_TRUE(moved.Read(data.data(), 2));
+    ASSERT_EQ(data[1], static_cast<uint8_t>(99999));
+  }
+}
+
 TEST_F(UtilsFileTest, ConcurrentReadingAndWritting) {
   const auto file_path = storage / "existing_dir_777" / "existing_file_777";
   memgraph::utils::OutputFile handle;